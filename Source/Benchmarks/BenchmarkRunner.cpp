@@ -0,0 +1,82 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _M_X86
+#ifdef _WIN32
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+#include "BenchmarkRunner.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
+
+namespace Benchmark
+{
+static std::string s_filter;
+
+void PinThread()
+{
+  Common::SetCurrentThreadAffinity(1);
+}
+
+void SetFilter(const std::string& filter)
+{
+  s_filter = filter;
+}
+
+static u64 ReadCycleCounter()
+{
+#ifdef _M_X86
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+void Run(const std::string& name, u64 bytes_per_op, const std::function<void()>& body)
+{
+  if (!s_filter.empty() && name.find(s_filter) == std::string::npos)
+    return;
+
+  // One untimed call to warm caches and trigger any one-time work.
+  body();
+
+  // Grow the batch until it runs long enough that timer and loop overhead
+  // are negligible.
+  u64 iterations = 1;
+  u64 elapsed_us = 0;
+  u64 elapsed_cycles = 0;
+  for (;;)
+  {
+    const u64 start_cycles = ReadCycleCounter();
+    const u64 start_us = Common::Timer::GetTimeUs();
+    for (u64 i = 0; i < iterations; ++i)
+      body();
+    elapsed_us = Common::Timer::GetTimeUs() - start_us;
+    elapsed_cycles = ReadCycleCounter() - start_cycles;
+    if (elapsed_us >= 250000)
+      break;
+    // Aim past the threshold in one step to keep total runtime bounded.
+    const u64 scaled =
+        elapsed_us > 0 ? iterations * (300000 / elapsed_us + 1) : iterations * 16;
+    iterations = std::max(iterations * 2, scaled);
+  }
+
+  const double ns_per_op = elapsed_us * 1000.0 / iterations;
+  printf("%-48s %12llu ops %12.1f ns/op", name.c_str(),
+         static_cast<unsigned long long>(iterations), ns_per_op);
+  if (elapsed_cycles != 0)
+    printf(" %14.1f cycles/op", static_cast<double>(elapsed_cycles) / iterations);
+  if (bytes_per_op != 0)
+    printf(" %10.1f MB/s", static_cast<double>(bytes_per_op * iterations) / elapsed_us);
+  printf("\n");
+  fflush(stdout);
+}
+}
@@ -0,0 +1,32 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Benchmark
+{
+// Pins the calling thread to one core so TSC readings stay comparable.
+void PinThread();
+
+// Only benchmarks whose name contains the filter string are run.
+void SetFilter(const std::string& filter);
+
+// Calibrates an iteration count that keeps the timed batch well above timer
+// overhead, then reports ns/op, cycles/op (TSC, x86 only) and, when
+// bytes_per_op is nonzero, throughput in MB/s.
+void Run(const std::string& name, u64 bytes_per_op, const std::function<void()>& body);
+}
+
+// Benchmark suites, one per hot kernel family.
+void RunCoreTimingBenchmarks();
+void RunHashBenchmarks();
+void RunMixerBenchmarks();
+void RunQueueBenchmarks();
+void RunTextureDecoderBenchmarks();
+void RunVertexLoaderBenchmarks();
@@ -0,0 +1,46 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <string>
+
+#include "BenchmarkRunner.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "UICommon/UICommon.h"
+
+// Same environment CoreTimingTest sets up: enough core state for CoreTiming
+// and the mixer without booting a game.
+int main(int argc, char* argv[])
+{
+  if (argc > 1)
+    Benchmark::SetFilter(argv[1]);
+  Benchmark::PinThread();
+
+  const std::string profile_path = File::CreateTempDir();
+  Core::DeclareAsCPUThread();
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  PowerPC::Init(PowerPC::CORE_INTERPRETER);
+  CoreTiming::Init();
+
+  RunHashBenchmarks();
+  RunQueueBenchmarks();
+  RunCoreTimingBenchmarks();
+  RunMixerBenchmarks();
+  RunTextureDecoderBenchmarks();
+  RunVertexLoaderBenchmarks();
+
+  CoreTiming::Shutdown();
+  PowerPC::Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+  File::DeleteDirRecursively(profile_path);
+  return 0;
+}
@@ -0,0 +1,30 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "BenchmarkRunner.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+
+static void EmptyCallback(u64 userdata, s64 lateness)
+{
+}
+
+void RunCoreTimingBenchmarks()
+{
+  CoreTiming::EventType* event_type = CoreTiming::RegisterEvent("benchmark", EmptyCallback);
+
+  // Schedule plus the Advance that dispatches the event: the full cost a
+  // device pays per timed callback.
+  Benchmark::Run("CoreTiming/ScheduleEvent+Advance", 0, [&] {
+    CoreTiming::ScheduleEvent(100, event_type);
+    PowerPC::ppcState.downcount = 0;
+    CoreTiming::Advance();
+  });
+
+  // An Advance with nothing due, the per-slice bookkeeping overhead.
+  Benchmark::Run("CoreTiming/Advance idle", 0, [&] {
+    PowerPC::ppcState.downcount = 0;
+    CoreTiming::Advance();
+  });
+}
@@ -0,0 +1,36 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <numeric>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "Common/CPUDetect.h"
+#include "Common/Hash.h"
+
+static void BenchmarkBuffer(const std::vector<u8>& buffer, const std::string& suffix)
+{
+  const u8* data = buffer.data();
+  const u32 len = static_cast<u32>(buffer.size());
+
+  Benchmark::Run("Hash/GetHash64" + suffix, len, [&] { GetHash64(data, len, 0); });
+  Benchmark::Run("Hash/GetMurmurHash3" + suffix, len, [&] { GetMurmurHash3(data, len, 0); });
+  Benchmark::Run("Hash/GetHashHiresTexture" + suffix, len,
+                 [&] { GetHashHiresTexture(data, len, 0); });
+  if (cpu_info.bSSE4_2)
+    Benchmark::Run("Hash/GetCRC32" + suffix, len, [&] { GetCRC32(data, len, 0); });
+}
+
+void RunHashBenchmarks()
+{
+  // A texture-sized buffer and a small one, so both the streaming rate and
+  // the per-call overhead are visible.
+  std::vector<u8> big(1024 * 1024);
+  std::iota(big.begin(), big.end(), 0);
+  std::vector<u8> small(4 * 1024);
+  std::iota(small.begin(), small.end(), 0);
+
+  BenchmarkBuffer(big, "/1MB");
+  BenchmarkBuffer(small, "/4kB");
+}
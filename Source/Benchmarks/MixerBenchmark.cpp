@@ -0,0 +1,26 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <array>
+
+#include "AudioCommon/Mixer.h"
+#include "BenchmarkRunner.h"
+
+void RunMixerBenchmarks()
+{
+  // 2 ms of audio per op at 48 kHz, roughly what a backend callback asks for.
+  constexpr unsigned int FRAMES_PER_OP = 96;
+
+  Mixer mixer(48000);
+  std::array<short, FRAMES_PER_OP * 2> input{};
+  std::array<short, FRAMES_PER_OP * 2> output{};
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<short>(i * 251);
+
+  // Keep the fifo from draining so Mix always resamples real data.
+  Benchmark::Run("Mixer/PushSamples+Mix", sizeof(short) * FRAMES_PER_OP * 2, [&] {
+    mixer.PushSamples(input.data(), FRAMES_PER_OP);
+    mixer.Mix(output.data(), FRAMES_PER_OP);
+  });
+}
@@ -0,0 +1,42 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <thread>
+
+#include "BenchmarkRunner.h"
+#include "Common/SPSCQueue.h"
+
+void RunQueueBenchmarks()
+{
+  // Uncontended push+pop, the cost the CPU thread pays per queued item.
+  {
+    Common::SPSCQueue<u64> queue;
+    Benchmark::Run("Queue/SPSCQueue/push+pop", sizeof(u64), [&] {
+      queue.Push(1);
+      u64 item;
+      queue.Pop(item);
+    });
+  }
+
+  // Cross-thread transfer with both ends live, as in DVDThread and
+  // CoreTiming. The thread spawn is amortized over the batch.
+  {
+    constexpr u64 BATCH = 64 * 1024;
+    Common::SPSCQueue<u64> queue;
+    Benchmark::Run("Queue/SPSCQueue/cross-thread", BATCH * sizeof(u64), [&] {
+      std::thread producer([&] {
+        for (u64 i = 0; i < BATCH; ++i)
+          queue.Push(i);
+      });
+      u64 item;
+      for (u64 i = 0; i < BATCH; ++i)
+      {
+        while (!queue.Pop(item))
+        {
+        }
+      }
+      producer.join();
+    });
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/TextureDecoder.h"
+
+static void BenchmarkFormat(const char* name, u32 texformat)
+{
+  constexpr u32 WIDTH = 256;
+  constexpr u32 HEIGHT = 256;
+
+  const u32 src_size = TexDecoder::GetTextureSizeInBytes(WIDTH, HEIGHT, texformat);
+  std::vector<u8> src(src_size);
+  for (u32 i = 0; i < src_size; ++i)
+    src[i] = static_cast<u8>(i * 33);
+  std::vector<u8> dst(WIDTH * HEIGHT * 4);
+
+  Benchmark::Run(StringFromFormat("TextureDecoder/%s/256x256", name), src_size, [&] {
+    TexDecoder::Decode(dst.data(), src.data(), WIDTH, HEIGHT, texformat, 0, GX_TL_RGB565, true,
+                       false);
+  });
+}
+
+void RunTextureDecoderBenchmarks()
+{
+  // Fill the first palette with something deterministic for the C formats.
+  for (u32 i = 0; i < 512; ++i)
+    texMem[i] = static_cast<u8>(i * 7);
+
+  BenchmarkFormat("I4", GX_TF_I4);
+  BenchmarkFormat("IA8", GX_TF_IA8);
+  BenchmarkFormat("RGB565", GX_TF_RGB565);
+  BenchmarkFormat("RGB5A3", GX_TF_RGB5A3);
+  BenchmarkFormat("RGBA8", GX_TF_RGBA8);
+  BenchmarkFormat("C8", GX_TF_C8);
+  BenchmarkFormat("CMPR", GX_TF_CMPR);
+}
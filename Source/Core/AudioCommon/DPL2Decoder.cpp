@@ -12,11 +12,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <functional>
-#include <numeric>
 #include <vector>
 
 #include "AudioCommon/DPL2Decoder.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
 
 #ifndef M_PI
@@ -34,41 +34,44 @@ static float l_fwr, r_fwr, lpr_fwr, lmr_fwr;
 static std::vector<float> fwrbuf_l, fwrbuf_r;
 static float adapt_l_gain, adapt_r_gain, adapt_lpr_gain, adapt_lmr_gain;
 static std::vector<float> lf, rf, lr, rr, cf, cr;
-static float LFE_buf[256];
-static unsigned int lfe_pos;
 static std::vector<float> filter_coefs_lfe;
 static unsigned int len125;
 
-template <class T>
-static float DotProduct(int count, const T* buf, const std::vector<float>& coeffs, int offset)
+// The decoder works in blocks of up to this many sample pairs. A mixer pull
+// smaller than a block is processed in one pass, a larger one is split into
+// cache-friendly chunks.
+static const unsigned int DECODE_BLOCK_SIZE = 256;
+
+// LFE low-pass state, laid out linearly instead of as a circular buffer:
+// len125 - 1 samples of history followed by up to DECODE_BLOCK_SIZE fresh
+// samples, oldest first. lfe_kernel holds the filter taps reordered at setup
+// so that each output sample is a single contiguous dot product against the
+// history - no per-tap wraparound arithmetic in the inner loop.
+static std::vector<float> lfe_history;
+static std::vector<float> lfe_kernel;
+
+// Contiguous FIR dot product; count must be a multiple of 8 (the 125 Hz
+// low-pass always uses 256 taps).
+static float FIRDotProduct(const float* buf, const float* taps, unsigned int count)
 {
-  return std::inner_product(buf, buf + count, coeffs.begin() + offset, T(0));
-}
-
-template <class T>
-static T FIRFilter(const T* buf, int pos, int len, int count, const std::vector<float>& coeffs)
-{
-  int count1, count2;
-
-  if (pos >= count)
+#if _M_SSE >= 0x200
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  for (unsigned int i = 0; i < count; i += 8)
   {
-    pos -= count;
-    count1 = count;
-    count2 = 0;
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&buf[i]), _mm_loadu_ps(&taps[i])));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&buf[i + 4]), _mm_loadu_ps(&taps[i + 4])));
   }
-  else
-  {
-    count2 = pos;
-    count1 = count - pos;
-    pos = len - count1;
-  }
-
-  // high part of window
-  const T* ptr = &buf[pos];
-
-  float r1 = DotProduct(count1, ptr, coeffs, 0);
-  float r2 = DotProduct(count2, buf, coeffs, count1);
-  return T(r1 + r2);
+  __m128 sum = _mm_add_ps(acc0, acc1);
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 1)));
+  return _mm_cvtss_f32(sum);
+#else
+  float sum = 0.0f;
+  for (unsigned int i = 0; i < count; i++)
+    sum += buf[i] * taps[i];
+  return sum;
+#endif
 }
 
 /*
@@ -167,8 +170,7 @@ static void OnSeek()
   std::fill(rr.begin(), rr.end(), 0.0f);
   std::fill(cf.begin(), cf.end(), 0.0f);
   std::fill(cr.begin(), cr.end(), 0.0f);
-  lfe_pos = 0;
-  memset(LFE_buf, 0, sizeof(LFE_buf));
+  std::fill(lfe_history.begin(), lfe_history.end(), 0.0f);
 }
 
 static void Done()
@@ -176,6 +178,7 @@ static void Done()
   OnSeek();
 
   filter_coefs_lfe.clear();
+  lfe_kernel.clear();
 }
 
 static std::vector<float> CalculateCoefficients125HzLowpass(int rate)
@@ -289,8 +292,6 @@ void DPL2Decode(float* samples, int numsamples, float* out)
   static const unsigned int fmt_freq = 48000;
   static const unsigned int fmt_nchannels = 2;  // input channels
 
-  int cur = 0;
-
   if (olddelay != cfg_delay || oldfreq != fmt_freq)
   {
     Done();
@@ -307,52 +308,70 @@ void DPL2Decode(float* samples, int numsamples, float* out)
     cf.resize(dlbuflen);
     cr.resize(dlbuflen);
     filter_coefs_lfe = CalculateCoefficients125HzLowpass(fmt_freq);
-    lfe_pos = 0;
-    memset(LFE_buf, 0, sizeof(LFE_buf));
+    // The circular layout evaluated tap 0 against the newest sample and
+    // taps 1..N-1 against samples N-1..1 frames old; reorder once so the
+    // linear history (oldest first) lines up with the taps directly.
+    lfe_kernel.resize(len125);
+    lfe_kernel[len125 - 1] = filter_coefs_lfe[0];
+    for (unsigned int i = 0; i + 1 < len125; i++)
+      lfe_kernel[i] = filter_coefs_lfe[i + 1];
+    lfe_history.assign(len125 - 1 + DECODE_BLOCK_SIZE, 0.0f);
   }
 
-  float* in = samples;                           // Input audio data
-  float* end = in + numsamples * fmt_nchannels;  // Loop end
+  float* in = samples;  // Input audio data
+  int done = 0;
 
-  while (in < end)
+  while (done < numsamples)
   {
-    const int k = cyc_pos;
-
-    const int fwr_pos = (k + FWRDURATION) % dlbuflen;
-    /* Update the full wave rectified total amplitude */
-    /* Input matrix decoder */
-    l_fwr += fabs(in[0]) - fabs(fwrbuf_l[fwr_pos]);
-    r_fwr += fabs(in[1]) - fabs(fwrbuf_r[fwr_pos]);
-    lpr_fwr += fabs(in[0] + in[1]) - fabs(fwrbuf_l[fwr_pos] + fwrbuf_r[fwr_pos]);
-    lmr_fwr += fabs(in[0] - in[1]) - fabs(fwrbuf_l[fwr_pos] - fwrbuf_r[fwr_pos]);
-
-    /* Matrix encoded 2 channel sources */
-    fwrbuf_l[k] = in[0];
-    fwrbuf_r[k] = in[1];
-    MatrixDecode(in, k, 0, 1, true, dlbuflen, l_fwr, r_fwr, lpr_fwr, lmr_fwr, &adapt_l_gain,
-                 &adapt_r_gain, &adapt_lpr_gain, &adapt_lmr_gain, &lf[0], &rf[0], &lr[0], &rr[0],
-                 &cf[0]);
-
-    out[cur + 0] = lf[k];
-    out[cur + 1] = rf[k];
-    out[cur + 2] = cf[k];
-    LFE_buf[lfe_pos] = (lf[k] + rf[k] + 2.0f * cf[k] + lr[k] + rr[k]) / 2.0f;
-    out[cur + 3] = FIRFilter(LFE_buf, lfe_pos, len125, len125, filter_coefs_lfe);
-    lfe_pos++;
-    if (lfe_pos == len125)
-    {
-      lfe_pos = 0;
-    }
-    out[cur + 4] = lr[k];
-    out[cur + 5] = rr[k];
-    // Next sample...
-    in += 2;
-    cur += 6;
-    cyc_pos--;
-    if (cyc_pos < 0)
+    const int block = std::min(numsamples - done, static_cast<int>(DECODE_BLOCK_SIZE));
+    float* block_out = out + done * 6;
+    float* lfe_in = &lfe_history[len125 - 1];
+
+    // First pass: the matrix decode is a serial recurrence (the AGC state
+    // feeds back sample to sample), so it stays scalar.
+    for (int n = 0; n < block; n++)
     {
-      cyc_pos += dlbuflen;
+      const int k = cyc_pos;
+
+      const int fwr_pos = (k + FWRDURATION) % dlbuflen;
+      /* Update the full wave rectified total amplitude */
+      /* Input matrix decoder */
+      l_fwr += fabs(in[0]) - fabs(fwrbuf_l[fwr_pos]);
+      r_fwr += fabs(in[1]) - fabs(fwrbuf_r[fwr_pos]);
+      lpr_fwr += fabs(in[0] + in[1]) - fabs(fwrbuf_l[fwr_pos] + fwrbuf_r[fwr_pos]);
+      lmr_fwr += fabs(in[0] - in[1]) - fabs(fwrbuf_l[fwr_pos] - fwrbuf_r[fwr_pos]);
+
+      /* Matrix encoded 2 channel sources */
+      fwrbuf_l[k] = in[0];
+      fwrbuf_r[k] = in[1];
+      MatrixDecode(in, k, 0, 1, true, dlbuflen, l_fwr, r_fwr, lpr_fwr, lmr_fwr, &adapt_l_gain,
+                   &adapt_r_gain, &adapt_lpr_gain, &adapt_lmr_gain, &lf[0], &rf[0], &lr[0], &rr[0],
+                   &cf[0]);
+
+      block_out[n * 6 + 0] = lf[k];
+      block_out[n * 6 + 1] = rf[k];
+      block_out[n * 6 + 2] = cf[k];
+      lfe_in[n] = (lf[k] + rf[k] + 2.0f * cf[k] + lr[k] + rr[k]) / 2.0f;
+      block_out[n * 6 + 4] = lr[k];
+      block_out[n * 6 + 5] = rr[k];
+      // Next sample...
+      in += fmt_nchannels;
+      cyc_pos--;
+      if (cyc_pos < 0)
+      {
+        cyc_pos += dlbuflen;
+      }
     }
+
+    // Second pass: 125 Hz LFE low-pass for the whole block, one vectorized
+    // dot product per output sample.
+    for (int n = 0; n < block; n++)
+      block_out[n * 6 + 3] = FIRDotProduct(&lfe_history[n], lfe_kernel.data(), len125);
+
+    // Slide the newest len125 - 1 samples back to the front for the next
+    // block.
+    memmove(&lfe_history[0], &lfe_history[block], (len125 - 1) * sizeof(float));
+    done += block;
   }
 }
 
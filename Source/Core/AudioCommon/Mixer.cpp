@@ -4,17 +4,42 @@
 
 #include "AudioCommon/Mixer.h"
 
+#include <array>
 #include <cmath>
 #include <cstring>
 
 #include "AudioCommon/DPL2Decoder.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/Profiler.h"
 #include "Common/Swap.h"
 #include "Core/ConfigManager.h"
 
+#if _M_SSE >= 0x200
+// Catmull-Rom coefficients for the high-quality resampler, precomputed for
+// 256 fractional phases. Each phase is a 4-tap filter over the previous,
+// current, next and next-next input samples.
+static const std::array<std::array<float, 4>, 256>& GetCubicCoefficients()
+{
+  static const auto s_coefficients = [] {
+    std::array<std::array<float, 4>, 256> table{};
+    for (size_t phase = 0; phase < table.size(); ++phase)
+    {
+      const float x = phase / static_cast<float>(table.size());
+      table[phase][0] = -0.5f * x * x * x + x * x - 0.5f * x;
+      table[phase][1] = 1.5f * x * x * x - 2.5f * x * x + 1.0f;
+      table[phase][2] = -1.5f * x * x * x + 2.0f * x * x + 0.5f * x;
+      table[phase][3] = 0.5f * x * x * x - 0.5f * x * x;
+    }
+    return table;
+  }();
+  return s_coefficients;
+}
+#endif
+
 Mixer::Mixer(unsigned int BackendSampleRate)
     : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate)
 {
@@ -77,7 +102,84 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  // TODO: consider a higher-quality resampling algorithm.
+#if _M_SSE >= 0x200
+  // Process eight output frames per iteration. Gathering the input taps
+  // stays scalar because the read index advances by a data-dependent
+  // amount, but the filter evaluation, volume scaling, accumulation and
+  // clamping are all done four frames at a time with SSE2. The scalar loop
+  // below handles whatever is left at the tail.
+  const bool hq_resampler = SConfig::GetInstance().m_audio_hq_resampler;
+  const auto& cubic = GetCubicCoefficients();
+  const __m128 lvolume_scale = _mm_set1_ps(lvolume * (1.0f / 256.0f));
+  const __m128 rvolume_scale = _mm_set1_ps(rvolume * (1.0f / 256.0f));
+
+  while (numSamples * 2 - currentSample >= 16 &&
+         ((indexW - indexR) & INDEX_MASK) > 2 * ((m_frac + 8 * ratio) >> 16) + 8)
+  {
+    alignas(16) float taps_l[4][8];
+    alignas(16) float taps_r[4][8];
+    alignas(16) float coeffs[4][8];
+
+    for (int i = 0; i < 8; i++)
+    {
+      for (int t = 0; t < 4; t++)
+      {
+        const u32 index = indexR + 2 * (t - 1);
+        taps_l[t][i] = (s16)Common::swap16(m_buffer[index & INDEX_MASK]);
+        taps_r[t][i] = (s16)Common::swap16(m_buffer[(index + 1) & INDEX_MASK]);
+      }
+      if (hq_resampler)
+      {
+        const std::array<float, 4>& c = cubic[m_frac >> 8];
+        for (int t = 0; t < 4; t++)
+          coeffs[t][i] = c[t];
+      }
+      else
+      {
+        const float frac = m_frac * (1.0f / 65536.0f);
+        coeffs[0][i] = 0.0f;
+        coeffs[1][i] = 1.0f - frac;
+        coeffs[2][i] = frac;
+        coeffs[3][i] = 0.0f;
+      }
+      m_frac += ratio;
+      indexR += 2 * (u16)(m_frac >> 16);
+      m_frac &= 0xffff;
+    }
+
+    for (int i = 0; i < 8; i += 4)
+    {
+      __m128 left = _mm_setzero_ps();
+      __m128 right = _mm_setzero_ps();
+      for (int t = 0; t < 4; t++)
+      {
+        const __m128 c = _mm_load_ps(&coeffs[t][i]);
+        left = _mm_add_ps(left, _mm_mul_ps(_mm_load_ps(&taps_l[t][i]), c));
+        right = _mm_add_ps(right, _mm_mul_ps(_mm_load_ps(&taps_r[t][i]), c));
+      }
+      left = _mm_mul_ps(left, lvolume_scale);
+      right = _mm_mul_ps(right, rvolume_scale);
+
+      // Interleave to the R, L order used in the output buffer, then
+      // accumulate onto the existing samples with saturation.
+      const __m128i left_i = _mm_cvtps_epi32(left);
+      const __m128i right_i = _mm_cvtps_epi32(right);
+      const __m128i rl_lo = _mm_unpacklo_epi32(right_i, left_i);
+      const __m128i rl_hi = _mm_unpackhi_epi32(right_i, left_i);
+
+      __m128i* out = reinterpret_cast<__m128i*>(&samples[currentSample]);
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i existing = _mm_loadu_si128(out);
+      const __m128i existing_lo = _mm_srai_epi32(_mm_unpacklo_epi16(zero, existing), 16);
+      const __m128i existing_hi = _mm_srai_epi32(_mm_unpackhi_epi16(zero, existing), 16);
+      const __m128i mixed = _mm_packs_epi32(_mm_add_epi32(rl_lo, existing_lo),
+                                            _mm_add_epi32(rl_hi, existing_hi));
+      _mm_storeu_si128(out, mixed);
+      currentSample += 8;
+    }
+  }
+#endif
+
   for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
   {
     u32 indexR2 = indexR + 2;  // next sample
@@ -127,6 +229,7 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
+  TRACE_EVENT("Mixer::Mix");
   if (!samples)
     return 0;
 
@@ -153,10 +256,13 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true);
+    unsigned int actual_samples = m_dma_mixer.Mix(samples, num_samples, true);
     m_streaming_mixer.Mix(samples, num_samples, true);
     m_wiimote_speaker_mixer.Mix(samples, num_samples, true);
     m_is_stretching = false;
+
+    if (m_dma_samples_pushed.load(std::memory_order_relaxed))
+      m_underrun_frames.fetch_add(num_samples - actual_samples, std::memory_order_relaxed);
   }
 
   return num_samples;
@@ -215,6 +321,8 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
 void Mixer::PushSamples(const short* samples, unsigned int num_samples)
 {
   m_dma_mixer.PushSamples(samples, num_samples);
+  if (num_samples != 0)
+    m_dma_samples_pushed.store(true, std::memory_order_relaxed);
   int sample_rate = m_dma_mixer.GetInputSampleRate();
   if (m_log_dsp_audio)
     m_wave_writer_dsp.AddStereoSamplesBE(samples, num_samples, sample_rate);
@@ -44,6 +44,10 @@ public:
 
   float GetCurrentSpeed() const { return m_speed.load(); }
   void UpdateSpeed(float val) { m_speed.store(val); }
+  // Number of output frames that had to be padded with the last sample
+  // because the DMA FIFO ran dry. Read-and-reset by the per-second
+  // statistics update on the CPU thread.
+  u64 GetAndResetUnderrunFrames() { return m_underrun_frames.exchange(0); }
 private:
   static constexpr u32 MAX_SAMPLES = 1024 * 4;  // 128 ms
   static constexpr u32 INDEX_MASK = MAX_SAMPLES * 2 - 1;
@@ -96,4 +100,9 @@ private:
 
   // Current rate of emulation (1.0 = 100% speed)
   std::atomic<float> m_speed{0.0f};
+
+  // Underrun accounting. The "seen samples" flag keeps the permanent
+  // padding before the DSP has produced anything from being counted.
+  std::atomic<u64> m_underrun_frames{0};
+  std::atomic<bool> m_dma_samples_pushed{false};
 };
@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <thread>
 
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/Thread.h"
 
 namespace Common
 {
@@ -57,6 +59,23 @@ public:
     if (IsDone())
       return;
 
+    // The worker is very often just about to finish, so spin for a short while
+    // before paying for the mutex + event handshake below. The budget adapts to
+    // the observed handoff latency: it grows while spinning keeps succeeding
+    // and shrinks whenever we had to block anyway, so long payloads fall back
+    // to the event wait almost immediately.
+    int budget = m_spin_budget.load(std::memory_order_relaxed);
+    for (int i = 0; i < budget; ++i)
+    {
+      if (IsDone())
+      {
+        m_spin_budget.store(std::min(budget * 2, MAX_SPIN_BUDGET), std::memory_order_relaxed);
+        return;
+      }
+      YieldCPU();
+    }
+    m_spin_budget.store(std::max(budget / 2, MIN_SPIN_BUDGET), std::memory_order_relaxed);
+
     // notifying this event will only wake up one thread, so use a mutex here to
     // allow only one waiting thread. And in this way, we get an event free wakeup
     // but for the first thread for free
@@ -249,6 +268,10 @@ private:
   };
   std::atomic<int> m_running_state;  // must be of type RUNNING_TYPE
 
+  static constexpr int MIN_SPIN_BUDGET = 16;
+  static constexpr int MAX_SPIN_BUDGET = 4096;
+  std::atomic<int> m_spin_budget{256};  // Adaptive spin count used by Wait().
+
   Flag m_may_sleep;  // If this is set, we fall back from the busy loop to an event based
                      // synchronization.
 };
@@ -133,7 +133,7 @@ public:
   template <typename T>
   void Do(std::vector<T>& x)
   {
-    DoContainer(x);
+    DoContiguousContainer(x);
   }
 
   template <typename T>
@@ -151,7 +151,7 @@ public:
   template <typename T>
   void Do(std::basic_string<T>& x)
   {
-    DoContainer(x);
+    DoContiguousContainer(x);
   }
 
   template <typename T, typename U>
@@ -272,6 +272,48 @@ private:
     DoEachElement(x, [](PointerWrap& p, typename T::value_type& elem) { p.Do(elem); });
   }
 
+  // For containers with contiguous storage (vector, string). Trivially
+  // copyable elements go through a single DoVoid covering the whole range
+  // instead of one tiny DoVoid per element.
+  template <typename T>
+  void DoContiguousContainer(T& x)
+  {
+    u32 size = static_cast<u32>(x.size());
+    Do(size);
+    x.resize(size);
+    DoContiguousElements(
+        x, size, std::integral_constant<bool, IsTriviallyCopyable(typename T::value_type)>());
+  }
+
+  // Bulk path. The element size is stamped into the stream so that a layout
+  // change of the element struct turns into a load error instead of silently
+  // reinterpreting the rest of the savestate.
+  template <typename T>
+  void DoContiguousElements(T& x, u32 size, std::true_type)
+  {
+    u32 elem_size = static_cast<u32>(sizeof(typename T::value_type));
+    Do(elem_size);
+    if (mode == MODE_READ && elem_size != sizeof(typename T::value_type))
+    {
+      PanicAlertT("Error: Container element size %u doesn't match expected size %u. Aborting "
+                  "savestate load...",
+                  elem_size, static_cast<u32>(sizeof(typename T::value_type)));
+      mode = MODE_MEASURE;
+      return;
+    }
+    if (size > 0)
+      DoVoid(&x[0], size * static_cast<u32>(sizeof(typename T::value_type)));
+  }
+
+  // Elements with their own serialization (or a non-trivial layout) keep the
+  // per-element path.
+  template <typename T>
+  void DoContiguousElements(T& x, u32 size, std::false_type)
+  {
+    for (auto& elem : x)
+      Do(elem);
+  }
+
   __forceinline void DoVoid(void* data, u32 size)
   {
     switch (mode)
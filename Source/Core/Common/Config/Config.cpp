@@ -14,6 +14,7 @@ namespace Config
 {
 static Layers s_layers;
 static std::list<ConfigChangedCallback> s_callbacks;
+static u64 s_generation = 1;
 
 void InvokeConfigChangedCallbacks();
 
@@ -57,15 +58,24 @@ void AddConfigChangedCallback(ConfigChangedCallback func)
 
 void InvokeConfigChangedCallbacks()
 {
+  s_generation++;
   for (const auto& callback : s_callbacks)
     callback();
 }
 
+u64 GetGeneration()
+{
+  return s_generation;
+}
+
 // Explicit load and save of layers
 void Load()
 {
   for (auto& layer : s_layers)
     layer.second->Load();
+
+  // Load() does not invoke the callbacks, but it still changes values.
+  s_generation++;
 }
 
 void Save()
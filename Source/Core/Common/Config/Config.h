@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 
+#include "Common/CommonTypes.h"
 #include "Common/Config/ConfigInfo.h"
 #include "Common/Config/Enums.h"
 #include "Common/Config/Layer.h"
@@ -30,6 +31,12 @@ bool LayerExists(LayerType layer);
 void AddConfigChangedCallback(ConfigChangedCallback func);
 void InvokeConfigChangedCallbacks();
 
+// Monotonically increasing counter, bumped whenever any layer changes.
+// Subsystems can stamp a snapshot of resolved values with this and skip
+// re-reading until the generation advances, which keeps repeated reads out
+// of the layer maps.
+u64 GetGeneration();
+
 // Explicit load and save of layers
 void Load();
 void Save();
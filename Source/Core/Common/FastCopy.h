@@ -0,0 +1,153 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+
+#include "Common/Swap.h"
+
+#if defined(_M_X86)
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#endif
+
+// Copy helpers for the guest-visible hot paths (gather pipe bursts, CopyTo/FromEmu,
+// XFB transfers). The sizes on these paths are either known at compile time or large
+// and phase-stable, which plain memcpy can't take advantage of: the libc dispatch is
+// re-run on every call and never uses non-temporal stores for buffers that won't be
+// read back through the cache.
+
+namespace Common
+{
+// Fixed-size copy; the size is a template parameter so the compiler emits a fully
+// unrolled, branch-free sequence at the call site.
+template <size_t N>
+inline void CopyFixed(void* dst, const void* src)
+{
+  std::memcpy(dst, src, N);
+}
+
+#if defined(_M_X86)
+// The 32 byte gather pipe burst runs millions of times per second, so spell it out
+// as two unaligned vector moves instead of trusting the memcpy expansion.
+template <>
+inline void CopyFixed<32>(void* dst, const void* src)
+{
+  const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src) + 1);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst) + 1, b);
+}
+#endif
+
+#if defined(_M_X86)
+// Copies with non-temporal stores when the destination is vector aligned and the
+// copy is large enough that evicting it from the cache is a win (XFB and texture
+// sized transfers); falls back to memcpy otherwise. Streaming stores are SSE2,
+// which is baseline for every x64 CPU we run on, so no runtime dispatch is needed.
+inline void StreamCopy(void* dst, const void* src, size_t size)
+{
+  // Below this, the copy fits comfortably in L1 and the sfence costs more than it saves.
+  constexpr size_t STREAM_THRESHOLD = 2048;
+
+  u8* d = static_cast<u8*>(dst);
+  const u8* s = static_cast<const u8*>(src);
+  if (size < STREAM_THRESHOLD || (reinterpret_cast<uintptr_t>(d) & 0xF))
+  {
+    std::memcpy(dst, src, size);
+    return;
+  }
+
+  const size_t vec_bytes = size & ~static_cast<size_t>(0x3F);
+  for (size_t i = 0; i < vec_bytes; i += 64)
+  {
+    const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i) + 1);
+    const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i) + 2);
+    const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i) + 3);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i), v0);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i) + 1, v1);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i) + 2, v2);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + i) + 3, v3);
+  }
+  // Make the streaming stores visible before anyone reads the buffer.
+  _mm_sfence();
+
+  if (size != vec_bytes)
+    std::memcpy(d + vec_bytes, s + vec_bytes, size - vec_bytes);
+}
+#else
+inline void StreamCopy(void* dst, const void* src, size_t size)
+{
+  std::memcpy(dst, src, size);
+}
+#endif
+
+// Byteswapping copies for guest<->host endian conversion on bulk transfers
+// (EXI/SI DMA, MMIO-visible buffers). The devices otherwise run one
+// Common::swap* per element; a pshufb converts sixteen bytes per iteration.
+// Also usable in place (dst == src), since whole vectors are loaded before
+// being stored back.
+template <typename T>
+inline void SwapCopy(T* dst, const T* src, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    dst[i] = FromBigEndian(src[i]);
+}
+
+#if defined(_M_X86)
+FUNCTION_TARGET_SSSE3
+inline void SwapCopy16SSSE3(u16* dst, const u16* src, size_t count)
+{
+  const __m128i mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+  }
+  for (; i < count; i++)
+    dst[i] = swap16(src[i]);
+}
+
+FUNCTION_TARGET_SSSE3
+inline void SwapCopy32SSSE3(u32* dst, const u32* src, size_t count)
+{
+  const __m128i mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+  }
+  for (; i < count; i++)
+    dst[i] = swap32(src[i]);
+}
+#endif
+
+inline void SwapCopy(u16* dst, const u16* src, size_t count)
+{
+#if defined(_M_X86)
+  if (count >= 8 && cpu_info.bSSSE3)
+    return SwapCopy16SSSE3(dst, src, count);
+#endif
+  for (size_t i = 0; i < count; i++)
+    dst[i] = swap16(src[i]);
+}
+
+inline void SwapCopy(u32* dst, const u32* src, size_t count)
+{
+#if defined(_M_X86)
+  if (count >= 4 && cpu_info.bSSSE3)
+    return SwapCopy32SSSE3(dst, src, count);
+#endif
+  for (size_t i = 0; i < count; i++)
+    dst[i] = swap32(src[i]);
+}
+}  // namespace Common
@@ -0,0 +1,145 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Common
+{
+// Open-addressing hash map with linear probing and power-of-two capacity.
+// Entries live directly in the bucket array, so a lookup is one hash plus a
+// short linear scan over adjacent cache lines instead of a node pointer
+// chase through std::unordered_map. Erasing single entries is not supported;
+// the hot caches this backs only grow and are cleared wholesale.
+template <typename K, typename V, typename Hash = std::hash<K>>
+class FlatHashMap
+{
+public:
+  FlatHashMap() = default;
+
+  FlatHashMap(const FlatHashMap&) = delete;
+  FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+  ~FlatHashMap()
+  {
+    clear();
+    ::operator delete(m_buckets);
+  }
+
+  // Returns a pointer to the mapped value, or nullptr if the key is absent.
+  V* find(const K& key)
+  {
+    if (m_size == 0)
+      return nullptr;
+    for (size_t index = Hash()(key) & m_mask;; index = (index + 1) & m_mask)
+    {
+      Bucket& bucket = m_buckets[index];
+      if (!bucket.occupied)
+        return nullptr;
+      if (bucket.Entry()->first == key)
+        return &bucket.Entry()->second;
+    }
+  }
+
+  // Default-constructs the mapped value for absent keys, like std::map.
+  V& operator[](const K& key)
+  {
+    if (m_size + 1 > (Capacity() - Capacity() / 4))
+      Grow();
+    for (size_t index = Hash()(key) & m_mask;; index = (index + 1) & m_mask)
+    {
+      Bucket& bucket = m_buckets[index];
+      if (!bucket.occupied)
+      {
+        new (&bucket.storage) std::pair<K, V>(key, V());
+        bucket.occupied = true;
+        m_size++;
+        return bucket.Entry()->second;
+      }
+      if (bucket.Entry()->first == key)
+        return bucket.Entry()->second;
+    }
+  }
+
+  // Calls func(key, value) for every entry, in unspecified order.
+  template <typename F>
+  void ForEach(F func) const
+  {
+    for (size_t i = 0; i < Capacity(); ++i)
+    {
+      if (m_buckets[i].occupied)
+        func(m_buckets[i].Entry()->first, m_buckets[i].Entry()->second);
+    }
+  }
+
+  void clear()
+  {
+    for (size_t i = 0; i < Capacity(); ++i)
+    {
+      if (m_buckets[i].occupied)
+      {
+        m_buckets[i].Entry()->~pair();
+        m_buckets[i].occupied = false;
+      }
+    }
+    m_size = 0;
+  }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+private:
+  struct Bucket
+  {
+    typename std::aligned_storage<sizeof(std::pair<K, V>), alignof(std::pair<K, V>)>::type storage;
+    bool occupied;
+
+    std::pair<K, V>* Entry() { return reinterpret_cast<std::pair<K, V>*>(&storage); }
+  };
+
+  size_t Capacity() const { return m_buckets ? m_mask + 1 : 0; }
+
+  void Grow()
+  {
+    const size_t old_capacity = Capacity();
+    const size_t new_capacity = old_capacity ? old_capacity * 2 : INITIAL_CAPACITY;
+    Bucket* old_buckets = m_buckets;
+
+    m_buckets = static_cast<Bucket*>(::operator new(new_capacity * sizeof(Bucket)));
+    for (size_t i = 0; i < new_capacity; ++i)
+      m_buckets[i].occupied = false;
+    m_mask = new_capacity - 1;
+
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+      if (!old_buckets[i].occupied)
+        continue;
+      std::pair<K, V>* entry = old_buckets[i].Entry();
+      for (size_t index = Hash()(entry->first) & m_mask;; index = (index + 1) & m_mask)
+      {
+        Bucket& bucket = m_buckets[index];
+        if (!bucket.occupied)
+        {
+          new (&bucket.storage) std::pair<K, V>(std::move(*entry));
+          bucket.occupied = true;
+          break;
+        }
+      }
+      entry->~pair();
+    }
+    ::operator delete(old_buckets);
+  }
+
+  static constexpr size_t INITIAL_CAPACITY = 64;
+
+  Bucket* m_buckets = nullptr;
+  size_t m_mask = 0;
+  size_t m_size = 0;
+};
+}  // namespace Common
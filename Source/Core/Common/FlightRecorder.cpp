@@ -0,0 +1,223 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/FlightRecorder.h"
+
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+
+namespace Common
+{
+namespace FlightRecorder
+{
+namespace
+{
+// A frame slower than this is treated as a stutter and dumps the ring.
+constexpr u32 FRAME_DEADLINE_US = 50000;
+// Successive dumps are rate limited so one bad scene doesn't thrash the disk.
+constexpr u64 DUMP_INTERVAL_US = 10 * 1000000;
+
+constexpr u32 NUM_COUNTERS = static_cast<u32>(Counter::NumCounters);
+
+constexpr const char* COUNTER_NAMES[NUM_COUNTERS] = {
+    "jit_blocks", "tex_uploads", "disc_reads", "fifo_waits",
+};
+
+struct FrameRecord
+{
+  u64 end_us;
+  u32 duration_us;
+  u32 fifo_wait_us;
+  u32 counters[NUM_COUNTERS];
+};
+
+std::array<std::atomic<u32>, NUM_COUNTERS> s_counters;
+std::atomic<u32> s_fifo_wait_us{0};
+
+// Written only by the video thread in EndFrame; read by Dump, which on the
+// deadline path runs on the same thread and at crash time is best effort.
+std::array<FrameRecord, RECORDED_FRAMES> s_frames{};
+u64 s_frame_number = 0;
+u64 s_last_frame_end_us = 0;
+u64 s_last_dump_us = 0;
+
+// Resolved on the first EndFrame so the crash path never has to build a path
+// (and therefore allocate) inside a signal handler.
+char s_dump_path[1024];
+std::atomic<bool> s_path_ready{false};
+
+// Live export of the ring through a memory-mapped file (layout documented in
+// the header). There is a single writer, the video thread in EndFrame, so
+// publishing is wait-free; external monitors map the file read-only.
+constexpr u32 EXPORT_MAGIC = 0x44465431;  // "DFT1"
+constexpr u32 EXPORT_VERSION = 1;
+
+struct ExportHeader
+{
+  u32 magic;
+  u32 version;
+  u32 capacity;
+  u32 record_size;
+  std::atomic<u64> frame_count;
+};
+
+ExportHeader* s_export_header = nullptr;
+FrameRecord* s_export_records = nullptr;
+
+void OpenExport(const std::string& path)
+{
+  const size_t size = sizeof(ExportHeader) + RECORDED_FRAMES * sizeof(FrameRecord);
+  void* data = nullptr;
+
+#ifdef _WIN32
+  HANDLE file = CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                           FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return;
+
+  HANDLE file_mapping = CreateFileMapping(file, nullptr, PAGE_READWRITE, 0,
+                                          static_cast<DWORD>(size), nullptr);
+  if (!file_mapping)
+  {
+    CloseHandle(file);
+    return;
+  }
+
+  data = MapViewOfFile(file_mapping, FILE_MAP_WRITE, 0, 0, 0);
+  // The view keeps the file and mapping alive; the export lives until exit.
+  CloseHandle(file_mapping);
+  CloseHandle(file);
+  if (!data)
+    return;
+#else
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return;
+
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+  {
+    close(fd);
+    return;
+  }
+
+  data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps the file alive; the export lives until exit.
+  close(fd);
+  if (data == MAP_FAILED)
+    return;
+#endif
+
+  std::memset(data, 0, size);
+  ExportHeader* header = static_cast<ExportHeader*>(data);
+  header->magic = EXPORT_MAGIC;
+  header->version = EXPORT_VERSION;
+  header->capacity = RECORDED_FRAMES;
+  header->record_size = sizeof(FrameRecord);
+
+  s_export_records = reinterpret_cast<FrameRecord*>(header + 1);
+  s_export_header = header;
+}
+}  // Anonymous namespace
+
+void Count(Counter counter, u32 amount)
+{
+  s_counters[static_cast<u32>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void AddFifoWaitTime(u32 us)
+{
+  s_fifo_wait_us.fetch_add(us, std::memory_order_relaxed);
+}
+
+void EndFrame()
+{
+  if (!s_path_ready.load(std::memory_order_relaxed))
+  {
+    const std::string path = File::GetUserPath(D_DUMP_IDX) + "flight_recorder.txt";
+    snprintf(s_dump_path, sizeof(s_dump_path), "%s", path.c_str());
+    OpenExport(File::GetUserPath(D_LOGS_IDX) + "frametimes.shm");
+    s_path_ready.store(true, std::memory_order_release);
+  }
+
+  const u64 now = Timer::GetTimeUs();
+
+  FrameRecord& record = s_frames[s_frame_number % RECORDED_FRAMES];
+  record.end_us = now;
+  record.duration_us =
+      s_last_frame_end_us != 0 ? static_cast<u32>(now - s_last_frame_end_us) : 0;
+  record.fifo_wait_us = s_fifo_wait_us.exchange(0, std::memory_order_relaxed);
+  for (u32 i = 0; i < NUM_COUNTERS; i++)
+    record.counters[i] = s_counters[i].exchange(0, std::memory_order_relaxed);
+
+  // Publish the record to the shared-memory ring: the slot is filled before
+  // the frame count is release-stored, so a reader never takes a half-written
+  // record for a complete one.
+  if (s_export_records)
+  {
+    s_export_records[s_frame_number % RECORDED_FRAMES] = record;
+    s_export_header->frame_count.store(s_frame_number + 1, std::memory_order_release);
+  }
+
+  s_frame_number++;
+  s_last_frame_end_us = now;
+
+  if (record.duration_us > FRAME_DEADLINE_US && now - s_last_dump_us > DUMP_INTERVAL_US)
+  {
+    s_last_dump_us = now;
+    Dump("frame deadline exceeded");
+  }
+}
+
+void Dump(const char* reason)
+{
+  if (!s_path_ready.load(std::memory_order_acquire) || s_frame_number == 0)
+    return;
+
+  // Plain stdio instead of IOFile: no allocation, and usable (if formally
+  // unsafe) from the crash handlers.
+  std::FILE* file = std::fopen(s_dump_path, "w");
+  if (!file)
+    return;
+
+  fprintf(file, "# flight recorder dump: %s\n", reason);
+  fprintf(file, "# frame end_us duration_us fifo_wait_us");
+  for (u32 i = 0; i < NUM_COUNTERS; i++)
+    fprintf(file, " %s", COUNTER_NAMES[i]);
+  fprintf(file, "\n");
+
+  const u64 first =
+      s_frame_number > RECORDED_FRAMES ? s_frame_number - RECORDED_FRAMES : 0;
+  for (u64 frame = first; frame < s_frame_number; frame++)
+  {
+    const FrameRecord& record = s_frames[frame % RECORDED_FRAMES];
+    fprintf(file, "%" PRIu64 " %" PRIu64 " %u %u", frame, record.end_us, record.duration_us,
+            record.fifo_wait_us);
+    for (u32 i = 0; i < NUM_COUNTERS; i++)
+      fprintf(file, " %u", record.counters[i]);
+    fprintf(file, "\n");
+  }
+
+  std::fclose(file);
+  WARN_LOG(COMMON, "Flight recorder dumped to %s (%s)", s_dump_path, reason);
+}
+}
+}
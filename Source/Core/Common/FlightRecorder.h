@@ -0,0 +1,59 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Always-on flight recorder: a small ring of per-frame metrics (frame time,
+// FIFO sync waits, JIT compiles, texture uploads, disc reads) that is dumped
+// to disk when a frame blows past its deadline or when the process crashes.
+// Unlike the Tracer capture this never needs to be armed, so it can turn an
+// unreproducible stutter report from the field into data. Overhead is a
+// handful of relaxed atomic increments per frame.
+//
+// The same records are also published live through a memory-mapped file
+// (Logs/frametimes.shm) for external monitors, so frame timing can be
+// scraped without tailing logs. The layout is a header
+//   { u32 magic "DFT1"; u32 version; u32 capacity; u32 record_size;
+//     u64 frame_count; }
+// followed by capacity records of
+//   { u64 end_us; u32 duration_us; u32 fifo_wait_us;
+//     u32 counters[NumCounters]; }
+// written into slot (frame - 1) % capacity. The writer fills the slot before
+// release-storing frame_count, so a reader that rereads frame_count after
+// copying a record can reject the one slot that may be mid-write.
+namespace FlightRecorder
+{
+// Number of frames kept in the ring (~5 seconds at 60 fps).
+constexpr u32 RECORDED_FRAMES = 300;
+
+enum class Counter : u32
+{
+  JitBlocksCompiled,
+  TextureUploads,
+  DiscReads,
+  FifoSyncWaits,
+  NumCounters
+};
+
+// Relaxed increment of a per-frame counter; callable from any thread.
+void Count(Counter counter, u32 amount = 1);
+
+// Adds wall time spent blocked on GPU synchronization to the current frame.
+void AddFifoWaitTime(u32 us);
+
+// Folds the counters into the ring and checks the frame deadline. Called once
+// per presented frame from the renderer.
+void EndFrame();
+
+// Writes the recorded window to flight_recorder.txt in the dump directory.
+// The reason appears in the file header. Called on deadline misses and from
+// the crash handlers in MemTools; as a crash-time best effort it avoids any
+// allocation but is not strictly async-signal-safe.
+void Dump(const char* reason);
+}
+}
@@ -636,6 +636,7 @@ PFNDOLVERTEXATTRIBI4USVPROC dolVertexAttribI4usv;
 PFNDOLVERTEXATTRIBIPOINTERPROC dolVertexAttribIPointer;
 
 // gl_3_1
+PFNDOLCOPYBUFFERSUBDATAPROC dolCopyBufferSubData;
 PFNDOLDRAWARRAYSINSTANCEDPROC dolDrawArraysInstanced;
 PFNDOLDRAWELEMENTSINSTANCEDPROC dolDrawElementsInstanced;
 PFNDOLPRIMITIVERESTARTINDEXPROC dolPrimitiveRestartIndex;
@@ -1395,6 +1396,7 @@ const GLFunc gl_function_array[] = {
     GLFUNC_REQUIRES(glTexParameterIuiv, "VERSION_3_0 |VERSION_GLES_3_2"),
 
     // gl_3_1
+    GLFUNC_REQUIRES(glCopyBufferSubData, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glPrimitiveRestartIndex, "VERSION_3_1"),
     GLFUNC_REQUIRES(glDrawArraysInstanced, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glDrawElementsInstanced, "VERSION_3_1 |VERSION_GLES_3"),
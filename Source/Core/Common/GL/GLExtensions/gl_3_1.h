@@ -114,11 +114,13 @@ typedef void(APIENTRYP PFNDOLGETACTIVEUNIFORMBLOCKNAMEPROC)(GLuint program,
 typedef void(APIENTRYP PFNDOLUNIFORMBLOCKBINDINGPROC)(GLuint program, GLuint uniformBlockIndex,
                                                       GLuint uniformBlockBinding);
 
+extern PFNDOLCOPYBUFFERSUBDATAPROC dolCopyBufferSubData;
 extern PFNDOLDRAWARRAYSINSTANCEDPROC dolDrawArraysInstanced;
 extern PFNDOLDRAWELEMENTSINSTANCEDPROC dolDrawElementsInstanced;
 extern PFNDOLPRIMITIVERESTARTINDEXPROC dolPrimitiveRestartIndex;
 extern PFNDOLTEXBUFFERPROC dolTexBuffer;
 
+#define glCopyBufferSubData dolCopyBufferSubData
 #define glDrawArraysInstanced dolDrawArraysInstanced
 #define glDrawElementsInstanced dolDrawElementsInstanced
 #define glPrimitiveRestartIndex dolPrimitiveRestartIndex
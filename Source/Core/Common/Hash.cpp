@@ -91,7 +91,26 @@ u32 HashEctor(const u8* ptr, int length)
 {
   u32 crc = 0;
 
-  for (int i = 0; i < length; i++)
+  // The update rotl(crc ^ b, 3) is linear, so it splits into
+  // rotl(crc, 3) ^ rotl(b, 3), and 32 steps rotate the previous state by
+  // 96 bits == 0 (mod 32). A whole 32-byte block therefore folds into the
+  // state as a single xor of its bytes, each rotated by a fixed per-position
+  // amount. That removes the byte-to-byte dependency chain, which dominates
+  // the serial version, while staying bit-exact with it.
+  int i = 0;
+  for (; length - i >= 32; i += 32)
+  {
+    u32 block = 0;
+    for (int j = 0; j < 32; j++)
+    {
+      const u32 b = ptr[i + j];
+      const u32 r = (96 - 3 * j) & 31;
+      block ^= (b << r) | (b >> ((32 - r) & 31));
+    }
+    crc ^= block;
+  }
+
+  for (; i < length; i++)
   {
     crc ^= ptr[i];
     crc = (crc << 3) | (crc >> 29);
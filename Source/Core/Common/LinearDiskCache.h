@@ -6,25 +6,32 @@
 
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/MappedFile.h"
 #include "Common/Version.h"
 
 // On disk format:
 // header{
-// u32 'DCAC';
-// u32 version;  // svn_rev
+// u32 'DCA2';
 // u16 sizeof(key_type);
 // u16 sizeof(value_type);
+// char ver[40];
 //}
 
 // key_value_pair{
 // u32 value_size;
+// u32 checksum;  // over the key and value bytes
 // key_type   key;
 // value_type[value_size]   value;
+// u32 entry_number;
 //}
 
 template <typename K, typename V>
@@ -39,7 +46,9 @@ public:
 // Keys and values can contain any characters, including \0.
 //
 // Suitable for caching generated shader bytecode between executions.
-// Not tuned for extreme performance but should be reasonably fast.
+// Appends are O(1) and records carry a checksum, so an unclean shutdown
+// costs at most the torn tail record instead of the whole cache: OpenAndRead
+// keeps every intact record and compacts the torn tail away.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
 
@@ -68,70 +77,125 @@ public:
     // close any currently opened file
     Close();
     m_num_entries = 0;
-
-    // try opening for reading/writing
-    File::OpenFStream(m_file, filename, ios_base::in | ios_base::out | ios_base::binary);
-
-    m_file.seekg(0, std::ios::end);
-    std::fstream::pos_type end_pos = m_file.tellg();
-    m_file.seekg(0, std::ios::beg);
-    std::fstream::pos_type start_pos = m_file.tellg();
-    std::streamoff file_size = end_pos - start_pos;
     if (version.empty())
     {
-    m_header.Init();
+      m_header.Init();
     }
     else
     {
       m_header.Init(version);
     }
-    if (m_file.is_open() && ValidateHeader())
-    {
-      // good header, read some key/value pairs
-      K key;
 
-      V* value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-
-      std::fstream::pos_type last_pos = m_file.tellg();
+    // Parse the existing cache through a read-only mapping: values are handed
+    // to the reader straight out of the mapped pages instead of through a
+    // buffered read loop. A plain read into memory is the fallback for files
+    // that cannot be mapped.
+    std::vector<u8> backing;
+    const u8* data = nullptr;
+    u64 size = 0;
+    std::unique_ptr<Common::MappedFile> mapping = Common::MappedFile::Open(filename);
+    if (mapping)
+    {
+      data = mapping->Data();
+      size = mapping->Size();
+    }
+    else
+    {
+      File::IOFile file(filename, "rb");
+      if (file)
+      {
+        backing.resize(file.GetSize());
+        if (!backing.empty() && file.ReadBytes(backing.data(), backing.size()))
+        {
+          data = backing.data();
+          size = backing.size();
+        }
+      }
+    }
 
-      while (Read(&value_size))
+    const bool header_good =
+        data && size >= sizeof(Header) && !memcmp(data, &m_header, sizeof(Header));
+    u64 valid_end = sizeof(Header);
+    bool torn_tail = false;
+    if (header_good)
+    {
+      u64 pos = sizeof(Header);
+      while (pos != size)
       {
-        std::streamoff next_extent = (last_pos - start_pos) + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
+        if (pos + 2 * sizeof(u32) + sizeof(K) > size)
+        {
+          torn_tail = true;
+          break;
+        }
+        u32 value_size;
+        u32 checksum;
+        std::memcpy(&value_size, data + pos, sizeof(u32));
+        std::memcpy(&checksum, data + pos + sizeof(u32), sizeof(u32));
+        const u64 record_end = pos + 2 * sizeof(u32) + sizeof(K) +
+                               static_cast<u64>(value_size) * sizeof(V) + sizeof(u32);
+        if (record_end > size)
+        {
+          torn_tail = true;
           break;
+        }
 
-        delete[] value;
-        value = new V[value_size];
+        K key;
+        std::memcpy(&key, data + pos + 2 * sizeof(u32), sizeof(K));
+        const u8* value_ptr = data + pos + 2 * sizeof(u32) + sizeof(K);
+        u32 entry_number;
+        std::memcpy(&entry_number, data + record_end - sizeof(u32), sizeof(u32));
+        if (entry_number != m_num_entries + 1 ||
+            checksum != ComputeChecksum(key, reinterpret_cast<const V*>(value_ptr), value_size))
+        {
+          torn_tail = true;
+          break;
+        }
 
-        // read key/value and pass to reader
-        if (Read(&key) && Read(value, value_size) && Read(&entry_number) &&
-            entry_number == m_num_entries + 1)
+        if (reinterpret_cast<uintptr_t>(value_ptr) % alignof(V) == 0)
         {
-          reader.Read(key, value, value_size);
+          reader.Read(key, reinterpret_cast<const V*>(value_ptr), value_size);
         }
         else
         {
-          break;
+          std::vector<V> value(value_size);
+          std::memcpy(value.data(), value_ptr, static_cast<u64>(value_size) * sizeof(V));
+          reader.Read(key, value.data(), value_size);
         }
 
         m_num_entries++;
-        last_pos = m_file.tellg();
+        pos = record_end;
       }
-      m_file.seekp(last_pos);
-      m_file.clear();
+      valid_end = pos;
+    }
 
-      delete[] value;
-      return m_num_entries;
+    // Keep the intact records around before the mapping goes away, in case
+    // the file has to be rewritten below.
+    std::vector<u8> valid_records;
+    if (header_good && torn_tail)
+      valid_records.assign(data + sizeof(Header), data + valid_end);
+    backing.clear();
+    mapping.reset();
+
+    if (header_good && !torn_tail)
+    {
+      // Clean cache: reopen for appending after the last record.
+      File::OpenFStream(m_file, filename, ios_base::in | ios_base::out | ios_base::binary);
+      if (m_file.is_open())
+      {
+        m_file.seekp(valid_end);
+        return m_num_entries;
+      }
     }
 
-    // failed to open file for reading or bad header
-    // close and recreate file
+    // Missing file, bad header, or a torn tail from an unclean shutdown:
+    // recreate the file from the header and the records that survived, so the
+    // garbage does not accumulate or mask later appends.
     Close();
     File::OpenFStream(m_file, filename, ios_base::out | ios_base::trunc | ios_base::binary);
     WriteHeader();
-    return 0;
+    if (!valid_records.empty())
+      Write(valid_records.data(), static_cast<u32>(valid_records.size()));
+    return m_num_entries;
   }
 
   void Sync() { m_file.flush(); }
@@ -148,7 +212,9 @@ public:
   {
     // TODO: Should do a check that we don't already have "key"? (I think each caller does that
     // already.)
+    const u32 checksum = ComputeChecksum(key, value, value_size);
     Write(&value_size);
+    Write(&checksum);
     Write(&key);
     Write(value, value_size);
     m_num_entries++;
@@ -157,12 +223,15 @@ public:
 
 private:
   void WriteHeader() { Write(&m_header); }
-  bool ValidateHeader()
-  {
-    char file_header[sizeof(Header)];
 
-    return (Read(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+  static u32 ComputeChecksum(const K& key, const V* value, u32 value_size)
+  {
+    // Covers the key as well as the value, so a record is rejected if either
+    // was torn by an unclean shutdown.
+    u32 checksum = HashAdler32(reinterpret_cast<const u8*>(&key), sizeof(K));
+    checksum ^= HashAdler32(reinterpret_cast<const u8*>(value),
+                            static_cast<size_t>(value_size) * sizeof(V));
+    return checksum;
   }
 
   template <typename D>
@@ -171,18 +240,12 @@ private:
     return m_file.write(reinterpret_cast<const char*>(data), count * sizeof(D)).good();
   }
 
-  template <typename D>
-  bool Read(D* data, u32 count = 1)
-  {
-    return m_file.read(reinterpret_cast<char*>(data), count * sizeof(D)).good();
-  }
-
   struct Header
   {
     void Init(std::string version)
     {
       // Null-terminator is intentionally not copied.
-      std::memcpy(&id, "DCAC", sizeof(u32));
+      std::memcpy(&id, "DCA2", sizeof(u32));
       std::memcpy(ver, version.c_str(), std::min(version.size(), sizeof(ver)));
     }
     void Init()
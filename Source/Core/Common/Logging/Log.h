@@ -72,6 +72,19 @@ enum LOG_LEVELS
 
 static const char LOG_LEVEL_TO_CHAR[7] = "-NEWID";
 
+// Individual categories can be compiled out entirely (e.g. for release
+// builds on slow platforms) by defining STRIPPED_LOG_TYPES_MASK to a bitmask
+// of LOG_TYPE bits, e.g. (1ull << LogTypes::DSP_MAIL). A stripped category
+// makes the whole logging statement fold away, arguments included.
+#ifndef STRIPPED_LOG_TYPES_MASK
+#define STRIPPED_LOG_TYPES_MASK 0ull
+#endif
+
+constexpr bool IsLogTypeCompiledIn(LOG_TYPE type)
+{
+  return ((STRIPPED_LOG_TYPES_MASK >> static_cast<int>(type)) & 1) == 0;
+}
+
 }  // namespace
 
 void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char* file, int line,
@@ -81,6 +94,10 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 #endif
     ;
 
+// Runtime check used by the macros below so that format arguments are never
+// evaluated for messages that will not be emitted.
+bool GenericLogEnabled(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type);
+
 #if defined LOGGING || defined _DEBUG || defined DEBUGFAST
 #define MAX_LOGLEVEL LogTypes::LOG_LEVELS::LDEBUG
 #else
@@ -89,10 +106,12 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 #endif  // loglevel
 #endif  // logging
 
-// Let the compiler optimize this out
+// The first two conditions are compile-time constants, so the compiler
+// optimizes stripped categories and levels out entirely; the runtime check
+// keeps disabled messages from ever evaluating their arguments.
 #define GENERIC_LOG(t, v, ...)                                                                     \
   {                                                                                                \
-    if (v <= MAX_LOGLEVEL)                                                                         \
+    if (LogTypes::IsLogTypeCompiledIn(t) && v <= MAX_LOGLEVEL && GenericLogEnabled(v, t))          \
       GenericLog(v, t, __FILE__, __LINE__, __VA_ARGS__);                                           \
   }
 
@@ -15,6 +15,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
 constexpr size_t MAX_MSGLEN = 1024;
@@ -64,6 +65,11 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
   va_end(args);
 }
 
+bool GenericLogEnabled(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type)
+{
+  return LogManager::GetInstance() && LogManager::GetInstance()->IsEnabled(type, level);
+}
+
 static size_t DeterminePathCutOffPoint()
 {
   constexpr const char* pattern = DIR_SEP "Source" DIR_SEP "Core" DIR_SEP;
@@ -149,15 +155,51 @@ LogManager::LogManager()
         Config::ConfigInfo<bool>{{Config::System::Logger, "Logs", container.m_short_name}, false});
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_writer_thread = std::thread(&LogManager::WriterThread, this);
 }
 
 LogManager::~LogManager()
 {
+  // Flush and stop the writer thread before tearing down the listeners.
+  m_writer_shutdown.store(true);
+  m_writer_event.Set();
+  m_writer_thread.join();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
 }
 
+void LogManager::WriterThread()
+{
+  Common::SetCurrentThreadName("Log writer");
+
+  while (true)
+  {
+    m_writer_event.Wait();
+
+    u64 read_index = m_read_index.load(std::memory_order_relaxed);
+    while (m_queue[read_index & (QUEUE_SIZE - 1)].ready.load(std::memory_order_acquire))
+    {
+      QueueEntry& entry = m_queue[read_index & (QUEUE_SIZE - 1)];
+
+      for (auto listener_id : m_listener_ids)
+        if (m_listeners[listener_id])
+          m_listeners[listener_id]->Log(entry.level, entry.msg);
+
+      entry.ready.store(false, std::memory_order_release);
+      read_index++;
+      m_read_index.store(read_index, std::memory_order_release);
+    }
+
+    // Only exit once everything queued before the shutdown flag is flushed.
+    if (m_writer_shutdown.load() &&
+        read_index == m_write_index.load(std::memory_order_acquire))
+      return;
+  }
+}
+
 void LogManager::SaveSettings()
 {
   Config::SetBaseOrCurrent(LOGGER_WRITE_TO_FILE, IsListenerEnabled(LogListener::FILE_LISTENER));
@@ -193,9 +235,29 @@ void LogManager::LogWithFullPath(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE
       StringFromFormat("%s %s:%u %c[%s]: %s\n", Common::Timer::GetTimeFormatted().c_str(), file,
                        line, LogTypes::LOG_LEVEL_TO_CHAR[(int)level], GetShortName(type), temp);
 
-  for (auto listener_id : m_listener_ids)
-    if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+  // Claim a ring slot. Producers are lock-free against each other; if the
+  // ring is full we wait for the writer thread, which is no worse than the
+  // old synchronous write.
+  u64 index = m_write_index.load(std::memory_order_relaxed);
+  while (true)
+  {
+    if (index - m_read_index.load(std::memory_order_acquire) >= QUEUE_SIZE)
+    {
+      m_writer_event.Set();
+      std::this_thread::yield();
+      index = m_write_index.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (m_write_index.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel))
+      break;
+  }
+
+  QueueEntry& entry = m_queue[index & (QUEUE_SIZE - 1)];
+  entry.level = level;
+  strncpy(entry.msg, msg.c_str(), QUEUE_MSG_SIZE - 1);
+  entry.msg[QUEUE_MSG_SIZE - 1] = '\0';
+  entry.ready.store(true, std::memory_order_release);
+  m_writer_event.Set();
 }
 
 LogTypes::LOG_LEVELS LogManager::GetLogLevel() const
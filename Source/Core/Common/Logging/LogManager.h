@@ -5,9 +5,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <thread>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 
 // pure virtual interface
@@ -62,9 +66,24 @@ private:
     bool m_enable = false;
   };
 
+  // Messages are formatted on the logging thread, then handed to a bounded
+  // MPSC ring drained by a dedicated writer thread, so the file/console
+  // writes never stall emulation. Must be a power of two.
+  static constexpr size_t QUEUE_SIZE = 256;
+  static constexpr size_t QUEUE_MSG_SIZE = 1280;
+
+  struct QueueEntry
+  {
+    std::atomic<bool> ready{false};
+    LogTypes::LOG_LEVELS level;
+    char msg[QUEUE_MSG_SIZE];
+  };
+
   LogManager();
   ~LogManager();
 
+  void WriterThread();
+
   LogManager(const LogManager&) = delete;
   LogManager& operator=(const LogManager&) = delete;
   LogManager(LogManager&&) = delete;
@@ -75,4 +94,11 @@ private:
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  std::array<QueueEntry, QUEUE_SIZE> m_queue;
+  std::atomic<u64> m_write_index{0};
+  std::atomic<u64> m_read_index{0};  // only advanced by the writer thread
+  std::thread m_writer_thread;
+  Common::Event m_writer_event;
+  std::atomic<bool> m_writer_shutdown{false};
 };
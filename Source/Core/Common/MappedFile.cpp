@@ -0,0 +1,100 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Common
+{
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path)
+{
+  std::unique_ptr<MappedFile> mapping(new MappedFile());
+
+#ifdef _WIN32
+  HANDLE file = CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return nullptr;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  HANDLE file_mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!file_mapping)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  const void* data = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    CloseHandle(file_mapping);
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  mapping->m_file_handle = file;
+  mapping->m_mapping_handle = file_mapping;
+  mapping->m_data = static_cast<const u8*>(data);
+  mapping->m_size = static_cast<u64>(size.QuadPart);
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  mapping->m_fd = fd;
+  mapping->m_data = static_cast<const u8*>(data);
+  mapping->m_size = static_cast<u64>(info.st_size);
+#endif
+
+  return mapping;
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping_handle)
+    CloseHandle(m_mapping_handle);
+  if (m_file_handle)
+    CloseHandle(m_file_handle);
+#else
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), static_cast<size_t>(m_size));
+  if (m_fd >= 0)
+    close(m_fd);
+#endif
+}
+
+}  // namespace Common
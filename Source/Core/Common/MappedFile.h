@@ -0,0 +1,48 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Read-only shared mapping of a file. All processes mapping the same file
+// share one set of physical pages through the page cache, so resources every
+// instance opens (disc images, texture packs) are only resident once per
+// machine, no matter how many emulator instances are running.
+class MappedFile
+{
+public:
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Returns nullptr if the file cannot be opened or mapped (missing, empty,
+  // or out of address space); callers are expected to fall back to buffered
+  // reads in that case.
+  static std::unique_ptr<MappedFile> Open(const std::string& path);
+
+  const u8* Data() const { return m_data; }
+  u64 Size() const { return m_size; }
+
+private:
+  MappedFile() = default;
+
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+
+#ifdef _WIN32
+  void* m_file_handle = nullptr;
+  void* m_mapping_handle = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+
+}  // namespace Common
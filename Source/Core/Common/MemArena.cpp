@@ -52,8 +52,9 @@ static int AshmemCreateFileMapping(const char* name, size_t size)
 }
 #endif
 
-void MemArena::GrabSHMSegment(size_t size)
+void MemArena::GrabSHMSegment(size_t size, bool hugepages)
 {
+  use_hugepages = hugepages;
 #ifdef _WIN32
   const std::string name = "dolphin-emu." + std::to_string(GetCurrentProcessId());
   hMemoryMapping = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
@@ -104,6 +105,12 @@ void* MemArena::CreateView(s64 offset, size_t size, void* base)
   }
   else
   {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Transparent huge pages for shmem are advisory; on kernels or mounts
+    // without support this just fails and the view keeps 4KB pages.
+    if (use_hugepages && madvise(retval, size, MADV_HUGEPAGE) != 0)
+      INFO_LOG(MEMMAP, "madvise(MADV_HUGEPAGE) not honored: %s", strerror(errno));
+#endif
     return retval;
   }
 #endif
@@ -20,7 +20,12 @@
 class MemArena
 {
 public:
-  void GrabSHMSegment(size_t size);
+  // hugepages asks the kernel to back the views with 2MB pages to cut dTLB
+  // pressure on the guest memory fast paths. Advisory only: the views are
+  // mapped at arbitrary 4KB offsets for the memory mirrors, so explicit
+  // hugetlb segments can't be used and the request falls back to 4KB pages
+  // wherever the kernel can't honor it.
+  void GrabSHMSegment(size_t size, bool hugepages = false);
   void ReleaseSHMSegment();
   void* CreateView(s64 offset, size_t size, void* base = nullptr);
   void ReleaseView(void* view, size_t size);
@@ -34,4 +39,5 @@ private:
 #else
   int fd;
 #endif
+  bool use_hugepages = false;
 };
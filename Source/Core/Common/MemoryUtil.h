@@ -5,6 +5,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <string>
 
 namespace Common
@@ -74,6 +76,103 @@ private:
   size_t m_size;
 };
 
+// Bump allocator over a fixed page-backed region. An allocation is a pointer
+// increment and individual frees are no-ops; everything is reclaimed at once
+// by Reset(). Requests that do not fit fall back to the heap (handled by
+// ArenaAllocator below), so the arena size only needs to cover the common
+// case.
+class Arena
+{
+public:
+  explicit Arena(size_t size) : m_size(size)
+  {
+    m_base = static_cast<char*>(AllocateMemoryPages(size));
+    m_ptr = m_base;
+  }
+
+  ~Arena()
+  {
+    FreeMemoryPages(m_base, m_size);
+  }
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  void* Allocate(size_t bytes, size_t alignment)
+  {
+    uintptr_t ptr = (reinterpret_cast<uintptr_t>(m_ptr) + alignment - 1) & ~(alignment - 1);
+    if (ptr + bytes > reinterpret_cast<uintptr_t>(m_base) + m_size)
+      return nullptr;
+    m_ptr = reinterpret_cast<char*>(ptr + bytes);
+    return reinterpret_cast<void*>(ptr);
+  }
+
+  bool Owns(const void* ptr) const
+  {
+    return ptr >= m_base && ptr < m_base + m_size;
+  }
+
+  // Invalidates everything allocated from the arena.
+  void Reset()
+  {
+    m_ptr = m_base;
+  }
+
+private:
+  char* m_base;
+  char* m_ptr;
+  size_t m_size;
+};
+
+// STL-compatible adapter for Arena. Memory the arena could not serve comes
+// from the heap, so containers stay correct when the arena overflows;
+// deallocation only does work for those fallback allocations.
+template <typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+
+  explicit ArenaAllocator(Arena* arena) : m_arena(arena)
+  {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.m_arena)
+  {}
+
+  template <typename U>
+  struct rebind
+  {
+    typedef ArenaAllocator<U> other;
+  };
+
+  T* allocate(std::size_t n)
+  {
+    void* ptr = m_arena->Allocate(n * sizeof(T), alignof(T));
+    if (!ptr)
+      ptr = malloc(n * sizeof(T));
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* ptr, std::size_t)
+  {
+    if (!m_arena->Owns(ptr))
+      free(ptr);
+  }
+
+  bool operator==(const ArenaAllocator& other) const
+  {
+    return m_arena == other.m_arena;
+  }
+
+  bool operator!=(const ArenaAllocator& other) const
+  {
+    return !(*this == other);
+  }
+
+  Arena* m_arena;
+};
+
 template <typename T, std::size_t Alignment>
 class aligned_allocator
 {
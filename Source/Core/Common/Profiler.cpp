@@ -8,9 +8,14 @@
 #include <cstring>
 #include <iomanip>
 #include <ios>
+#include <memory>
 #include <sstream>
+#include <vector>
 
+#include "Common/File.h"
 #include "Common/Profiler.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
 namespace Common
@@ -161,4 +166,96 @@ std::string Profiler::Read()
 
   return buffer.str();
 }
+
+namespace Tracer
+{
+std::atomic<bool> g_capture_active{false};
+
+namespace
+{
+// ~1.5 MB per thread; a full buffer just drops events for the rest of the
+// capture instead of reallocating on a hot path.
+constexpr size_t EVENTS_PER_THREAD = 64 * 1024;
+
+struct ThreadBuffer
+{
+  int tid;
+  std::vector<Event> events;
+  // Written only by the owning thread; released so Stop() can read the
+  // events published before it.
+  std::atomic<size_t> count{0};
+};
+
+std::mutex s_buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+
+ThreadBuffer* GetThreadBuffer()
+{
+  static thread_local ThreadBuffer* tls_buffer = nullptr;
+  if (!tls_buffer)
+  {
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->tid = CurrentThreadId();
+    buffer->events.resize(EVENTS_PER_THREAD);
+    tls_buffer = buffer.get();
+
+    std::lock_guard<std::mutex> lk(s_buffers_mutex);
+    s_buffers.push_back(std::move(buffer));
+  }
+  return tls_buffer;
+}
+}  // Anonymous namespace
+
+void Start()
+{
+  std::lock_guard<std::mutex> lk(s_buffers_mutex);
+  for (auto& buffer : s_buffers)
+    buffer->count.store(0, std::memory_order_relaxed);
+  g_capture_active.store(true, std::memory_order_release);
+}
+
+bool Stop(const std::string& filename)
+{
+  g_capture_active.store(false, std::memory_order_release);
+
+  std::lock_guard<std::mutex> lk(s_buffers_mutex);
+
+  std::string json = "{\"traceEvents\":[\n";
+  bool first = true;
+  for (const auto& buffer : s_buffers)
+  {
+    const size_t count = buffer->count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+    {
+      const Event& e = buffer->events[i];
+      json += StringFromFormat("%s{\"pid\":1,\"tid\":%d,\"ph\":\"X\",\"name\":\"%s\","
+                               "\"ts\":%llu,\"dur\":%llu}",
+                               first ? "" : ",\n", buffer->tid, e.name,
+                               static_cast<unsigned long long>(e.begin_us),
+                               static_cast<unsigned long long>(e.end_us - e.begin_us));
+      first = false;
+    }
+  }
+  json += "\n]}\n";
+
+  if (first)
+    return false;
+
+  File::IOFile file(filename, "wb");
+  return file.IsOpen() && file.WriteBytes(json.data(), json.size());
+}
+
+void RecordEvent(const char* name, u64 begin_us, u64 end_us)
+{
+  // Scopes that were already open when Stop() ran may still get here; their
+  // events land in the buffer but are ignored until the next Start() resets
+  // the count, so there is nothing to filter.
+  ThreadBuffer* buffer = GetThreadBuffer();
+  const size_t index = buffer->count.load(std::memory_order_relaxed);
+  if (index >= buffer->events.size())
+    return;
+  buffer->events[index] = Event{name, begin_us, end_us};
+  buffer->count.store(index + 1, std::memory_order_release);
+}
+}
 }
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <string>
 
 #include "CommonTypes.h"
+#include "Timer.h"
 
 namespace Common
 {
@@ -54,9 +56,58 @@ public:
 private:
   Profiler* m_p;
 };
+
+// Scoped tracing with per-thread event buffers and chrome://tracing export.
+// Unlike Profiler above this is safe to use from any thread: each thread
+// records into its own fixed-size buffer, so no lock is taken while a capture
+// is running (only on a thread's first event and in Start/Stop). When no
+// capture is active a trace scope costs a single relaxed atomic load.
+namespace Tracer
+{
+struct Event
+{
+  const char* name;
+  u64 begin_us;
+  u64 end_us;
+};
+
+// Starts capturing. Per-thread buffers are cleared; once a buffer fills up,
+// further events on that thread are dropped until the next capture.
+void Start();
+// Stops capturing and writes the captured window in the Chrome trace event
+// JSON format (open with chrome://tracing or ui.perfetto.dev).
+// Returns false if no event was captured or the file could not be written.
+bool Stop(const std::string& filename);
+
+extern std::atomic<bool> g_capture_active;
+void RecordEvent(const char* name, u64 begin_us, u64 end_us);
+
+class Scope
+{
+public:
+  explicit Scope(const char* name) : m_name(name)
+  {
+    if (g_capture_active.load(std::memory_order_relaxed))
+      m_begin_us = Common::Timer::GetTimeUs();
+  }
+  ~Scope()
+  {
+    if (m_begin_us != 0)
+      RecordEvent(m_name, m_begin_us, Common::Timer::GetTimeUs());
+  }
+
+private:
+  const char* m_name;
+  u64 m_begin_us = 0;
+};
+};
 };
 
 // Warning: This profiler isn't thread safe. Only profile functions which doesn't run simultaneously
 #define PROFILE(name)                                                                              \
   static Common::Profiler prof_gen(name);                                                          \
   Common::ProfilerExecuter prof_e(&prof_gen);
+
+// Records the enclosing scope as a trace event while a Tracer capture is
+// active. The name must have static storage duration (normally a literal).
+#define TRACE_EVENT(name) Common::Tracer::Scope trace_scope_(name);
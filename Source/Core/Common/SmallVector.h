@@ -0,0 +1,139 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Common
+{
+// Vector with inline storage for the first N elements; only spills to the
+// heap when it grows past that. Intended for hot paths where the typical
+// element count is small and known, so the common case does no allocation
+// and stays on the owner's cache lines.
+template <typename T, size_t N>
+class SmallVector
+{
+public:
+  SmallVector() = default;
+
+  SmallVector(const SmallVector& other)
+  {
+    reserve(other.m_size);
+    for (size_t i = 0; i < other.m_size; ++i)
+      new (data() + i) T(other.data()[i]);
+    m_size = other.m_size;
+  }
+
+  SmallVector(SmallVector&& other)
+  {
+    reserve(other.m_size);
+    for (size_t i = 0; i < other.m_size; ++i)
+      new (data() + i) T(std::move(other.data()[i]));
+    m_size = other.m_size;
+    other.clear();
+  }
+
+  SmallVector& operator=(const SmallVector& other)
+  {
+    if (this != &other)
+    {
+      clear();
+      reserve(other.m_size);
+      for (size_t i = 0; i < other.m_size; ++i)
+        new (data() + i) T(other.data()[i]);
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other)
+  {
+    if (this != &other)
+    {
+      clear();
+      reserve(other.m_size);
+      for (size_t i = 0; i < other.m_size; ++i)
+        new (data() + i) T(std::move(other.data()[i]));
+      m_size = other.m_size;
+      other.clear();
+    }
+    return *this;
+  }
+
+  ~SmallVector()
+  {
+    clear();
+    if (m_heap)
+      ::operator delete(m_heap);
+  }
+
+  void push_back(const T& value)
+  {
+    emplace_back(value);
+  }
+
+  void push_back(T&& value)
+  {
+    emplace_back(std::move(value));
+  }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args)
+  {
+    if (m_size == m_capacity)
+      reserve(m_capacity * 2);
+    T* slot = new (data() + m_size) T(std::forward<Args>(args)...);
+    m_size++;
+    return *slot;
+  }
+
+  void reserve(size_t capacity)
+  {
+    if (capacity <= m_capacity)
+      return;
+    T* storage = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    for (size_t i = 0; i < m_size; ++i)
+    {
+      new (storage + i) T(std::move(data()[i]));
+      data()[i].~T();
+    }
+    if (m_heap)
+      ::operator delete(m_heap);
+    m_heap = storage;
+    m_capacity = capacity;
+  }
+
+  void clear()
+  {
+    for (size_t i = 0; i < m_size; ++i)
+      data()[i].~T();
+    m_size = 0;
+  }
+
+  T* data() { return m_heap ? m_heap : reinterpret_cast<T*>(&m_inline); }
+  const T* data() const { return m_heap ? m_heap : reinterpret_cast<const T*>(&m_inline); }
+
+  T* begin() { return data(); }
+  T* end() { return data() + m_size; }
+  const T* begin() const { return data(); }
+  const T* end() const { return data() + m_size; }
+
+  T& operator[](size_t index) { return data()[index]; }
+  const T& operator[](size_t index) const { return data()[index]; }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+private:
+  typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type m_inline;
+  T* m_heap = nullptr;
+  size_t m_size = 0;
+  size_t m_capacity = N;
+};
+}  // namespace Common
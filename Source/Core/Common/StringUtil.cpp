@@ -95,7 +95,18 @@ bool AsciiToHex(const std::string& _szValue, u32& result)
   return true;
 }
 
-bool CharArrayFromFormatV(char* out, int outsize, const char* format, va_list args)
+#ifdef _WIN32
+static _locale_t GetCLocaleWin32()
+{
+  static _locale_t c_locale = _create_locale(LC_ALL, "C");
+  return c_locale;
+}
+#endif
+
+// Locale-independent vsnprintf, shared by the formatting helpers below.
+// Returns what the underlying vsnprintf returns; note that on Windows that
+// is -1 on truncation rather than the required length.
+static int VSNPrintfCLocale(char* out, int outsize, const char* format, va_list args)
 {
   int writtenCount;
 
@@ -123,10 +134,7 @@ bool CharArrayFromFormatV(char* out, int outsize, const char* format, va_list ar
   // will be present in the middle of a multibyte sequence.
   //
   // This is why we look up the default C locale here and use _vsnprintf_l.
-  static _locale_t c_locale = nullptr;
-  if (!c_locale)
-    c_locale = _create_locale(LC_ALL, "C");
-  writtenCount = _vsnprintf_l(out, outsize, format, c_locale, args);
+  writtenCount = _vsnprintf_l(out, outsize, format, GetCLocaleWin32(), args);
 #else
 #if !defined(ANDROID) && !defined(__HAIKU__) && !defined(__OpenBSD__)
   locale_t previousLocale = uselocale(GetCLocale());
@@ -137,6 +145,13 @@ bool CharArrayFromFormatV(char* out, int outsize, const char* format, va_list ar
 #endif
 #endif
 
+  return writtenCount;
+}
+
+bool CharArrayFromFormatV(char* out, int outsize, const char* format, va_list args)
+{
+  const int writtenCount = VSNPrintfCLocale(out, outsize, format, args);
+
   if (writtenCount > 0 && writtenCount < outsize)
   {
     out[writtenCount] = '\0';
@@ -188,6 +203,41 @@ std::string StringFromFormatV(const char* format, va_list args)
   return temp;
 }
 
+void StringAppendFormatV(std::string& str, const char* format, va_list args)
+{
+  // Most callers (the shader generators above all) append many small
+  // fragments into a string with preallocated capacity. Format into a stack
+  // buffer and memcpy into that capacity, so the common case does not touch
+  // the heap at all; StringFromFormatV allocates twice per call.
+  char stack_buf[2048];
+  va_list args_copy;
+  va_copy(args_copy, args);
+  const int written = VSNPrintfCLocale(stack_buf, sizeof(stack_buf), format, args_copy);
+  va_end(args_copy);
+
+  if (written >= 0 && written < static_cast<int>(sizeof(stack_buf)))
+  {
+    str.append(stack_buf, written);
+    return;
+  }
+
+  // Didn't fit (or, on Windows, got truncated): measure, then format
+  // directly into the string's storage.
+#ifdef _WIN32
+  va_copy(args_copy, args);
+  const int required = _vscprintf_l(format, GetCLocaleWin32(), args_copy);
+  va_end(args_copy);
+#else
+  const int required = written;  // vsnprintf already reported the full length.
+#endif
+  if (required < 0)
+    return;
+
+  const size_t used = str.size();
+  str.resize(used + required);
+  VSNPrintfCLocale(&str[used], required + 1, format, args);
+}
+
 // For Debugging. Read out an u8 array.
 std::string ArrayToString(const u8* data, u32 size, int line_len, bool spaces)
 {
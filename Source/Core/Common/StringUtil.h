@@ -15,6 +15,10 @@
 
 std::string StringFromFormatV(const char* format, va_list args);
 
+// Appends the formatted output to str, without the temporary string (and its
+// heap round trip) that StringFromFormatV costs per call.
+void StringAppendFormatV(std::string& str, const char* format, va_list args);
+
 std::string StringFromFormat(const char* format, ...)
 #if !defined _WIN32
     // On compilers that support function attributes, this gives StringFromFormat
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cstring>
 #include <map>
 #include <string>
@@ -41,6 +42,56 @@ void SymbolDB::Clear(const char* prefix)
   // TODO: honor prefix
   functions.clear();
   checksumToFunction.clear();
+  m_addr_index.clear();
+  MarkAddrIndexDirty();
+}
+
+Symbol* SymbolDB::LookupByAddr(u32 addr)
+{
+  // One-entry MRU: the profiler resolves the same function many times in a
+  // row, and each thread gets its own slot so the JIT and debugger threads
+  // don't evict each other. The generation check drops the entry after any
+  // mutation, so it can never hand out a pointer into a cleared map.
+  struct MRUEntry
+  {
+    const SymbolDB* db;
+    u32 generation;
+    Symbol* symbol;
+  };
+  static thread_local MRUEntry mru = {};
+
+  if (mru.db == this && mru.generation == m_addr_index_generation &&
+      addr >= mru.symbol->address &&
+      (addr == mru.symbol->address || addr < mru.symbol->address + mru.symbol->size))
+  {
+    return mru.symbol;
+  }
+
+  if (m_addr_index_dirty)
+  {
+    m_addr_index.clear();
+    m_addr_index.reserve(functions.size());
+    for (auto& func : functions)
+    {
+      m_addr_index.push_back(
+          {func.second.address, func.second.address + func.second.size, &func.second});
+    }
+    m_addr_index_dirty = false;
+  }
+
+  // Last entry starting at or before addr.
+  auto it = std::upper_bound(m_addr_index.begin(), m_addr_index.end(), addr,
+                             [](u32 a, const AddrIndexEntry& entry) { return a < entry.address; });
+  if (it == m_addr_index.begin())
+    return nullptr;
+  --it;
+  // An exact hit counts even for zero-sized (data) symbols, matching the map
+  // walk this replaces.
+  if (addr != it->address && addr >= it->end)
+    return nullptr;
+
+  mru = {this, m_addr_index_generation, it->symbol};
+  return it->symbol;
 }
 
 void SymbolDB::Index()
@@ -98,4 +149,5 @@ std::vector<Symbol*> SymbolDB::GetSymbolsFromHash(u32 hash)
 void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
   functions.emplace(symbol.address, symbol);
+  MarkAddrIndexDirty();
 }
@@ -66,6 +66,24 @@ protected:
   XFuncMap functions;
   XFuncPtrMap checksumToFunction;
 
+  // Flat (address, end, symbol) view of `functions`, sorted by address, so
+  // hot diagnostic paths (JIT profiler, JitRegister, debugger views) can
+  // binary-search instead of walking the map's tree per lookup. Rebuilt
+  // lazily on the next lookup after a mutation; the generation counter also
+  // invalidates the per-thread MRU entry in LookupByAddr.
+  struct AddrIndexEntry
+  {
+    u32 address;
+    u32 end;
+    Symbol* symbol;
+  };
+  Symbol* LookupByAddr(u32 addr);
+  void MarkAddrIndexDirty()
+  {
+    m_addr_index_dirty = true;
+    m_addr_index_generation++;
+  }
+
 public:
   SymbolDB() {}
   virtual ~SymbolDB() {}
@@ -79,8 +97,18 @@ public:
   std::vector<Symbol*> GetSymbolsFromHash(u32 hash);
 
   const XFuncMap& Symbols() const { return functions; }
-  XFuncMap& AccessSymbols() { return functions; }
+  XFuncMap& AccessSymbols()
+  {
+    // Callers get mutable access, so assume they change something.
+    MarkAddrIndexDirty();
+    return functions;
+  }
   void Clear(const char* prefix = "");
   void List();
   void Index();
+
+private:
+  std::vector<AddrIndexEntry> m_addr_index;
+  u32 m_addr_index_generation = 0;
+  bool m_addr_index_dirty = true;
 };
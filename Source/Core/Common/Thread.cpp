@@ -3,6 +3,12 @@
 // Refer to the license.txt file included.
 
 #include "Common/Thread.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 
@@ -27,6 +33,14 @@
 
 namespace Common
 {
+inline int CountMaskBits(u32 mask)
+{
+  int count = 0;
+  for (; mask != 0; mask &= mask - 1)
+    count++;
+  return count;
+}
+
 int CurrentThreadId()
 {
 #ifdef _WIN32
@@ -50,6 +64,41 @@ void SetCurrentThreadAffinity(u32 mask)
   SetThreadAffinityMask(GetCurrentThread(), mask);
 }
 
+u32 GetSharedLLCAffinityMask()
+{
+  DWORD length = 0;
+  GetLogicalProcessorInformationEx(RelationCache, nullptr, &length);
+  if (GetLastError() != ERROR_INSUFFICIENT_BUFFER || length == 0)
+    return 0;
+
+  std::vector<u8> buffer(length);
+  auto* info = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+  if (!GetLogicalProcessorInformationEx(RelationCache, info, &length))
+    return 0;
+
+  u32 best_mask = 0;
+  int best_count = 0;
+  for (DWORD offset = 0; offset < length;)
+  {
+    const auto* entry =
+        reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+    // Our affinity masks are 32 bits wide, so only look at processor group 0.
+    if (entry->Relationship == RelationCache && entry->Cache.Level == 3 &&
+        entry->Cache.GroupMask.Group == 0)
+    {
+      const u32 mask = static_cast<u32>(entry->Cache.GroupMask.Mask);
+      const int count = CountMaskBits(mask);
+      if (count > best_count)
+      {
+        best_count = count;
+        best_mask = mask;
+      }
+    }
+    offset += entry->Size;
+  }
+  return best_mask;
+}
+
 // Supporting functions
 void SleepCurrentThread(int ms)
 {
@@ -119,6 +168,44 @@ void SetCurrentThreadAffinity(u32 mask)
   SetThreadAffinity(pthread_self(), mask);
 }
 
+u32 GetSharedLLCAffinityMask()
+{
+#if defined __linux__ && !(defined ANDROID)
+  // sysfs exports one L3 sharing mask per logical CPU; distinct masks
+  // correspond to distinct cache domains (CCDs on Ryzen). Pick the biggest.
+  u32 best_mask = 0;
+  int best_count = 0;
+  for (int cpu = 0; cpu < 32; ++cpu)
+  {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                       "/cache/index3/shared_cpu_map");
+    if (!file)
+      break;
+
+    std::string line;
+    if (!std::getline(file, line))
+      continue;
+
+    // The mask is printed as comma-separated 32 bit chunks, least
+    // significant chunk last; we only care about CPUs 0-31.
+    const size_t comma = line.rfind(',');
+    if (comma != std::string::npos)
+      line = line.substr(comma + 1);
+
+    const u32 mask = static_cast<u32>(strtoul(line.c_str(), nullptr, 16));
+    const int count = CountMaskBits(mask);
+    if (count > best_count)
+    {
+      best_count = count;
+      best_mask = mask;
+    }
+  }
+  return best_mask;
+#else
+  return 0;
+#endif
+}
+
 void SleepCurrentThread(int ms)
 {
   usleep(1000 * ms);
@@ -23,6 +23,12 @@ int CurrentThreadId();
 void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask);
 void SetCurrentThreadAffinity(u32 mask);
 
+// Returns the affinity mask of the largest group of logical CPUs sharing a
+// last-level cache, or 0 if the topology cannot be determined. On multi-die
+// CPUs (Ryzen CCXs and the like) keeping tightly coupled threads inside one
+// such group avoids cross-die cache traffic.
+u32 GetSharedLLCAffinityMask();
+
 void SleepCurrentThread(int ms);
 void SwitchCurrentThread();  // On Linux, this is equal to sleep 1ms
 
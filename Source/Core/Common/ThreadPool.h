@@ -39,6 +39,7 @@
 #include <utility>
 #include <vector>
 
+#include "Common/Common.h"
 #include "Common/Thread.h"
 
 namespace Common
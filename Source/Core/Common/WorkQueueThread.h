@@ -0,0 +1,89 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/Thread.h"
+
+// A thread that executes the given function for every item placed into its
+// queue.
+
+namespace Common
+{
+template <typename T>
+class WorkQueueThread
+{
+public:
+  WorkQueueThread() = default;
+  WorkQueueThread(std::function<void(T)> function) { Reset(std::move(function)); }
+  ~WorkQueueThread() { Shutdown(); }
+  void Reset(std::function<void(T)> function)
+  {
+    Shutdown();
+    m_shutdown.Clear();
+    m_function = std::move(function);
+    m_thread = std::thread(&WorkQueueThread::ThreadLoop, this);
+  }
+
+  template <typename... Args>
+  void EmplaceItem(Args&&... args)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_items.emplace(std::forward<Args>(args)...);
+    }
+    m_wakeup.Set();
+  }
+
+private:
+  void Shutdown()
+  {
+    if (m_thread.joinable())
+    {
+      m_shutdown.Set();
+      m_wakeup.Set();
+      m_thread.join();
+    }
+  }
+
+  void ThreadLoop()
+  {
+    Common::SetCurrentThreadName("WorkQueueThread");
+    while (true)
+    {
+      m_wakeup.Wait();
+
+      while (!m_shutdown.IsSet())
+      {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (m_items.empty())
+          break;
+        T item{std::move(m_items.front())};
+        m_items.pop();
+        lock.unlock();
+
+        m_function(std::move(item));
+      }
+
+      if (m_shutdown.IsSet())
+        break;
+    }
+  }
+
+  std::function<void(T)> m_function;
+  std::thread m_thread;
+  std::mutex m_lock;
+  std::queue<T> m_items;
+  Event m_wakeup;
+  Flag m_shutdown;
+};
+
+}  // namespace Common
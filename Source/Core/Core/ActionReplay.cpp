@@ -79,9 +79,26 @@ enum
                           SUB_MASTER_CODE = 0x03,
 };
 
+// A pre-decoded unconditional RAM write. Codes whose every op is a plain
+// write/fill (type 0x00, subtype SUB_RAM_WRITE) are compiled into a flat list
+// of these when they are activated and replayed each frame without re-decoding
+// anything. Genuinely dynamic codes (conditionals, pointer writes, add codes,
+// zero codes) still go through the interpreter.
+struct CompiledWrite
+{
+  u32 address;
+  u32 value;
+  u32 size;  // DATATYPE_*
+};
+
+// Fills with huge repeat counts stay in the interpreter so the compiled list
+// stays bounded.
+constexpr size_t MAX_COMPILED_WRITES_PER_CODE = 0x10000;
+
 // General lock. Protects codes list and internal log.
 static std::mutex s_lock;
 static std::vector<ARCode> s_active_codes;
+static std::vector<CompiledWrite> s_compiled_writes;
 static std::vector<std::string> s_internal_log;
 static std::atomic<bool> s_use_internal_log{ false };
 // pointer to the code currently being run, (used by log messages that include the code name)
@@ -107,6 +124,8 @@ struct ARAddr
   operator u32() const { return address; }
 };
 
+static bool TryCompileCodeLocked(const ARCode& code);
+
 // ----------------------
 // AR Remote Functions
 void ApplyCodes(const std::vector<ARCode>& codes)
@@ -119,7 +138,15 @@ void ApplyCodes(const std::vector<ARCode>& codes)
   s_active_codes.clear();
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
     [](const ARCode& code) { return code.active; });
+
+  // Codes made of nothing but plain writes don't need the interpreter; move
+  // them into the compiled write list and keep only dynamic codes around.
+  s_compiled_writes.clear();
+  s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
+    [](const ARCode& code) { return TryCompileCodeLocked(code); }),
+    s_active_codes.end());
   s_active_codes.shrink_to_fit();
+  s_compiled_writes.shrink_to_fit();
 }
 
 void AddCode(ARCode code)
@@ -131,7 +158,8 @@ void AddCode(ARCode code)
   {
     std::lock_guard<std::mutex> guard(s_lock);
     s_disable_logging = false;
-    s_active_codes.emplace_back(std::move(code));
+    if (!TryCompileCodeLocked(code))
+      s_active_codes.emplace_back(std::move(code));
   }
 }
 
@@ -316,6 +344,90 @@ bool IsSelfLogging()
   return s_use_internal_log.load(std::memory_order_relaxed);
 }
 
+// Requires s_lock. Appends to s_compiled_writes and returns true when every op
+// of the code is an unconditional RAM write/fill; such codes never branch and
+// never fail, so they don't need to be re-decoded every frame. Anything else
+// (zero codes, self-modification, conditionals, pointer writes, add codes,
+// master codes, invalid sizes) is left to the interpreter.
+static bool TryCompileCodeLocked(const ARCode& code)
+{
+  std::vector<CompiledWrite> writes;
+
+  for (const AREntry& entry : code.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+
+    if (0x0 == addr || (addr >= 0x00002000 && addr < 0x00003000))
+      return false;
+    if (addr.type != 0x00 || addr.subtype != SUB_RAM_WRITE)
+      return false;
+
+    const u32 new_addr = addr.GCAddress();
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+    {
+      const u32 repeat = data >> 8;
+      if (writes.size() + repeat + 1 > MAX_COMPILED_WRITES_PER_CODE)
+        return false;
+      for (u32 i = 0; i <= repeat; ++i)
+        writes.push_back({ new_addr + i, data & 0xFF, DATATYPE_8BIT });
+      break;
+    }
+
+    case DATATYPE_16BIT:
+    {
+      const u32 repeat = data >> 16;
+      if (writes.size() + repeat + 1 > MAX_COMPILED_WRITES_PER_CODE)
+        return false;
+      for (u32 i = 0; i <= repeat; ++i)
+        writes.push_back({ new_addr + i * 2, data & 0xFFFF, DATATYPE_16BIT });
+      break;
+    }
+
+    case DATATYPE_32BIT_FLOAT:
+    case DATATYPE_32BIT:
+      writes.push_back({ new_addr, data, DATATYPE_32BIT });
+      break;
+
+    default:
+      return false;
+    }
+  }
+
+  LogInfo("Compiled \"%s\" into %zu direct write(s)", code.name.c_str(), writes.size());
+  s_compiled_writes.insert(s_compiled_writes.end(), writes.begin(), writes.end());
+  return true;
+}
+
+// Requires s_lock. Replays the pre-decoded writes of the compiled codes.
+// Stores whose target already holds the value are skipped; that keeps codes
+// which patch instructions from invalidating the same JIT blocks every frame.
+static void RunCompiledWritesLocked()
+{
+  for (const CompiledWrite& write : s_compiled_writes)
+  {
+    switch (write.size)
+    {
+    case DATATYPE_8BIT:
+      if (PowerPC::HostRead_U8(write.address) != write.value)
+        PowerPC::HostWrite_U8(write.value, write.address);
+      break;
+
+    case DATATYPE_16BIT:
+      if (PowerPC::HostRead_U16(write.address) != write.value)
+        PowerPC::HostWrite_U16(write.value, write.address);
+      break;
+
+    default:
+      if (PowerPC::HostRead_U32(write.address) != write.value)
+        PowerPC::HostWrite_U32(write.value, write.address);
+      break;
+    }
+  }
+}
+
 // ----------------------
 // Code Functions
 static bool Subtype_RamWriteAndFill(const ARAddr& addr, const u32 data)
@@ -945,6 +1057,7 @@ void RunAllActive()
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard<std::mutex> guard(s_lock);
+  RunCompiledWritesLocked();
   s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
     [](const ARCode& code) {
     bool success = RunCodeLocked(code);
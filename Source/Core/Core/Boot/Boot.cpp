@@ -11,6 +11,7 @@
 #include <numeric>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -23,6 +24,7 @@
 #include "Common/Config/Config.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -72,7 +74,7 @@ BootParameters::GenerateFromFile(const std::string& path,
   std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
 
   static const std::unordered_set<std::string> disc_image_extensions = {
-    { ".gcm", ".iso", ".tgc", ".wbfs", ".ciso", ".gcz", ".dol", ".elf" } };
+    { ".gcm", ".iso", ".tgc", ".wbfs", ".ciso", ".gcz", ".lzb", ".dol", ".elf" } };
   if (disc_image_extensions.find(extension) != disc_image_extensions.end() || is_drive)
   {
     std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolumeFromFilename(path);
@@ -181,12 +183,37 @@ bool CBoot::LoadMapFromFilename()
 {
   std::string strMapFilename;
   bool found = FindMapFile(&strMapFilename, nullptr);
-  if (found && g_symbolDB.LoadMap(strMapFilename))
+  if (!found)
+    return false;
+
+  // Loading a map re-analyzes and checksums every function from emulated
+  // memory, which adds noticeable time to every boot. A binary index of the
+  // previous load is much cheaper, so try it first. The key hashes the map
+  // file itself, so an edited map takes the slow path once and the index is
+  // refreshed.
+  const std::string index_filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().m_debugger_game_id + ".sidx";
+  u64 map_hash = 0;
+  {
+    std::string map_data;
+    if (File::ReadFileToString(strMapFilename, map_data))
+      map_hash = GetHash64(reinterpret_cast<const u8*>(map_data.data()),
+                           static_cast<u32>(map_data.size()), 0);
+  }
+
+  if (g_symbolDB.LoadSymbolIndex(index_filename, map_hash))
   {
     UpdateDebugger_MapLoaded();
     return true;
   }
 
+  if (g_symbolDB.LoadMap(strMapFilename))
+  {
+    g_symbolDB.SaveSymbolIndex(index_filename, map_hash);
+    UpdateDebugger_MapLoaded();
+    return true;
+  }
+
   return false;
 }
 
@@ -330,11 +357,24 @@ bool CBoot::BootUp(std::unique_ptr<BootParameters> boot)
       if (!EmulatedBS2(config.bWii, *volume))
         return false;
 
+      // The host-side view of the disc - the parsed FST (used by FileMonitor
+      // on every emulated read) and the banner - is built lazily on first
+      // use, which lands its cost on boot-to-first-frame. Build it here on
+      // another thread, overlapped with the symbol map load below. The disc
+      // is exclusively ours for this window: the CPU (and with it the DVD
+      // thread's reads) only starts after BootUp returns, and we join first.
+      std::thread metadata_prefetch([volume] {
+        volume->GetFileSystem(volume->GetGamePartition());
+        int width, height;
+        volume->GetBanner(&width, &height);
+      });
+
       // Try to load the symbol map if there is one, and then scan it for
       // and eventually replace code
       if (LoadMapFromFilename())
         HLE::PatchFunctions();
 
+      metadata_prefetch.join();
       return true;
     }
 
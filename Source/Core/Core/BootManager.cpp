@@ -46,6 +46,7 @@
 #include "Core/HW/Sram.h"
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 #include "Core/Movie.h"
+#include "Core/PerfProfile.h"
 #include "Core/NetPlayProto.h"
 
 #include "DiscIO/Enums.h"
@@ -95,6 +96,8 @@ private:
   float m_EmulationSpeed;
   float m_OCFactor;
   bool m_OCEnable;
+  bool m_OCGovernorEnable;
+  float m_OCGovernorMinFactor;
   std::string strBackend;
   std::string sBackend;
   std::string m_strGPUDeterminismMode;
@@ -130,6 +133,8 @@ void ConfigCache::SaveConfig(const SConfig& config)
   bHalfAudioRate = config.bHalfAudioRate;
   m_OCFactor = config.m_OCFactor;
   m_OCEnable = config.m_OCEnable;
+  m_OCGovernorEnable = config.m_OCGovernorEnable;
+  m_OCGovernorMinFactor = config.m_OCGovernorMinFactor;
 
   std::copy(std::begin(g_wiimote_sources), std::end(g_wiimote_sources), std::begin(iWiimoteSource));
   std::copy(std::begin(config.m_SIDevice), std::end(config.m_SIDevice), std::begin(Pads));
@@ -203,6 +208,8 @@ void ConfigCache::RestoreConfig(SConfig* config)
   config->m_strGPUDeterminismMode = m_strGPUDeterminismMode;
   config->m_OCFactor = m_OCFactor;
   config->m_OCEnable = m_OCEnable;
+  config->m_OCGovernorEnable = m_OCGovernorEnable;
+  config->m_OCGovernorMinFactor = m_OCGovernorMinFactor;
   VideoBackendBase::ActivateBackend(config->m_strVideoBackend);
 }
 
@@ -277,6 +284,10 @@ bool BootCore(std::unique_ptr<BootParameters> boot)
       StartUp.m_strGPUDeterminismMode);
     core_section->Get("Overclock", &StartUp.m_OCFactor, StartUp.m_OCFactor);
     core_section->Get("OverclockEnable", &StartUp.m_OCEnable, StartUp.m_OCEnable);
+    core_section->Get("OverclockGovernor", &StartUp.m_OCGovernorEnable,
+      StartUp.m_OCGovernorEnable);
+    core_section->Get("OverclockGovernorMinClock", &StartUp.m_OCGovernorMinFactor,
+      StartUp.m_OCGovernorMinFactor);
 
     for (unsigned int i = 0; i < SerialInterface::MAX_SI_CHANNELS; ++i)
     {
@@ -315,6 +326,10 @@ bool BootCore(std::unique_ptr<BootParameters> boot)
     }
   }
 
+  // Layer the recorded performance envelope (if any) for this title and host
+  // on top of the game INI settings.
+  PerfProfile::ApplyBootProfile(StartUp);
+
   StartUp.m_GPUDeterminismMode = ParseGPUDeterminismMode(StartUp.m_strGPUDeterminismMode);
 
   // Movie settings
@@ -25,7 +25,9 @@ extern const ConfigInfo<int> GFX_SUGGESTED_ASPECT_RATIO;
 extern const ConfigInfo<bool> GFX_CROP;
 extern const ConfigInfo<bool> GFX_USE_XFB;
 extern const ConfigInfo<bool> GFX_USE_REAL_XFB;
+extern const ConfigInfo<bool> GFX_PRESENT_SKIP_GOVERNOR;
 extern const ConfigInfo<int> GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES;
+extern const ConfigInfo<int> GFX_TEXTURE_CACHE_MEMORY_BUDGET_MB;
 extern const ConfigInfo<bool> GFX_SHOW_FPS;
 extern const ConfigInfo<bool> GFX_SHOW_NETPLAY_PING;
 extern const ConfigInfo<bool> GFX_SHOW_NETPLAY_MESSAGES;
@@ -33,6 +35,7 @@ extern const ConfigInfo<bool> GFX_LOG_RENDER_TIME_TO_FILE;
 extern const ConfigInfo<bool> GFX_OVERLAY_STATS;
 extern const ConfigInfo<bool> GFX_OVERLAY_PROJ_STATS;
 extern const ConfigInfo<bool> GFX_DUMP_TEXTURES;
+extern const ConfigInfo<bool> GFX_DUMP_VERTEX_LOADERS;
 extern const ConfigInfo<bool> GFX_HIRES_TEXTURES;
 extern const ConfigInfo<bool> GFX_HIRES_MATERIAL_MAPS;
 extern const ConfigInfo<bool> GFX_HIRES_MATERIAL_MAPS_BUILD;
@@ -150,6 +150,7 @@ void SConfig::SaveGeneralSettings(IniFile& ini)
 #endif
   general->Set("GDBPort", iGDBPort);
 #endif
+  general->Set("PerfServerPort", iPerfServerPort);
 }
 
 void SConfig::SaveInterfaceSettings(IniFile& ini)
@@ -239,7 +240,11 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   core->Set("TimingVariance", iTimingVariance);
   core->Set("CPUCore", iCPUCore);
   core->Set("Fastmem", bFastmem);
+  core->Set("JITBackgroundCompilation", bJITBackgroundCompilation);
+  core->Set("HugePages", bHugePages);
   core->Set("CPUThread", bCPUThread);
+  core->Set("AffinityPinning", bAffinityPinning);
+  core->Set("AffinityPinningMask", iAffinityPinningMask);
   core->Set("DSPHLE", bDSPHLE);
   core->Set("SyncOnSkipIdle", bSyncGPUOnSkipIdleHack);
   core->Set("SyncGPU", bSyncGPU);
@@ -256,6 +261,7 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   core->Set("AudioLatency", iLatency);
   core->Set("AudioStretch", m_audio_stretch);
   core->Set("AudioStretchMaxLatency", m_audio_stretch_max_latency);
+  core->Set("AudioHQResampler", m_audio_hq_resampler);
   core->Set("MemcardAPath", m_strMemoryCardA);
   core->Set("MemcardBPath", m_strMemoryCardB);
   core->Set("AgpCartAPath", m_strGbaCartA);
@@ -279,6 +285,11 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   core->Set("EmulationSpeed", m_EmulationSpeed);
   core->Set("FrameSkip", m_FrameSkip);
   core->Set("Overclock", m_OCFactor);
+  core->Set("OverclockGovernor", m_OCGovernorEnable);
+  core->Set("OverclockGovernorMinClock", m_OCGovernorMinFactor);
+  core->Set("PerfProfileApply", m_PerfProfileApply);
+  core->Set("PerfProfileRecord", m_PerfProfileRecord);
+  core->Set("JitCacheDumpOnStall", m_JitCacheDumpOnStall);
   core->Set("OverclockEnable", m_OCEnable);
   core->Set("GFXBackend", m_strVideoBackend);
   core->Set("GPUDeterminismMode", m_strGPUDeterminismMode);
@@ -298,6 +309,8 @@ void SConfig::SaveMovieSettings(IniFile& ini)
   movie->Set("DumpFramesSilent", m_DumpFramesSilent);
   movie->Set("ShowInputDisplay", m_ShowInputDisplay);
   movie->Set("ShowRTC", m_ShowRTC);
+  movie->Set("DeterminismAudit", m_DeterminismAudit);
+  movie->Set("DeterminismAuditInterval", m_DeterminismAuditInterval);
 }
 
 void SConfig::SaveDSPSettings(IniFile& ini)
@@ -415,6 +428,7 @@ void SConfig::LoadGeneralSettings(IniFile& ini)
 #endif
   general->Get("GDBPort", &(iGDBPort), -1);
 #endif
+  general->Get("PerfServerPort", &iPerfServerPort, -1);
 
   m_ISOFolder.clear();
   int numISOPaths;
@@ -533,9 +547,13 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("CPUCore", &iCPUCore, PowerPC::CORE_INTERPRETER);
 #endif
   core->Get("Fastmem", &bFastmem, true);
+  core->Get("JITBackgroundCompilation", &bJITBackgroundCompilation, false);
+  core->Get("HugePages", &bHugePages, false);
   core->Get("DSPHLE", &bDSPHLE, true);
   core->Get("TimingVariance", &iTimingVariance, 40);
   core->Get("CPUThread", &bCPUThread, true);
+  core->Get("AffinityPinning", &bAffinityPinning, false);
+  core->Get("AffinityPinningMask", &iAffinityPinningMask, 0);
   core->Get("SyncOnSkipIdle", &bSyncGPUOnSkipIdleHack, true);
   core->Get("DefaultISO", &m_strDefaultISO);
   core->Get("EnableCheats", &bEnableCheats, false);
@@ -545,6 +563,7 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("AudioLatency", &iLatency, 20);
   core->Get("AudioStretch", &m_audio_stretch, false);
   core->Get("AudioStretchMaxLatency", &m_audio_stretch_max_latency, 80);
+  core->Get("AudioHQResampler", &m_audio_hq_resampler, false);
   core->Get("MemcardAPath", &m_strMemoryCardA);
   core->Get("MemcardBPath", &m_strMemoryCardB);
   core->Get("AgpCartAPath", &m_strGbaCartA);
@@ -579,6 +598,11 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("AccurateNaNs", &bAccurateNaNs, false);
   core->Get("EmulationSpeed", &m_EmulationSpeed, 1.0f);
   core->Get("Overclock", &m_OCFactor, 1.0f);
+  core->Get("OverclockGovernor", &m_OCGovernorEnable, false);
+  core->Get("OverclockGovernorMinClock", &m_OCGovernorMinFactor, 0.85f);
+  core->Get("PerfProfileApply", &m_PerfProfileApply, true);
+  core->Get("PerfProfileRecord", &m_PerfProfileRecord, false);
+  core->Get("JitCacheDumpOnStall", &m_JitCacheDumpOnStall, false);
   core->Get("OverclockEnable", &m_OCEnable, false);
   core->Get("FrameSkip", &m_FrameSkip, 0);
   core->Get("GFXBackend", &m_strVideoBackend, "");
@@ -600,6 +624,8 @@ void SConfig::LoadMovieSettings(IniFile& ini)
   movie->Get("DumpFramesSilent", &m_DumpFramesSilent, false);
   movie->Get("ShowInputDisplay", &m_ShowInputDisplay, false);
   movie->Get("ShowRTC", &m_ShowRTC, false);
+  movie->Get("DeterminismAudit", &m_DeterminismAudit, false);
+  movie->Get("DeterminismAuditInterval", &m_DeterminismAuditInterval, 60);
 }
 
 void SConfig::LoadDSPSettings(IniFile& ini)
@@ -780,10 +806,13 @@ void SConfig::LoadDefaults()
   gdb_socket = "";
 #endif
 #endif
+  iPerfServerPort = -1;
 
   iCPUCore = PowerPC::DefaultCPUCore();
   iTimingVariance = 40;
   bCPUThread = false;
+  bAffinityPinning = false;
+  iAffinityPinningMask = 0;
   bSyncGPUOnSkipIdleHack = true;
   bRunCompareServer = false;
   bDSPHLE = true;
@@ -809,6 +838,7 @@ void SConfig::LoadDefaults()
   iLatency = 20;
   m_audio_stretch = false;
   m_audio_stretch_max_latency = 80;
+  m_audio_hq_resampler = false;
 
   iPosX = INT_MIN;
   iPosY = INT_MIN;
@@ -65,6 +65,8 @@ struct SConfig
 
   // Settings
   bool bEnableDebugging = false;
+  // Guest function profile server (Profiler::StartServer); <= 0 disables it.
+  int iPerfServerPort;
 #ifdef USE_GDBSTUB
   int iGDBPort;
 #ifndef _WIN32
@@ -78,6 +80,12 @@ struct SConfig
 
   bool bJITNoBlockCache = false;
   bool bJITNoBlockLinking = false;
+  // Compile cold blocks on a background thread while the CPU thread runs them
+  // through the interpreter (experimental, Jit64 only).
+  bool bJITBackgroundCompilation = false;
+  // Ask the kernel for huge-page backing of the emulated memory arena to
+  // reduce dTLB pressure (advisory, Linux only).
+  bool bHugePages = false;
   bool bJITOff = false;
   bool bJITLoadStoreOff = false;
   bool bJITLoadStorelXzOff = false;
@@ -97,6 +105,10 @@ struct SConfig
 
   int iTimingVariance = 40;  // in milli secounds
   bool bCPUThread = true;
+  // Pin the CPU and GPU threads to one shared-L3 cache domain, so the fifo
+  // handoff does not cross a CCX/die boundary on multi-die CPUs.
+  bool bAffinityPinning = false;
+  int iAffinityPinningMask = 0;  // explicit mask override; 0 = autodetect
   bool bDSPThread = false;
   bool bDSPHLE = true;
   bool bSyncGPUOnSkipIdleHack = true;
@@ -109,6 +121,7 @@ struct SConfig
   int iLatency = 20;
   bool m_audio_stretch = false;
   int m_audio_stretch_max_latency = 80;
+  bool m_audio_hq_resampler = false;
 
   bool bRunCompareServer = false;
   bool bRunCompareClient = false;
@@ -237,6 +250,16 @@ struct SConfig
   float m_EmulationSpeed;
   bool m_OCEnable;
   float m_OCFactor;
+  // Adaptive clock governor: underclock within [m_OCGovernorMinFactor, 1.0]
+  // of the (possibly overclocked) clock whenever full speed cannot be held.
+  // See SystemTimers::GetAdaptiveClockFactor().
+  bool m_OCGovernorEnable;
+  float m_OCGovernorMinFactor;
+  // Per-title performance profiles, see Core/PerfProfile.h.
+  bool m_PerfProfileApply;
+  bool m_PerfProfileRecord;
+  // Dump the JIT cache on sustained stalls, see Core/PowerPC/JitCacheDump.h.
+  bool m_JitCacheDumpOnStall;
   // other interface settings
   bool m_InterfaceToolbar;
   bool m_InterfaceStatusbar;
@@ -290,6 +313,8 @@ struct SConfig
   bool m_DumpFrames;
   bool m_DumpFramesSilent;
   bool m_ShowInputDisplay;
+  bool m_DeterminismAudit;
+  int m_DeterminismAuditInterval;  // in input polls
 
   bool m_PauseOnFocusLost;
 
@@ -4,6 +4,7 @@
 
 #include "Core/Core.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 #include <locale>
@@ -36,6 +37,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
+#include "Core/Hooks.h"
 #include "Core/Host.h"
 #include "Core/MemTools.h"
 #ifdef USE_MEMORYWATCHER
@@ -58,8 +60,11 @@
 #include "Core/NetPlayClient.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PatchEngine.h"
+#include "Core/PerfProfile.h"
+#include "Core/PowerPC/JitCacheDump.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/Profiler.h"
 #include "Core/State.h"
 #include "Core/WiiRoot.h"
 
@@ -74,6 +79,7 @@
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoConfig.h"
 
 // Android and OSX haven't implemented the keyword yet.
 #if defined __ANDROID__ || defined __APPLE__
@@ -104,6 +110,13 @@ static bool s_request_refresh_info = false;
 static bool s_is_throttler_temp_disabled = false;
 static bool s_frame_step = false;
 
+// Frame pacing: running average of the interval between presented frames
+// (written on the GPU thread) and the resulting throttle micro-adjustment
+// used to phase-lock the guest VI rate to the host display.
+static u64 s_last_present_time_us = 0;  // GPU thread only
+static std::atomic<float> s_avg_present_interval_us{0.0f};
+static std::atomic<float> s_pacing_adjustment{1.0f};
+
 struct HostJob
 {
   std::function<void()> job;
@@ -125,6 +138,11 @@ static void InitIsCPUKey()
 
 static void EmuThread(std::unique_ptr<BootParameters> boot);
 
+float GetPacingAdjustment()
+{
+  return s_pacing_adjustment.load(std::memory_order_relaxed);
+}
+
 bool GetIsThrottlerTempDisabled()
 {
   return s_is_throttler_temp_disabled;
@@ -328,6 +346,23 @@ static void CPUSetInitialExecutionState()
   });
 }
 
+// Pins the calling emulation thread to one shared-L3 cache domain when
+// affinity pinning is enabled, so the fifo handoff between the CPU and GPU
+// threads does not cross a CCX/die boundary on multi-die CPUs. An explicit
+// mask from the config wins over the detected topology.
+static void ApplyAffinityPinning()
+{
+  const SConfig& param = SConfig::GetInstance();
+  if (!param.bAffinityPinning)
+    return;
+
+  u32 mask = static_cast<u32>(param.iAffinityPinningMask);
+  if (mask == 0)
+    mask = Common::GetSharedLLCAffinityMask();
+  if (mask != 0)
+    Common::SetCurrentThreadAffinity(mask);
+}
+
 // Create the CPU thread, which is a CPU + Video thread in Single Core mode.
 static void CpuThread(const std::optional<std::string>& savestate_path, bool delete_savestate)
 {
@@ -347,6 +382,8 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     Host_Message(WM_USER_CREATE);
   }
 
+  ApplyAffinityPinning();
+
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance()->ReportGameStart();
 
@@ -354,6 +391,7 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     EMM::InstallExceptionHandler();  // Let's run under memory watch
 
   s_is_started = true;
+  Hooks::Fire(Hooks::Event::TitleLaunch, _CoreParameter.GetGameID());
   CPUSetInitialExecutionState();
 
 #ifdef USE_GDBSTUB
@@ -373,6 +411,9 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     }
 #endif
 
+  if (_CoreParameter.iPerfServerPort > 0)
+    Profiler::StartServer(_CoreParameter.iPerfServerPort);
+
 #ifdef USE_MEMORYWATCHER
   MemoryWatcher::Init();
 #endif
@@ -479,6 +520,12 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
   Movie::Init(*boot);
   Common::ScopeGuard movie_guard{ Movie::Shutdown };
 
+  PerfProfile::StartSession();
+  Common::ScopeGuard perf_profile_guard{ PerfProfile::EndSession };
+
+  JitCacheDump::StartWatchdog();
+  Common::ScopeGuard jit_dump_guard{ JitCacheDump::StopWatchdog };
+
   HW::Init();
   Common::ScopeGuard hw_guard{ [] {
     // We must set up this flag before executing HW::Shutdown()
@@ -610,6 +657,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    ApplyAffinityPinning();
 
     video_backend->Video_Prepare();
     Host_Message(WM_USER_CREATE);
@@ -653,6 +701,8 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
   INFO_LOG(CONSOLE, "%s", StopMessage(true, "GDB stopped.").c_str());
 #endif
 
+  Profiler::StopServer();
+
   s_cpu_thread.join();
 
   INFO_LOG(CONSOLE, "%s", StopMessage(true, "CPU thread stopped.").c_str());
@@ -826,6 +876,33 @@ void RunAsCPUThread(std::function<void()> function)
     PauseAndLock(false, was_unpaused);
 }
 
+// Recomputes the pacing micro-adjustment from the measured present cadence.
+// A 59.94Hz guest on a 60.00Hz (or 120Hz) display drifts one vsync every few
+// seconds, which shows up as a visible repeated/dropped frame. When we are
+// running at 1x with vsync and the present rate is already within 0.4% of the
+// guest VI rate, nudge the throttle toward the display's clock instead of the
+// guest's; anything further off (performance-bound, fast-forward, vsync off)
+// resets to neutral. The adjustment only changes wall-clock pacing, never
+// emulated timing, so determinism is unaffected.
+static void UpdatePacingAdjustment()
+{
+  const float avg_interval = s_avg_present_interval_us.load(std::memory_order_relaxed);
+  if (avg_interval > 0.0f && !s_is_throttler_temp_disabled &&
+      SConfig::GetInstance().m_EmulationSpeed == 1.0f && g_ActiveConfig.IsVSync())
+  {
+    const double target_interval = 1000000.0 / VideoInterface::GetTargetRefreshRate();
+    const double ratio = target_interval / avg_interval;
+    if (ratio > 0.996 && ratio < 1.004)
+    {
+      float adjustment = s_pacing_adjustment.load(std::memory_order_relaxed);
+      adjustment = std::min(1.005f, std::max(0.995f, adjustment * static_cast<float>(ratio)));
+      s_pacing_adjustment.store(adjustment, std::memory_order_relaxed);
+      return;
+    }
+  }
+  s_pacing_adjustment.store(1.0f, std::memory_order_relaxed);
+}
+
 // Display FPS info
 // This should only be called from VI
 void VideoThrottle()
@@ -836,6 +913,17 @@ void VideoThrottle()
   {
     UpdateTitle();
 
+    // Surface audio underruns accumulated by the mixer over the last second.
+    if (g_sound_stream)
+    {
+      const u64 underrun_frames = g_sound_stream->GetMixer()->GetAndResetUnderrunFrames();
+      if (underrun_frames != 0)
+        OSD::AddMessage(
+            StringFromFormat("Audio buffer underrun (%u frames)", (u32)underrun_frames), 2000);
+    }
+
+    UpdatePacingAdjustment();
+
     // Reset counter
     s_timer.Update();
     s_drawn_frame.store(0);
@@ -876,8 +964,25 @@ bool ShouldSkipFrame(int skipped)
 void Callback_VideoCopiedToXFB(bool video_update)
 {
   if (video_update)
+  {
     s_drawn_frame++;
 
+    // Track the present-to-present interval for the pacing adjustment. Large
+    // gaps (pauses, savestates, shader stalls) are ignored so a single hitch
+    // does not skew the average.
+    const u64 now_us = Common::Timer::GetTimeUs();
+    if (s_last_present_time_us != 0 && now_us - s_last_present_time_us < 100000)
+    {
+      const float interval = static_cast<float>(now_us - s_last_present_time_us);
+      float average = s_avg_present_interval_us.load(std::memory_order_relaxed);
+      average = average == 0.0f ? interval : average + 0.05f * (interval - average);
+      s_avg_present_interval_us.store(average, std::memory_order_relaxed);
+    }
+    s_last_present_time_us = now_us;
+
+    Hooks::Fire(Hooks::Event::FrameEnd);
+  }
+
   if (s_frame_step)
   {
     s_frame_step = false;
@@ -24,6 +24,10 @@ namespace Core
 bool GetIsThrottlerTempDisabled();
 void SetIsThrottlerTempDisabled(bool disable);
 
+// Small multiplier (within +/-0.5% of 1.0) applied to the throttle so the
+// guest VI rate settles onto the host display's measured present cadence.
+float GetPacingAdjustment();
+
 void Callback_VideoCopiedToXFB(bool video_update);
 
 enum class State
@@ -14,12 +14,14 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Profiler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/PowerPC.h"
 
 #include "VideoCommon/Fifo.h"
@@ -62,6 +64,8 @@ static std::unordered_map<std::string, EventType> s_event_types;
 // by the standard adaptor class.
 static std::vector<Event> s_event_queue;
 static u64 s_event_fifo_id;
+// Number of tombstoned entries still sitting in the queue (see RemoveEvent).
+static size_t s_dead_events;
 static std::mutex s_ts_write_lock;
 static Common::SPSCQueue<Event, false> s_ts_queue;
 
@@ -124,6 +128,7 @@ void UnregisterAllEvents()
 void Init()
 {
   s_last_OC_factor = SConfig::GetInstance().m_OCEnable ? SConfig::GetInstance().m_OCFactor : 1.0f;
+  s_last_OC_factor *= SystemTimers::GetAdaptiveClockFactor();
   g.last_OC_factor_inverted = 1.0f / s_last_OC_factor;
   PowerPC::ppcState.downcount = CyclesToDowncount(MAX_SLICE_LENGTH);
   g.slice_length = MAX_SLICE_LENGTH;
@@ -202,7 +207,10 @@ void DoState(PointerWrap& p)
   // The exact layout of the heap in memory is implementation defined, therefore it is platform
   // and library version specific.
   if (p.GetMode() == PointerWrap::MODE_READ)
+  {
     std::make_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+    s_dead_events = 0;
+  }
 }
 
 // This should only be called from the CPU thread. If you are calling
@@ -226,6 +234,7 @@ u64 GetIdleTicks()
 void ClearPendingEvents()
 {
   s_event_queue.clear();
+  s_dead_events = 0;
 }
 
 void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata, FromThread from)
@@ -272,14 +281,31 @@ void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
 
 void RemoveEvent(EventType* event_type)
 {
-  auto itr = std::remove_if(s_event_queue.begin(), s_event_queue.end(),
-                            [&](const Event& e) { return e.type == event_type; });
+  // Physically erasing entries breaks the heap invariant and forces a full
+  // make_heap, which gets expensive with the thousands of schedule/remove
+  // pairs per frame that IOS timers produce. The heap is only ordered by
+  // time and fifo_order, so an entry can instead be neutered in place: it
+  // stays where it is and fires as an empty "_lost_event" when its time
+  // comes, which is exactly how lost savestate events are handled already.
+  for (Event& ev : s_event_queue)
+  {
+    if (ev.type == event_type)
+    {
+      ev.type = s_ev_lost;
+      ev.userdata = 0;
+      s_dead_events++;
+    }
+  }
 
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (itr != s_event_queue.end())
+  // Don't let tombstones pile up and keep shortening slices forever;
+  // compact the queue once they outnumber the live events.
+  if (s_dead_events > s_event_queue.size() / 2)
   {
+    auto itr = std::remove_if(s_event_queue.begin(), s_event_queue.end(),
+                              [](const Event& e) { return e.type == s_ev_lost; });
     s_event_queue.erase(itr, s_event_queue.end());
     std::make_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+    s_dead_events = 0;
   }
 }
 
@@ -298,6 +324,8 @@ void ProcessFifoWaitEvents()
     Event evt = std::move(s_event_queue.front());
     std::pop_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
     s_event_queue.pop_back();
+    if (evt.type == s_ev_lost && s_dead_events > 0)
+      s_dead_events--;
     // NOTICE_LOG(POWERPC, "[Scheduler] %-20s (%lld, %lld)", evt.type->name->c_str(),
     //            g.global_timer, evt.time);
     evt.type->callback(evt.userdata, g.global_timer - evt.time);
@@ -328,11 +356,13 @@ void MoveEvents()
 
 void Advance()
 {
+  TRACE_EVENT("CoreTiming::Advance");
   MoveEvents();
 
   int cyclesExecuted = g.slice_length - DowncountToCycles(PowerPC::ppcState.downcount);
   g.global_timer += cyclesExecuted;
   s_last_OC_factor = SConfig::GetInstance().m_OCEnable ? SConfig::GetInstance().m_OCFactor : 1.0f;
+  s_last_OC_factor *= SystemTimers::GetAdaptiveClockFactor();
   g.last_OC_factor_inverted = 1.0f / s_last_OC_factor;
   g.slice_length = MAX_SLICE_LENGTH;
 
@@ -343,6 +373,8 @@ void Advance()
     Event evt = std::move(s_event_queue.front());
     std::pop_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
     s_event_queue.pop_back();
+    if (evt.type == s_ev_lost && s_dead_events > 0)
+      s_dead_events--;
     // NOTICE_LOG(POWERPC, "[Scheduler] %-20s (%lld, %lld)", evt.type->name->c_str(),
     //            g.global_timer, evt.time);
     evt.type->callback(evt.userdata, g.global_timer - evt.time);
@@ -106,22 +106,62 @@ void Step()
 // Used by thread mode.
 int RunCyclesThread(int cycles)
 {
-  while (true)
+  // First, let's run a few cycles with no idle skipping so that things can
+  // progress a bit.
+  for (int i = 0; i < 8; i++)
   {
     if (g_dsp.cr & CR_HALT)
       return 0;
-
     if (g_dsp.external_interrupt_waiting)
     {
       DSPCore_CheckExternalInterrupt();
       DSPCore_SetExternalInterrupt(false);
     }
-
     Step();
     cycles--;
     if (cycles < 0)
       return 0;
   }
+
+  while (true)
+  {
+    // Next, let's run a few cycles with idle skipping, so that we can skip
+    // idle loops. External interrupts are checked before every step, so
+    // giving up the rest of the grant here doesn't delay mail delivery.
+    for (int i = 0; i < 8; i++)
+    {
+      if (g_dsp.cr & CR_HALT)
+        return 0;
+      if (g_dsp.external_interrupt_waiting)
+      {
+        DSPCore_CheckExternalInterrupt();
+        DSPCore_SetExternalInterrupt(false);
+      }
+      // Idle skipping.
+      if (Analyzer::GetCodeFlags(g_dsp.pc) & Analyzer::CODE_IDLE_SKIP)
+        return 0;
+      Step();
+      cycles--;
+      if (cycles < 0)
+        return 0;
+    }
+
+    // Now, lets run some more without idle skipping.
+    for (int i = 0; i < 200; i++)
+    {
+      if (g_dsp.cr & CR_HALT)
+        return 0;
+      if (g_dsp.external_interrupt_waiting)
+      {
+        DSPCore_CheckExternalInterrupt();
+        DSPCore_SetExternalInterrupt(false);
+      }
+      Step();
+      cycles--;
+      if (cycles < 0)
+        return 0;
+    }
+  }
 }
 
 // This one has basic idle skipping, and checks breakpoints.
@@ -0,0 +1,255 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/DeterminismAudit.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace DeterminismAudit
+{
+// 64 KiB blocks give ~380 hashes per sample on GameCube, which is fine enough
+// to point at the diverging subsystem without blowing up the trace size.
+static constexpr u32 RAM_BLOCK_SIZE = 0x10000;
+static constexpr u32 TRACE_MAGIC = 0x414D5444;  // "DTMA"
+static constexpr u32 TRACE_VERSION = 1;
+// Don't flood the screen or the dump directory when whole regions diverge.
+static constexpr u32 MAX_REPORTED_BLOCKS = 8;
+
+enum class Mode
+{
+  Inactive,
+  Recording,
+  Verifying,
+};
+
+struct TraceHeader
+{
+  u32 magic;
+  u32 version;
+  u32 interval;
+  u32 ram_block_size;
+  u32 num_blocks;
+  u32 reserved;
+};
+
+static Mode s_mode = Mode::Inactive;
+static File::IOFile s_trace_file;
+static u32 s_interval = 1;
+static u32 s_num_blocks = 0;
+static std::vector<u64> s_block_hashes;
+static std::vector<u64> s_recorded_hashes;
+static u64 s_last_audited_count = 0;
+static bool s_diverged = false;
+
+static std::string GetTraceFileName()
+{
+  return File::GetUserPath(D_DUMP_IDX) + "determinism.audit";
+}
+
+static u32 CountBlocks()
+{
+  u32 blocks = Memory::REALRAM_SIZE / RAM_BLOCK_SIZE;
+  if (SConfig::GetInstance().bWii)
+    blocks += Memory::EXRAM_SIZE / RAM_BLOCK_SIZE;
+  return blocks;
+}
+
+// Physical address of the start of a block, for reporting.
+static u32 BlockAddress(u32 index)
+{
+  const u32 mem1_blocks = Memory::REALRAM_SIZE / RAM_BLOCK_SIZE;
+  if (index < mem1_blocks)
+    return index * RAM_BLOCK_SIZE;
+  return 0x10000000 + (index - mem1_blocks) * RAM_BLOCK_SIZE;
+}
+
+static const u8* BlockPointer(u32 index)
+{
+  const u32 mem1_blocks = Memory::REALRAM_SIZE / RAM_BLOCK_SIZE;
+  if (index < mem1_blocks)
+    return Memory::m_pRAM + index * RAM_BLOCK_SIZE;
+  return Memory::m_pEXRAM + (index - mem1_blocks) * RAM_BLOCK_SIZE;
+}
+
+// Hashes only the architectural part of ppcState. Host-side members
+// (pointers, downcount, caches) differ legitimately between runs.
+static u64 HashCPUState()
+{
+  const PowerPC::PowerPCState& ppc = PowerPC::ppcState;
+  u64 h[8];
+  h[0] = GetHash64(reinterpret_cast<const u8*>(ppc.gpr), sizeof(ppc.gpr), 0);
+  h[1] = GetHash64(reinterpret_cast<const u8*>(ppc.cr_val), sizeof(ppc.cr_val), 0);
+  h[2] = GetHash64(reinterpret_cast<const u8*>(ppc.ps), sizeof(ppc.ps), 0);
+  h[3] = GetHash64(reinterpret_cast<const u8*>(ppc.sr), sizeof(ppc.sr), 0);
+  h[4] = GetHash64(reinterpret_cast<const u8*>(ppc.spr), sizeof(ppc.spr), 0);
+  h[5] = static_cast<u64>(ppc.pc) | (static_cast<u64>(ppc.npc) << 32);
+  h[6] = static_cast<u64>(ppc.msr) | (static_cast<u64>(ppc.fpscr) << 32);
+  h[7] = static_cast<u64>(ppc.xer_ca) | (static_cast<u64>(ppc.xer_so_ov) << 8) |
+         (static_cast<u64>(ppc.xer_stringctrl) << 16);
+  return GetHash64(reinterpret_cast<const u8*>(h), sizeof(h), 0);
+}
+
+static void ComputeBlockHashes()
+{
+  for (u32 i = 0; i < s_num_blocks; i++)
+    s_block_hashes[i] = GetHash64(BlockPointer(i), RAM_BLOCK_SIZE, 0);
+}
+
+static void DumpBlock(u32 index, u64 input_count)
+{
+  const std::string filename =
+      File::GetUserPath(D_DUMP_IDX) +
+      StringFromFormat("divergence_%llu_%08x.bin", static_cast<unsigned long long>(input_count),
+                       BlockAddress(index));
+  File::IOFile file(filename, "wb");
+  if (file)
+    file.WriteBytes(BlockPointer(index), RAM_BLOCK_SIZE);
+}
+
+static void ReportDivergence(u64 input_count, const std::string& detail)
+{
+  s_diverged = true;
+  PanicAlertT("Determinism audit: first divergence at input poll %llu: %s.\n"
+              "Differing RAM blocks were dumped to the Dump directory.",
+              static_cast<unsigned long long>(input_count), detail.c_str());
+}
+
+bool IsEnabled()
+{
+  return s_mode != Mode::Inactive;
+}
+
+void Init()
+{
+  Shutdown();
+
+  const SConfig& config = SConfig::GetInstance();
+  if (!config.m_DeterminismAudit)
+    return;
+
+  s_interval = static_cast<u32>(std::max(config.m_DeterminismAuditInterval, 1));
+  s_num_blocks = CountBlocks();
+  s_block_hashes.assign(s_num_blocks, 0);
+  s_recorded_hashes.assign(s_num_blocks, 0);
+  s_last_audited_count = 0;
+  s_diverged = false;
+
+  const std::string filename = GetTraceFileName();
+  if (File::Exists(filename))
+  {
+    s_trace_file.Open(filename, "rb");
+    TraceHeader header = {};
+    if (!s_trace_file.ReadArray(&header, 1) || header.magic != TRACE_MAGIC ||
+        header.version != TRACE_VERSION || header.ram_block_size != RAM_BLOCK_SIZE ||
+        header.num_blocks != s_num_blocks)
+    {
+      PanicAlertT("Determinism audit: trace %s doesn't match this setup. "
+                  "Delete it to record a new one.",
+                  filename.c_str());
+      s_trace_file.Close();
+      return;
+    }
+    s_interval = header.interval;
+    s_mode = Mode::Verifying;
+    Core::DisplayMessage("Determinism audit: verifying against " + filename, 5000);
+  }
+  else
+  {
+    s_trace_file.Open(filename, "wb");
+    const TraceHeader header = {TRACE_MAGIC, TRACE_VERSION, s_interval, RAM_BLOCK_SIZE,
+                                s_num_blocks, 0};
+    s_trace_file.WriteArray(&header, 1);
+    s_mode = Mode::Recording;
+    Core::DisplayMessage("Determinism audit: recording to " + filename, 5000);
+  }
+}
+
+void Shutdown()
+{
+  if (s_mode == Mode::Verifying && !s_diverged)
+    Core::DisplayMessage("Determinism audit: no divergence found.", 5000);
+  s_trace_file.Close();
+  s_mode = Mode::Inactive;
+}
+
+void Update(u64 input_count)
+{
+  if (s_mode == Mode::Inactive || s_diverged || !Memory::IsInitialized())
+    return;
+  if (input_count % s_interval != 0 || input_count == s_last_audited_count)
+    return;
+  s_last_audited_count = input_count;
+
+  const u64 cpu_hash = HashCPUState();
+  ComputeBlockHashes();
+
+  if (s_mode == Mode::Recording)
+  {
+    s_trace_file.WriteArray(&input_count, 1);
+    s_trace_file.WriteArray(&cpu_hash, 1);
+    s_trace_file.WriteArray(s_block_hashes.data(), s_num_blocks);
+    return;
+  }
+
+  u64 recorded_count = 0;
+  u64 recorded_cpu_hash = 0;
+  if (!s_trace_file.ReadArray(&recorded_count, 1) ||
+      !s_trace_file.ReadArray(&recorded_cpu_hash, 1) ||
+      !s_trace_file.ReadArray(s_recorded_hashes.data(), s_num_blocks))
+  {
+    Core::DisplayMessage("Determinism audit: reached end of trace, no divergence found.", 5000);
+    s_trace_file.Close();
+    s_mode = Mode::Inactive;
+    return;
+  }
+
+  if (recorded_count != input_count)
+  {
+    ReportDivergence(input_count,
+                     StringFromFormat("input poll count skewed, trace expected poll %llu",
+                                      static_cast<unsigned long long>(recorded_count)));
+    return;
+  }
+
+  std::string detail;
+  if (cpu_hash != recorded_cpu_hash)
+    detail = "CPU state differs";
+
+  u32 differing_blocks = 0;
+  for (u32 i = 0; i < s_num_blocks; i++)
+  {
+    if (s_block_hashes[i] == s_recorded_hashes[i])
+      continue;
+    differing_blocks++;
+    if (differing_blocks > MAX_REPORTED_BLOCKS)
+      continue;
+    if (!detail.empty())
+      detail += ", ";
+    detail += StringFromFormat("RAM %08x-%08x", BlockAddress(i),
+                               BlockAddress(i) + RAM_BLOCK_SIZE - 1);
+    DumpBlock(i, input_count);
+  }
+  if (differing_blocks > MAX_REPORTED_BLOCKS)
+  {
+    detail += StringFromFormat(" and %u more blocks", differing_blocks - MAX_REPORTED_BLOCKS);
+  }
+
+  if (!detail.empty())
+    ReportDivergence(input_count, detail);
+}
+}  // namespace DeterminismAudit
@@ -0,0 +1,26 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Lockstep determinism auditing for netplay/TAS debugging. While active, a
+// fingerprint of the architectural CPU state plus block-wise RAM hashes is
+// taken every N input polls. The first run writes the fingerprints to a trace
+// file; a replay (or a second instance given a copy of the file) verifies
+// against it and reports the first divergent poll together with the RAM
+// ranges that differ, instead of leaving the bisection to a human.
+namespace DeterminismAudit
+{
+bool IsEnabled();
+
+// Called from Movie::Init on boot. Records a new trace if none exists in the
+// dump directory, otherwise verifies against the existing one.
+void Init();
+void Shutdown();
+
+// Called from Movie::InputUpdate on the CPU thread, once per input poll.
+void Update(u64 input_count);
+}  // namespace DeterminismAudit
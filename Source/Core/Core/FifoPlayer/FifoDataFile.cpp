@@ -5,12 +5,20 @@
 #include "Core/FifoPlayer/FifoDataFile.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "Common/Event.h"
 #include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
+#include "Common/Thread.h"
 
 enum
 {
@@ -68,6 +76,175 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 #pragma pack(pop)
 
+// Writes streamed frames to a temporary file on its own thread so recording
+// memory use stays bounded no matter how long the capture runs. The resulting
+// file differs from Save()'s layout only in where the frame list lives, which
+// loaders follow through the header offsets anyway.
+class FifoStreamWriter
+{
+public:
+  explicit FifoStreamWriter(const std::string& temp_filename) : m_TempFilename(temp_filename)
+  {
+    if (!m_File.Open(temp_filename, "wb"))
+      return;
+
+    FifoDataFile::PadFile(sizeof(FileHeader), m_File);
+
+    m_Good = true;
+    m_Running.Set();
+    m_Thread = std::thread(&FifoStreamWriter::ThreadFunc, this);
+  }
+
+  ~FifoStreamWriter()
+  {
+    StopThread();
+    if (m_File.IsOpen())
+      m_File.Close();
+    // A recording that was never saved leaves its temporary file behind.
+    if (!m_Finalized)
+      File::Delete(m_TempFilename);
+  }
+
+  bool IsGood() const { return m_Good; }
+  const std::string& GetTempFilename() const { return m_TempFilename; }
+
+  void PushFrame(FifoFrameInfo&& frame)
+  {
+    // Apply back pressure instead of queueing unboundedly if the disk can't
+    // keep up with the recording.
+    while (m_PendingFrames.Size() >= MAX_PENDING_FRAMES)
+      m_FrameConsumed.WaitFor(std::chrono::milliseconds(100));
+
+    m_PendingFrames.Push(std::move(frame));
+    m_FrameAvailable.Set();
+  }
+
+  // Stops the writer thread, then writes the register blocks, the frame list
+  // and the header. Leaves the finished file closed at the temporary path.
+  bool Finalize(const FifoDataFile& data)
+  {
+    StopThread();
+
+    // Write anything the writer thread didn't get to.
+    while (!m_PendingFrames.Empty())
+    {
+      WriteFrame(m_PendingFrames.Front());
+      m_PendingFrames.Pop();
+    }
+
+    m_File.Seek(0, SEEK_END);
+
+    const u64 bpMemOffset = m_File.Tell();
+    m_File.WriteArray(data.m_BPMem, FifoDataFile::BP_MEM_SIZE);
+
+    const u64 cpMemOffset = m_File.Tell();
+    m_File.WriteArray(data.m_CPMem, FifoDataFile::CP_MEM_SIZE);
+
+    const u64 xfMemOffset = m_File.Tell();
+    m_File.WriteArray(data.m_XFMem, FifoDataFile::XF_MEM_SIZE);
+
+    const u64 xfRegsOffset = m_File.Tell();
+    m_File.WriteArray(data.m_XFRegs, FifoDataFile::XF_REGS_SIZE);
+
+    const u64 texMemOffset = m_File.Tell();
+    m_File.WriteArray(data.m_TexMem, FifoDataFile::TEX_MEM_SIZE);
+
+    const u64 frameListOffset = m_File.Tell();
+    m_File.WriteArray(m_FrameList.data(), m_FrameList.size());
+
+    FileHeader header;
+    header.fileId = FILE_ID;
+    header.file_version = VERSION_NUMBER;
+    header.min_loader_version = MIN_LOADER_VERSION;
+
+    header.bpMemOffset = bpMemOffset;
+    header.bpMemSize = FifoDataFile::BP_MEM_SIZE;
+
+    header.cpMemOffset = cpMemOffset;
+    header.cpMemSize = FifoDataFile::CP_MEM_SIZE;
+
+    header.xfMemOffset = xfMemOffset;
+    header.xfMemSize = FifoDataFile::XF_MEM_SIZE;
+
+    header.xfRegsOffset = xfRegsOffset;
+    header.xfRegsSize = FifoDataFile::XF_REGS_SIZE;
+
+    header.texMemOffset = texMemOffset;
+    header.texMemSize = FifoDataFile::TEX_MEM_SIZE;
+
+    header.frameListOffset = frameListOffset;
+    header.frameCount = static_cast<u32>(m_FrameList.size());
+
+    header.flags = data.m_Flags;
+
+    m_File.Seek(0, SEEK_SET);
+    m_File.WriteBytes(&header, sizeof(FileHeader));
+
+    m_Finalized = m_File.Close();
+    return m_Finalized;
+  }
+
+private:
+  static constexpr u32 MAX_PENDING_FRAMES = 8;
+
+  void StopThread()
+  {
+    if (!m_Running.TestAndClear())
+      return;
+    m_FrameAvailable.Set();
+    m_Thread.join();
+  }
+
+  void WriteFrame(const FifoFrameInfo& frame)
+  {
+    m_File.Seek(0, SEEK_END);
+    const u64 dataOffset = m_File.Tell();
+    m_File.WriteBytes(frame.fifoData.data(), frame.fifoData.size());
+
+    const u64 memoryUpdatesOffset = FifoDataFile::WriteMemoryUpdates(frame.memoryUpdates, m_File);
+
+    FileFrameInfo dstFrame;
+    dstFrame.fifoDataSize = static_cast<u32>(frame.fifoData.size());
+    dstFrame.fifoDataOffset = dataOffset;
+    dstFrame.fifoStart = frame.fifoStart;
+    dstFrame.fifoEnd = frame.fifoEnd;
+    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
+    dstFrame.numMemoryUpdates = static_cast<u32>(frame.memoryUpdates.size());
+
+    m_FrameList.push_back(dstFrame);
+  }
+
+  void ThreadFunc()
+  {
+    Common::SetCurrentThreadName("FIFO Recording Writer");
+
+    while (m_Running.IsSet())
+    {
+      m_FrameAvailable.Wait();
+      while (!m_PendingFrames.Empty())
+      {
+        WriteFrame(m_PendingFrames.Front());
+        m_PendingFrames.Pop();
+        m_FrameConsumed.Set();
+      }
+    }
+  }
+
+  const std::string m_TempFilename;
+  File::IOFile m_File;
+  bool m_Good = false;
+  bool m_Finalized = false;
+
+  // Only touched by the writer thread until it has been joined.
+  std::vector<FileFrameInfo> m_FrameList;
+
+  Common::SPSCQueue<FifoFrameInfo> m_PendingFrames;
+  Common::Event m_FrameAvailable;
+  Common::Event m_FrameConsumed;
+  Common::Flag m_Running;
+  std::thread m_Thread;
+};
+
 FifoDataFile::FifoDataFile() = default;
 
 FifoDataFile::~FifoDataFile() = default;
@@ -92,13 +269,48 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
-void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
+bool FifoDataFile::BeginStreaming(const std::string& temp_filename)
 {
-  m_Frames.push_back(frameInfo);
+  auto writer = std::make_unique<FifoStreamWriter>(temp_filename);
+  if (!writer->IsGood())
+    return false;
+
+  m_StreamWriter = std::move(writer);
+  m_WasStreamed = true;
+  return true;
+}
+
+void FifoDataFile::AddFrame(FifoFrameInfo frameInfo)
+{
+  m_FrameCount++;
+  m_TotalFifoBytes += frameInfo.fifoData.size();
+  for (const auto& memUpdate : frameInfo.memoryUpdates)
+    m_TotalMemoryBytes += memUpdate.data.size();
+
+  if (m_StreamWriter)
+  {
+    m_StreamWriter->PushFrame(std::move(frameInfo));
+    return;
+  }
+
+  m_Frames.push_back(std::move(frameInfo));
 }
 
 bool FifoDataFile::Save(const std::string& filename)
 {
+  if (m_StreamWriter)
+  {
+    const bool success = m_StreamWriter->Finalize(*this) &&
+                         File::Rename(m_StreamWriter->GetTempFilename(), filename);
+    m_StreamWriter.reset();
+    return success;
+  }
+
+  // A streamed recording no longer holds its frames, so it can only be saved
+  // once.
+  if (m_WasStreamed)
+    return false;
+
   File::IOFile file;
   if (!file.Open(filename, "wb"))
     return false;
@@ -257,7 +469,7 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
                       dstFrame.memoryUpdates, file);
 
-    dataFile->AddFrame(dstFrame);
+    dataFile->AddFrame(std::move(dstFrame));
   }
 
   file.Close();
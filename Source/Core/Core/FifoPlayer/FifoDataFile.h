@@ -15,6 +15,8 @@ namespace File
 class IOFile;
 }
 
+class FifoStreamWriter;
+
 struct MemoryUpdate
 {
   enum Type
@@ -67,25 +69,35 @@ public:
   u32* GetXFMem() { return m_XFMem; }
   u32* GetXFRegs() { return m_XFRegs; }
   u8* GetTexMem() { return m_TexMem; }
-  void AddFrame(const FifoFrameInfo& frameInfo);
+
+  // Streams added frames to a temporary file on a writer thread instead of
+  // keeping them in memory, so recording memory use stays bounded. Save()
+  // then finalizes the temporary file and renames it into place.
+  bool BeginStreaming(const std::string& temp_filename);
+
+  void AddFrame(FifoFrameInfo frameInfo);
   const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  u32 GetFrameCount() const { return m_FrameCount; }
+  u64 GetTotalFifoBytes() const { return m_TotalFifoBytes; }
+  u64 GetTotalMemoryBytes() const { return m_TotalMemoryBytes; }
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
+  friend class FifoStreamWriter;
+
   enum
   {
     FLAG_IS_WII = 1
   };
 
-  void PadFile(size_t numBytes, File::IOFile& file);
+  static void PadFile(size_t numBytes, File::IOFile& file);
 
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  static u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
@@ -98,5 +110,11 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
+  u32 m_FrameCount = 0;
+  u64 m_TotalFifoBytes = 0;
+  u64 m_TotalMemoryBytes = 0;
+  bool m_WasStreamed = false;
+  std::unique_ptr<FifoStreamWriter> m_StreamWriter;
+
   std::vector<FifoFrameInfo> m_Frames;
 };
@@ -5,11 +5,19 @@
 #include "Core/FifoPlayer/FifoPlayer.h"
 
 #include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <mutex>
+#include <numeric>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -25,6 +33,7 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/OpcodeDecoding.h"
 
 // We need to include TextureDecoder.h for the texMem array.
 // TODO: Move texMem somewhere else so this isn't an issue.
@@ -133,7 +142,12 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame >= m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    if (m_BenchmarkLoops != 0 && ++m_BenchmarkLoopsDone >= m_BenchmarkLoops)
+    {
+      WriteBenchmarkResults();
+      return CPU::State::PowerDown;
+    }
+    if (!m_Loop && m_BenchmarkLoops == 0)
       return CPU::State::PowerDown;
     // If there are zero frames in the range then sleep instead of busy spinning
     if (m_FrameRangeStart >= m_FrameRangeEnd)
@@ -151,15 +165,223 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_FrameWrittenCb)
     m_FrameWrittenCb();
 
+  if (m_BenchmarkLoops != 0)
+    BuildBenchmarkAnalysis();
+
   if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
     WriteAllMemoryUpdates();
 
   WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
 
+  if (m_BenchmarkLoops != 0)
+  {
+    // WriteFifo blocks while the GPU drains the ring buffer, so the interval
+    // between frames reflects actual processing time, not just CPU-side copies.
+    const u64 now = Common::Timer::GetTimeUs();
+    if (m_BenchmarkLastFrameTime != 0)
+      m_BenchmarkFrameTimes.push_back(now - m_BenchmarkLastFrameTime);
+    m_BenchmarkLastFrameTime = now;
+  }
+
   ++m_CurrentFrame;
   return CPU::State::Running;
 }
 
+static const char* const s_benchmark_state_class_names[] = {
+  "tev", "texture", "scissor", "pixel", "efb_copy", "bp_other",
+  "cp", "xf_matrix", "xf_viewport", "xf_other",
+};
+
+static int ClassifyBPRegister(u8 reg)
+{
+  if ((reg >= 0x28 && reg <= 0x2F) || (reg >= 0xC0 && reg <= 0xEF) || (reg >= 0xF6 && reg <= 0xFD))
+    return FifoPlayer::BENCH_STATE_TEV;  // tref, combiners, tev registers, swap tables
+  if ((reg >= 0x30 && reg <= 0x3F) || reg == 0x64 || reg == 0x65 || (reg >= 0x80 && reg <= 0xBF))
+    return FifoPlayer::BENCH_STATE_TEXTURE;  // texcoord scale, tlut loads, sampler/image state
+  if (reg == 0x20 || reg == 0x21 || reg == 0x59)
+    return FifoPlayer::BENCH_STATE_SCISSOR;
+  if (reg >= 0x40 && reg <= 0x45)
+    return FifoPlayer::BENCH_STATE_PIXEL;  // zmode, blend, dst alpha, pe control
+  if (reg >= 0x49 && reg <= 0x52)
+    return FifoPlayer::BENCH_STATE_EFB_COPY;  // copy source/dest, stride, scale, trigger
+  return FifoPlayer::BENCH_STATE_BP_OTHER;
+}
+
+// Returns the state class of the command at data, or -1 for draws and NOPs.
+static int ClassifyStateCommand(const u8* data)
+{
+  switch (data[0])
+  {
+  case OpcodeDecoder::GX_LOAD_CP_REG:
+    return FifoPlayer::BENCH_STATE_CP;
+  case OpcodeDecoder::GX_LOAD_BP_REG:
+    return ClassifyBPRegister(data[1]);
+  case OpcodeDecoder::GX_LOAD_XF_REG:
+  {
+    const u16 address = Common::swap32(&data[1]) & 0xFFFF;
+    if (address < 0x1000)
+      return FifoPlayer::BENCH_STATE_XF_MATRIX;
+    if (address >= 0x101A && address <= 0x1026)
+      return FifoPlayer::BENCH_STATE_XF_VIEWPORT;  // viewport and projection
+    return FifoPlayer::BENCH_STATE_XF_OTHER;
+  }
+  case OpcodeDecoder::GX_LOAD_INDX_A:
+  case OpcodeDecoder::GX_LOAD_INDX_B:
+  case OpcodeDecoder::GX_LOAD_INDX_C:
+  case OpcodeDecoder::GX_LOAD_INDX_D:
+    return FifoPlayer::BENCH_STATE_XF_MATRIX;
+  default:
+    return -1;
+  }
+}
+
+void FifoPlayer::SetBenchmarkMode(u32 loop_count, const std::string& output_path)
+{
+  m_BenchmarkLoops = loop_count;
+  m_BenchmarkLoopsDone = 0;
+  m_BenchmarkOutputPath = output_path;
+  m_BenchmarkFrameTimes.clear();
+  m_BenchmarkLastFrameTime = 0;
+}
+
+bool FifoPlayer::SetBenchmarkSkipClass(const std::string& class_name)
+{
+  for (int i = 0; i < NUM_BENCH_STATE_CLASSES; ++i)
+  {
+    if (class_name == s_benchmark_state_class_names[i])
+    {
+      // CP register writes control how the GPU parses the vertex stream, so
+      // NOPing them out would desync every draw command that follows.
+      if (i == BENCH_STATE_CP)
+        return false;
+      m_BenchmarkSkipClass = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+void FifoPlayer::BuildBenchmarkAnalysis()
+{
+  if (m_BenchmarkAnalysisDone || !m_File)
+    return;
+  m_BenchmarkAnalysisDone = true;
+
+  // Reinitialize the analyzer's CP state the same way FifoPlaybackAnalyzer
+  // does, since vertex sizes depend on it.
+  u32* cpMem = m_File->GetCPMem();
+  FifoAnalyzer::LoadCPReg(0x50, cpMem[0x50], FifoAnalyzer::s_CpMem);
+  FifoAnalyzer::LoadCPReg(0x60, cpMem[0x60], FifoAnalyzer::s_CpMem);
+  for (int i = 0; i < 8; ++i)
+  {
+    FifoAnalyzer::LoadCPReg(0x70 + i, cpMem[0x70 + i], FifoAnalyzer::s_CpMem);
+    FifoAnalyzer::LoadCPReg(0x80 + i, cpMem[0x80 + i], FifoAnalyzer::s_CpMem);
+    FifoAnalyzer::LoadCPReg(0x90 + i, cpMem[0x90 + i], FifoAnalyzer::s_CpMem);
+  }
+
+  if (m_BenchmarkSkipClass >= 0)
+    m_FilteredFrameData.resize(m_File->GetFrameCount());
+
+  for (u32 frameIdx = 0; frameIdx < m_File->GetFrameCount(); ++frameIdx)
+  {
+    const FifoFrameInfo& frame = m_File->GetFrame(frameIdx);
+    std::vector<u8>* filtered = nullptr;
+    if (m_BenchmarkSkipClass >= 0)
+    {
+      m_FilteredFrameData[frameIdx] = frame.fifoData;
+      filtered = &m_FilteredFrameData[frameIdx];
+    }
+
+    FifoAnalyzer::s_DrawingObject = false;
+
+    u32 cmdStart = 0;
+    while (cmdStart < frame.fifoData.size())
+    {
+      const u8* cmd = &frame.fifoData[cmdStart];
+      const u32 cmdSize = FifoAnalyzer::AnalyzeCommand(cmd, FifoAnalyzer::DECODE_PLAYBACK);
+      if (cmdSize == 0)
+        break;
+
+      const int write_class = ClassifyStateCommand(cmd);
+      if (write_class >= 0 && frameIdx >= m_FrameRangeStart && frameIdx < m_FrameRangeEnd)
+      {
+        m_StateWriteCounts[write_class]++;
+        m_StateWriteBytes[write_class] += cmdSize;
+      }
+      // GX_NOP is a single zero byte, so a run of zeros of the same length
+      // keeps every later fifo offset (and memory update position) valid.
+      if (filtered && write_class == m_BenchmarkSkipClass)
+        memset(&(*filtered)[cmdStart], 0, cmdSize);
+
+      cmdStart += cmdSize;
+    }
+  }
+}
+
+void FifoPlayer::WriteBenchmarkResults()
+{
+  if (m_BenchmarkOutputPath.empty() || m_BenchmarkFrameTimes.empty())
+    return;
+
+  std::vector<u64> sorted = m_BenchmarkFrameTimes;
+  std::sort(sorted.begin(), sorted.end());
+  const auto percentile = [&sorted](double fraction) {
+    const size_t index = static_cast<size_t>(fraction * (sorted.size() - 1));
+    return sorted[index] / 1000.0;
+  };
+  const u64 total_us = std::accumulate(sorted.begin(), sorted.end(), u64(0));
+  const double average_ms = total_us / 1000.0 / sorted.size();
+
+  u64 objects_per_loop = 0;
+  for (u32 frame = m_FrameRangeStart; frame < m_FrameRangeEnd; ++frame)
+    objects_per_loop += m_FrameInfo[frame].objectStarts.size();
+
+  std::ofstream file;
+  File::OpenFStream(file, m_BenchmarkOutputPath, std::ios_base::out);
+  if (!file.is_open())
+  {
+    ERROR_LOG(VIDEO, "Failed to open benchmark output file %s", m_BenchmarkOutputPath.c_str());
+    return;
+  }
+
+  file << "{\n";
+  file << StringFromFormat("  \"frames_per_loop\": %u,\n", m_FrameRangeEnd - m_FrameRangeStart);
+  file << StringFromFormat("  \"loops\": %u,\n", m_BenchmarkLoops);
+  file << StringFromFormat("  \"objects_per_loop\": %llu,\n",
+    static_cast<unsigned long long>(objects_per_loop));
+  file << StringFromFormat("  \"frames_timed\": %u,\n", static_cast<u32>(sorted.size()));
+  file << "  \"frame_time_ms\": {\n";
+  file << StringFromFormat("    \"average\": %.4f,\n", average_ms);
+  file << StringFromFormat("    \"min\": %.4f,\n", sorted.front() / 1000.0);
+  file << StringFromFormat("    \"median\": %.4f,\n", percentile(0.50));
+  file << StringFromFormat("    \"p95\": %.4f,\n", percentile(0.95));
+  file << StringFromFormat("    \"p99\": %.4f,\n", percentile(0.99));
+  file << StringFromFormat("    \"max\": %.4f\n", sorted.back() / 1000.0);
+  file << "  },\n";
+  if (m_BenchmarkSkipClass >= 0)
+  {
+    file << StringFromFormat("  \"skipped_class\": \"%s\",\n",
+      s_benchmark_state_class_names[m_BenchmarkSkipClass]);
+  }
+  BuildBenchmarkAnalysis();
+  file << "  \"state_writes_per_loop\": {\n";
+  for (int i = 0; i < NUM_BENCH_STATE_CLASSES; ++i)
+  {
+    file << StringFromFormat("    \"%s\": { \"count\": %llu, \"bytes\": %llu }%s\n",
+      s_benchmark_state_class_names[i],
+      static_cast<unsigned long long>(m_StateWriteCounts[i]),
+      static_cast<unsigned long long>(m_StateWriteBytes[i]),
+      i + 1 < NUM_BENCH_STATE_CLASSES ? "," : "");
+  }
+  file << "  },\n";
+  file << StringFromFormat("  \"average_fps\": %.3f\n",
+    average_ms > 0.0 ? 1000.0 / average_ms : 0.0);
+  file << "}\n";
+
+  NOTICE_LOG(VIDEO, "FIFO benchmark finished: %.4f ms average over %u frames, results in %s",
+    average_ms, static_cast<u32>(sorted.size()), m_BenchmarkOutputPath.c_str());
+}
+
 std::unique_ptr<CPUCoreBase> FifoPlayer::GetCPUCore()
 {
   if (!m_File || m_File->GetFrameCount() == 0)
@@ -297,7 +519,9 @@ void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo&
 void FifoPlayer::WriteFramePart(u32 dataStart, u32 dataEnd, u32& nextMemUpdate,
                                 const FifoFrameInfo& frame, const AnalyzedFrameInfo& info)
 {
-  const u8* const data = frame.fifoData.data();
+  const u8* data = frame.fifoData.data();
+  if (m_BenchmarkSkipClass >= 0 && m_CurrentFrame < m_FilteredFrameData.size())
+    data = m_FilteredFrameData[m_CurrentFrame].data();
 
   while (nextMemUpdate < frame.memoryUpdates.size() && dataStart < dataEnd)
   {
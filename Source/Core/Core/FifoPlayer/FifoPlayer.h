@@ -92,6 +92,33 @@ public:
   // If enabled then all memory updates happen at once before the first frame
   // Default is disabled
   void SetEarlyMemoryUpdates(bool enabled) { m_EarlyMemoryUpdates = enabled; }
+  // Benchmark mode: replay the frame range loop_count times while collecting
+  // per-frame timings, write the statistics as JSON to output_path, then power
+  // down the core. Used by the headless frontend for driver regression runs.
+  void SetBenchmarkMode(u32 loop_count, const std::string& output_path);
+  bool IsBenchmarking() const { return m_BenchmarkLoops != 0; }
+  // Differential cost attribution: replay with one class of state writes
+  // replaced by NOPs, so frame-time deltas against a normal run measure what
+  // that class costs in the active backend. Returns false for an unknown
+  // class name (or "cp", which cannot be skipped safely - see the .cpp).
+  bool SetBenchmarkSkipClass(const std::string& class_name);
+
+  // Classes of state-changing FIFO commands, for benchmark cost attribution.
+  enum BenchmarkStateClass : int
+  {
+    BENCH_STATE_TEV,
+    BENCH_STATE_TEXTURE,
+    BENCH_STATE_SCISSOR,
+    BENCH_STATE_PIXEL,
+    BENCH_STATE_EFB_COPY,
+    BENCH_STATE_BP_OTHER,
+    BENCH_STATE_CP,
+    BENCH_STATE_XF_MATRIX,
+    BENCH_STATE_XF_VIEWPORT,
+    BENCH_STATE_XF_OTHER,
+    NUM_BENCH_STATE_CLASSES
+  };
+
   // Callbacks
   void SetFileLoadedCallback(CallbackFunc callback) { m_FileLoadedCb = callback; }
   void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = callback; }
@@ -137,8 +164,23 @@ private:
   static bool IsIdleSet();
   static bool IsHighWatermarkSet();
 
+  void BuildBenchmarkAnalysis();
+  void WriteBenchmarkResults();
+
   bool m_Loop;
 
+  u32 m_BenchmarkLoops = 0;
+  u32 m_BenchmarkLoopsDone = 0;
+  std::string m_BenchmarkOutputPath;
+  std::vector<u64> m_BenchmarkFrameTimes;  // microseconds
+  u64 m_BenchmarkLastFrameTime = 0;
+  int m_BenchmarkSkipClass = -1;
+  bool m_BenchmarkAnalysisDone = false;
+  u64 m_StateWriteCounts[NUM_BENCH_STATE_CLASSES] = {};
+  u64 m_StateWriteBytes[NUM_BENCH_STATE_CLASSES] = {};
+  // Per-frame copies of the fifo data with the skipped class NOPed out.
+  std::vector<std::vector<u8>> m_FilteredFrameData;
+
   u32 m_CurrentFrame = 0;
   u32 m_FrameRangeStart = 0;
   u32 m_FrameRangeEnd = 0;
@@ -6,7 +6,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
 
+#include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Core/ConfigManager.h"
@@ -26,6 +28,11 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
   m_File = std::make_unique<FifoDataFile>();
 
+  // Stream recorded frames to a temporary file as we go so memory use stays
+  // bounded no matter how long the recording runs. Falls back to buffering
+  // everything in memory if the file can't be created.
+  m_File->BeginStreaming(File::GetUserPath(D_DUMP_IDX) + "FifoRecording.dff.tmp");
+
   // TODO: This, ideally, would be deallocated when done recording.
   //       However, care needs to be taken since global state
   //       and multithreading don't play well nicely together.
@@ -102,7 +109,7 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 
       // Copy frame to file
       // The file will be responsible for freeing the memory allocated for each frame's fifoData
-      m_File->AddFrame(m_CurrentFrame);
+      m_File->AddFrame(std::move(m_CurrentFrame));
 
       if (m_FinishedCb && m_RequestedRecordingEnd)
         m_FinishedCb();
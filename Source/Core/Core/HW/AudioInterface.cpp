@@ -134,6 +134,7 @@ void DoState(PointerWrap& p)
 static void GenerateAudioInterrupt();
 static void UpdateInterrupts();
 static void IncreaseSampleCount(const u32 _uAmount);
+static void AdvanceSampleCounter();
 static int GetAIPeriod();
 static CoreTiming::EventType* et_AI;
 static void Update(u64 userdata, s64 cyclesLate);
@@ -224,7 +225,18 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
         if (tmpAICtrl.AIINT)
         {
           DEBUG_LOG(AUDIO_INTERFACE, "Clear AIS Interrupt");
+          // While AIINT was pending, timing matches were absorbed into the
+          // already-set bit and the event ran coalesced. Catch the sample
+          // counter up before the clear takes effect, then go back to firing
+          // on the next match.
+          if (m_Control.PSTAT)
+            AdvanceSampleCounter();
           m_Control.AIINT = 0;
+          if (m_Control.PSTAT)
+          {
+            CoreTiming::RemoveEvent(et_AI);
+            CoreTiming::ScheduleEvent(GetAIPeriod(), et_AI);
+          }
         }
 
         // Sample Count Reset
@@ -262,6 +274,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    DEBUG_LOG(AUDIO_INTERFACE, "AI_INTERRUPT_TIMING=%08x@%08x", val,
                              PowerPC::ppcState.pc);
                    m_InterruptTiming = val;
+                   if (m_Control.PSTAT)
+                     AdvanceSampleCounter();
                    CoreTiming::RemoveEvent(et_AI);
                    CoreTiming::ScheduleEvent(GetAIPeriod(), et_AI);
                  }));
@@ -310,17 +324,26 @@ unsigned int GetAIDSampleRate()
   return g_AIDSampleRate;
 }
 
+// Brings m_SampleCounter up to the current CPU time. Safe to run over a gap
+// of many periods: the wraparound compare in IncreaseSampleCount detects a
+// timing match anywhere in the interval, and further matches while AIINT is
+// still set only re-set the pending bit.
+static void AdvanceSampleCounter()
+{
+  const u64 Diff = CoreTiming::GetTicks() - g_LastCPUTime;
+  if (Diff > g_CPUCyclesPerSample)
+  {
+    const u32 Samples = static_cast<u32>(Diff / g_CPUCyclesPerSample);
+    g_LastCPUTime += Samples * g_CPUCyclesPerSample;
+    IncreaseSampleCount(Samples);
+  }
+}
+
 static void Update(u64 userdata, s64 cyclesLate)
 {
   if (m_Control.PSTAT)
   {
-    const u64 Diff = CoreTiming::GetTicks() - g_LastCPUTime;
-    if (Diff > g_CPUCyclesPerSample)
-    {
-      const u32 Samples = static_cast<u32>(Diff / g_CPUCyclesPerSample);
-      g_LastCPUTime += Samples * g_CPUCyclesPerSample;
-      IncreaseSampleCount(Samples);
-    }
+    AdvanceSampleCounter();
     CoreTiming::ScheduleEvent(GetAIPeriod() - cyclesLate, et_AI);
   }
 }
@@ -329,6 +352,12 @@ int GetAIPeriod()
 {
   u64 period = g_CPUCyclesPerSample * (m_InterruptTiming - m_SampleCounter);
   u64 s_period = g_CPUCyclesPerSample * g_AISSampleRate;
+  // While AIINT is set, timing matches can't change any guest-visible state
+  // (the pending bit just stays set and the counter is computed on the fly
+  // for MMIO reads), so don't wake up for every period; the clear of AIINT
+  // reschedules the next exact match.
+  if (m_Control.AIINT)
+    return static_cast<int>(s_period);
   if (period == 0)
     return static_cast<int>(s_period);
   return static_cast<int>(std::min(period, s_period));
@@ -16,6 +16,7 @@
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
@@ -396,6 +397,17 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
   pb.adpcm.pred_scale = s_accelerator->GetPredScale();
 }
 
+#if _M_SSE >= 0x200
+// SSE2 has no 32 bit low multiply; emulate it with two widening multiplies.
+__m128i MulLo32(const __m128i& a, const __m128i& b)
+{
+  const __m128i even = _mm_mul_epu32(a, b);
+  const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ramp)
 {
@@ -408,7 +420,57 @@ void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ra
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  u32 i = 0;
+
+#if _M_SSE >= 0x200
+  // Process eight samples at a time. The volume ramp is an arithmetic
+  // sequence, so eight lanes of it can be stepped at once, and the multiply,
+  // shift, clamp and accumulate below match the scalar loop bit for bit.
+  if (count >= 8)
+  {
+    alignas(16) u16 volumes[8];
+    for (u32 lane = 0; lane < 8; lane++)
+      volumes[lane] = volume + lane * volume_delta;
+    __m128i vol = _mm_load_si128(reinterpret_cast<const __m128i*>(volumes));
+    const __m128i vol_step = _mm_set1_epi16((s16)(8 * volume_delta));
+    const __m128i min_sample = _mm_set1_epi16(-32767);
+    const __m128i zero = _mm_setzero_si128();
+
+    alignas(16) s16 clamped[8];
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+      // Widen samples (sign extended) and volumes (zero extended) to 32 bits.
+      const __m128i in_lo = _mm_srai_epi32(_mm_unpacklo_epi16(zero, in), 16);
+      const __m128i in_hi = _mm_srai_epi32(_mm_unpackhi_epi16(zero, in), 16);
+      const __m128i vol_lo = _mm_unpacklo_epi16(vol, zero);
+      const __m128i vol_hi = _mm_unpackhi_epi16(vol, zero);
+
+      // The s16 * u16 product always fits in 32 bits, so the low half of an
+      // unsigned multiply is exact even for negative samples.
+      const __m128i prod_lo = _mm_srai_epi32(MulLo32(in_lo, vol_lo), 15);
+      const __m128i prod_hi = _mm_srai_epi32(MulLo32(in_hi, vol_hi), 15);
+
+      // Clamp to [-32767, 32767] like the scalar loop.
+      const __m128i result = _mm_max_epi16(_mm_packs_epi32(prod_lo, prod_hi), min_sample);
+      _mm_store_si128(reinterpret_cast<__m128i*>(clamped), result);
+
+      // Accumulate into the 32 bit output buffer.
+      const __m128i res_lo = _mm_srai_epi32(_mm_unpacklo_epi16(zero, result), 16);
+      const __m128i res_hi = _mm_srai_epi32(_mm_unpackhi_epi16(zero, result), 16);
+      __m128i* out_ptr = reinterpret_cast<__m128i*>(&out[i]);
+      _mm_storeu_si128(out_ptr, _mm_add_epi32(_mm_loadu_si128(out_ptr), res_lo));
+      _mm_storeu_si128(out_ptr + 1, _mm_add_epi32(_mm_loadu_si128(out_ptr + 1), res_hi));
+
+      vol = _mm_add_epi16(vol, vol_step);
+    }
+
+    volume += (u16)(i * volume_delta);
+    *dpop = clamped[7];
+  }
+#endif
+
+  for (; i < count; ++i)
   {
     s64 sample = input[i];
     sample *= volume;
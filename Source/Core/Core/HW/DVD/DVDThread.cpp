@@ -4,21 +4,28 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
 #include "Common/Flag.h"
+#include "Common/FlightRecorder.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Profiler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
@@ -84,11 +91,148 @@ static Common::Event s_result_queue_expanded;     // Is set by DVD thread
 static Common::Flag s_dvd_thread_exiting(false);  // Is set by CPU thread
 
 static Common::SPSCQueue<ReadRequest, false> s_request_queue;
+// Disc audio (DTK) reads get their own queue, serviced before the main one.
+// The guest pulls DTK data on a hard 3.5 ms cadence, but during level loads
+// the main queue holds a long run of chunk reads; letting the audio read
+// jump that line bounds its wait to the one chunk already in flight, instead
+// of the whole backlog, which is what made disc-streamed music hitch.
+// FinishRead matches results by ID, so out-of-order completion is fine.
+static Common::SPSCQueue<ReadRequest, false> s_dtk_request_queue;
 static Common::SPSCQueue<ReadResult, false> s_result_queue;
 static std::map<u64, ReadResult> s_result_map;
 
 static std::unique_ptr<DiscIO::Volume> s_disc;
 
+// Learned read-ahead. The DVD thread records the sequence of reads it
+// services, and the trace is saved to a per-title sidecar file on shutdown.
+// On later boots the saved sequence is replayed while the thread is otherwise
+// idle, prefetching the data into a host-side cache ahead of the guest's
+// requests. Disc access during loading screens is highly repeatable from run
+// to run, so this hides most of the host I/O latency behind emulated seek
+// time. The cache is transparent: a hit returns exactly the bytes a fresh
+// read would, so determinism and savestates are unaffected.
+struct TraceEntry
+{
+  u64 partition_offset;
+  u64 dvd_offset;
+  u32 length;
+  // Microseconds since emulation start when the read was serviced. Not used
+  // by the prefetcher yet, but recorded so pacing can be added later without
+  // a format change.
+  u32 realtime_offset_us;
+};
+
+static constexpr u32 TRACE_MAGIC = 0x44565431;  // "DVT1"
+static constexpr size_t MAX_TRACE_ENTRIES = 16384;
+static constexpr size_t MAX_PREFETCH_CACHE_BYTES = 32 * 1024 * 1024;
+// Prefetch reads done per idle loop iteration, so a new guest request never
+// waits behind more than one prefetch read plus this many cache probes.
+static constexpr size_t PREFETCH_BATCH = 8;
+
+// Apart from loading and saving (which the CPU thread does while the DVD
+// thread is stopped), all of this state is only touched by the DVD thread.
+static std::vector<TraceEntry> s_recorded_trace;
+static std::vector<TraceEntry> s_learned_trace;
+static size_t s_prefetch_index = 0;
+static size_t s_prefetch_cache_bytes = 0;
+static std::map<std::tuple<u64, u64, u32>, std::vector<u8>> s_prefetch_cache;
+static std::string s_trace_path;
+static u64 s_trace_start_us = 0;
+
+// Only call while the DVD thread is guaranteed to not be running.
+static void LoadTrace()
+{
+  s_recorded_trace.clear();
+  s_learned_trace.clear();
+  s_prefetch_cache.clear();
+  s_prefetch_cache_bytes = 0;
+  s_prefetch_index = 0;
+  s_trace_path.clear();
+  s_trace_start_us = Common::Timer::GetTimeUs();
+
+  if (!s_disc)
+    return;
+
+  const std::string game_id = s_disc->GetGameID();
+  if (game_id.empty())
+    return;
+
+  // Multi-disc titles share a game ID, but their traces must not mix.
+  const std::optional<u8> disc_number = s_disc->GetDiscNumber();
+  s_trace_path = File::GetUserPath(D_CACHE_IDX) + game_id + '_' +
+                 std::to_string(disc_number ? *disc_number : 0) + ".dvdtrace";
+
+  File::IOFile file(s_trace_path, "rb");
+  u32 magic, count;
+  if (!file.IsOpen() || !file.ReadArray(&magic, 1) || magic != TRACE_MAGIC ||
+      !file.ReadArray(&count, 1))
+  {
+    return;
+  }
+
+  s_learned_trace.resize(std::min<size_t>(count, MAX_TRACE_ENTRIES));
+  if (!file.ReadArray(s_learned_trace.data(), s_learned_trace.size()))
+  {
+    s_learned_trace.clear();
+    return;
+  }
+
+  INFO_LOG(DVDINTERFACE, "Loaded a DVD read trace with %zu entries", s_learned_trace.size());
+}
+
+// Only call while the DVD thread is guaranteed to not be running.
+static void SaveTrace()
+{
+  // A shorter run than what we already know about (e.g. quitting on the
+  // title screen) must not clobber a more complete trace.
+  if (s_trace_path.empty() || s_recorded_trace.size() <= s_learned_trace.size())
+    return;
+
+  File::IOFile file(s_trace_path, "wb");
+  const u32 magic = TRACE_MAGIC;
+  const u32 count = static_cast<u32>(s_recorded_trace.size());
+  if (!file.IsOpen() || !file.WriteArray(&magic, 1) || !file.WriteArray(&count, 1) ||
+      !file.WriteArray(s_recorded_trace.data(), s_recorded_trace.size()))
+  {
+    WARN_LOG(DVDINTERFACE, "Failed to save the DVD read trace to %s", s_trace_path.c_str());
+    return;
+  }
+
+  INFO_LOG(DVDINTERFACE, "Saved a DVD read trace with %u entries", count);
+}
+
+static bool HavePrefetchWork()
+{
+  return s_prefetch_index < s_learned_trace.size() &&
+         s_prefetch_cache_bytes < MAX_PREFETCH_CACHE_BYTES;
+}
+
+// Runs on the DVD thread while the request queue is empty.
+static void PrefetchFromTrace()
+{
+  for (size_t i = 0; i < PREFETCH_BATCH; ++i)
+  {
+    if (!HavePrefetchWork() || !s_request_queue.Empty() || !s_dtk_request_queue.Empty() ||
+        s_dvd_thread_exiting.IsSet())
+      return;
+
+    const TraceEntry& entry = s_learned_trace[s_prefetch_index++];
+    const auto key = std::make_tuple(entry.partition_offset, entry.dvd_offset, entry.length);
+    if (s_prefetch_cache.find(key) != s_prefetch_cache.end())
+      continue;
+
+    std::vector<u8> buffer(entry.length);
+    if (!s_disc->Read(entry.dvd_offset, entry.length, buffer.data(),
+                      DiscIO::Partition(entry.partition_offset)))
+    {
+      continue;
+    }
+
+    s_prefetch_cache_bytes += buffer.size();
+    s_prefetch_cache.emplace(key, std::move(buffer));
+  }
+}
+
 void Start()
 {
   s_finish_read = CoreTiming::RegisterEvent("FinishReadDVDThread", FinishRead);
@@ -96,6 +240,7 @@ void Start()
   s_request_queue_expanded.Reset();
   s_result_queue_expanded.Reset();
   s_request_queue.Clear();
+  s_dtk_request_queue.Clear();
   s_result_queue.Clear();
 
   // This is reset on every launch for determinism, but it doesn't matter
@@ -115,6 +260,7 @@ static void StartDVDThread()
 void Stop()
 {
   StopDVDThread();
+  SaveTrace();
   s_disc.reset();
 }
 
@@ -178,7 +324,9 @@ void DoState(PointerWrap& p)
 void SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  SaveTrace();
   s_disc = std::move(disc);
+  LoadTrace();
 }
 
 bool HasDisc()
@@ -226,7 +374,7 @@ void WaitUntilIdle()
 {
   ASSERT(Core::IsCPUThread());
 
-  while (!s_request_queue.Empty())
+  while (!s_request_queue.Empty() || !s_dtk_request_queue.Empty())
     s_result_queue_expanded.Wait();
 
   StopDVDThread();
@@ -268,7 +416,10 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
   request.time_started_ticks = CoreTiming::GetTicks();
   request.realtime_started_us = Common::Timer::GetTimeUs();
 
-  s_request_queue.Push(std::move(request));
+  if (reply_type == DVDInterface::ReplyType::DTK)
+    s_dtk_request_queue.Push(std::move(request));
+  else
+    s_request_queue.Push(std::move(request));
   s_request_queue_expanded.Set();
 
   CoreTiming::ScheduleEvent(ticks_until_completion, s_finish_read, id);
@@ -339,21 +490,58 @@ static void DVDThread()
 {
   Common::SetCurrentThreadName("DVD thread");
 
+  // Only prefetch once this incarnation of the thread has serviced a request.
+  // The CPU thread stops and restarts us to get exclusive access to s_disc
+  // (see WaitUntilIdle), so a freshly started thread must not touch the disc
+  // until a popped request proves that the CPU thread is done with it.
+  bool serviced_request = false;
+
   while (true)
   {
-    s_request_queue_expanded.Wait();
+    if (serviced_request && HavePrefetchWork() && s_request_queue.Empty() &&
+        s_dtk_request_queue.Empty())
+    {
+      PrefetchFromTrace();
+    }
+    else
+    {
+      s_request_queue_expanded.Wait();
+    }
 
     if (s_dvd_thread_exiting.IsSet())
       return;
 
     ReadRequest request;
-    while (s_request_queue.Pop(request))
+    while (s_dtk_request_queue.Pop(request) || s_request_queue.Pop(request))
     {
+      TRACE_EVENT("DVDThread::Read");
+      serviced_request = true;
+
       FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
 
-      std::vector<u8> buffer(request.length);
-      if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+      if (s_recorded_trace.size() < MAX_TRACE_ENTRIES)
+      {
+        s_recorded_trace.push_back(
+            {request.partition.offset, request.dvd_offset, request.length,
+             static_cast<u32>(Common::Timer::GetTimeUs() - s_trace_start_us)});
+      }
+
+      std::vector<u8> buffer;
+      const auto cached = s_prefetch_cache.find(
+          std::make_tuple(request.partition.offset, request.dvd_offset, request.length));
+      if (cached != s_prefetch_cache.end())
+      {
+        buffer = std::move(cached->second);
+        s_prefetch_cache_bytes -= buffer.size();
+        s_prefetch_cache.erase(cached);
+      }
+      else
+      {
+        buffer.resize(request.length);
+        Common::FlightRecorder::Count(Common::FlightRecorder::Counter::DiscReads);
+        if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+          buffer.resize(0);
+      }
 
       request.realtime_done_us = Common::Timer::GetTimeUs();
 
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cerrno>
 #include <cstring>
 
 #ifndef _WIN32
@@ -70,6 +71,10 @@ bool CEXIETHERNET::Activate()
   }
   ioctl(fd, TUNSETNOCSUM, 1);
 
+  // Non-blocking, so the read thread can drain every queued frame after one
+  // select() wakeup and stop on EAGAIN instead of blocking mid-batch.
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
   INFO_LOG(SP1, "BBA initialized with associated tap %s", ifr.ifr_name);
   return RecvInit();
 #else
@@ -139,17 +144,25 @@ static void ReadThreadHandler(CEXIETHERNET* self)
     if (select(self->fd + 1, &rfds, nullptr, nullptr, &timeout) <= 0)
       continue;
 
-    int readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
-    if (readBytes < 0)
-    {
-      ERROR_LOG(SP1, "Failed to read from BBA, err=%d", readBytes);
-    }
-    else if (self->readEnabled.IsSet())
+    // A TAP read returns one frame; under load several frames queue up per
+    // wakeup, so keep reading until the (non-blocking) fd runs dry rather
+    // than paying a select() round trip per packet.
+    while (!self->readThreadShutdown.IsSet())
     {
-      DEBUG_LOG(SP1, "Read data: %s",
-                ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
-      self->mRecvBufferLength = readBytes;
-      self->RecvHandlePacket();
+      int readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
+      if (readBytes < 0)
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+          ERROR_LOG(SP1, "Failed to read from BBA, err=%d", readBytes);
+        break;
+      }
+      else if (self->readEnabled.IsSet())
+      {
+        DEBUG_LOG(SP1, "Read data: %s",
+                  ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
+        self->mRecvBufferLength = readBytes;
+        self->RecvHandlePacket();
+      }
     }
   }
 }
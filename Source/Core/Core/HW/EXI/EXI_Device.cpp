@@ -48,6 +48,20 @@ void IEXIDevice::ImmReadWrite(u32& data, u32 size)
 
 void IEXIDevice::DMAWrite(u32 address, u32 size)
 {
+  // Generic fallback for devices without a bulk DMA path: resolve the
+  // physical address once instead of decoding it again for every byte.
+  // TransferByte still sees each byte in order.
+  const u8* src = Memory::GetPointer(address);
+  if (src != nullptr)
+  {
+    while (size--)
+    {
+      u8 byte = *src++;
+      TransferByte(byte);
+    }
+    return;
+  }
+
   while (size--)
   {
     u8 byte = Memory::Read_U8(address++);
@@ -57,6 +71,18 @@ void IEXIDevice::DMAWrite(u32 address, u32 size)
 
 void IEXIDevice::DMARead(u32 address, u32 size)
 {
+  u8* dst = Memory::GetPointer(address);
+  if (dst != nullptr)
+  {
+    while (size--)
+    {
+      u8 byte = 0;
+      TransferByte(byte);
+      *dst++ = byte;
+    }
+    return;
+  }
+
   while (size--)
   {
     u8 byte = 0;
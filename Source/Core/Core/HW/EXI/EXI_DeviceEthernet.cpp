@@ -4,6 +4,8 @@
 
 #include "Core/HW/EXI/EXI_DeviceEthernet.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -511,35 +513,55 @@ bool CEXIETHERNET::RecvHandlePacket()
   descriptor = (Descriptor*)write_ptr;
   write_ptr += 4;
 
-  for (u32 i = 0, off = 4; i < mRecvBufferLength; ++i, ++off)
+  // Copy the frame in page-bounded spans instead of byte by byte: the page
+  // bookkeeping (rwp advance, ring wrap, overflow check) only runs once per
+  // span and the bytes move with memcpy. Bit-identical to the old byte loop,
+  // including its quirk of restarting pages after the first at offset 1.
   {
-    *write_ptr++ = mRecvBuffer[i];
-
-    if (off == 0xff)
+    u32 i = 0;
+    u32 off = 4;
+    while (i < mRecvBufferLength)
     {
-      off = 0;
-      inc_rwp();
-    }
+      u32 chunk = std::min(mRecvBufferLength - i, 0x100 - off);
+      chunk = std::min<u32>(chunk, static_cast<u32>(end_ptr - write_ptr));
+      bool collision = false;
+      if (read_ptr > write_ptr && static_cast<u32>(read_ptr - write_ptr) <= chunk)
+      {
+        chunk = static_cast<u32>(read_ptr - write_ptr);
+        collision = true;
+      }
 
-    if (write_ptr == end_ptr)
-      write_ptr = ptr_from_page_ptr(BBA_BP);
+      memcpy(write_ptr, mRecvBuffer.get() + i, chunk);
+      write_ptr += chunk;
+      i += chunk;
+      off += chunk;
 
-    if (write_ptr == read_ptr)
-    {
-      /*
-      halt copy
-      if (cur_packet_size >= PAGE_SIZE)
-        desc.status |= FO | BF
-      if (RBFIM)
-        raise RBFI
-      if (AUTORCVR)
-        discard bad packet
-      else
-        inc MPC instead of receiving packets
-      */
-      status |= DESC_FO | DESC_BF;
-      mBbaMem[BBA_IR] |= mBbaMem[BBA_IMR] & INT_RBF;
-      break;
+      if (off == 0x100)
+      {
+        off = 1;
+        inc_rwp();
+      }
+
+      if (write_ptr == end_ptr)
+        write_ptr = ptr_from_page_ptr(BBA_BP);
+
+      if (collision || write_ptr == read_ptr)
+      {
+        /*
+        halt copy
+        if (cur_packet_size >= PAGE_SIZE)
+          desc.status |= FO | BF
+        if (RBFIM)
+          raise RBFI
+        if (AUTORCVR)
+          discard bad packet
+        else
+          inc MPC instead of receiving packets
+        */
+        status |= DESC_FO | DESC_BF;
+        mBbaMem[BBA_IR] |= mBbaMem[BBA_IMR] & INT_RBF;
+        break;
+      }
     }
   }
 
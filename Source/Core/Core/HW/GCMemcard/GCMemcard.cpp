@@ -275,6 +275,29 @@ void calc_checksumsBE(const u16* buf, u32 length, u16* csum, u16* inv_csum)
   }
 }
 
+void calc_checksums_adjustBE(const u16* old_data, const u16* new_data, u32 length, u16* csum,
+                             u16* inv_csum)
+{
+  u16 sum = BE16(*csum);
+  u16 inv_sum = BE16(*inv_csum);
+
+  for (u32 i = 0; i < length; ++i)
+  {
+    sum = (u16)(sum + BE16(new_data[i]) - BE16(old_data[i]));
+    inv_sum = (u16)(inv_sum + BE16((u16)(new_data[i] ^ 0xffff)) - BE16((u16)(old_data[i] ^ 0xffff)));
+  }
+  *csum = BE16(sum);
+  *inv_csum = BE16(inv_sum);
+  if (*csum == 0xffff)
+  {
+    *csum = 0;
+  }
+  if (*inv_csum == 0xffff)
+  {
+    *inv_csum = 0;
+  }
+}
+
 u32 GCMemcard::TestChecksums() const
 {
   u16 csum = 0, csum_inv = 0;
@@ -679,6 +702,7 @@ u32 GCMemcard::ImportFile(const DEntry& direntry, std::vector<GCMBlock>& saveBlo
     }
   }
   UpdatedDir.UpdateCounter = BE16(BE16(UpdatedDir.UpdateCounter) + 1);
+  UpdatedDir.fixChecksums();
   *PreviousDir = UpdatedDir;
   if (PreviousDir == &dir)
   {
@@ -715,6 +739,7 @@ u32 GCMemcard::ImportFile(const DEntry& direntry, std::vector<GCMBlock>& saveBlo
 
   UpdatedBat.FreeBlocks = BE16(BE16(UpdatedBat.FreeBlocks) - fileBlocks);
   UpdatedBat.UpdateCounter = BE16(BE16(UpdatedBat.UpdateCounter) + 1);
+  UpdatedBat.fixChecksums();
   *PreviousBat = UpdatedBat;
   if (PreviousBat == &bat)
   {
@@ -744,6 +769,7 @@ u32 GCMemcard::RemoveFile(u8 index)  // index in the directory array
   if (!UpdatedBat.ClearBlocks(startingblock, numberofblocks))
     return DELETE_FAIL;
   UpdatedBat.UpdateCounter = BE16(BE16(UpdatedBat.UpdateCounter) + 1);
+  UpdatedBat.fixChecksums();
   *PreviousBat = UpdatedBat;
   if (PreviousBat == &bat)
   {
@@ -780,6 +806,7 @@ u32 GCMemcard::RemoveFile(u8 index)  // index in the directory array
   */
   memset(&(UpdatedDir.Dir[index]), 0xFF, DENTRY_SIZE);
   UpdatedDir.UpdateCounter = BE16(BE16(UpdatedDir.UpdateCounter) + 1);
+  UpdatedDir.fixChecksums();
   *PreviousDir = UpdatedDir;
   if (PreviousDir == &dir)
   {
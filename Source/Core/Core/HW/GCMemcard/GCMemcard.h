@@ -95,6 +95,13 @@ struct GCMBlock
 };
 
 void calc_checksumsBE(const u16* buf, u32 length, u16* csum, u16* inv_csum);
+// Adjusts an existing checksum pair for replacing `length` words of old_data
+// with new_data; the checksum is additive, so only the difference of the
+// replaced span is needed. Not valid when either stored value is 0: the
+// normalization above maps both raw 0 and raw 0xFFFF to 0, so the starting
+// sum cannot be recovered - recompute with calc_checksumsBE instead.
+void calc_checksums_adjustBE(const u16* old_data, const u16* new_data, u32 length, u16* csum,
+                             u16* inv_csum);
 
 #pragma pack(push, 1)
 struct Header  // Offset    Size    Description
@@ -226,8 +233,18 @@ struct Directory
   }
   void Replace(DEntry d, int idx)
   {
-    Dir[idx] = d;
-    fixChecksums();
+    if (Checksum != 0 && Checksum_Inv != 0)
+    {
+      calc_checksums_adjustBE((u16*)&Dir[idx], (u16*)&d, DENTRY_SIZE / 2, &Checksum,
+                              &Checksum_Inv);
+      Dir[idx] = d;
+    }
+    else
+    {
+      // A stored value of 0 is ambiguous, see calc_checksums_adjustBE.
+      Dir[idx] = d;
+      fixChecksums();
+    }
   }
   void fixChecksums() { calc_checksumsBE((u16*)this, 0xFFE, &Checksum, &Checksum_Inv); }
 };
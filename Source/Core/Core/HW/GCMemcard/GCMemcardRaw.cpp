@@ -4,12 +4,15 @@
 
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -25,6 +28,19 @@
 #define SIZE_TO_Mb (1024 * 8 * 16)
 #define MC_HDR_SIZE 0xA000
 
+// Incremental flushes are journaled so that a crash in the middle of
+// updating the .raw file can be replayed on the next boot. The journal is
+// written and fsynced before the card image is touched, and deleted after
+// the image update completes; an incomplete journal (no commit marker)
+// means the image was never modified and can be ignored.
+static const u32 JOURNAL_MAGIC = 0x4743444A;   // "GCDJ"
+static const u32 JOURNAL_COMMIT = 0x434D4954;  // "CMIT"
+
+static std::string JournalPath(const std::string& filename)
+{
+  return filename + ".journal";
+}
+
 MemoryCard::MemoryCard(const std::string& filename, int card_index, u16 size_mbits)
     : MemoryCardBase(card_index, size_mbits), m_filename(filename)
 {
@@ -39,6 +55,9 @@ MemoryCard::MemoryCard(const std::string& filename, int card_index, u16 size_mbi
 
     INFO_LOG(EXPANSIONINTERFACE, "Reading memory card %s", m_filename.c_str());
     file.ReadBytes(&m_memcard_data[0], m_memory_card_size);
+    file.Close();
+
+    ReplayJournal();
   }
   else
   {
@@ -55,6 +74,8 @@ MemoryCard::MemoryCard(const std::string& filename, int card_index, u16 size_mbi
     INFO_LOG(EXPANSIONINTERFACE, "No memory card found. A new one was created instead.");
   }
 
+  m_dirty_blocks.resize(m_memory_card_size / BLOCK_SIZE);
+
   // Class members (including inherited ones) have now been initialized, so
   // it's safe to startup the flush thread (which reads them).
   m_flush_buffer = std::make_unique<u8[]>(m_memory_card_size);
@@ -71,6 +92,52 @@ MemoryCard::~MemoryCard()
   }
 }
 
+void MemoryCard::ReplayJournal()
+{
+  const std::string journal_path = JournalPath(m_filename);
+  if (!File::Exists(journal_path))
+    return;
+
+  File::IOFile journal(journal_path, "rb");
+  u32 magic = 0, card_size = 0, num_entries = 0;
+  bool valid = journal && journal.ReadBytes(&magic, sizeof(magic)) &&
+               journal.ReadBytes(&card_size, sizeof(card_size)) &&
+               journal.ReadBytes(&num_entries, sizeof(num_entries)) && magic == JOURNAL_MAGIC &&
+               card_size == m_memory_card_size && num_entries <= card_size / BLOCK_SIZE;
+
+  std::vector<std::pair<u32, std::vector<u8>>> entries;
+  for (u32 i = 0; valid && i < num_entries; ++i)
+  {
+    u32 offset = 0;
+    std::vector<u8> data(BLOCK_SIZE);
+    valid = journal.ReadBytes(&offset, sizeof(offset)) &&
+            journal.ReadBytes(data.data(), BLOCK_SIZE) && offset + BLOCK_SIZE <= card_size;
+    if (valid)
+      entries.emplace_back(offset, std::move(data));
+  }
+
+  u32 commit = 0;
+  valid = valid && journal.ReadBytes(&commit, sizeof(commit)) && commit == JOURNAL_COMMIT;
+  journal.Close();
+
+  if (valid)
+  {
+    INFO_LOG(EXPANSIONINTERFACE, "Replaying memory card journal %s", journal_path.c_str());
+    m_dirty_blocks.resize(m_memory_card_size / BLOCK_SIZE);
+    for (const auto& entry : entries)
+    {
+      memcpy(&m_memcard_data[entry.first], entry.second.data(), BLOCK_SIZE);
+      m_dirty_blocks[entry.first / BLOCK_SIZE] = 1;
+    }
+    // Have the flush thread bring the card image up to date.
+    MakeDirty();
+  }
+
+  // An incomplete journal means the card image was never touched, so the
+  // journal can simply be dropped either way.
+  File::Delete(journal_path);
+}
+
 void MemoryCard::FlushThread()
 {
   if (!SConfig::GetInstance().bEnableMemcardSdWriting)
@@ -100,6 +167,7 @@ void MemoryCard::FlushThread()
     // Opening the file is purposefully done each iteration to ensure the
     // file doesn't disappear out from under us after the first check.
     File::IOFile file(m_filename, "r+b");
+    bool write_whole_card = false;
 
     if (!file)
     {
@@ -110,6 +178,7 @@ void MemoryCard::FlushThread()
         File::CreateFullPath(dir);
       }
       file.Open(m_filename, "wb");
+      write_whole_card = true;
     }
 
     // Note - file may have changed above, after ctor
@@ -127,18 +196,83 @@ void MemoryCard::FlushThread()
       return;
     }
 
+    std::vector<u8> dirty_blocks;
     {
       std::unique_lock<std::mutex> l(m_flush_mutex);
       memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+      dirty_blocks = m_dirty_blocks;
+      std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), 0);
+    }
+
+    if (!write_whole_card && file.GetSize() != m_memory_card_size)
+      write_whole_card = true;
+
+    u32 num_dirty = 0;
+    for (u8 dirty : dirty_blocks)
+      num_dirty += dirty;
+
+    bool wrote = false;
+    if (write_whole_card)
+    {
+      file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
+      wrote = true;
+    }
+    else if (num_dirty != 0)
+    {
+      // Journal the dirty blocks before touching the card image so an
+      // interrupted update can be replayed by ReplayJournal().
+      const std::string journal_path = JournalPath(m_filename);
+      bool journaled;
+      {
+        File::IOFile journal(journal_path, "wb");
+        journaled = journal && journal.WriteBytes(&JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) &&
+                    journal.WriteBytes(&m_memory_card_size, sizeof(m_memory_card_size)) &&
+                    journal.WriteBytes(&num_dirty, sizeof(num_dirty));
+        for (u32 i = 0; journaled && i < dirty_blocks.size(); ++i)
+        {
+          if (!dirty_blocks[i])
+            continue;
+          const u32 offset = i * BLOCK_SIZE;
+          journaled = journal.WriteBytes(&offset, sizeof(offset)) &&
+                      journal.WriteBytes(&m_flush_buffer[offset], BLOCK_SIZE);
+        }
+        journaled = journaled && journal.WriteBytes(&JOURNAL_COMMIT, sizeof(JOURNAL_COMMIT)) &&
+                    journal.Flush();
+      }
+
+      if (journaled)
+      {
+        // Only the blocks that changed are rewritten; save-heavy titles
+        // touch a few blocks per autosave, not the whole card.
+        for (u32 i = 0; i < dirty_blocks.size(); ++i)
+        {
+          if (!dirty_blocks[i])
+            continue;
+          file.Seek(i * BLOCK_SIZE, SEEK_SET);
+          file.WriteBytes(&m_flush_buffer[i * BLOCK_SIZE], BLOCK_SIZE);
+        }
+        file.Flush();
+        File::Delete(journal_path);
+      }
+      else
+      {
+        // No journal protection available; fall back to rewriting the
+        // whole image like the old code did.
+        file.Seek(0, SEEK_SET);
+        file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
+      }
+      wrote = true;
     }
-    file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
 
     if (!do_exit)
     {
-      Core::DisplayMessage(StringFromFormat("Wrote memory card %c contents to %s",
-                                            m_card_index ? 'B' : 'A', m_filename.c_str())
-                               .c_str(),
-                           4000);
+      if (wrote)
+      {
+        Core::DisplayMessage(StringFromFormat("Wrote memory card %c contents to %s",
+                                              m_card_index ? 'B' : 'A', m_filename.c_str())
+                                 .c_str(),
+                             4000);
+      }
     }
     else
     {
@@ -152,6 +286,14 @@ void MemoryCard::MakeDirty()
   m_dirty.Set();
 }
 
+void MemoryCard::MarkDirtyRange(u32 address, u32 length)
+{
+  const u32 first = address / BLOCK_SIZE;
+  const u32 last = (address + length - 1) / BLOCK_SIZE;
+  for (u32 i = first; i <= last && i < m_dirty_blocks.size(); ++i)
+    m_dirty_blocks[i] = 1;
+}
+
 s32 MemoryCard::Read(u32 src_address, s32 length, u8* dest_address)
 {
   if (!IsAddressInBounds(src_address))
@@ -175,6 +317,7 @@ s32 MemoryCard::Write(u32 dest_address, s32 length, const u8* src_address)
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memcpy(&m_memcard_data[dest_address], src_address, length);
+    MarkDirtyRange(dest_address, length);
   }
   MakeDirty();
   return length;
@@ -191,6 +334,7 @@ void MemoryCard::ClearBlock(u32 address)
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memset(&m_memcard_data[address], 0xFF, BLOCK_SIZE);
+    MarkDirtyRange(address, BLOCK_SIZE);
   }
   MakeDirty();
 }
@@ -200,13 +344,23 @@ void MemoryCard::ClearAll()
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
+    MarkDirtyRange(0, m_memory_card_size);
   }
   MakeDirty();
 }
 
 void MemoryCard::DoState(PointerWrap& p)
 {
+  std::unique_lock<std::mutex> l(m_flush_mutex);
   p.Do(m_card_index);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+
+  // Loading a state replaces the card contents wholesale; make sure the
+  // flush thread writes the image back out.
+  if (p.GetMode() == PointerWrap::MODE_READ)
+  {
+    MarkDirtyRange(0, m_memory_card_size);
+    MakeDirty();
+  }
 }
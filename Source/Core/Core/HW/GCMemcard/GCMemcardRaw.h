@@ -8,6 +8,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -29,6 +30,10 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
+  // Must be called with m_flush_mutex held.
+  void MarkDirtyRange(u32 address, u32 length);
+  void ReplayJournal();
+
   std::string m_filename;
   std::unique_ptr<u8[]> m_memcard_data;
   std::unique_ptr<u8[]> m_flush_buffer;
@@ -36,4 +41,7 @@ private:
   std::mutex m_flush_mutex;
   Common::Event m_flush_trigger;
   Common::Flag m_dirty;
+  // per-block dirty flags, guarded by m_flush_mutex; lets the flush thread
+  // write only the blocks that changed instead of the whole card image
+  std::vector<u8> m_dirty_blocks;
 };
@@ -4,11 +4,14 @@
 
 #include "Core/HW/GCPad.h"
 
+#include <array>
+#include <atomic>
 #include <cstring>
 
 #include "Common/Common.h"
 #include "Core/HW/GCPadEmu.h"
 #include "InputCommon/ControllerEmu/ControlGroup/ControlGroup.h"
+#include "InputCommon/ControllerEmu/ControllerEmu.h"
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 #include "InputCommon/GCPadStatus.h"
 #include "InputCommon/InputConfig.h"
@@ -16,6 +19,13 @@
 namespace Pad
 {
 static InputConfig s_config("GCPadNew", _trans("Pad"), "GCPad");
+
+// Latest pad state published by UpdateStatusSnapshots(). The sequence counter
+// is bumped to an odd value before a snapshot is written and to an even value
+// afterwards, so GetStatus can read without taking the emulated controller's
+// state lock once per channel.
+static std::array<GCPadStatus, 4> s_status_snapshot;
+static std::array<std::atomic<u32>, 4> s_status_snapshot_seq;
 InputConfig* GetConfig()
 {
   return &s_config;
@@ -52,7 +62,39 @@ bool IsInitialized()
 
 GCPadStatus GetStatus(int pad_num)
 {
-  return static_cast<GCPad*>(s_config.GetController(pad_num))->GetInput();
+  auto& seq = s_status_snapshot_seq[pad_num];
+
+  // Nothing published yet (e.g. the config dialog polling outside of
+  // emulation) - fall back to querying the controller directly.
+  if (seq.load(std::memory_order_acquire) == 0)
+    return static_cast<GCPad*>(s_config.GetController(pad_num))->GetInput();
+
+  GCPadStatus pad_status;
+  u32 seq_before, seq_after;
+  do
+  {
+    seq_before = seq.load(std::memory_order_acquire);
+    pad_status = s_status_snapshot[pad_num];
+    seq_after = seq.load(std::memory_order_acquire);
+  } while (seq_before != seq_after || (seq_before & 1));
+  return pad_status;
+}
+
+void UpdateStatusSnapshots()
+{
+  // The state lock is recursive, so holding it across the four GetInput calls
+  // means at most one contended acquisition per poll instead of one per
+  // channel.
+  const auto lock = ControllerEmu::EmulatedController::GetStateLock();
+  for (int pad_num = 0; pad_num < 4; ++pad_num)
+  {
+    const GCPadStatus pad_status =
+        static_cast<GCPad*>(s_config.GetController(pad_num))->GetInput();
+    auto& seq = s_status_snapshot_seq[pad_num];
+    seq.fetch_add(1, std::memory_order_relaxed);
+    s_status_snapshot[pad_num] = pad_status;
+    seq.fetch_add(1, std::memory_order_release);
+  }
 }
 
 ControllerEmu::ControlGroup* GetGroup(int pad_num, PadGroup group)
@@ -26,6 +26,7 @@ bool IsInitialized();
 InputConfig* GetConfig();
 
 GCPadStatus GetStatus(int pad_num);
+void UpdateStatusSnapshots();
 ControllerEmu::ControlGroup* GetGroup(int pad_num, PadGroup group);
 void Rumble(int pad_num, ControlState strength);
 void ResetRumble(int pad_num);
@@ -9,6 +9,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FastCopy.h"
 #include "Common/Swap.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/ProcessorInterface.h"
@@ -30,7 +31,7 @@ namespace GPFifo
 // the same function could use both methods. Compile 2 different versions of each such block?
 
 // More room for the fastmodes
-alignas(32) static u8 s_gather_pipe[GATHER_PIPE_SIZE * 16];
+alignas(32) static u8 s_gather_pipe[GATHER_PIPE_EXTRA_SIZE];
 
 static size_t GetGatherPipeCount()
 {
@@ -75,7 +76,7 @@ void UpdateGatherPipe()
   for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
   {
     // copy the GatherPipe
-    memcpy(cur_mem, s_gather_pipe + processed, GATHER_PIPE_SIZE);
+    Common::CopyFixed<GATHER_PIPE_SIZE>(cur_mem, s_gather_pipe + processed);
     pipe_count -= GATHER_PIPE_SIZE;
 
     // increase the CPUWritePointer
@@ -12,7 +12,10 @@ namespace GPFifo
 {
 enum
 {
-  GATHER_PIPE_SIZE = 32
+  GATHER_PIPE_SIZE = 32,
+  // Size of the backing buffer. The JIT defers its overflow checks and may
+  // overfill past GATHER_PIPE_SIZE up to this limit before a drain.
+  GATHER_PIPE_EXTRA_SIZE = GATHER_PIPE_SIZE * 16
 };
 
 // Init
@@ -9,6 +9,7 @@
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FastCopy.h"
 #include "Common/Swap.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -95,8 +96,7 @@ void CopyFromEmuSwapped(T* data, u32 address, size_t size)
   if (src == nullptr)
     return;
 
-  for (size_t i = 0; i < size / sizeof(T); i++)
-    data[i] = Common::FromBigEndian(src[i]);
+  Common::SwapCopy(data, src, size / sizeof(T));
 }
 
 template <typename T>
@@ -107,7 +107,6 @@ void CopyToEmuSwapped(u32 address, const T* data, size_t size)
   if (dest == nullptr)
     return;
 
-  for (size_t i = 0; i < size / sizeof(T); i++)
-    dest[i] = Common::FromBigEndian(data[i]);
+  Common::SwapCopy(dest, data, size / sizeof(T));
 }
 }
@@ -13,6 +13,7 @@
 #include "Common/CommonTypes.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
+#include "Core/HW/GCPad.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI_DeviceGBA.h"
@@ -20,6 +21,8 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 
+#include "VideoCommon/InputLatencyTelemetry.h"
+
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
 namespace SerialInterface
@@ -569,6 +572,11 @@ void UpdateDevices()
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
   g_controller_interface.UpdateInput();
+  InputLatencyTelemetry::OnInputPoll();
+
+  // Publish one pad state snapshot per poll so the per-channel GetData calls
+  // below read it wait-free instead of taking the state lock four times.
+  Pad::UpdateStatusSnapshots();
 
   // Update channels and set the status bit if there's new data
   s_status_reg.RDST0 =
@@ -4,6 +4,7 @@
 
 #include "Core/HW/SI/SI_DeviceGBA.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <memory>
@@ -161,9 +162,63 @@ GBASockServer::GBASockServer()
 
 GBASockServer::~GBASockServer()
 {
+  if (m_transfer_thread.joinable())
+  {
+    m_thread_running.Clear();
+    m_transfer_request.Set();
+    m_transfer_thread.join();
+  }
   Disconnect();
 }
 
+void GBASockServer::SendAsync(const u8* si_buffer)
+{
+  std::copy(si_buffer, si_buffer + m_send_data.size(), m_send_data.begin());
+  m_response_len.store(-1, std::memory_order_relaxed);
+
+  // The worker is only started once a GBA peer actually transfers.
+  if (!m_transfer_thread.joinable())
+  {
+    m_thread_running.Set();
+    m_transfer_thread = std::thread(&GBASockServer::TransferThread, this);
+  }
+  m_transfer_request.Set();
+}
+
+int GBASockServer::GetResponse(u8* si_buffer)
+{
+  const int num_received = m_response_len.load(std::memory_order_acquire);
+  if (num_received < 0)
+    return -1;
+
+  // Only copy the bytes Receive() actually wrote (indices 0-3 and 7).
+  for (size_t i = 0; i < RECV_MAX_SIZE; i++)
+    si_buffer[i ^ 3] = m_recv_data[i ^ 3];
+  return num_received;
+}
+
+// Everything that can block on the peer - the send, the response selector
+// wait and the receive - happens here. The SI state machine in RunBuffer
+// keeps returning 0 ("poll again later") until the response is published,
+// so the CPU thread never waits on a socket. Only one transfer is ever in
+// flight, so the sockets are not touched concurrently: the CPU thread uses
+// them again only after consuming the response.
+void GBASockServer::TransferThread()
+{
+  Common::SetCurrentThreadName("GBA Link Transfer");
+  while (m_thread_running.IsSet())
+  {
+    m_transfer_request.Wait();
+    if (!m_thread_running.IsSet())
+      break;
+
+    Send(m_send_data.data());
+    m_recv_data.fill(0);
+    const int num_received = IsConnected() ? Receive(m_recv_data.data()) : 0;
+    m_response_len.store(num_received, std::memory_order_release);
+  }
+}
+
 void GBASockServer::Disconnect()
 {
   if (m_client)
@@ -302,7 +357,7 @@ int CSIDevice_GBA::RunBuffer(u8* buffer, int length)
       NOTICE_LOG(SERIALINTERFACE, "%01d cmd %02x [> %02x%02x%02x%02x]", m_device_number, buffer[3],
                  buffer[2], buffer[1], buffer[0], buffer[7]);
 #endif
-      m_sock_server.Send(buffer);
+      m_sock_server.SendAsync(buffer);
     }
     else
     {
@@ -328,7 +383,10 @@ int CSIDevice_GBA::RunBuffer(u8* buffer, int length)
   // [[fallthrough]]
   case NextAction::ReceiveResponse:
   {
-    int num_data_received = m_sock_server.Receive(buffer);
+    const int num_data_received = m_sock_server.GetResponse(buffer);
+    // Still in flight on the link thread; tell SI to poll again.
+    if (num_data_received < 0)
+      return 0;
     m_next_action = NextAction::SendCommand;
     if (num_data_received == 0)
     {
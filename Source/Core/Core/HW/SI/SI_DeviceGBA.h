@@ -5,11 +5,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include <SFML/Network.hpp>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Core/HW/SI/SI_Device.h"
 
 // GameBoy Advance "Link Cable"
@@ -27,15 +31,35 @@ public:
   bool Connect();
   bool IsConnected();
   void ClockSync();
-  void Send(const u8* si_buffer);
-  int Receive(u8* si_buffer);
+
+  // Joybus transfers run on a per-device worker thread so the socket
+  // round-trip to the GBA emulator peer never stalls the CPU thread.
+  // SendAsync hands the SI buffer to the worker; GetResponse returns -1
+  // while the transfer is still in flight, otherwise the response length
+  // (0 meaning no response, as before).
+  void SendAsync(const u8* si_buffer);
+  int GetResponse(u8* si_buffer);
 
 private:
   void Disconnect();
+  void TransferThread();
+  void Send(const u8* si_buffer);
+  int Receive(u8* si_buffer);
 
   std::unique_ptr<sf::TcpSocket> m_client;
   std::unique_ptr<sf::TcpSocket> m_clock_sync;
 
+  // The joybus byte swizzle (i ^ 3) addresses SI buffer bytes up to index 7.
+  std::array<u8, 8> m_send_data{};
+  std::array<u8, 8> m_recv_data{};
+  // -1 while a transfer is in flight; the worker stores the response length
+  // with release ordering after filling m_recv_data.
+  std::atomic<int> m_response_len{0};
+
+  std::thread m_transfer_thread;
+  Common::Event m_transfer_request;
+  Common::Flag m_thread_running;
+
   u64 m_last_time_slice = 0;
   bool m_booted = false;
 };
@@ -8,6 +8,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FastCopy.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/CoreTiming.h"
@@ -89,11 +90,9 @@ int CSIDevice_GCController::RunBuffer(u8* buffer, int length)
     if (!m_calibrated)
       Calibrate();
 
-    u8* calibration = reinterpret_cast<u8*>(&m_origin);
-    for (int i = 0; i < (int)sizeof(SOrigin); i++)
-    {
-      buffer[i ^ 3] = *calibration++;
-    }
+    // The SI buffer swizzle (i ^ 3) is a byteswap of each 32 bit word.
+    Common::SwapCopy(reinterpret_cast<u32*>(buffer), reinterpret_cast<const u32*>(&m_origin),
+                     sizeof(SOrigin) / sizeof(u32));
   }
   break;
 
@@ -105,11 +104,9 @@ int CSIDevice_GCController::RunBuffer(u8* buffer, int length)
     if (!m_calibrated)
       Calibrate();
 
-    u8* calibration = reinterpret_cast<u8*>(&m_origin);
-    for (int i = 0; i < (int)sizeof(SOrigin); i++)
-    {
-      buffer[i ^ 3] = *calibration++;
-    }
+    // The SI buffer swizzle (i ^ 3) is a byteswap of each 32 bit word.
+    Common::SwapCopy(reinterpret_cast<u32*>(buffer), reinterpret_cast<const u32*>(&m_origin),
+                     sizeof(SOrigin) / sizeof(u32));
   }
   break;
 
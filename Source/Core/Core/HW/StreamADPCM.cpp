@@ -18,27 +18,18 @@ static s32 histl2;
 static s32 histr1;
 static s32 histr2;
 
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+// Predictor coefficients indexed by the filter select nibble. Only 0-3 are
+// defined; the remaining entries decode as filter 0, like the switch that
+// used to be here.
+static const s32 COEF1[16] = {0, 0x3c, 0x73, 0x62};
+static const s32 COEF2[16] = {0, 0, -0x34, -0x37};
+
+static s16 ADPDecodeSample(s32 bits, s32 shift, s32 coef1, s32 coef2, s32& hist1, s32& hist2)
 {
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
+  s32 hist = (hist1 * coef1) + (hist2 * coef2);
   hist = MathUtil::Clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+  s32 cur = (((s16)(bits << 12) >> shift) << 6) + hist;
 
   hist2 = hist1;
   hist1 = cur;
@@ -67,12 +58,33 @@ void DoState(PointerWrap& p)
 
 void DecodeBlock(s16* pcm, const u8* adpcm)
 {
+  // The filter select and shift are per-block constants, so hoist them out
+  // of the sample loop: the predictor becomes two multiplies instead of a
+  // per-sample switch. The history recurrence itself is serial (every sample
+  // feeds the next), so the win comes from keeping it in locals the compiler
+  // can hold in registers for the whole block.
+  const s32 coefl1 = COEF1[adpcm[0] >> 4];
+  const s32 coefl2 = COEF2[adpcm[0] >> 4];
+  const s32 shiftl = adpcm[0] & 0xf;
+  const s32 coefr1 = COEF1[adpcm[1] >> 4];
+  const s32 coefr2 = COEF2[adpcm[1] >> 4];
+  const s32 shiftr = adpcm[1] & 0xf;
+
+  s32 hl1 = histl1;
+  s32 hl2 = histl2;
+  s32 hr1 = histr1;
+  s32 hr2 = histr2;
+
   for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
   {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-      histl1, histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-      histr1, histr2);
+    const u8 byte = adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)];
+    pcm[i * 2] = ADPDecodeSample(byte & 0xf, shiftl, coefl1, coefl2, hl1, hl2);
+    pcm[i * 2 + 1] = ADPDecodeSample(byte >> 4, shiftr, coefr1, coefr2, hr1, hr2);
   }
+
+  histl1 = hl1;
+  histl2 = hl2;
+  histr1 = hr1;
+  histr2 = hr2;
 }
 }
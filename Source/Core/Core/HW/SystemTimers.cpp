@@ -45,6 +45,7 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 
 #include "Core/HW/SystemTimers.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 
@@ -69,7 +70,6 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 namespace SystemTimers
 {
 static CoreTiming::EventType* et_Dec;
-static CoreTiming::EventType* et_VI;
 static CoreTiming::EventType* et_AudioDMA;
 static CoreTiming::EventType* et_DSP;
 static CoreTiming::EventType* et_IPC_HLE;
@@ -121,12 +121,6 @@ static void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
   }
 }
 
-static void VICallback(u64 userdata, s64 cyclesLate)
-{
-  VideoInterface::Update(CoreTiming::GetTicks() - cyclesLate);
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine() - cyclesLate, et_VI);
-}
-
 static void DecrementerCallback(u64 userdata, s64 cyclesLate)
 {
   PowerPC::ppcState.spr[SPR_DEC] = 0xFFFFFFFF;
@@ -195,6 +189,64 @@ static void PatchEngineCallback(u64 userdata, s64 cycles_late)
   CoreTiming::ScheduleEvent(next_schedule, et_PatchEngine, cycles_pruned);
 }
 
+// Adaptive clock governor. The throttle event runs once per emulated
+// millisecond and tracks how far emulated time has drifted from wall time, so
+// the drift is a direct measure of frame deadline headroom: positive means
+// the throttle is sleeping, negative means the host cannot keep up. When the
+// emulator falls behind for a sustained stretch, the effective clock is
+// stepped down towards the configured floor; it is only stepped back up -
+// more slowly, and in smaller steps - after headroom has been solid for a
+// while, so the factor does not oscillate at the boundary.
+static float s_adaptive_clock_factor = 1.0f;
+static int s_governor_behind_ms = 0;
+static int s_governor_ahead_ms = 0;
+
+float GetAdaptiveClockFactor()
+{
+  return s_adaptive_clock_factor;
+}
+
+static void RunClockGovernor(int drift_ms)
+{
+  const SConfig& config = SConfig::GetInstance();
+  // Scaling the clock changes event interleaving, so never engage the
+  // governor when movies or netplay need deterministic timing.
+  if (!config.m_OCGovernorEnable || config.m_EmulationSpeed != 1.0f || Core::WantsDeterminism())
+  {
+    s_adaptive_clock_factor = 1.0f;
+    s_governor_behind_ms = 0;
+    s_governor_ahead_ms = 0;
+    return;
+  }
+
+  // The throttle lets the drift float within +/- iTimingVariance before it
+  // resynchronizes, so judge headroom relative to that window.
+  const int variance = std::max(1, config.iTimingVariance);
+  if (drift_ms < -variance / 4)
+  {
+    s_governor_behind_ms++;
+    s_governor_ahead_ms = 0;
+  }
+  else if (drift_ms > variance / 2)
+  {
+    s_governor_ahead_ms++;
+    s_governor_behind_ms = 0;
+  }
+
+  const float min_factor = std::min(1.0f, std::max(0.5f, config.m_OCGovernorMinFactor));
+  if (s_governor_behind_ms >= 100)
+  {
+    s_adaptive_clock_factor = std::max(min_factor, s_adaptive_clock_factor - 0.05f);
+    s_governor_behind_ms = 0;
+    s_governor_ahead_ms = 0;
+  }
+  else if (s_governor_ahead_ms >= 1000)
+  {
+    s_adaptive_clock_factor = std::min(1.0f, s_adaptive_clock_factor + 0.025f);
+    s_governor_ahead_ms = 0;
+  }
+}
+
 static void ThrottleCallback(u64 last_time, s64 cyclesLate)
 {
   // Allow the GPU thread to sleep. Setting this flag here limits the wakeups to 1 kHz.
@@ -205,11 +257,25 @@ static void ThrottleCallback(u64 last_time, s64 cyclesLate)
   int diff = (u32)last_time - time;
   const SConfig& config = SConfig::GetInstance();
   bool frame_limiter = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled();
+  if (frame_limiter)
+    RunClockGovernor(diff);
+  else if (s_adaptive_clock_factor != 1.0f)
+    s_adaptive_clock_factor = 1.0f;
   u32 next_event = GetTicksPerSecond() / 1000;
   if (frame_limiter)
   {
     if (config.m_EmulationSpeed != 1.0f)
+    {
       next_event = u32(next_event * config.m_EmulationSpeed);
+    }
+    else
+    {
+      // At 1x, apply the frame pacing micro-adjustment (at most +/-0.5%) that
+      // phase-locks the guest VI rate to the host display's present cadence.
+      const float pacing = Core::GetPacingAdjustment();
+      if (pacing != 1.0f)
+        next_event = u32(next_event * pacing);
+    }
     const int max_fallback = config.iTimingVariance;
     if (abs(diff) > max_fallback)
     {
@@ -254,6 +320,10 @@ void Init()
   // System internal sample rate is fixed at 32KHz * 4 (16bit Stereo) / 32 bytes DMA
   s_audio_dma_period = s_cpu_core_clock / (AudioInterface::GetAIDSampleRate() * 4 / 32);
 
+  s_adaptive_clock_factor = 1.0f;
+  s_governor_behind_ms = 0;
+  s_governor_ahead_ms = 0;
+
   Common::Timer::IncreaseResolution();
   // store and convert localtime at boot to timebase ticks
   if (SConfig::GetInstance().bEnableCustomRTC)
@@ -272,14 +342,12 @@ void Init()
   CoreTiming::SetFakeDecStartTicks(CoreTiming::GetTicks());
 
   et_Dec = CoreTiming::RegisterEvent("DecCallback", DecrementerCallback);
-  et_VI = CoreTiming::RegisterEvent("VICallback", VICallback);
   et_DSP = CoreTiming::RegisterEvent("DSPCallback", DSPCallback);
   et_AudioDMA = CoreTiming::RegisterEvent("AudioDMACallback", AudioDMACallback);
   et_IPC_HLE = CoreTiming::RegisterEvent("IPC_HLE_UpdateCallback", IPC_HLE_UpdateCallback);
   et_PatchEngine = CoreTiming::RegisterEvent("PatchEngine", PatchEngineCallback);
   et_Throttle = CoreTiming::RegisterEvent("Throttle", ThrottleCallback);
 
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine(), et_VI);
   CoreTiming::ScheduleEvent(0, et_DSP);
   CoreTiming::ScheduleEvent(s_audio_dma_period, et_AudioDMA);
   CoreTiming::ScheduleEvent(0, et_Throttle, Common::Timer::GetTimeMs());
@@ -40,6 +40,12 @@ enum class Mode
 };
 
 u32 GetTicksPerSecond();
+
+// Factor the adaptive clock governor currently applies on top of the
+// configured overclock (1.0 when the governor is disabled or idle). Updated
+// from the throttle event on the CPU thread and read by CoreTiming::Advance.
+float GetAdaptiveClockFactor();
+
 void PreInit();
 void Init();
 void Shutdown();
@@ -4,9 +4,11 @@
 
 #include "Core/HW/VideoInterface.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -65,7 +67,8 @@ static constexpr std::array<u32, 2> s_clock_freqs{{
 }};
 
 static u64 s_ticks_last_line_start;  // number of ticks when the current full scanline started
-static u32 s_half_line_count;        // number of halflines that have occurred for this full frame
+static u32 s_half_line_count;        // halfline the next update event will process
+static u32 s_last_event_half_line;   // halfline the most recent update event processed
 static u32 s_half_line_of_next_si_poll;  // halfline when next SI poll results should be available
 static constexpr u32 num_half_lines_for_si_poll = (7 * 2) + 1;  // this is how long an SI poll takes
 
@@ -77,6 +80,22 @@ static u32 s_odd_field_first_hl;   // index first halfline of the odd field
 static u32 s_even_field_last_hl;   // index last halfline of the even field
 static u32 s_odd_field_last_hl;    // index last halfline of the odd field
 
+// Halflines (1-based, within one pair of fields) where Update() has real work
+// to do: field begin/end, the SI poll rebase at the field boundary, and the
+// programmed display interrupts. Rebuilt whenever the registers behind it
+// change; the update event jumps from one entry to the next instead of
+// ticking through every halfline.
+static std::vector<u32> s_half_line_schedule;
+static u32 s_ticks_until_next_update;  // set by Update(): distance to the next scheduled halfline
+static CoreTiming::EventType* s_update_event = nullptr;
+
+static u32 GetHalfLinesPerEvenField();
+static u32 GetHalfLinesPerOddField();
+static u32 GetCurrentHalfLine();
+static void RebuildHalfLineSchedule();
+static void ResyncUpdateEvent();
+static void UpdateCallback(u64 userdata, s64 cycles_late);
+
 void DoState(PointerWrap& p)
 {
   p.DoPOD(m_VerticalTimingRegister);
@@ -104,12 +123,16 @@ void DoState(PointerWrap& p)
   p.Do(s_target_refresh_rate);
   p.Do(s_ticks_last_line_start);
   p.Do(s_half_line_count);
+  p.Do(s_last_event_half_line);
   p.Do(s_half_line_of_next_si_poll);
   p.Do(s_current_field);
   p.Do(s_even_field_first_hl);
   p.Do(s_odd_field_first_hl);
   p.Do(s_even_field_last_hl);
   p.Do(s_odd_field_last_hl);
+
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    RebuildHalfLineSchedule();
 }
 
 // Executed after Init, before game boot
@@ -188,8 +211,9 @@ void Preset(bool _bNTSC)
   m_FBWidth.Hex = 0;
   m_BorderHBlank.Hex = 0;
 
-  s_ticks_last_line_start = 0;
+  s_ticks_last_line_start = CoreTiming::GetTicks();
   s_half_line_count = 1;
+  s_last_event_half_line = 1;
   s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first sampling starts at vsync
   s_current_field = FieldType::Odd;
 
@@ -198,7 +222,9 @@ void Preset(bool _bNTSC)
 
 void Init()
 {
+  s_update_event = CoreTiming::RegisterEvent("VICallback", UpdateCallback);
   Preset(true);
+  CoreTiming::ScheduleEvent(GetTicksPerHalfLine(), s_update_event);
 }
 
 void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
@@ -314,8 +340,13 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   // MMIOs with unimplemented writes that trigger warnings.
   mmio->Register(
-      base | VI_VERTICAL_BEAM_POSITION,
-      MMIO::ComplexRead<u16>([](u32) { return 1 + (s_half_line_count - 1) / 2; }),
+      base | VI_VERTICAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](u32) {
+        u32 half_line = GetCurrentHalfLine();
+        const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+        if (total_half_lines != 0 && half_line > total_half_lines)
+          half_line = (half_line - 1) % total_half_lines + 1;
+        return static_cast<u16>(1 + (half_line - 1) / 2);
+      }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
         WARN_LOG(VIDEOINTERFACE,
                  "Changing vertical beam position to 0x%04x - not documented or implemented yet",
@@ -323,10 +354,11 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       }));
   mmio->Register(
       base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](u32) {
-        u16 value =
-            static_cast<u16>(1 +
-                             m_HTiming0.HLW * (CoreTiming::GetTicks() - s_ticks_last_line_start) /
-                                 (GetTicksPerHalfLine()));
+        // The line start may be several lines stale between update events, so
+        // only the position within the current line is kept.
+        const u64 ticks_into_line =
+            (CoreTiming::GetTicks() - s_ticks_last_line_start) % (2 * GetTicksPerHalfLine());
+        u16 value = static_cast<u16>(1 + m_HTiming0.HLW * ticks_into_line / GetTicksPerHalfLine());
         return MathUtil::Clamp(value, static_cast<u16>(1), static_cast<u16>(m_HTiming0.HLW * 2));
       }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
@@ -341,23 +373,31 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[0].Hi = val;
                    UpdateInterrupts();
+                   RebuildHalfLineSchedule();
+                   ResyncUpdateEvent();
                  }));
   mmio->Register(base | VI_POSTRETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[1].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[1].Hi = val;
                    UpdateInterrupts();
+                   RebuildHalfLineSchedule();
+                   ResyncUpdateEvent();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_2_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[2].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[2].Hi = val;
                    UpdateInterrupts();
+                   RebuildHalfLineSchedule();
+                   ResyncUpdateEvent();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_3_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[3].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[3].Hi = val;
                    UpdateInterrupts();
+                   RebuildHalfLineSchedule();
+                   ResyncUpdateEvent();
                  }));
 
   // Unknown anti-aliasing related MMIO register: puts a warning on log and
@@ -458,6 +498,58 @@ static u32 GetHalfLinesPerOddField()
           2 * m_VerticalTimingRegister.ACV + m_VBlankTimingOdd.PSB);
 }
 
+// The update event skips halflines with nothing to do, so the halfline the
+// beam is currently on is derived from the tick count instead of being
+// stepped per event.
+static u32 GetCurrentHalfLine()
+{
+  const u64 ticks_per_half_line = GetTicksPerHalfLine();
+  if (ticks_per_half_line == 0)
+    return s_last_event_half_line;
+  // full scanlines start on odd halflines
+  const u32 line_start_half_line = s_last_event_half_line - 1 + (s_last_event_half_line & 1);
+  return line_start_half_line +
+         static_cast<u32>((CoreTiming::GetTicks() - s_ticks_last_line_start) / ticks_per_half_line);
+}
+
+static void RebuildHalfLineSchedule()
+{
+  s_half_line_schedule.clear();
+  s_half_line_schedule.push_back(s_even_field_first_hl);
+  s_half_line_schedule.push_back(s_odd_field_first_hl);
+  s_half_line_schedule.push_back(s_even_field_last_hl);
+  s_half_line_schedule.push_back(s_odd_field_last_hl);
+  // crossing the field boundary rebases the SI poll counter
+  s_half_line_schedule.push_back(GetHalfLinesPerEvenField());
+  for (const UVIInterruptRegister& reg : m_InterruptRegister)
+  {
+    if (reg.VCT)
+      s_half_line_schedule.push_back(2u * reg.VCT - 1);
+  }
+  std::sort(s_half_line_schedule.begin(), s_half_line_schedule.end());
+}
+
+// A register write can give a halfline inside the current skip window new
+// work to do (say, a display interrupt moved closer), so pull the pending
+// update event back to the next halfline boundary and let Update() pick its
+// next target from the new schedule.
+static void ResyncUpdateEvent()
+{
+  if (s_update_event == nullptr)
+    return;
+  const u64 ticks_per_half_line = GetTicksPerHalfLine();
+  if (ticks_per_half_line == 0)
+    return;
+  const u32 next_half_line = GetCurrentHalfLine() + 1;
+  if (next_half_line >= s_half_line_count)
+    return;  // the pending update is already due on or before that halfline
+  s_half_line_count = next_half_line;
+  const u64 line_ticks = CoreTiming::GetTicks() - s_ticks_last_line_start;
+  CoreTiming::RemoveEvent(s_update_event);
+  CoreTiming::ScheduleEvent(
+      static_cast<s64>(ticks_per_half_line - line_ticks % ticks_per_half_line), s_update_event);
+}
+
 static u32 GetTicksPerEvenField()
 {
   return GetTicksPerHalfLine() * GetHalfLinesPerEvenField();
@@ -617,6 +709,9 @@ void UpdateParameters()
 
   s_target_refresh_rate = lround(2.0 * SystemTimers::GetTicksPerSecond() /
                                  (GetTicksPerEvenField() + GetTicksPerOddField()));
+
+  RebuildHalfLineSchedule();
+  ResyncUpdateEvent();
 }
 
 u32 GetTargetRefreshRate()
@@ -723,9 +818,16 @@ static void EndField()
 }
 
 // Purpose: Send VI interrupt when triggered
-// Run when: When a frame is scanned (progressive/interlace)
+// Run when: on every halfline that has work to do (see s_half_line_schedule)
 void Update(u64 ticks)
 {
+  s_last_event_half_line = s_half_line_count;
+  // full scanlines start on odd halflines
+  if (s_half_line_count & 1)
+    s_ticks_last_line_start = ticks;
+  else
+    s_ticks_last_line_start = ticks - GetTicksPerHalfLine();
+
   if (s_half_line_of_next_si_poll == s_half_line_count)
   {
     SerialInterface::UpdateDevices();
@@ -756,9 +858,29 @@ void Update(u64 ticks)
     }
   }
 
-  s_half_line_count++;
+  // Jump straight to the next halfline with work to do; the ones in between
+  // are plain scanout, and the beam position reads derive their value from
+  // the tick count instead of per-halfline bookkeeping.
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+  u32 next_half_line = total_half_lines + 1;  // first halfline of the next frame
+  for (const u32 half_line : s_half_line_schedule)
+  {
+    if (half_line > s_half_line_count)
+    {
+      next_half_line = std::min(next_half_line, half_line);
+      break;
+    }
+  }
+  if (s_half_line_of_next_si_poll > s_half_line_count &&
+      s_half_line_of_next_si_poll < next_half_line)
+  {
+    next_half_line = s_half_line_of_next_si_poll;
+  }
+
+  s_ticks_until_next_update = (next_half_line - s_half_line_count) * GetTicksPerHalfLine();
+  s_half_line_count = next_half_line;
 
-  if (s_half_line_count > GetHalfLinesPerEvenField() + GetHalfLinesPerOddField())
+  if (s_half_line_count > total_half_lines)
   {
     s_half_line_count = 1;
     s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first results start at vsync
@@ -769,12 +891,13 @@ void Update(u64 ticks)
     s_half_line_of_next_si_poll = GetHalfLinesPerEvenField() + num_half_lines_for_si_poll;
   }
 
-  if (s_half_line_count & 1)
-  {
-    s_ticks_last_line_start = CoreTiming::GetTicks();
-  }
-
   UpdateInterrupts();
 }
 
+static void UpdateCallback(u64 userdata, s64 cycles_late)
+{
+  Update(CoreTiming::GetTicks() - cycles_late);
+  CoreTiming::ScheduleEvent(s_ticks_until_next_update - cycles_late, s_update_event);
+}
+
 }  // namespace
@@ -9,6 +9,7 @@
 
 #include "Core/HW/WiiSaveCrypted.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdio>
@@ -30,6 +31,7 @@
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 const u8 CWiiSaveCrypted::s_sd_key[16] = {0xAB, 0x01, 0xB9, 0xD8, 0xE1, 0x62, 0x2B, 0x08,
                                           0xAF, 0xBA, 0xD8, 0x4D, 0xBF, 0xC2, 0xA5, 0x5D};
@@ -43,6 +45,30 @@ bool CWiiSaveCrypted::ImportWiiSave(const std::string& filename)
   return save_file.m_valid;
 }
 
+u32 CWiiSaveCrypted::ImportWiiSaves(const std::vector<std::string>& filenames)
+{
+  // Each save is self-contained (own data.bin, own AES context, own output
+  // directory), so the read/decrypt/verify/write of every title runs as its
+  // own task on the shared pool.
+  std::atomic<u32> success{0};
+  std::atomic<s32> pending{static_cast<s32>(filenames.size())};
+  for (const std::string& filename : filenames)
+  {
+    Common::AsyncWorker::ExecuteAsync([&success, &pending, filename]() {
+      CWiiSaveCrypted save_file(filename, 0, true);
+      if (save_file.m_valid)
+        success.fetch_add(1, std::memory_order_relaxed);
+      pending.fetch_sub(1, std::memory_order_release);
+    });
+  }
+  u32 loopcount = 0;
+  while (pending.load(std::memory_order_acquire) > 0)
+    Common::cYield(loopcount++);
+
+  SuccessAlertT("Imported %u of %zu save file(s)", success.load(), filenames.size());
+  return success.load();
+}
+
 bool CWiiSaveCrypted::ExportWiiSave(u64 title_id)
 {
   CWiiSaveCrypted export_save("", title_id);
@@ -86,19 +112,30 @@ void CWiiSaveCrypted::ExportAllSaves()
     }
   }
   SuccessAlertT("Found %zu save file(s)", titles.size());
-  u32 success = 0;
-  for (const u64& title : titles)
+
+  // Every title writes to its own data.bin, so the scan/encrypt/sign work is
+  // independent per save and runs concurrently on the shared pool.
+  std::atomic<u32> success{0};
+  std::atomic<s32> pending{static_cast<s32>(titles.size())};
+  for (const u64 title : titles)
   {
-    CWiiSaveCrypted export_save{"", title};
-    if (export_save.m_valid)
-      success++;
+    Common::AsyncWorker::ExecuteAsync([&success, &pending, title]() {
+      CWiiSaveCrypted export_save{"", title, true};
+      if (export_save.m_valid)
+        success.fetch_add(1, std::memory_order_relaxed);
+      pending.fetch_sub(1, std::memory_order_release);
+    });
   }
-  SuccessAlertT("Successfully exported %u save(s) to %s", success,
+  u32 loopcount = 0;
+  while (pending.load(std::memory_order_acquire) > 0)
+    Common::cYield(loopcount++);
+
+  SuccessAlertT("Successfully exported %u save(s) to %s", success.load(),
                 (File::GetUserPath(D_USER_IDX) + "private/wii/title/").c_str());
 }
 
-CWiiSaveCrypted::CWiiSaveCrypted(const std::string& filename, u64 title_id)
-    : m_encrypted_save_path(filename), m_title_id(title_id)
+CWiiSaveCrypted::CWiiSaveCrypted(const std::string& filename, u64 title_id, bool quiet)
+    : m_encrypted_save_path(filename), m_title_id(title_id), m_quiet(quiet)
 {
   memcpy(m_sd_iv, "\x21\x67\x12\xE6\xAA\x1F\x68\x9F\x95\xC5\xA2\x23\x24\xDC\x6A\x98", 0x10);
 
@@ -110,13 +147,16 @@ CWiiSaveCrypted::CWiiSaveCrypted(const std::string& filename, u64 title_id)
     ReadBKHDR();
     ImportWiiSaveFiles();
     // TODO: check_sig()
-    if (m_valid)
+    if (!m_quiet)
     {
-      SuccessAlertT("Successfully imported save file(s)");
-    }
-    else
-    {
-      PanicAlertT("Import failed");
+      if (m_valid)
+      {
+        SuccessAlertT("Successfully imported save file(s)");
+      }
+      else
+      {
+        PanicAlertT("Import failed");
+      }
     }
   }
   else
@@ -182,7 +222,7 @@ void CWiiSaveCrypted::ReadHDR()
     return;
   }
   std::string banner_file_path = m_wii_title_path + "banner.bin";
-  if (!File::Exists(banner_file_path) ||
+  if (!File::Exists(banner_file_path) || m_quiet ||
       AskYesNoT("%s already exists. Consider making a backup of the current save files before "
                 "overwriting.\nOverwrite now?",
                 banner_file_path.c_str()))
@@ -14,11 +14,17 @@ class CWiiSaveCrypted
 {
 public:
   bool static ImportWiiSave(const std::string& filename);
+  // Imports several data.bin files concurrently on the shared thread pool.
+  // Runs quietly: existing save files are overwritten without prompting, as a
+  // backup restore expects, and a single summary alert replaces the per-file
+  // ones. The files must belong to distinct titles. Returns the number of
+  // saves imported successfully.
+  u32 static ImportWiiSaves(const std::vector<std::string>& filenames);
   bool static ExportWiiSave(u64 title_id);
   void static ExportAllSaves();
 
 private:
-  CWiiSaveCrypted(const std::string& filename, u64 title_id = 0);
+  CWiiSaveCrypted(const std::string& filename, u64 title_id = 0, bool quiet = false);
   ~CWiiSaveCrypted();
   void ReadHDR();
   void ReadBKHDR();
@@ -55,6 +61,9 @@ private:
   u64 m_title_id;
 
   bool m_valid;
+  // Suppresses the interactive prompts and per-save alerts; set for batch
+  // operations running on pool threads, which cannot raise UI.
+  bool m_quiet;
 
   enum
   {
@@ -2,10 +2,12 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
-#include <memory>
+#include <array>
+#include <cstring>
 
 #include "AudioCommon/AudioCommon.h"
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
@@ -57,6 +59,52 @@ static s16 adpcm_yamaha_expand_nibble(ADPCMState& s, u8 nibble)
   return s.predictor;
 }
 
+// Games replay identical short speaker sounds constantly (menu ticks), and
+// the decoder above is a serial recurrence - every nibble depends on the
+// predictor/step left by the previous one - so repeats are memoized instead.
+// The starting ADPCM state is part of the key: a report only decodes to the
+// same samples when the state it starts from matches too, which also makes
+// the cache safely shareable between wiimotes.
+struct ADPCMCacheEntry
+{
+  u8 source[sizeof(wm_speaker_data::data)];
+  u8 length = 0;
+  ADPCMState state_in;
+  ADPCMState state_out;
+  s16 samples[sizeof(wm_speaker_data::data) * 2];
+};
+static std::array<ADPCMCacheEntry, 64> s_adpcm_cache;
+
+// Decodes into `samples` (two per source byte), advancing `state`. Served
+// from the direct-mapped cache on repeats, so the common menu-tick case is
+// a memcpy.
+static void DecodeADPCM(const u8* data, u8 length, ADPCMState& state, s16* samples)
+{
+  const u64 hash = GetMurmurHash3(data, length, 0) ^
+                   (static_cast<u64>(static_cast<u32>(state.predictor)) |
+                    (static_cast<u64>(static_cast<u32>(state.step)) << 32));
+  ADPCMCacheEntry& entry = s_adpcm_cache[hash & (s_adpcm_cache.size() - 1)];
+
+  if (entry.length == length && entry.state_in.predictor == state.predictor &&
+      entry.state_in.step == state.step && memcmp(entry.source, data, length) == 0)
+  {
+    memcpy(samples, entry.samples, length * 2 * sizeof(s16));
+    state = entry.state_out;
+    return;
+  }
+
+  entry.state_in = state;
+  for (int i = 0; i < length; ++i)
+  {
+    samples[i * 2] = adpcm_yamaha_expand_nibble(state, (data[i] >> 4) & 0xf);
+    samples[i * 2 + 1] = adpcm_yamaha_expand_nibble(state, data[i] & 0xf);
+  }
+  entry.state_out = state;
+  entry.length = length;
+  memcpy(entry.source, data, length);
+  memcpy(entry.samples, samples, length * 2 * sizeof(s16));
+}
+
 #ifdef WIIMOTE_SPEAKER_DUMP
 std::ofstream ofile;
 WaveFileWriter wav;
@@ -75,8 +123,9 @@ void Wiimote::SpeakerData(const wm_speaker_data* sd)
   if (m_reg_speaker.volume == 0 || m_reg_speaker.sample_rate == 0 || sd->length == 0)
     return;
 
-  // TODO consider using static max size instead of new
-  std::unique_ptr<s16[]> samples(new s16[sd->length * 2]);
+  // sd->length is at most 20 bytes, so the decoded data always fits here;
+  // no need for a heap allocation per 200Hz report
+  s16 samples[sizeof(sd->data) * 2];
 
   unsigned int sample_rate_dividend, sample_length;
   u8 volume_divisor;
@@ -97,11 +146,7 @@ void Wiimote::SpeakerData(const wm_speaker_data* sd)
   else if (m_reg_speaker.format == 0x00)
   {
     // 4 bit Yamaha ADPCM (same as dreamcast)
-    for (int i = 0; i < sd->length; ++i)
-    {
-      samples[i * 2] = adpcm_yamaha_expand_nibble(m_adpcm_state, (sd->data[i] >> 4) & 0xf);
-      samples[i * 2 + 1] = adpcm_yamaha_expand_nibble(m_adpcm_state, sd->data[i] & 0xf);
-    }
+    DecodeADPCM(sd->data, sd->length, m_adpcm_state, samples);
 
     // Following details from http://wiibrew.org/wiki/Wiimote#Speaker
     sample_rate_dividend = 6000000;
@@ -133,7 +178,7 @@ void Wiimote::SpeakerData(const wm_speaker_data* sd)
   g_sound_stream->GetMixer()->SetWiimoteSpeakerVolume(left_volume, right_volume);
 
   // ADPCM sample rate is thought to be x2.(3000 x2 = 6000).
-  g_sound_stream->GetMixer()->PushWiimoteSpeakerSamples(samples.get(), sample_length,
+  g_sound_stream->GetMixer()->PushWiimoteSpeakerSamples(samples, sample_length,
                                                         sample_rate * 2);
 
 #ifdef WIIMOTE_SPEAKER_DUMP
@@ -147,7 +192,7 @@ void Wiimote::SpeakerData(const wm_speaker_data* sd)
     File::OpenFStream(ofile, "rmtdump.bin", ofile.binary | ofile.out);
     wav.Start("rmtdump.wav", 6000);
   }
-  wav.AddMonoSamples(samples.get(), sd->length * 2);
+  wav.AddMonoSamples(samples, sd->length * 2);
   if (ofile.good())
   {
     for (int i = 0; i < sd->length; i++)
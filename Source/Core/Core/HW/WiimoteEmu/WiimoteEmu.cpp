@@ -238,6 +238,8 @@ void Wiimote::Reset()
 
   memset(m_shake_step, 0, sizeof(m_shake_step));
 
+  m_ir_cache_valid = false;
+
   // clear read request queue
   while (!m_read_requests.empty())
   {
@@ -324,7 +326,7 @@ Wiimote::Wiimote(const unsigned int index) : m_index(index), ir_sin(0), ir_cos(1
   m_hotkeys->AddInput(_trans("Sideways Hold"), false);
   m_hotkeys->AddInput(_trans("Upright Hold"), false);
 
-  // TODO: This value should probably be re-read if SYSCONF gets changed
+  m_last_config_generation = Config::GetGeneration();
   m_sensor_bar_on_top = Config::Get(Config::SYSCONF_SENSOR_BAR_POSITION) != 0;
 
   // --- reset eeprom/register/values to default ---
@@ -510,9 +512,6 @@ inline void LowPassFilter(double& var, double newval, double period)
 
 void Wiimote::GetIRData(u8* const data, bool use_accel)
 {
-  u16 x[4], y[4];
-  memset(x, 0xFF, sizeof(x));
-
   ControlState xx = 10000, yy = 0, zz = 0;
   double nsin, ncos;
 
@@ -547,49 +546,63 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
 
   m_ir->GetState(&xx, &yy, &zz, true);
 
-  Vertex v[4];
+  // The point projection below is a pure function of these inputs. At the
+  // 200Hz report rate they are nearly always identical to the previous poll
+  // (the filtered rotation settles once the accelerometer is at rest), so
+  // reuse the previously projected points instead of redoing the transforms.
+  const double ir_input[6] = {xx, yy, zz, ir_sin, ir_cos,
+                              m_sensor_bar_on_top ? 1.0 : 0.0};
+  if (!m_ir_cache_valid || memcmp(ir_input, m_ir_last_input, sizeof(ir_input)))
+  {
+    memset(m_ir_x, 0xFF, sizeof(m_ir_x));
 
-  static const int camWidth = 1024;
-  static const int camHeight = 768;
-  static const double bndup = -0.315447;
-  static const double bnddown = 0.85;
-  static const double bndleft = 0.443364;
-  static const double bndright = -0.443364;
-  static const double dist1 = 100.0 / camWidth;  // this seems the optimal distance for zelda
-  static const double dist2 = 1.2 * dist1;
+    Vertex v[4];
 
-  for (auto& vtx : v)
-  {
-    vtx.x = xx * (bndright - bndleft) / 2 + (bndleft + bndright) / 2;
-    if (m_sensor_bar_on_top)
-      vtx.y = yy * (bndup - bnddown) / 2 + (bndup + bnddown) / 2;
-    else
-      vtx.y = yy * (bndup - bnddown) / 2 - (bndup + bnddown) / 2;
-    vtx.z = 0;
-  }
+    static const int camWidth = 1024;
+    static const int camHeight = 768;
+    static const double bndup = -0.315447;
+    static const double bnddown = 0.85;
+    static const double bndleft = 0.443364;
+    static const double bndright = -0.443364;
+    static const double dist1 = 100.0 / camWidth;  // this seems the optimal distance for zelda
+    static const double dist2 = 1.2 * dist1;
 
-  v[0].x -= (zz * 0.5 + 1) * dist1;
-  v[1].x += (zz * 0.5 + 1) * dist1;
-  v[2].x -= (zz * 0.5 + 1) * dist2;
-  v[3].x += (zz * 0.5 + 1) * dist2;
+    for (auto& vtx : v)
+    {
+      vtx.x = xx * (bndright - bndleft) / 2 + (bndleft + bndright) / 2;
+      if (m_sensor_bar_on_top)
+        vtx.y = yy * (bndup - bnddown) / 2 + (bndup + bnddown) / 2;
+      else
+        vtx.y = yy * (bndup - bnddown) / 2 - (bndup + bnddown) / 2;
+      vtx.z = 0;
+    }
+
+    v[0].x -= (zz * 0.5 + 1) * dist1;
+    v[1].x += (zz * 0.5 + 1) * dist1;
+    v[2].x -= (zz * 0.5 + 1) * dist2;
+    v[3].x += (zz * 0.5 + 1) * dist2;
 
 #define printmatrix(m)                                                                             \
   PanicAlert("%f %f %f %f\n%f %f %f %f\n%f %f %f %f\n%f %f %f %f\n", m[0][0], m[0][1], m[0][2],    \
              m[0][3], m[1][0], m[1][1], m[1][2], m[1][3], m[2][0], m[2][1], m[2][2], m[2][3],      \
              m[3][0], m[3][1], m[3][2], m[3][3])
-  Matrix rot, tot;
-  static Matrix scale;
-  MatrixScale(scale, 1, camWidth / camHeight, 1);
-  MatrixRotationByZ(rot, ir_sin, ir_cos);
-  MatrixMultiply(tot, scale, rot);
+    Matrix rot, tot;
+    static Matrix scale;
+    MatrixScale(scale, 1, camWidth / camHeight, 1);
+    MatrixRotationByZ(rot, ir_sin, ir_cos);
+    MatrixMultiply(tot, scale, rot);
 
-  for (int i = 0; i < 4; i++)
-  {
-    MatrixTransformVertex(tot, v[i]);
-    if ((v[i].x < -1) || (v[i].x > 1) || (v[i].y < -1) || (v[i].y > 1))
-      continue;
-    x[i] = (u16)lround((v[i].x + 1) / 2 * (camWidth - 1));
-    y[i] = (u16)lround((v[i].y + 1) / 2 * (camHeight - 1));
+    for (int i = 0; i < 4; i++)
+    {
+      MatrixTransformVertex(tot, v[i]);
+      if ((v[i].x < -1) || (v[i].x > 1) || (v[i].y < -1) || (v[i].y > 1))
+        continue;
+      m_ir_x[i] = (u16)lround((v[i].x + 1) / 2 * (camWidth - 1));
+      m_ir_y[i] = (u16)lround((v[i].y + 1) / 2 * (camHeight - 1));
+    }
+
+    memcpy(m_ir_last_input, ir_input, sizeof(m_ir_last_input));
+    m_ir_cache_valid = true;
   }
   // Fill report with valid data when full handshake was done
   if (m_reg_ir.data[0x30])
@@ -603,21 +616,21 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
       wm_ir_basic* const irdata = reinterpret_cast<wm_ir_basic*>(data);
       for (unsigned int i = 0; i < 2; ++i)
       {
-        if (x[i * 2] < 1024 && y[i * 2] < 768)
+        if (m_ir_x[i * 2] < 1024 && m_ir_y[i * 2] < 768)
         {
-          irdata[i].x1 = static_cast<u8>(x[i * 2]);
-          irdata[i].x1hi = x[i * 2] >> 8;
+          irdata[i].x1 = static_cast<u8>(m_ir_x[i * 2]);
+          irdata[i].x1hi = m_ir_x[i * 2] >> 8;
 
-          irdata[i].y1 = static_cast<u8>(y[i * 2]);
-          irdata[i].y1hi = y[i * 2] >> 8;
+          irdata[i].y1 = static_cast<u8>(m_ir_y[i * 2]);
+          irdata[i].y1hi = m_ir_y[i * 2] >> 8;
         }
-        if (x[i * 2 + 1] < 1024 && y[i * 2 + 1] < 768)
+        if (m_ir_x[i * 2 + 1] < 1024 && m_ir_y[i * 2 + 1] < 768)
         {
-          irdata[i].x2 = static_cast<u8>(x[i * 2 + 1]);
-          irdata[i].x2hi = x[i * 2 + 1] >> 8;
+          irdata[i].x2 = static_cast<u8>(m_ir_x[i * 2 + 1]);
+          irdata[i].x2hi = m_ir_x[i * 2 + 1] >> 8;
 
-          irdata[i].y2 = static_cast<u8>(y[i * 2 + 1]);
-          irdata[i].y2hi = y[i * 2 + 1] >> 8;
+          irdata[i].y2 = static_cast<u8>(m_ir_y[i * 2 + 1]);
+          irdata[i].y2hi = m_ir_y[i * 2 + 1] >> 8;
         }
       }
     }
@@ -628,13 +641,13 @@ void Wiimote::GetIRData(u8* const data, bool use_accel)
       memset(data, 0xFF, 12);
       wm_ir_extended* const irdata = reinterpret_cast<wm_ir_extended*>(data);
       for (unsigned int i = 0; i < 4; ++i)
-        if (x[i] < 1024 && y[i] < 768)
+        if (m_ir_x[i] < 1024 && m_ir_y[i] < 768)
         {
-          irdata[i].x = static_cast<u8>(x[i]);
-          irdata[i].xhi = x[i] >> 8;
+          irdata[i].x = static_cast<u8>(m_ir_x[i]);
+          irdata[i].xhi = m_ir_x[i] >> 8;
 
-          irdata[i].y = static_cast<u8>(y[i]);
-          irdata[i].yhi = y[i] >> 8;
+          irdata[i].y = static_cast<u8>(m_ir_y[i]);
+          irdata[i].yhi = m_ir_y[i] >> 8;
 
           irdata[i].size = 10;
         }
@@ -667,6 +680,14 @@ void Wiimote::Update()
   if (0 == m_reporting_channel)
     return;
 
+  // re-read config snapshot values when the config generation has advanced;
+  // at the 200Hz report rate this is normally just an integer compare
+  if (m_last_config_generation != Config::GetGeneration())
+  {
+    m_last_config_generation = Config::GetGeneration();
+    m_sensor_bar_on_top = Config::Get(Config::SYSCONF_SENSOR_BAR_POSITION) != 0;
+  }
+
   // returns true if a report was sent
   {
     const auto lock = GetStateLock();
@@ -267,6 +267,12 @@ private:
 
   double ir_sin, ir_cos;  // for the low pass filter
 
+  // cached IR camera point projection, reused while the inputs feeding it
+  // (cursor state, filtered rotation, sensor bar position) are unchanged
+  bool m_ir_cache_valid;
+  double m_ir_last_input[6];
+  u16 m_ir_x[4], m_ir_y[4];
+
   bool m_rumble_on;
   bool m_speaker_mute;
 
@@ -278,6 +284,9 @@ private:
 
   bool m_sensor_bar_on_top;
 
+  // config generation stamp for the snapshot values above
+  u64 m_last_config_generation;
+
   wm_status_report m_status;
 
   ADPCMState m_adpcm_state;
@@ -579,7 +579,10 @@ void WiimoteScanner::ThreadFunc()
         {
           if (!g_real_wiimotes_initialized)
             continue;
-          std::lock_guard<std::mutex> lk(g_wiimotes_mutex);
+          // Connecting can block for a long time, so g_wiimotes_mutex is only
+          // taken around the actual slot updates inside these calls. Holding
+          // it for the whole loop made the CPU thread skip Wiimote::Update
+          // (which merely try_locks) for the duration of every connect.
           std::for_each(found_wiimotes.begin(), found_wiimotes.end(), TryToConnectWiimote);
           if (found_board)
             TryToConnectBalanceBoard(found_board);
@@ -769,23 +772,19 @@ void ChangeWiimoteSource(unsigned int index, int source)
 {
   const int previous_source = g_wiimote_sources[index];
   g_wiimote_sources[index] = source;
+
+  // kill real connection (or swap to different slot)
+  Wiimote* wm = nullptr;
   {
-    // kill real connection (or swap to different slot)
     std::lock_guard<std::mutex> lk(g_wiimotes_mutex);
-
-    Wiimote* wm = g_wiimotes[index];
-
-    if (wm)
-    {
-      g_wiimotes[index] = nullptr;
-      // First see if we can use this real Wiimote in another slot.
-      TryToConnectWiimote(wm);
-    }
-
-    // else, just disconnect the Wiimote
-    HandleWiimoteDisconnect(index);
+    std::swap(wm, g_wiimotes[index]);
   }
 
+  // First see if we can use this real Wiimote in another slot.
+  // TryToConnectWiimote takes g_wiimotes_mutex itself around the slot updates.
+  if (wm)
+    TryToConnectWiimote(wm);
+
   // reconnect to the emulator
   Core::RunAsCPUThread([index, previous_source, source] {
     if (previous_source != WIIMOTE_SRC_NONE)
@@ -795,22 +794,35 @@ void ChangeWiimoteSource(unsigned int index, int source)
   });
 }
 
-// Called from the Wiimote scanner thread
+// Called from the Wiimote scanner thread (and the GUI thread when moving a
+// Wiimote to a different slot). Must not be called with g_wiimotes_mutex held.
 static bool TryToConnectWiimoteToSlot(Wiimote* wm, unsigned int i)
 {
-  if (WIIMOTE_SRC_REAL & g_wiimote_sources[i] && !g_wiimotes[i])
   {
-    if (wm->Connect(i))
-    {
-      NOTICE_LOG(WIIMOTE, "Connected to Wiimote %i.", i + 1);
-      g_wiimotes[i] = wm;
-      Core::RunAsCPUThread([i] { ::Wiimote::Connect(i, true); });
-      std::lock_guard<std::mutex> lk(s_known_ids_mutex);
-      s_known_ids.insert(wm->GetId());
-    }
+    std::lock_guard<std::mutex> lk(g_wiimotes_mutex);
+    if (!(WIIMOTE_SRC_REAL & g_wiimote_sources[i]) || g_wiimotes[i])
+      return false;
+  }
+
+  // Connect with g_wiimotes_mutex released - connecting blocks, and the CPU
+  // thread only try_locks the mutex in Wiimote::Update, so holding it here
+  // turns every connection attempt into an input latency spike.
+  if (!wm->Connect(i))
     return true;
+
+  {
+    std::lock_guard<std::mutex> lk(g_wiimotes_mutex);
+    // The slot may have been filled or its source changed while connecting.
+    if (!(WIIMOTE_SRC_REAL & g_wiimote_sources[i]) || g_wiimotes[i])
+      return false;
+    g_wiimotes[i] = wm;
   }
-  return false;
+
+  NOTICE_LOG(WIIMOTE, "Connected to Wiimote %i.", i + 1);
+  Core::RunAsCPUThread([i] { ::Wiimote::Connect(i, true); });
+  std::lock_guard<std::mutex> lk(s_known_ids_mutex);
+  s_known_ids.insert(wm->GetId());
+  return true;
 }
 
 void TryToConnectWiimote(Wiimote* wm)
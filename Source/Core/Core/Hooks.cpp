@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/Hooks.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace Hooks
+{
+namespace Detail
+{
+std::atomic<u32> g_hook_counts[static_cast<size_t>(Event::Count)];
+}
+
+// Ordered map so hooks fire in registration order; the key doubles as the
+// handle handed back to the caller.
+static std::mutex s_mutex;
+static std::map<HookID, std::pair<Event, Callback>> s_hooks;
+static HookID s_next_id = 1;
+
+HookID Register(Event event, Callback callback)
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  const HookID id = s_next_id++;
+  s_hooks.emplace(id, std::make_pair(event, std::move(callback)));
+
+  // Bump the counter last, so a dispatch site that takes the fast path never
+  // misses a hook that is fully registered.
+  Detail::g_hook_counts[static_cast<size_t>(event)].fetch_add(1, std::memory_order_release);
+  return id;
+}
+
+void Unregister(HookID id)
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  const auto it = s_hooks.find(id);
+  if (it == s_hooks.end())
+    return;
+
+  Detail::g_hook_counts[static_cast<size_t>(it->second.first)].fetch_sub(
+      1, std::memory_order_release);
+  s_hooks.erase(it);
+}
+
+void Detail::FireSlow(Event event, const std::string& argument)
+{
+  // Fired with the mutex held: unregistering from another thread must be
+  // able to guarantee that its callback is not (and will not start) running
+  // once Unregister returns. Callbacks registering or unregistering hooks
+  // from inside a callback would deadlock; orchestration code has no reason
+  // to do that from the emulator's threads.
+  std::lock_guard<std::mutex> lock(s_mutex);
+  for (const auto& hook : s_hooks)
+  {
+    if (hook.second.first == event)
+      hook.second.second(argument);
+  }
+}
+}
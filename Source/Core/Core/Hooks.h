@@ -0,0 +1,60 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Hook points for external orchestration (frontends, automation, cabinet
+// controllers). Callbacks can be registered for frame boundaries, savestate
+// events and title launch, without the registering code having to poll
+// emulated memory or scrape output.
+//
+// Dispatch is designed to cost nothing while nothing is registered: every
+// call site is guarded by one relaxed atomic per-event counter, so the idle
+// path is a load and a predictable branch. The callback list and its mutex
+// are only touched once a hook exists.
+namespace Hooks
+{
+enum class Event
+{
+  // End of an emulated frame, fired from the video thread. No argument.
+  FrameEnd,
+  // A savestate was written; the argument is its filename.
+  StateSave,
+  // A savestate was loaded successfully; the argument is its filename.
+  StateLoad,
+  // Emulation entered the CPU run loop; the argument is the game ID.
+  TitleLaunch,
+
+  Count,
+};
+
+using HookID = u64;
+using Callback = std::function<void(const std::string& argument)>;
+
+// Threadsafe. The callback runs on whichever thread fires the event (see
+// Event), so it must not block: a frame-boundary hook that stalls stalls
+// the emulator.
+HookID Register(Event event, Callback callback);
+void Unregister(HookID id);
+
+namespace Detail
+{
+extern std::atomic<u32> g_hook_counts[static_cast<size_t>(Event::Count)];
+void FireSlow(Event event, const std::string& argument);
+}
+
+// Call sites use this; it compiles down to the counter check when no hook
+// of the given type is registered.
+inline void Fire(Event event, const std::string& argument = {})
+{
+  if (Detail::g_hook_counts[static_cast<size_t>(event)].load(std::memory_order_relaxed) != 0)
+    Detail::FireSlow(event, argument);
+}
+}
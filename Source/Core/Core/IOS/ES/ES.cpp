@@ -60,6 +60,9 @@ constexpr std::array<DirectoryToCreate, 9> s_directories_to_create = {{
 
 ES::ES(Kernel& ios, const std::string& device_name) : Device(ios, device_name)
 {
+  // The session NAND root may have changed since the last ES instance.
+  InvalidateTitleCache();
+
   for (const auto& directory : s_directories_to_create)
   {
     const std::string path = Common::RootUserPath(Common::FROM_SESSION_ROOT) + directory.path;
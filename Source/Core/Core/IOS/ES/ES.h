@@ -83,6 +83,11 @@ public:
   IOS::ES::TMDReader FindInstalledTMD(u64 title_id) const;
   IOS::ES::TicketReader FindSignedTicket(u64 title_id) const;
 
+  // Drops the cached installed TMD and ticket blobs. Must be called by
+  // anything that writes to /title or /ticket behind FindInstalledTMD's and
+  // FindSignedTicket's back.
+  static void InvalidateTitleCache();
+
   // Get installed titles (in /title) without checking for TMDs at all.
   std::vector<u64> GetInstalledTitles() const;
   // Get titles which are being imported (in /import) without checking for TMDs at all.
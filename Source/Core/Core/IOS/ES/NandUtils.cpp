@@ -8,6 +8,7 @@
 #include <cinttypes>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -27,6 +28,21 @@ namespace HLE
 {
 namespace Device
 {
+// Installed TMDs and tickets are looked up dozens of times during channel
+// and disc boots, so the raw blobs are kept keyed by title ID to avoid
+// re-reading them from the host. Only used from the CPU thread, like the
+// rest of ES. The cache is dropped whenever anything writes to /title or
+// /ticket, and when the ES device is recreated (which also covers the
+// session NAND root changing between titles).
+static std::map<u64, std::vector<u8>> s_tmd_cache;
+static std::map<u64, std::vector<u8>> s_ticket_cache;
+
+void ES::InvalidateTitleCache()
+{
+  s_tmd_cache.clear();
+  s_ticket_cache.clear();
+}
+
 static IOS::ES::TMDReader FindTMD(u64 title_id, const std::string& tmd_path)
 {
   File::IOFile file(tmd_path, "rb");
@@ -47,11 +63,23 @@ IOS::ES::TMDReader ES::FindImportTMD(u64 title_id) const
 
 IOS::ES::TMDReader ES::FindInstalledTMD(u64 title_id) const
 {
-  return FindTMD(title_id, Common::GetTMDFileName(title_id, Common::FROM_SESSION_ROOT));
+  const auto cached = s_tmd_cache.find(title_id);
+  if (cached != s_tmd_cache.end())
+    return IOS::ES::TMDReader{std::vector<u8>(cached->second)};
+
+  IOS::ES::TMDReader tmd =
+      FindTMD(title_id, Common::GetTMDFileName(title_id, Common::FROM_SESSION_ROOT));
+  if (tmd.IsValid())
+    s_tmd_cache.emplace(title_id, tmd.GetBytes());
+  return tmd;
 }
 
 IOS::ES::TicketReader ES::FindSignedTicket(u64 title_id) const
 {
+  const auto cached = s_ticket_cache.find(title_id);
+  if (cached != s_ticket_cache.end())
+    return IOS::ES::TicketReader{std::vector<u8>(cached->second)};
+
   const std::string path = Common::GetTicketFileName(title_id, Common::FROM_SESSION_ROOT);
   File::IOFile ticket_file(path, "rb");
   if (!ticket_file)
@@ -61,7 +89,10 @@ IOS::ES::TicketReader ES::FindSignedTicket(u64 title_id) const
   if (!ticket_file.ReadBytes(signed_ticket.data(), signed_ticket.size()))
     return {};
 
-  return IOS::ES::TicketReader{std::move(signed_ticket)};
+  IOS::ES::TicketReader ticket{std::move(signed_ticket)};
+  if (ticket.IsValid())
+    s_ticket_cache.emplace(title_id, ticket.GetBytes());
+  return ticket;
 }
 
 static bool IsValidPartOfTitleID(const std::string& string)
@@ -260,6 +291,9 @@ bool ES::FinishImport(const IOS::ES::TMDReader& tmd)
     ERROR_LOG(IOS_ES, "FinishImport: Failed to rename import directory to %s", content_dir.c_str());
     return false;
   }
+
+  // The freshly imported title.tmd replaces whatever was installed before.
+  InvalidateTitleCache();
   return true;
 }
 
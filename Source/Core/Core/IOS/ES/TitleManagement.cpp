@@ -39,6 +39,8 @@ static ReturnCode WriteTicket(const IOS::ES::TicketReader& ticket)
   if (!ticket_file)
     return ES_EIO;
 
+  ES::InvalidateTitleCache();
+
   const std::vector<u8>& raw_ticket = ticket.GetBytes();
   return ticket_file.WriteBytes(raw_ticket.data(), raw_ticket.size()) ? IPC_SUCCESS : ES_EIO;
 }
@@ -293,6 +295,10 @@ ReturnCode ES::ImportContentBegin(Context& context, u64 title_id, u32 content_id
   context.title_import_export.content.iv[0] = (content_info.index >> 8) & 0xFF;
   context.title_import_export.content.iv[1] = content_info.index & 0xFF;
 
+  // The full content size is known here, so reserve up front instead of
+  // letting installers that stream in small chunks regrow the buffer.
+  context.title_import_export.content.buffer.reserve(content_info.size);
+
   context.title_import_export.content.valid = true;
 
   // We're supposed to return a "content file descriptor" here, which is
@@ -505,6 +511,7 @@ ReturnCode ES::DeleteTitle(u64 title_id)
     return FS_EACCESS;
   }
 
+  InvalidateTitleCache();
   return IPC_SUCCESS;
 }
 
@@ -531,6 +538,8 @@ ReturnCode ES::DeleteTicket(const u8* ticket_view)
   const u64 ticket_id = Common::swap64(ticket_view + offsetof(IOS::ES::TicketView, ticket_id));
   ticket.DeleteTicket(ticket_id);
 
+  InvalidateTitleCache();
+
   const std::vector<u8>& new_ticket = ticket.GetBytes();
   const std::string ticket_path = Common::GetTicketFileName(title_id, Common::FROM_SESSION_ROOT);
   {
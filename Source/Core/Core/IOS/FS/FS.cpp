@@ -47,6 +47,9 @@ void FS::DoState(PointerWrap& p)
 {
   DoStateShared(p);
 
+  // /tmp is read from and written to the host below.
+  FlushNandWriteback();
+
   // handle /tmp
 
   std::string Path = File::GetUserPath(D_SESSION_WIIROOT_IDX) + "/tmp";
@@ -155,6 +158,17 @@ static u64 ComputeTotalFileSize(const File::FSTEntry& parentEntry)
 
 IPCCommandResult FS::IOCtl(const IOCtlRequest& request)
 {
+  // These operations work on the host filesystem directly, so any buffered
+  // file content that is still being written back has to land first.
+  FlushNandWriteback();
+
+  // Guest-side file changes can touch TMDs and tickets too.
+  if (request.request == IOCTL_DELETE_FILE || request.request == IOCTL_RENAME_FILE ||
+      request.request == IOCTL_CREATE_FILE)
+  {
+    ES::InvalidateTitleCache();
+  }
+
   Memory::Memset(request.buffer_out, 0, request.buffer_out_size);
 
   switch (request.request)
@@ -185,6 +199,8 @@ IPCCommandResult FS::IOCtl(const IOCtlRequest& request)
 
 IPCCommandResult FS::IOCtlV(const IOCtlVRequest& request)
 {
+  FlushNandWriteback();
+
   switch (request.request)
   {
   case IOCTLV_READ_DIR:
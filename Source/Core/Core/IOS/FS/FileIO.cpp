@@ -4,27 +4,85 @@
 
 #include "Core/IOS/FS/FileIO.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cstdio>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <utility>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
+#include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/NandPaths.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "Core/CommonTitles.h"
 #include "Core/HW/Memmap.h"
+#include "Core/IOS/ES/ES.h"
 #include "Core/IOS/IOS.h"
 
 namespace IOS
 {
 namespace HLE
 {
-static std::map<std::string, std::weak_ptr<File::IOFile>> openFiles;
+static std::map<std::string, std::weak_ptr<NandFileBuffer>> openFiles;
+
+// Number of buffers handed to the worker pool whose content hasn't reached
+// the host filesystem yet.
+static std::atomic<u32> s_pending_flushes = { 0 };
+
+void FlushNandWriteback()
+{
+  u32 loopcount = 0;
+  while (s_pending_flushes.load() != 0)
+  {
+    Common::cYield(loopcount++);
+  }
+}
+
+NandFileBuffer::NandFileBuffer(const std::string& host_path) : m_host_path(host_path)
+{
+  File::IOFile file(host_path, "rb");
+  if (!file)
+    return;
+  m_data.resize(file.GetSize());
+  if (m_data.empty() || file.ReadBytes(m_data.data(), m_data.size()))
+    m_valid = true;
+  else
+    m_data.clear();
+}
+
+u32 NandFileBuffer::Read(u8* dst, u32 offset, u32 length) const
+{
+  if (offset >= m_data.size())
+    return 0;
+  const u32 read_length = std::min<u32>(length, static_cast<u32>(m_data.size()) - offset);
+  std::memcpy(dst, m_data.data() + offset, read_length);
+  return read_length;
+}
+
+void NandFileBuffer::Write(const u8* src, u32 offset, u32 length)
+{
+  if (offset + static_cast<u64>(length) > m_data.size())
+    m_data.resize(offset + static_cast<u64>(length));
+  std::memcpy(m_data.data() + offset, src, length);
+  m_dirty = true;
+}
+
+void NandFileBuffer::Flush()
+{
+  if (!m_dirty)
+    return;
+  File::IOFile file(m_host_path, "wb");
+  if (file && (m_data.empty() || file.WriteBytes(m_data.data(), m_data.size())))
+    m_dirty = false;
+}
 
 // This is used by several of the FileIO and /dev/fs functions
 std::string BuildFilename(const std::string& wii_path)
@@ -110,6 +168,14 @@ IPCCommandResult FileIO::Open(const OpenRequest& request)
   }
 
   INFO_LOG(IOS_FILEIO, "FileIO: Open %s (%s == %08X)", m_name.c_str(), Modes[m_Mode], m_Mode);
+
+  // Guest code can rewrite TMDs and tickets through /dev/fs as well.
+  if ((m_Mode & IOS_OPEN_WRITE) &&
+      (StringEndsWith(m_name, ".tmd") || m_name.compare(0, 8, "/ticket/") == 0))
+  {
+    ES::InvalidateTitleCache();
+  }
+
   OpenFile();
 
   m_is_active = true;
@@ -143,20 +209,31 @@ void FileIO::OpenFile()
   }
   else
   {
+    // Make sure a previous buffer for this file (or any other) has finished
+    // writing back before the content is read from the host.
+    FlushNandWriteback();
+
     std::string path = m_name;
     // This code will be called when all references to the shared pointer below have been removed.
-    auto deleter = [path](File::IOFile* ptr) {
-      delete ptr;             // IOFile's deconstructor closes the file.
+    // The content is written back on the worker pool so that closing a file
+    // the guest just saved doesn't stall the CPU thread on host I/O.
+    auto deleter = [path](NandFileBuffer* ptr) {
       openFiles.erase(path);  // erase the weak pointer from the list of open files.
+      s_pending_flushes.fetch_add(1);
+      Common::AsyncWorker::ExecuteAsync([ptr]() {
+        ptr->Flush();
+        delete ptr;
+        s_pending_flushes.fetch_sub(1);
+      });
     };
 
     // All files are opened read/write. Actual access rights will be controlled per handle by the
     // read/write functions below
-    m_file = std::shared_ptr<File::IOFile>(new File::IOFile(m_filepath, "r+b"),
-                                           deleter);  // Use the custom deleter from above.
+    m_file = std::shared_ptr<NandFileBuffer>(new NandFileBuffer(m_filepath),
+                                             deleter);  // Use the custom deleter from above.
 
     // Store a weak pointer to our newly opened file in the cache.
-    openFiles[path] = std::weak_ptr<File::IOFile>(m_file);
+    openFiles[path] = std::weak_ptr<NandFileBuffer>(m_file);
   }
 }
 
@@ -220,12 +297,8 @@ IPCCommandResult FileIO::Read(const ReadWriteRequest& request)
 
   DEBUG_LOG(IOS_FILEIO, "Read 0x%x bytes to 0x%08x from %s", request.size, request.buffer,
             m_name.c_str());
-  m_file->Seek(m_SeekPos, SEEK_SET);  // File might be opened twice, need to seek before we read
-  const u32 number_of_bytes_read = static_cast<u32>(
-      fread(Memory::GetPointer(request.buffer), 1, requested_read_length, m_file->GetHandle()));
-
-  if (number_of_bytes_read != requested_read_length && ferror(m_file->GetHandle()))
-    return GetDefaultReply(FS_EACCESS);
+  const u32 number_of_bytes_read =
+      m_file->Read(Memory::GetPointer(request.buffer), m_SeekPos, requested_read_length);
 
   // IOS returns the number of bytes read and adds that value to the seek position,
   // instead of adding the *requested* read length.
@@ -248,13 +321,9 @@ IPCCommandResult FileIO::Write(const ReadWriteRequest& request)
     {
       DEBUG_LOG(IOS_FILEIO, "FileIO: Write 0x%04x bytes from 0x%08x to %s", request.size,
                 request.buffer, m_name.c_str());
-      m_file->Seek(m_SeekPos,
-                   SEEK_SET);  // File might be opened twice, need to seek before we write
-      if (m_file->WriteBytes(Memory::GetPointer(request.buffer), request.size))
-      {
-        return_value = request.size;
-        m_SeekPos += request.size;
-      }
+      m_file->Write(Memory::GetPointer(request.buffer), m_SeekPos, request.size);
+      return_value = request.size;
+      m_SeekPos += request.size;
     }
   }
   else
@@ -290,6 +359,10 @@ void FileIO::PrepareForState(PointerWrap::Mode mode)
   // Temporally close the file, to prevent any issues with the savestating of /tmp
   // it can be opened again with another call to OpenFile()
   m_file.reset();
+
+  // The buffer's write-back runs on the worker pool; the state must not be
+  // taken (or the file reopened) until the host file is current.
+  FlushNandWriteback();
 }
 
 void FileIO::DoState(PointerWrap& p)
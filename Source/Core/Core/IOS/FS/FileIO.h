@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -13,11 +14,6 @@
 
 class PointerWrap;
 
-namespace File
-{
-class IOFile;
-}
-
 namespace IOS
 {
 namespace HLE
@@ -25,6 +21,34 @@ namespace HLE
 std::string BuildFilename(const std::string& wii_path);
 void CreateVirtualFATFilesystem();
 
+// Waits until every NAND file buffer that has been scheduled for write-back
+// has reached the host filesystem. Must be called before anything accesses
+// the NAND directory behind the buffers' back: host-side /dev/fs operations,
+// savestating and shutdown.
+void FlushNandWriteback();
+
+// In-memory image of a NAND file. Guest reads and writes are served from
+// memory, so they don't pay the host filesystem's latency per IPC request;
+// the content is written back in one pass when the last handle closes (on a
+// worker thread) or when a flush is forced.
+class NandFileBuffer
+{
+public:
+  explicit NandFileBuffer(const std::string& host_path);
+
+  bool IsOpen() const { return m_valid; }
+  u64 GetSize() const { return m_data.size(); }
+  u32 Read(u8* dst, u32 offset, u32 length) const;
+  void Write(const u8* src, u32 offset, u32 length);
+  void Flush();
+
+private:
+  std::string m_host_path;
+  std::vector<u8> m_data;
+  bool m_valid = false;
+  bool m_dirty = false;
+};
+
 namespace Device
 {
 class FileIO : public Device
@@ -76,7 +100,7 @@ private:
   u32 m_SeekPos = 0;
 
   std::string m_filepath;
-  std::shared_ptr<File::IOFile> m_file;
+  std::shared_ptr<NandFileBuffer> m_file;
 };
 }  // namespace Device
 }  // namespace HLE
@@ -201,6 +201,9 @@ Kernel::~Kernel()
     m_device_map.clear();
   }
 
+  // Closing the devices above may have queued NAND write-backs.
+  FlushNandWriteback();
+
   if (m_is_responsible_for_nand_root)
     Core::ShutdownWiiRoot();
 }
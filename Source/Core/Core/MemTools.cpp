@@ -11,6 +11,7 @@
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlightRecorder.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 
@@ -50,6 +51,8 @@ LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
     }
     else
     {
+      // Going down; leave the flight recorder window behind for the report.
+      Common::FlightRecorder::Dump("unhandled access violation");
       // Let's not prevent debugging.
       return (DWORD)EXCEPTION_CONTINUE_SEARCH;
     }
@@ -266,6 +269,9 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
 #endif
   ))
   {
+    // Going down; leave the flight recorder window behind for the report.
+    Common::FlightRecorder::Dump("unhandled segfault");
+
     // retry and crash
     // According to the sigaction man page, if sa_flags "SA_SIGINFO" is set to the sigaction
     // function pointer, otherwise sa_handler contains one of:
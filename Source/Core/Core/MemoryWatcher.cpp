@@ -67,19 +67,21 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return m_values.size() > 0;
+  return m_watches.size() > 0;
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch watch;
+  watch.line = line;
 
   std::stringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
+
+  m_watches.push_back(std::move(watch));
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -92,10 +94,10 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const std::string& line)
+u32 MemoryWatcher::ChasePointer(const std::vector<u32>& offsets)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : offsets)
     value = Memory::Read_U32(value + offset);
   return value;
 }
@@ -112,17 +114,14 @@ void MemoryWatcher::Step()
   if (!m_running)
     return;
 
-  for (auto& entry : m_values)
+  for (auto& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    u32 new_value = ChasePointer(watch.offsets);
+    if (new_value != watch.current_value)
     {
       // Update the value
-      current_value = new_value;
-      std::string message = ComposeMessage(address, new_value);
+      watch.current_value = new_value;
+      std::string message = ComposeMessage(watch.line, new_value);
       sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
         sizeof(m_addr));
     }
@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include <map>
+#include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <vector>
@@ -31,8 +31,17 @@ private:
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
+  // A line from the input file, broken down into the offsets to follow so
+  // Step() doesn't have to re-parse or look anything up per iteration.
+  struct Watch
+  {
+    std::string line;
+    std::vector<u32> offsets;
+    u32 current_value = 0;
+  };
+
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const std::string& line);
+  static u32 ChasePointer(const std::vector<u32>& offsets);
   std::string ComposeMessage(const std::string& line, u32 value);
 
   bool m_running;
@@ -40,8 +49,5 @@ private:
   int m_fd;
   sockaddr_un m_addr;
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  std::vector<Watch> m_watches;
 };
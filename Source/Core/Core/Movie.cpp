@@ -9,8 +9,10 @@
 #include <cctype>
 #include <iomanip>
 #include <iterator>
+#include <cstring>
 #include <mbedtls/config.h>
 #include <mbedtls/md.h>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -38,6 +40,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSP/DSPCore.h"
+#include "Core/DeterminismAudit.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
@@ -48,6 +51,7 @@
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
+#include "Core/MovieInputColumns.h"
 #include "Core/NetPlayProto.h"
 #include "Core/State.h"
 
@@ -70,7 +74,124 @@ static PlayMode s_playMode = MODE_NONE;
 static u8 s_controllers = 0;
 static ControllerState s_padState;
 static DTMHeader tmpHeader;
-static std::vector<u8> s_temp_input;
+
+// Recorded input is stored in fixed-size chunks rather than one contiguous
+// allocation: long recordings reach hundreds of MB, and growing a single
+// buffer that size copies everything it holds, which shows up as dropped
+// frames while recording.
+class ChunkedInputBuffer
+{
+public:
+  u64 Size() const { return m_size; }
+  bool Empty() const { return m_size == 0; }
+
+  void Clear()
+  {
+    m_chunks.clear();
+    m_size = 0;
+  }
+
+  void Resize(u64 new_size)
+  {
+    const size_t chunks_needed = static_cast<size_t>((new_size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    while (m_chunks.size() > chunks_needed)
+      m_chunks.pop_back();
+    while (m_chunks.size() < chunks_needed)
+      m_chunks.push_back(std::make_unique<u8[]>(CHUNK_SIZE));
+    m_size = new_size;
+  }
+
+  void ReadBytes(u64 offset, void* dst, u64 size) const
+  {
+    u8* out = static_cast<u8*>(dst);
+    while (size > 0)
+    {
+      const u64 chunk_offset = offset % CHUNK_SIZE;
+      const u64 copy_size = std::min(size, CHUNK_SIZE - chunk_offset);
+      std::memcpy(out, &m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)][chunk_offset],
+        static_cast<size_t>(copy_size));
+      out += copy_size;
+      offset += copy_size;
+      size -= copy_size;
+    }
+  }
+
+  void WriteBytes(u64 offset, const void* src, u64 size)
+  {
+    const u8* in = static_cast<const u8*>(src);
+    while (size > 0)
+    {
+      const u64 chunk_offset = offset % CHUNK_SIZE;
+      const u64 copy_size = std::min(size, CHUNK_SIZE - chunk_offset);
+      std::memcpy(&m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)][chunk_offset], in,
+        static_cast<size_t>(copy_size));
+      in += copy_size;
+      offset += copy_size;
+      size -= copy_size;
+    }
+  }
+
+  u8 ReadU8(u64 offset) const
+  {
+    return m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)][offset % CHUNK_SIZE];
+  }
+
+  bool ReadFromFile(File::IOFile& file, u64 size)
+  {
+    Resize(size);
+    for (u64 offset = 0; offset < m_size; offset += CHUNK_SIZE)
+    {
+      const u64 read_size = std::min(m_size - offset, CHUNK_SIZE);
+      if (!file.ReadBytes(m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)].get(),
+            static_cast<size_t>(read_size)))
+        return false;
+    }
+    return true;
+  }
+
+  bool WriteToFile(File::IOFile& file) const
+  {
+    for (u64 offset = 0; offset < m_size; offset += CHUNK_SIZE)
+    {
+      const u64 write_size = std::min(m_size - offset, CHUNK_SIZE);
+      if (!file.WriteBytes(m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)].get(),
+            static_cast<size_t>(write_size)))
+        return false;
+    }
+    return true;
+  }
+
+  // Returns the index of the first differing byte, or other.size() if the
+  // buffer matches the whole of other.
+  u64 FirstMismatch(const std::vector<u8>& other) const
+  {
+    u64 offset = 0;
+    while (offset < other.size())
+    {
+      const u64 chunk_offset = offset % CHUNK_SIZE;
+      const u64 compare_size = std::min<u64>(other.size() - offset, CHUNK_SIZE - chunk_offset);
+      const u8* chunk = &m_chunks[static_cast<size_t>(offset / CHUNK_SIZE)][chunk_offset];
+      if (std::memcmp(chunk, &other[static_cast<size_t>(offset)],
+            static_cast<size_t>(compare_size)) != 0)
+      {
+        u64 i = 0;
+        while (chunk[i] == other[static_cast<size_t>(offset + i)])
+          i++;
+        return offset + i;
+      }
+      offset += compare_size;
+    }
+    return other.size();
+  }
+
+private:
+  static constexpr u64 CHUNK_SIZE = 8 * 1024 * 1024;
+
+  std::vector<std::unique_ptr<u8[]>> m_chunks;
+  u64 m_size = 0;
+};
+
+static ChunkedInputBuffer s_temp_input;
 static u64 s_currentByte = 0;
 static u64 s_currentFrame = 0, s_totalFrames = 0;  // VI
 static u64 s_currentLagCount = 0;
@@ -245,6 +366,8 @@ void Init(const BootParameters& boot)
     s_currentLagCount = 0;
     s_currentInputCount = 0;
   }
+
+  DeterminismAudit::Init();
 }
 
 // NOTE: CPU Thread
@@ -257,6 +380,9 @@ void InputUpdate()
     s_totalTickCount += CoreTiming::GetTicks() - s_tickCountAtLastInput;
     s_tickCountAtLastInput = CoreTiming::GetTicks();
   }
+
+  if (DeterminismAudit::IsEnabled())
+    DeterminismAudit::Update(s_currentInputCount);
 }
 
 // NOTE: CPU Thread
@@ -531,7 +657,7 @@ bool BeginRecordingInput(int controllers)
 
     s_playMode = MODE_RECORDING;
     s_author = SConfig::GetInstance().m_strMovieAuthor;
-    s_temp_input.clear();
+    s_temp_input.Clear();
 
     s_currentByte = 0;
 
@@ -805,8 +931,8 @@ void RecordInput(GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
-  s_temp_input.resize(s_currentByte + sizeof(ControllerState));
-  memcpy(&s_temp_input[s_currentByte], &s_padState, sizeof(ControllerState));
+  s_temp_input.Resize(s_currentByte + sizeof(ControllerState));
+  s_temp_input.WriteBytes(s_currentByte, &s_padState, sizeof(ControllerState));
   s_currentByte += sizeof(ControllerState);
 }
 
@@ -826,9 +952,10 @@ void RecordWiimote(int wiimote, u8* data, u8 size)
     return;
 
   InputUpdate();
-  s_temp_input.resize(s_currentByte + size + 1);
-  s_temp_input[s_currentByte++] = size;
-  memcpy(&s_temp_input[s_currentByte], data, size);
+  s_temp_input.Resize(s_currentByte + size + 1);
+  s_temp_input.WriteBytes(s_currentByte, &size, 1);
+  s_currentByte++;
+  s_temp_input.WriteBytes(s_currentByte, data, size);
   s_currentByte += size;
 }
 
@@ -894,8 +1021,7 @@ bool PlayInput(const std::string& movie_path, std::optional<std::string>* savest
 
   Core::UpdateWantDeterminism();
 
-  s_temp_input.resize(recording_file.GetSize() - 256);
-  recording_file.ReadBytes(s_temp_input.data(), s_temp_input.size());
+  s_temp_input.ReadFromFile(recording_file, recording_file.GetSize() - 256);
   s_currentByte = 0;
   recording_file.Close();
 
@@ -970,41 +1096,40 @@ void LoadInput(const std::string& movie_path)
     afterEnd = true;
   }
 
-  if (!s_bReadOnly || s_temp_input.empty())
+  if (!s_bReadOnly || s_temp_input.Empty())
   {
     s_totalFrames = tmpHeader.frameCount;
     s_totalLagCount = tmpHeader.lagCount;
     s_totalInputCount = tmpHeader.inputCount;
     s_totalTickCount = s_tickCountAtLastInput = tmpHeader.tickCount;
 
-    s_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(s_temp_input.data(), s_temp_input.size());
+    s_temp_input.ReadFromFile(t_record, totalSavedBytes);
   }
   else if (s_currentByte > 0)
   {
     if (s_currentByte > totalSavedBytes)
     {
     }
-    else if (s_currentByte > s_temp_input.size())
+    else if (s_currentByte > s_temp_input.Size())
     {
       afterEnd = true;
       PanicAlertT("Warning: You loaded a save that's after the end of the current movie. (byte %u "
         "> %zu) (input %u > %u). You should load another save before continuing, or load "
         "this state with read-only mode off.",
-        (u32)s_currentByte + 256, s_temp_input.size() + 256, (u32)s_currentInputCount,
+        (u32)s_currentByte + 256, (size_t)s_temp_input.Size() + 256, (u32)s_currentInputCount,
         (u32)s_totalInputCount);
     }
-    else if (s_currentByte > 0 && !s_temp_input.empty())
+    else if (s_currentByte > 0 && !s_temp_input.Empty())
     {
       // verify identical from movie start to the save's current frame
       std::vector<u8> movInput(s_currentByte);
       t_record.ReadArray(movInput.data(), movInput.size());
 
-      const auto result = std::mismatch(movInput.begin(), movInput.end(), s_temp_input.begin());
+      const u64 first_mismatch = s_temp_input.FirstMismatch(movInput);
 
-      if (result.first != movInput.end())
+      if (first_mismatch != movInput.size())
       {
-        const ptrdiff_t mismatch_index = std::distance(movInput.begin(), result.first);
+        const ptrdiff_t mismatch_index = static_cast<ptrdiff_t>(first_mismatch);
 
         // this is a "you did something wrong" alert for the user's benefit.
         // we'll try to say what's going on in excruciating detail, otherwise the user might not
@@ -1019,16 +1144,16 @@ void LoadInput(const std::string& movie_path)
             "read-only mode off. Otherwise you'll probably get a desync.",
             byte_offset, byte_offset);
 
-          std::copy(movInput.begin(), movInput.end(), s_temp_input.begin());
+          s_temp_input.WriteBytes(0, movInput.data(), movInput.size());
         }
         else
         {
           const ptrdiff_t frame = mismatch_index / sizeof(ControllerState);
           ControllerState curPadState;
-          memcpy(&curPadState, &s_temp_input[frame * sizeof(ControllerState)],
+          s_temp_input.ReadBytes(frame * sizeof(ControllerState), &curPadState,
             sizeof(ControllerState));
           ControllerState movPadState;
-          memcpy(&movPadState, &s_temp_input[frame * sizeof(ControllerState)],
+          s_temp_input.ReadBytes(frame * sizeof(ControllerState), &movPadState,
             sizeof(ControllerState));
           PanicAlertT(
             "Warning: You loaded a save whose movie mismatches on frame %td. You should load "
@@ -1095,7 +1220,7 @@ void LoadInput(const std::string& movie_path)
 // NOTE: CPU Thread
 static void CheckInputEnd()
 {
-  if (s_currentByte >= s_temp_input.size() ||
+  if (s_currentByte >= s_temp_input.Size() ||
     (CoreTiming::GetTicks() > s_totalTickCount && !IsRecordingInputFromSaveState()))
   {
     EndPlayInput(!s_bReadOnly);
@@ -1107,18 +1232,18 @@ void PlayController(GCPadStatus* PadStatus, int controllerID)
 {
   // Correct playback is entirely dependent on the emulator polling the controllers
   // in the same order done during recording
-  if (!IsPlayingInput() || !IsUsingPad(controllerID) || s_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingPad(controllerID) || s_temp_input.Empty())
     return;
 
-  if (s_currentByte + sizeof(ControllerState) > s_temp_input.size())
+  if (s_currentByte + sizeof(ControllerState) > s_temp_input.Size())
   {
     PanicAlertT("Premature movie end in PlayController. %u + %zu > %zu", (u32)s_currentByte,
-      sizeof(ControllerState), s_temp_input.size());
+      sizeof(ControllerState), (size_t)s_temp_input.Size());
     EndPlayInput(!s_bReadOnly);
     return;
   }
 
-  memcpy(&s_padState, &s_temp_input[s_currentByte], sizeof(ControllerState));
+  s_temp_input.ReadBytes(s_currentByte, &s_padState, sizeof(ControllerState));
   s_currentByte += sizeof(ControllerState);
 
   PadStatus->isConnected = s_padState.is_connected;
@@ -1204,20 +1329,20 @@ void PlayController(GCPadStatus* PadStatus, int controllerID)
 bool PlayWiimote(int wiimote, u8* data, const WiimoteEmu::ReportFeatures& rptf, int ext,
   const wiimote_key key)
 {
-  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || s_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || s_temp_input.Empty())
     return false;
 
-  if (s_currentByte > s_temp_input.size())
+  if (s_currentByte > s_temp_input.Size())
   {
     PanicAlertT("Premature movie end in PlayWiimote. %u > %zu", (u32)s_currentByte,
-      s_temp_input.size());
+      (size_t)s_temp_input.Size());
     EndPlayInput(!s_bReadOnly);
     return false;
   }
 
   u8 size = rptf.size;
 
-  u8 sizeInMovie = s_temp_input[s_currentByte];
+  u8 sizeInMovie = s_temp_input.ReadU8(s_currentByte);
 
   if (size != sizeInMovie)
   {
@@ -1233,15 +1358,15 @@ bool PlayWiimote(int wiimote, u8* data, const WiimoteEmu::ReportFeatures& rptf,
 
   s_currentByte++;
 
-  if (s_currentByte + size > s_temp_input.size())
+  if (s_currentByte + size > s_temp_input.Size())
   {
     PanicAlertT("Premature movie end in PlayWiimote. %u + %d > %zu", (u32)s_currentByte, size,
-      s_temp_input.size());
+      (size_t)s_temp_input.Size());
     EndPlayInput(!s_bReadOnly);
     return false;
   }
 
-  memcpy(data, &s_temp_input[s_currentByte], size);
+  s_temp_input.ReadBytes(s_currentByte, data, size);
   s_currentByte += size;
 
   s_currentInputCount++;
@@ -1329,7 +1454,7 @@ void SaveRecording(const std::string& filename)
 
   save_record.WriteArray(&header, 1);
 
-  bool success = save_record.WriteBytes(s_temp_input.data(), s_temp_input.size());
+  bool success = s_temp_input.WriteToFile(save_record);
 
   if (success && s_bRecordingFromSaveState)
   {
@@ -1343,6 +1468,47 @@ void SaveRecording(const std::string& filename)
     Core::DisplayMessage(StringFromFormat("Failed to save %s", filename.c_str()), 2000);
 }
 
+// NOTE: Host Thread
+bool CopyGCInputToColumns(InputColumnStore* store)
+{
+  store->Clear();
+
+  // Wiimote reports are variable-size and interleaved with the pad frames,
+  // so a movie using them has no fixed stride to split into columns.
+  if ((s_controllers & 0xF0) != 0)
+    return false;
+
+  const u64 frame_count = s_temp_input.Size() / sizeof(ControllerState);
+  for (u64 frame = 0; frame < frame_count; frame++)
+  {
+    ControllerState state;
+    s_temp_input.ReadBytes(frame * sizeof(ControllerState), &state, sizeof(ControllerState));
+    store->Append(state);
+  }
+  return true;
+}
+
+// NOTE: Host Thread
+bool ReplaceGCInputFromColumns(const InputColumnStore& store)
+{
+  if (s_bReadOnly || !IsMovieActive() || (s_controllers & 0xF0) != 0)
+    return false;
+
+  const u64 frame_count = store.GetFrameCount();
+  s_temp_input.Resize(frame_count * sizeof(ControllerState));
+  for (u64 frame = 0; frame < frame_count; frame++)
+  {
+    const ControllerState state = store.GetFrame(frame);
+    s_temp_input.WriteBytes(frame * sizeof(ControllerState), &state, sizeof(ControllerState));
+  }
+
+  // Each record of a Wiimote-less movie is one poll.
+  s_totalInputCount = frame_count;
+  if (s_currentByte > s_temp_input.Size())
+    s_currentByte = s_temp_input.Size();
+  return true;
+}
+
 void SetGCInputManip(GCManipFunction func)
 {
   s_gc_manip_func = std::move(func);
@@ -1479,7 +1645,8 @@ static void GetMD5()
 // NOTE: EmuThread
 void Shutdown()
 {
+  DeterminismAudit::Shutdown();
   s_currentInputCount = s_totalInputCount = s_totalFrames = s_tickCountAtLastInput = 0;
-  s_temp_input.clear();
+  s_temp_input.Clear();
 }
 };
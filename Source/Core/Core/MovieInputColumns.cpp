@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/MovieInputColumns.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "InputCommon/GCPadStatus.h"
+
+namespace Movie
+{
+// The packed button bytes at the front of ControllerState, read and written
+// through memcpy since the individual bits are bitfields.
+static u16 PackButtons(const ControllerState& state)
+{
+  u16 buttons;
+  std::memcpy(&buttons, &state, sizeof(buttons));
+  return buttons;
+}
+
+static ControllerState NeutralState()
+{
+  ControllerState state = {};
+  state.is_connected = true;
+  state.AnalogStickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  state.AnalogStickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  state.CStickX = GCPadStatus::C_STICK_CENTER_X;
+  state.CStickY = GCPadStatus::C_STICK_CENTER_Y;
+  return state;
+}
+
+void InputColumnStore::Clear()
+{
+  m_buttons.clear();
+  m_trigger_l.clear();
+  m_trigger_r.clear();
+  m_analog_x.clear();
+  m_analog_y.clear();
+  m_c_x.clear();
+  m_c_y.clear();
+}
+
+void InputColumnStore::Append(const ControllerState& state)
+{
+  m_buttons.push_back(PackButtons(state));
+  m_trigger_l.push_back(state.TriggerL);
+  m_trigger_r.push_back(state.TriggerR);
+  m_analog_x.push_back(state.AnalogStickX);
+  m_analog_y.push_back(state.AnalogStickY);
+  m_c_x.push_back(state.CStickX);
+  m_c_y.push_back(state.CStickY);
+}
+
+ControllerState InputColumnStore::GetFrame(u64 frame) const
+{
+  ControllerState state = {};
+  const u16 buttons = m_buttons[static_cast<size_t>(frame)];
+  std::memcpy(&state, &buttons, sizeof(buttons));
+  state.TriggerL = m_trigger_l[static_cast<size_t>(frame)];
+  state.TriggerR = m_trigger_r[static_cast<size_t>(frame)];
+  state.AnalogStickX = m_analog_x[static_cast<size_t>(frame)];
+  state.AnalogStickY = m_analog_y[static_cast<size_t>(frame)];
+  state.CStickX = m_c_x[static_cast<size_t>(frame)];
+  state.CStickY = m_c_y[static_cast<size_t>(frame)];
+  return state;
+}
+
+void InputColumnStore::SetFrame(u64 frame, const ControllerState& state)
+{
+  m_buttons[static_cast<size_t>(frame)] = PackButtons(state);
+  m_trigger_l[static_cast<size_t>(frame)] = state.TriggerL;
+  m_trigger_r[static_cast<size_t>(frame)] = state.TriggerR;
+  m_analog_x[static_cast<size_t>(frame)] = state.AnalogStickX;
+  m_analog_y[static_cast<size_t>(frame)] = state.AnalogStickY;
+  m_c_x[static_cast<size_t>(frame)] = state.CStickX;
+  m_c_y[static_cast<size_t>(frame)] = state.CStickY;
+}
+
+InputColumnStore::View InputColumnStore::GetView(u64 first, u64 count) const
+{
+  const size_t f = static_cast<size_t>(first);
+  View view;
+  view.buttons = m_buttons.data() + f;
+  view.trigger_l = m_trigger_l.data() + f;
+  view.trigger_r = m_trigger_r.data() + f;
+  view.analog_x = m_analog_x.data() + f;
+  view.analog_y = m_analog_y.data() + f;
+  view.c_x = m_c_x.data() + f;
+  view.c_y = m_c_y.data() + f;
+  view.count = std::min(count, GetFrameCount() - first);
+  return view;
+}
+
+void InputColumnStore::ShiftFrames(u64 first, s64 amount)
+{
+  first = std::min(first, GetFrameCount());
+  const size_t f = static_cast<size_t>(first);
+  if (amount > 0)
+  {
+    const size_t n = static_cast<size_t>(amount);
+    const ControllerState neutral = NeutralState();
+    m_buttons.insert(m_buttons.begin() + f, n, PackButtons(neutral));
+    m_trigger_l.insert(m_trigger_l.begin() + f, n, neutral.TriggerL);
+    m_trigger_r.insert(m_trigger_r.begin() + f, n, neutral.TriggerR);
+    m_analog_x.insert(m_analog_x.begin() + f, n, neutral.AnalogStickX);
+    m_analog_y.insert(m_analog_y.begin() + f, n, neutral.AnalogStickY);
+    m_c_x.insert(m_c_x.begin() + f, n, neutral.CStickX);
+    m_c_y.insert(m_c_y.begin() + f, n, neutral.CStickY);
+  }
+  else if (amount < 0)
+  {
+    const size_t n = std::min(static_cast<size_t>(-amount),
+                              static_cast<size_t>(GetFrameCount() - first));
+    m_buttons.erase(m_buttons.begin() + f, m_buttons.begin() + f + n);
+    m_trigger_l.erase(m_trigger_l.begin() + f, m_trigger_l.begin() + f + n);
+    m_trigger_r.erase(m_trigger_r.begin() + f, m_trigger_r.begin() + f + n);
+    m_analog_x.erase(m_analog_x.begin() + f, m_analog_x.begin() + f + n);
+    m_analog_y.erase(m_analog_y.begin() + f, m_analog_y.begin() + f + n);
+    m_c_x.erase(m_c_x.begin() + f, m_c_x.begin() + f + n);
+    m_c_y.erase(m_c_y.begin() + f, m_c_y.begin() + f + n);
+  }
+}
+
+u64 InputColumnStore::FindButtons(u16 pressed, u16 mask, u64 from) const
+{
+  // A linear scan over one flat u16 array: the compiler vectorizes this, and
+  // even scalar it walks 2 bytes per frame instead of 8.
+  for (size_t i = static_cast<size_t>(from); i < m_buttons.size(); i++)
+  {
+    if ((m_buttons[i] & mask) == pressed)
+      return i;
+  }
+  return GetFrameCount();
+}
+}
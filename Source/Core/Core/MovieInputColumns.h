@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/Movie.h"
+
+namespace Movie
+{
+// Columnar mirror of a run of GameCube ControllerState frames for TAS
+// editing. Each field lives in its own contiguous array, so bulk operations
+// (shifting a range of inputs, scanning a million frames for a button
+// combination) touch only the bytes they care about and run as straight-line
+// loops over one array, and any frame is an O(1) index instead of a byte
+// offset into the movie stream. The editor works on a store in memory and
+// commits the result back to the movie in one go through
+// ReplaceGCInputFromColumns, instead of rewriting the file per edit.
+class InputColumnStore
+{
+public:
+  // Non-owning window over a frame range; the pointers alias the column
+  // arrays directly, so a scan over a view copies nothing. Invalidated by
+  // any mutation of the store.
+  struct View
+  {
+    const u16* buttons;  // the two packed button/flag bytes of each frame
+    const u8* trigger_l;
+    const u8* trigger_r;
+    const u8* analog_x;
+    const u8* analog_y;
+    const u8* c_x;
+    const u8* c_y;
+    u64 count;
+  };
+
+  u64 GetFrameCount() const { return m_buttons.size(); }
+  void Clear();
+
+  void Append(const ControllerState& state);
+  // O(1) random access; reassembles the packed struct from the columns.
+  ControllerState GetFrame(u64 frame) const;
+  void SetFrame(u64 frame, const ControllerState& state);
+
+  View GetView(u64 first, u64 count) const;
+
+  // Shifts every input at or after first by amount frames: a positive amount
+  // inserts that many neutral frames (connected pad, centered sticks),
+  // pushing later inputs back; a negative amount drops frames, pulling later
+  // inputs forward. One contiguous move per column.
+  void ShiftFrames(u64 first, s64 amount);
+
+  // Returns the first frame at or after from whose button word matches
+  // pressed on the bits set in mask, or GetFrameCount() if there is none.
+  u64 FindButtons(u16 pressed, u16 mask, u64 from) const;
+
+private:
+  std::vector<u16> m_buttons;
+  std::vector<u8> m_trigger_l;
+  std::vector<u8> m_trigger_r;
+  std::vector<u8> m_analog_x;
+  std::vector<u8> m_analog_y;
+  std::vector<u8> m_c_x;
+  std::vector<u8> m_c_y;
+};
+
+// Fills the store from the active movie's input stream. Only possible when
+// no Wiimotes are recorded: their variable-size reports are interleaved with
+// the pad frames, so the stream has no fixed stride to split into columns.
+bool CopyGCInputToColumns(InputColumnStore* store);
+
+// Rewrites the active movie's input stream from the store. Fails on
+// read-only movies, inactive movies, and movies with Wiimotes.
+bool ReplaceGCInputFromColumns(const InputColumnStore& store);
+}
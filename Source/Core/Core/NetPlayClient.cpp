@@ -42,6 +42,105 @@ static std::mutex crit_netplay_client;
 static NetPlayClient* netplay_client = nullptr;
 NetSettings g_NetPlaySettings;
 
+// Wire format of an NP_MSG_PAD_BATCH entry: a bitmask of the GCPadStatus
+// fields that differ from the previous state of the same in-game pad,
+// followed by only those fields, in bit order. Most frames change nothing
+// or a single stick axis, so an entry is usually one to four bytes instead
+// of the twelve a full status takes. NetPlayServer.cpp mirrors this format.
+enum PadDeltaField : u16
+{
+  PAD_DELTA_BUTTON = 0x001,
+  PAD_DELTA_ANALOG_A = 0x002,
+  PAD_DELTA_ANALOG_B = 0x004,
+  PAD_DELTA_STICK_X = 0x008,
+  PAD_DELTA_STICK_Y = 0x010,
+  PAD_DELTA_SUBSTICK_X = 0x020,
+  PAD_DELTA_SUBSTICK_Y = 0x040,
+  PAD_DELTA_TRIGGER_LEFT = 0x080,
+  PAD_DELTA_TRIGGER_RIGHT = 0x100,
+  PAD_DELTA_CONNECTED = 0x200,
+};
+
+static u16 ComputePadDelta(const GCPadStatus& prev, const GCPadStatus& now)
+{
+  u16 mask = 0;
+  if (now.button != prev.button)
+    mask |= PAD_DELTA_BUTTON;
+  if (now.analogA != prev.analogA)
+    mask |= PAD_DELTA_ANALOG_A;
+  if (now.analogB != prev.analogB)
+    mask |= PAD_DELTA_ANALOG_B;
+  if (now.stickX != prev.stickX)
+    mask |= PAD_DELTA_STICK_X;
+  if (now.stickY != prev.stickY)
+    mask |= PAD_DELTA_STICK_Y;
+  if (now.substickX != prev.substickX)
+    mask |= PAD_DELTA_SUBSTICK_X;
+  if (now.substickY != prev.substickY)
+    mask |= PAD_DELTA_SUBSTICK_Y;
+  if (now.triggerLeft != prev.triggerLeft)
+    mask |= PAD_DELTA_TRIGGER_LEFT;
+  if (now.triggerRight != prev.triggerRight)
+    mask |= PAD_DELTA_TRIGGER_RIGHT;
+  if (now.isConnected != prev.isConnected)
+    mask |= PAD_DELTA_CONNECTED;
+  return mask;
+}
+
+static void WritePadDelta(sf::Packet& packet, const u16 mask, const GCPadStatus& pad)
+{
+  packet << mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet << pad.button;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet << pad.analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet << pad.analogB;
+  if (mask & PAD_DELTA_STICK_X)
+    packet << pad.stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet << pad.stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet << pad.substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet << pad.substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet << pad.triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet << pad.triggerRight;
+  if (mask & PAD_DELTA_CONNECTED)
+    packet << pad.isConnected;
+}
+
+// Applies the delta on top of *pad, which holds the previous state on entry,
+// and returns the field mask that was read.
+static u16 ReadPadDelta(sf::Packet& packet, GCPadStatus* pad)
+{
+  u16 mask = 0;
+  packet >> mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet >> pad->button;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet >> pad->analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet >> pad->analogB;
+  if (mask & PAD_DELTA_STICK_X)
+    packet >> pad->stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet >> pad->stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet >> pad->substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet >> pad->substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet >> pad->triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet >> pad->triggerRight;
+  if (mask & PAD_DELTA_CONNECTED)
+    packet >> pad->isConnected;
+  return mask;
+}
+
 // called from ---GUI--- thread
 NetPlayClient::~NetPlayClient()
 {
@@ -337,6 +436,27 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
   }
   break;
 
+  case NP_MSG_PAD_BATCH:
+  {
+    u16 count = 0;
+    packet >> count;
+    while (count--)
+    {
+      PadMapping map = 0;
+      packet >> map;
+
+      // Trusting server for good map value (>=0 && <4)
+      GCPadStatus pad = m_last_pad_status_received.at(map);
+      ReadPadDelta(packet, &pad);
+      m_last_pad_status_received.at(map) = pad;
+
+      // add to pad buffer
+      m_pad_buffer.at(map).Push(pad);
+    }
+    m_gc_pad_event.Set();
+  }
+  break;
+
   case NP_MSG_WIIMOTE_DATA:
   {
     PadMapping map = 0;
@@ -760,13 +880,18 @@ void NetPlayClient::SendChatMessage(const std::string& msg)
 }
 
 // called from ---CPU--- thread
-void NetPlayClient::SendPadState(const int in_game_pad, const GCPadStatus& pad)
+void NetPlayClient::SendPadBatch(const std::vector<std::pair<PadMapping, GCPadStatus>>& batch)
 {
   sf::Packet packet;
-  packet << static_cast<MessageId>(NP_MSG_PAD_DATA);
-  packet << static_cast<PadMapping>(in_game_pad);
-  packet << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-    << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+  packet << static_cast<MessageId>(NP_MSG_PAD_BATCH);
+  packet << static_cast<u16>(batch.size());
+  for (const auto& entry : batch)
+  {
+    GCPadStatus& last = m_last_pad_status_sent[entry.first];
+    packet << entry.first;
+    WritePadDelta(packet, ComputePadDelta(last, entry.second), entry.second);
+    last = entry.second;
+  }
 
   SendAsync(std::move(packet));
 }
@@ -904,6 +1029,11 @@ void NetPlayClient::ClearBuffers()
     while (m_wiimote_buffer[i].Size())
       m_wiimote_buffer[i].Pop();
   }
+
+  // reset the NP_MSG_PAD_BATCH delta baselines to the zero status that
+  // every peer starts a game from
+  m_last_pad_status_sent.fill(GCPadStatus{});
+  m_last_pad_status_received.fill(GCPadStatus{});
 }
 
 // called from ---NETPLAY--- thread
@@ -955,6 +1085,29 @@ void NetPlayClient::OnConnectFailed(u8 reason)
   }
 }
 
+// called from ---CPU--- thread
+void NetPlayClient::ReportPadBufferStall(const u64 stall_us)
+{
+  m_pad_stall_us += stall_us;
+
+  const u64 now = Common::Timer::GetTimeUs();
+  if (now - m_pad_stall_last_report_us < 1000000)
+    return;
+
+  // Only bother the player once the stalls eat a noticeable share of each
+  // second; occasional sub-millisecond waits are normal scheduling jitter.
+  if (m_pad_stall_us >= 5000)
+  {
+    OSD::AddTypedMessage(OSD::MessageType::NetPlayBuffer,
+      StringFromFormat("NetPlay stalled %u ms waiting for pad data - try a larger buffer",
+        static_cast<u32>(m_pad_stall_us / 1000)),
+      OSD::Duration::NORMAL, OSD::Color::RED);
+  }
+
+  m_pad_stall_us = 0;
+  m_pad_stall_last_report_us = now;
+}
+
 // called from ---CPU--- thread
 bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
 {
@@ -981,6 +1134,10 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
   // clients.
   if (IsFirstInGamePad(pad_nb))
   {
+    // Collect every state produced by this poll and send them as one
+    // NP_MSG_PAD_BATCH packet; a packet per pad per state made the
+    // per-packet overhead several times the payload at full tables.
+    std::vector<std::pair<PadMapping, GCPadStatus>> batch;
     const int num_local_pads = NumLocalPads();
     for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
     {
@@ -1004,22 +1161,30 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
         // add to buffer
         m_pad_buffer[ingame_pad].Push(*pad_status);
 
-        // send
-        SendPadState(ingame_pad, *pad_status);
+        // queue for sending
+        batch.emplace_back(static_cast<PadMapping>(ingame_pad), *pad_status);
       }
     }
+
+    if (!batch.empty())
+      SendPadBatch(batch);
   }
 
   // Now, we either use the data pushed earlier, or wait for the
   // other clients to send it to us
-  while (m_pad_buffer[pad_nb].Size() == 0)
+  if (m_pad_buffer[pad_nb].Size() == 0)
   {
-    if (!m_is_running.IsSet())
+    const u64 stall_start = Common::Timer::GetTimeUs();
+    while (m_pad_buffer[pad_nb].Size() == 0)
     {
-      return false;
-    }
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
 
-    m_gc_pad_event.Wait();
+      m_gc_pad_event.Wait();
+    }
+    ReportPadBufferStall(Common::Timer::GetTimeUs() - stall_start);
   }
 
   m_pad_buffer[pad_nb].Pop(*pad_status);
@@ -1061,15 +1226,20 @@ bool NetPlayClient::WiimoteUpdate(int _number, u8* data, const u8 size, u8 repor
 
   }  // unlock players
 
-  while (m_wiimote_buffer[_number].Size() == 0)
+  if (m_wiimote_buffer[_number].Size() == 0)
   {
-    if (!m_is_running.IsSet())
+    const u64 stall_start = Common::Timer::GetTimeUs();
+    while (m_wiimote_buffer[_number].Size() == 0)
     {
-      return false;
-    }
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
 
-    // wait for receiving thread to push some data
-    m_wii_pad_event.Wait();
+      // wait for receiving thread to push some data
+      m_wii_pad_event.Wait();
+    }
+    ReportPadBufferStall(Common::Timer::GetTimeUs() - stall_start);
   }
 
   m_wiimote_buffer[_number].Pop(nw);
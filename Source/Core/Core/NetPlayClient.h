@@ -10,6 +10,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -152,7 +153,7 @@ private:
   void SendStopGamePacket();
 
   void UpdateDevices();
-  void SendPadState(int in_game_pad, const GCPadStatus& np);
+  void SendPadBatch(const std::vector<std::pair<PadMapping, GCPadStatus>>& batch);
   void SendWiimoteState(int in_game_pad, const NetWiimote& nw);
   unsigned int OnData(sf::Packet& packet);
   void Send(const sf::Packet& packet);
@@ -161,6 +162,7 @@ private:
   void ComputeMD5(const std::string& file_identifier);
   void DisplayPlayersPing();
   u32 GetPlayersMaxPing() const;
+  void ReportPadBufferStall(u64 stall_us);
 
   bool m_is_connected = false;
   ConnectionState m_connection_state = ConnectionState::Failure;
@@ -176,6 +178,18 @@ private:
   Common::Event m_gc_pad_event;
   Common::Event m_wii_pad_event;
 
+  // Baselines for the NP_MSG_PAD_BATCH delta encoding: the last status we
+  // sent for each in-game pad, and the last one the server relayed to us.
+  // Both sides reset these to the zero status when a game starts.
+  std::array<GCPadStatus, 4> m_last_pad_status_sent{};
+  std::array<GCPadStatus, 4> m_last_pad_status_received{};
+
+  // Time the CPU thread has spent blocked waiting for remote pad data,
+  // surfaced periodically so players can tell whether the buffer is too
+  // small for the connection.
+  u64 m_pad_stall_us = 0;
+  u64 m_pad_stall_last_report_us = 0;
+
   u32 m_timebase_frame = 0;
 };
 
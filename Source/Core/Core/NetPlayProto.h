@@ -60,6 +60,9 @@ enum
   NP_MSG_PAD_DATA = 0x60,
   NP_MSG_PAD_MAPPING = 0x61,
   NP_MSG_PAD_BUFFER = 0x62,
+  // All pad states produced by one poll in a single packet, each entry
+  // delta-encoded against the previous state of the same in-game pad.
+  NP_MSG_PAD_BATCH = 0x63,
 
   NP_MSG_WIIMOTE_DATA = 0x70,
   NP_MSG_WIIMOTE_MAPPING = 0x71,
@@ -41,6 +41,76 @@
 
 u64 g_netplay_initial_rtc = 1272737767;
 
+// Field bitmask for NP_MSG_PAD_BATCH delta entries; must stay in sync with
+// the copy in NetPlayClient.cpp, which documents the wire format.
+enum PadDeltaField : u16
+{
+  PAD_DELTA_BUTTON = 0x001,
+  PAD_DELTA_ANALOG_A = 0x002,
+  PAD_DELTA_ANALOG_B = 0x004,
+  PAD_DELTA_STICK_X = 0x008,
+  PAD_DELTA_STICK_Y = 0x010,
+  PAD_DELTA_SUBSTICK_X = 0x020,
+  PAD_DELTA_SUBSTICK_Y = 0x040,
+  PAD_DELTA_TRIGGER_LEFT = 0x080,
+  PAD_DELTA_TRIGGER_RIGHT = 0x100,
+  PAD_DELTA_CONNECTED = 0x200,
+};
+
+// Reads the changed fields of a delta entry into *pad and returns the mask.
+// The server only relays entries, so *pad does not need to hold a baseline.
+static u16 ReadPadDelta(sf::Packet& packet, GCPadStatus* pad)
+{
+  u16 mask = 0;
+  packet >> mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet >> pad->button;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet >> pad->analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet >> pad->analogB;
+  if (mask & PAD_DELTA_STICK_X)
+    packet >> pad->stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet >> pad->stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet >> pad->substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet >> pad->substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet >> pad->triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet >> pad->triggerRight;
+  if (mask & PAD_DELTA_CONNECTED)
+    packet >> pad->isConnected;
+  return mask;
+}
+
+static void WritePadDelta(sf::Packet& packet, const u16 mask, const GCPadStatus& pad)
+{
+  packet << mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet << pad.button;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet << pad.analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet << pad.analogB;
+  if (mask & PAD_DELTA_STICK_X)
+    packet << pad.stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet << pad.stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet << pad.substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet << pad.substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet << pad.triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet << pad.triggerRight;
+  if (mask & PAD_DELTA_CONNECTED)
+    packet << pad.isConnected;
+}
+
 NetPlayServer::~NetPlayServer()
 {
   if (is_connected)
@@ -546,6 +616,43 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   }
   break;
 
+  case NP_MSG_PAD_BATCH:
+  {
+    // if this is pad data from the last game still being received, ignore it
+    if (player.current_game != m_current_game)
+      break;
+
+    // The entries are deltas against state only the endpoints track, so
+    // they are relayed verbatim; the server just validates the mappings.
+    sf::Packet spac;
+    spac << (MessageId)NP_MSG_PAD_BATCH;
+
+    u16 count = 0;
+    packet >> count;
+    spac << count;
+
+    while (count--)
+    {
+      PadMapping map = 0;
+      packet >> map;
+
+      // If the data is not from the correct player,
+      // then disconnect them.
+      if (m_pad_map.at(map) != player.pid)
+      {
+        return 1;
+      }
+
+      GCPadStatus pad{};
+      const u16 mask = ReadPadDelta(packet, &pad);
+      spac << map;
+      WritePadDelta(spac, mask, pad);
+    }
+
+    SendToClients(spac, player.pid);
+  }
+  break;
+
   case NP_MSG_WIIMOTE_DATA:
   {
     // if this is Wiimote data from the last game still being received, ignore it
@@ -0,0 +1,212 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PerfProfile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <vector>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IniFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+
+#include "Core/ConfigManager.h"
+#include "Core/Hooks.h"
+
+namespace PerfProfile
+{
+namespace
+{
+// Boot, shader warmup and loading screens are not steady state.
+constexpr u32 WARMUP_FRAMES = 600;
+// A session is only trusted once it covers about 30 seconds of play.
+constexpr u64 MIN_MEASURED_FRAMES = 1800;
+// Frame times are binned per millisecond, so percentiles need no per-frame
+// storage no matter how long the session runs.
+constexpr u32 BUCKET_US = 1000;
+constexpr u32 NUM_BUCKETS = 100;
+
+struct SessionStats
+{
+  u64 frames;
+  u64 sum_us;
+  u64 last_end_us;
+  u32 warmup_left;
+  u32 buckets[NUM_BUCKETS];
+};
+
+// Written by the FrameEnd hook on the video thread; read by EndSession after
+// the hook has been unregistered, which guarantees the writer is done.
+static SessionStats s_stats;
+static Hooks::HookID s_hook = 0;
+static std::string s_game_id;
+
+void OnFrameEnd(const std::string&)
+{
+  const u64 now = Common::Timer::GetTimeUs();
+  if (s_stats.last_end_us != 0)
+  {
+    if (s_stats.warmup_left > 0)
+    {
+      s_stats.warmup_left--;
+    }
+    else
+    {
+      const u64 duration = now - s_stats.last_end_us;
+      s_stats.frames++;
+      s_stats.sum_us += duration;
+      s_stats.buckets[std::min<u64>(duration / BUCKET_US, NUM_BUCKETS - 1)]++;
+    }
+  }
+  s_stats.last_end_us = now;
+}
+
+u64 Percentile(const SessionStats& stats, u32 percent)
+{
+  const u64 target = stats.frames * percent / 100;
+  u64 seen = 0;
+  for (u32 i = 0; i < NUM_BUCKETS; i++)
+  {
+    seen += stats.buckets[i];
+    if (seen > target)
+      return (i + 1) * static_cast<u64>(BUCKET_US);
+  }
+  return NUM_BUCKETS * static_cast<u64>(BUCKET_US);
+}
+
+std::string ProfilePath(const std::string& game_id)
+{
+  return File::GetUserPath(D_CONFIG_IDX) + "PerfProfiles" DIR_SEP + game_id + ".ini";
+}
+
+// The envelope deliberately covers only settings that trade speed against
+// synchronization accuracy; nothing in it changes what the game can do. The
+// key names match the [Core] game INI keys read in BootCore.
+void ApplyEnvelope(const IniFile::Section* section, SConfig& config)
+{
+  section->Get("CPUThread", &config.bCPUThread, config.bCPUThread);
+  section->Get("SyncGPU", &config.bSyncGPU, config.bSyncGPU);
+  section->Get("SyncOnSkipIdle", &config.bSyncGPUOnSkipIdleHack, config.bSyncGPUOnSkipIdleHack);
+  section->Get("FastDiscSpeed", &config.bFastDiscSpeed, config.bFastDiscSpeed);
+  section->Get("DSPHLE", &config.bDSPHLE, config.bDSPHLE);
+  section->Get("CPUCore", &config.iCPUCore, config.iCPUCore);
+  section->Get("Video_Rate", &config.iVideoRate, config.iVideoRate);
+  section->Get("HalfAudioRate", &config.bHalfAudioRate, config.bHalfAudioRate);
+  section->Get("Overclock", &config.m_OCFactor, config.m_OCFactor);
+  section->Get("OverclockEnable", &config.m_OCEnable, config.m_OCEnable);
+  section->Get("OverclockGovernor", &config.m_OCGovernorEnable, config.m_OCGovernorEnable);
+}
+
+void StoreEnvelope(IniFile::Section* section, const SConfig& config)
+{
+  section->Set("CPUThread", config.bCPUThread);
+  section->Set("SyncGPU", config.bSyncGPU);
+  section->Set("SyncOnSkipIdle", config.bSyncGPUOnSkipIdleHack);
+  section->Set("FastDiscSpeed", config.bFastDiscSpeed);
+  section->Set("DSPHLE", config.bDSPHLE);
+  section->Set("CPUCore", config.iCPUCore);
+  section->Set("Video_Rate", config.iVideoRate);
+  section->Set("HalfAudioRate", config.bHalfAudioRate);
+  section->Set("Overclock", config.m_OCFactor);
+  section->Set("OverclockEnable", config.m_OCEnable);
+  section->Set("OverclockGovernor", config.m_OCGovernorEnable);
+}
+}  // Anonymous namespace
+
+std::string GetHardwareClass()
+{
+  // Brand strings contain spaces and punctuation that have no business in an
+  // INI section name.
+  std::string brand(cpu_info.brand_string);
+  for (char& c : brand)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(c)))
+      c = '_';
+  }
+  return StringFromFormat("%s-%dc", brand.c_str(), cpu_info.num_cores);
+}
+
+void ApplyBootProfile(SConfig& config)
+{
+  if (!config.m_PerfProfileApply)
+    return;
+
+  IniFile ini;
+  if (!ini.Load(ProfilePath(config.GetGameID())))
+    return;
+
+  std::string section_name = GetHardwareClass();
+  std::vector<std::string> keys;
+  if (!ini.GetKeys(section_name, &keys) || keys.empty())
+    section_name = "Default";
+  if (!ini.GetKeys(section_name, &keys) || keys.empty())
+    return;
+
+  ApplyEnvelope(ini.GetOrCreateSection(section_name), config);
+  NOTICE_LOG(BOOT, "Applied performance profile for %s (%s)", config.GetGameID().c_str(),
+             GetHardwareClass().c_str());
+}
+
+void StartSession()
+{
+  const SConfig& config = SConfig::GetInstance();
+  if (!config.m_PerfProfileRecord || s_hook != 0 || config.GetGameID().empty())
+    return;
+
+  s_game_id = config.GetGameID();
+  memset(&s_stats, 0, sizeof(s_stats));
+  s_stats.warmup_left = WARMUP_FRAMES;
+  s_hook = Hooks::Register(Hooks::Event::FrameEnd, OnFrameEnd);
+}
+
+void EndSession()
+{
+  if (s_hook == 0)
+    return;
+  Hooks::Unregister(s_hook);
+  s_hook = 0;
+
+  if (s_stats.frames < MIN_MEASURED_FRAMES)
+    return;
+
+  const u64 avg = s_stats.sum_us / s_stats.frames;
+  const u64 p95 = Percentile(s_stats, 95);
+
+  const std::string path = ProfilePath(s_game_id);
+  IniFile ini;
+  ini.Load(path);  // A missing file just starts a fresh profile.
+  IniFile::Section* section = ini.GetOrCreateSection(GetHardwareClass());
+
+  // Pareto test on (average, p95): the session only replaces the stored
+  // envelope when it is no worse in either metric and better in one, so a
+  // setting that trades throughput for stutter (or the reverse) never
+  // overwrites a strictly better configuration.
+  u64 old_avg = 0;
+  u64 old_p95 = 0;
+  if (section->Get("MeasuredAvgUs", &old_avg, u64(0)) &&
+      section->Get("MeasuredP95Us", &old_p95, u64(0)))
+  {
+    if (avg > old_avg || p95 > old_p95 || (avg == old_avg && p95 == old_p95))
+      return;
+  }
+
+  section->Set("MeasuredAvgUs", avg);
+  section->Set("MeasuredP95Us", p95);
+  section->Set("MeasuredFrames", s_stats.frames);
+  StoreEnvelope(section, SConfig::GetInstance());
+
+  File::CreateFullPath(path);
+  if (ini.Save(path))
+  {
+    NOTICE_LOG(BOOT, "Recorded performance profile for %s (%s): avg %.2f ms, p95 %.2f ms",
+               s_game_id.c_str(), GetHardwareClass().c_str(), avg / 1000.0, p95 / 1000.0);
+  }
+}
+}
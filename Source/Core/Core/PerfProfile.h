@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+class SConfig;
+
+// Per-title performance profiles: a small INI next to the regular game INIs
+// (Config/PerfProfiles/<GameID>.ini) that stores, per host hardware class,
+// the settings of the best session measured so far together with the frame
+// times they achieved. With PerfProfileRecord enabled, each session's
+// steady-state frame times are measured and the stored envelope is replaced
+// when the current settings did strictly better; with PerfProfileApply, the
+// stored envelope is layered on top of the game INI at boot. The files are
+// plain INIs, so hand-tuning a profile stays possible.
+namespace PerfProfile
+{
+// Coarse host identity used as the profile section name. CPU brand plus core
+// count tells machine models apart without being so specific that a driver
+// update orphans every recorded profile.
+std::string GetHardwareClass();
+
+// Applies the stored envelope for this title and hardware class on top of the
+// game INI settings. Called from BootCore.
+void ApplyBootProfile(SConfig& config);
+
+// Starts measuring the session's frame times. No-op unless recording is
+// enabled. Called from the emu thread once emulation is set up.
+void StartSession();
+
+// Stops measuring and folds the session into the profile file when it ran
+// long enough and measured better than what is stored. Safe to call without
+// a matching StartSession.
+void EndSession();
+}
@@ -35,6 +35,10 @@ struct CachedInterpreter::Instruction
   {
     Abort,
     Common,
+    // Superinstruction: this entry and the next are both common callbacks,
+    // executed under a single dispatch test. Formed by the fusion pass at the
+    // end of Jit().
+    Pair,
     Conditional,
   };
 
@@ -89,22 +93,30 @@ void CachedInterpreter::ExecuteOneBlock()
 
   const Instruction* code = reinterpret_cast<const Instruction*>(normal_entry);
 
-  for (; code->type != Instruction::Type::Abort; ++code)
+  // Ordered by frequency: most entries are fused pairs, then lone common
+  // callbacks, and everything else is conditional (Abort ends the loop), so
+  // the hot path is two well-predicted compares instead of a switch.
+  while (code->type != Instruction::Type::Abort)
   {
-    switch (code->type)
+    if (code->type == Instruction::Type::Pair)
     {
-    case Instruction::Type::Common:
       code->common_callback(UGeckoInstruction(code->data));
-      break;
-
-    case Instruction::Type::Conditional:
-      if (code->conditional_callback(code->data))
-        return;
-      break;
-
-    default:
-      ERROR_LOG(POWERPC, "Unknown CachedInterpreter Instruction: %d", code->type);
-      break;
+      ++code;
+      code->common_callback(UGeckoInstruction(code->data));
+      ++code;
+    }
+    else if (code->type == Instruction::Type::Common)
+    {
+      code->common_callback(UGeckoInstruction(code->data));
+      ++code;
+    }
+    else if (code->conditional_callback(code->data))
+    {
+      return;
+    }
+    else
+    {
+      ++code;
     }
   }
 }
@@ -204,6 +216,8 @@ void CachedInterpreter::Jit(u32 address)
   b->checkedEntry = GetCodePtr();
   b->normalEntry = GetCodePtr();
 
+  const size_t block_start = m_code.size();
+
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     js.downcountAmount += ops[i].opinfo->numCycles;
@@ -258,6 +272,23 @@ void CachedInterpreter::Jit(u32 address)
   }
   m_code.emplace_back();
 
+  // Superinstruction pass: fuse runs of adjacent common callbacks into
+  // pairs, so the dispatch loop pays one type test for two callbacks.
+  // Conditional callbacks stay unfused since they can leave the block.
+  for (size_t i = block_start; i + 1 < m_code.size();)
+  {
+    if (m_code[i].type == Instruction::Type::Common &&
+        m_code[i + 1].type == Instruction::Type::Common)
+    {
+      m_code[i].type = Instruction::Type::Pair;
+      i += 2;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
   b->codeSize = (u32)(GetCodePtr() - b->checkedEntry);
   b->originalSize = code_block.m_num_instructions;
 
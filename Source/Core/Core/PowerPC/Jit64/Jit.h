@@ -18,6 +18,14 @@
 // ----------
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 #include "Common/CommonTypes.h"
 #include "Common/x64ABI.h"
 #include "Common/x64Emitter.h"
@@ -41,6 +49,8 @@ public:
   bool HandleStackFault() override;
 
   void EnableOptimization();
+  // Reduced analysis for first-time (tier-1) compiles; see RecompileHotBlock.
+  void EnableTier1Analysis();
   void EnableBlockLink();
 
   // Jit!
@@ -88,9 +98,12 @@ public:
   Gen::OpArg ExtractFromReg(int reg, int offset);
   void AndWithMask(Gen::X64Reg reg, u32 mask);
   bool CheckMergedBranch(u32 crf);
+  bool CheckMergedBranchBit(u32 crbit);
   void DoMergedBranch();
   void DoMergedBranchCondition();
   void DoMergedBranchImmediate(s64 val);
+  void DoMergedBranchBit();
+  void DoMergedBranchKnownBit(bool set);
 
   // Reads a given bit of a given CR register part.
   void GetCRFieldBit(int field, int bit, Gen::X64Reg out, bool negate = false);
@@ -237,6 +250,49 @@ private:
   void AllocStack();
   void FreeStack();
 
+  // Background compilation of cold blocks (experimental, enabled with
+  // JITBackgroundCompilation). While a block is cold the CPU thread runs it
+  // through the interpreter and a worker thread compiles it; the finalized
+  // block is picked up by the dispatcher on a later execution.
+  bool DeferColdBlock(u32 em_address);
+  void BackgroundCompilerLoop();
+  void StartBackgroundCompiler();
+  void StopBackgroundCompiler();
+
+public:
+  // Replaces a block whose execution counter ran out with one compiled under
+  // a larger branch-follow budget. Called from the block's own prologue, via
+  // the trampoline in Jit.cpp.
+  void RecompileHotBlock(u32 em_address);
+
+private:
+
+  // The near code region is treated as a ring of NEAR_CODE_REGIONS slices.
+  // When emission approaches the end of the current slice, only the blocks in
+  // the next slice are evicted and the write pointer moves there, so running
+  // out of code space costs a fraction of the compiled blocks instead of a
+  // full-cache clear.
+  bool NearCodeRegionAlmostFull() const;
+  void RecycleNearCodeRegion();
+
+  // A small inline cache emitted at each indirect exit (bctr, and blr when
+  // the return stack optimization is off). It remembers the last two blocks
+  // the exit dispatched to so the hot path skips the fast_block_map probe in
+  // the assembly dispatcher. Entries are tagged with the block cache
+  // generation counter, which invalidates all of them whenever any block is
+  // destroyed; see JitBaseBlockCache::GetGeneration().
+  struct DispatchCacheSite
+  {
+    struct Entry
+    {
+      u64 key;            // (msrBits << 32) | effective address of the target
+      u64 generation;     // blocks generation when the entry was filled
+      const u8* target;   // the target block's checkedEntry
+    };
+    Entry entries[2] = {};
+  };
+  static void FillDispatchCacheSite(Jit64* jit, DispatchCacheSite* site);
+
   GPRRegCache gpr{*this};
   FPURegCache fpr{*this};
 
@@ -248,4 +304,29 @@ private:
   bool m_enable_blr_optimization;
   bool m_cleanup_after_stackfault;
   u8* m_stack;
+
+  // Serializes block compilation and block cache mutation between the CPU
+  // thread and the background compiler. Recursive because the invalidation
+  // paths in JitBaseBlockCache nest.
+  std::recursive_mutex m_compile_lock;
+  std::thread m_compile_thread;
+  std::atomic<bool> m_background_compiler_running{false};
+  std::mutex m_compile_queue_lock;
+  std::condition_variable m_compile_queue_cond;
+  std::deque<std::pair<u32, u32>> m_compile_queue;  // effective address, msr bits
+  // Executions seen per cold block, keyed by msr bits << 32 | address.
+  // Only touched on the CPU thread.
+  std::unordered_map<u64, u32> m_warm_up_counts;
+
+  // Set while RecompileHotBlock() is compiling, so the replacement block does
+  // not get an execution counter of its own.
+  bool m_compiling_hot_block = false;
+
+  static constexpr size_t NEAR_CODE_REGIONS = 4;
+  // Slice of the near code region currently being filled.
+  size_t m_near_region = 0;
+
+  // Inline cache storage for indirect exits. A deque so the addresses baked
+  // into emitted code stay stable; only freed on a full cache clear.
+  std::deque<DispatchCacheSite> m_dispatch_cache_sites;
 };
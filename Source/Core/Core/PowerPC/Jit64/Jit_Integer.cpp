@@ -366,6 +366,16 @@ bool Jit64::CheckMergedBranch(u32 crf)
           static_cast<u32>(next.BI >> 2) == crf);
 }
 
+// Like CheckMergedBranch, but requires the branch to consume exactly the given
+// CR bit, so CR-logical instructions can feed the branch from host flags.
+bool Jit64::CheckMergedBranchBit(u32 crbit)
+{
+  if (!CheckMergedBranch(crbit >> 2))
+    return false;
+
+  return static_cast<u32>(js.op[1].inst.BI) == crbit;
+}
+
 void Jit64::DoMergedBranch()
 {
   // Code that handles successful PPC branching.
@@ -477,6 +487,62 @@ void Jit64::DoMergedBranchImmediate(s64 val)
   }
 }
 
+// Branches on the CR bit the previous instruction just computed, using the
+// host flags instead of re-extracting the bit from cr_val. The caller must
+// leave ZF clear iff the bit is set (e.g. with a TEST of the bit value).
+void Jit64::DoMergedBranchBit()
+{
+  js.downcountAmount++;
+  js.skipInstructions = 1;
+  const UGeckoInstruction& next = js.op[1].inst;
+  bool condition = !!(next.BO & BO_BRANCH_IF_TRUE);
+  const u32 nextPC = js.op[1].address;
+
+  gpr.UnlockAll();
+  gpr.UnlockAllX();
+  FixupBranch pDontBranch = J_CC(condition ? CC_Z : CC_NZ, true);
+
+  gpr.Flush(RegCache::FlushMode::MaintainState);
+  fpr.Flush(RegCache::FlushMode::MaintainState);
+
+  DoMergedBranch();
+
+  SetJumpTarget(pDontBranch);
+
+  if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
+  {
+    gpr.Flush();
+    fpr.Flush();
+    WriteExit(nextPC + 4);
+  }
+}
+
+// Same, but for a CR bit whose value is known at compile time (crset/crclr),
+// so the branch direction is decided without emitting a test at all.
+void Jit64::DoMergedBranchKnownBit(bool set)
+{
+  js.downcountAmount++;
+  js.skipInstructions = 1;
+  const UGeckoInstruction& next = js.op[1].inst;
+  bool condition = !!(next.BO & BO_BRANCH_IF_TRUE);
+  const u32 nextPC = js.op[1].address;
+
+  gpr.UnlockAll();
+  gpr.UnlockAllX();
+  if (set == condition)
+  {
+    gpr.Flush();
+    fpr.Flush();
+    DoMergedBranch();
+  }
+  else if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
+  {
+    gpr.Flush();
+    fpr.Flush();
+    WriteExit(nextPC + 4);
+  }
+}
+
 void Jit64::cmpXX(UGeckoInstruction inst)
 {
   // USES_CR
@@ -59,6 +59,16 @@ void Jit64::lfXXX(UGeckoInstruction inst)
       offset = (s16)inst.SIMM_16;
   }
 
+  // Merge a following stfs that stores the register we just loaded. The raw
+  // single in RSCRATCH is bit-for-bit what stfs would store (the PPC
+  // single->double->single round trip is exact), so the store can reuse it and
+  // skip the double-to-single reconversion. lfs/stfs pairs like this are how
+  // games copy float data around. Not done with memchecks since a store fault
+  // would be reported with the load's PC.
+  const bool merge_store = single && !jo.memcheck && CanMergeNextInstructions(1) &&
+                           js.op[1].inst.OPCD == 52 && js.op[1].inst.RS == d &&
+                           js.op[1].inst.RA != 0;
+
   fpr.Lock(d);
   if (jo.memcheck && single)
   {
@@ -82,6 +92,19 @@ void Jit64::lfXXX(UGeckoInstruction inst)
   }
   if (update && jo.memcheck)
     MOV(32, gpr.R(a), addr);
+
+  if (merge_store)
+  {
+    const UGeckoInstruction& next = js.op[1].inst;
+    js.downcountAmount++;
+    js.skipInstructions = 1;
+    // An update form with a == next.RA is fine: gpr.R(a) already holds the
+    // updated address, which is what the stfs would see.
+    MOV(32, R(RSCRATCH2), gpr.R(next.RA));
+    SafeWriteRegToReg(RSCRATCH, RSCRATCH2, 32, (s32)(s16)next.SIMM_16,
+                      CallerSavedRegistersInUse());
+  }
+
   fpr.UnlockAll();
   gpr.UnlockAll();
 }
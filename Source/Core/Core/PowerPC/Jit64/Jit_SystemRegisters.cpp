@@ -550,10 +550,18 @@ void Jit64::crXXX(UGeckoInstruction inst)
   JITDISABLE(bJITSystemRegistersOff);
   DEBUG_ASSERT_MSG(DYNA_REC, inst.OPCD == 19, "Invalid crXXX");
 
+  // If the next instruction is a branch conditional consuming exactly the bit
+  // we are about to write, feed it from the host flags instead of having bcx
+  // re-extract the bit from cr_val. The bit still gets materialized into the
+  // CR field, since the analyzer does not track per-field liveness.
+  const bool merge_branch = CheckMergedBranchBit(inst.CRBD);
+
   // Special case: crclr
   if (inst.CRBA == inst.CRBB && inst.CRBA == inst.CRBD && inst.SUBOP10 == 193)
   {
     ClearCRFieldBit(inst.CRBD >> 2, 3 - (inst.CRBD & 3));
+    if (merge_branch)
+      DoMergedBranchKnownBit(false);
     return;
   }
 
@@ -561,6 +569,8 @@ void Jit64::crXXX(UGeckoInstruction inst)
   if (inst.CRBA == inst.CRBB && inst.CRBA == inst.CRBD && inst.SUBOP10 == 289)
   {
     SetCRFieldBit(inst.CRBD >> 2, 3 - (inst.CRBD & 3));
+    if (merge_branch)
+      DoMergedBranchKnownBit(true);
     return;
   }
 
@@ -574,6 +584,9 @@ void Jit64::crXXX(UGeckoInstruction inst)
   bool negateB =
       inst.SUBOP10 == 129 || inst.SUBOP10 == 417 || inst.SUBOP10 == 225 || inst.SUBOP10 == 33;
 
+  if (merge_branch)
+    gpr.FlushLockX(RSCRATCH_EXTRA);
+
   GetCRFieldBit(inst.CRBA >> 2, 3 - (inst.CRBA & 3), RSCRATCH, negateA);
   GetCRFieldBit(inst.CRBB >> 2, 3 - (inst.CRBB & 3), RSCRATCH2, negateB);
 
@@ -598,8 +611,19 @@ void Jit64::crXXX(UGeckoInstruction inst)
     break;
   }
 
+  // Keep a copy of the combined bit; SetCRFieldBit clobbers both scratch
+  // registers and the flags.
+  if (merge_branch)
+    MOVZX(32, 8, RSCRATCH_EXTRA, R(RSCRATCH));
+
   // Store result bit in CRBD
   SetCRFieldBit(inst.CRBD >> 2, 3 - (inst.CRBD & 3), RSCRATCH);
+
+  if (merge_branch)
+  {
+    TEST(8, R(RSCRATCH_EXTRA), R(RSCRATCH_EXTRA));
+    DoMergedBranchBit();
+  }
 }
 
 void Jit64::mcrfs(UGeckoInstruction inst)
@@ -284,6 +284,109 @@ private:
   bool m_sign_extend;
 };
 
+// Visitor that generates code to write a MMIO value. Values cross the MMIO
+// interface in logical form, so no byteswap is involved, mirroring the read
+// generator above.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use, Gen::OpArg src,
+                         u32 address)
+      : m_code(code), m_registers_in_use(registers_in_use), m_src(src), m_address(address)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // Writes to this register are discarded, nothing to emit.
+  }
+  void VisitDirect(T* addr, u32 mask) override { StoreToAddrMask(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  void StoreToAddrMask(int sbits, void* ptr, u32 mask)
+  {
+    m_code->MOV(64, R(RSCRATCH2), Gen::ImmPtr(ptr));
+    if (m_src.IsImm())
+    {
+      // The mask folds into the immediate.
+      u32 value = 0;
+      switch (sbits)
+      {
+      case 8:
+        value = m_src.Imm8();
+        break;
+      case 16:
+        value = m_src.Imm16();
+        break;
+      case 32:
+        value = m_src.Imm32();
+        break;
+      }
+      value &= mask;
+      Gen::OpArg imm =
+          sbits == 8 ? Gen::Imm8(static_cast<u8>(value)) :
+          sbits == 16 ? Gen::Imm16(static_cast<u16>(value)) : Gen::Imm32(value);
+      m_code->MOV(sbits, Gen::MatR(RSCRATCH2), imm);
+      return;
+    }
+    u32 all_ones = (1ULL << sbits) - 1;
+    if ((all_ones & mask) == all_ones && m_src.IsSimpleReg())
+    {
+      m_code->MOV(sbits, Gen::MatR(RSCRATCH2), m_src);
+    }
+    else
+    {
+      m_code->MOVZX(32, sbits, RSCRATCH, m_src);
+      if ((all_ones & mask) != all_ones)
+        m_code->AND(32, R(RSCRATCH), Gen::Imm32(mask));
+      m_code->MOV(sbits, Gen::MatR(RSCRATCH2), R(RSCRATCH));
+    }
+  }
+
+  void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallLambdaCA(sbits, lambda, m_address, m_src);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_src;
+  u32 m_address;
+};
+
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, Gen::OpArg src,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
                                  BitSet32 registers_in_use, u32 address, int access_size,
                                  bool sign_extend)
@@ -314,9 +417,70 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
-  bool slowmem = (flags & SAFE_LOADSTORE_FORCE_SLOWMEM) != 0;
+  bool slowmem = (flags & SAFE_LOADSTORE_FORCE_SLOWMEM) != 0 ||
+                 g_jit->js.slowmemAddresses.find(g_jit->js.compilerPC) !=
+                     g_jit->js.slowmemAddresses.end();
 
   registersInUse[reg_value] = false;
+
+  // Loads from a compile-time constant RAM address are speculatively folded to
+  // the value that memory held when the block was compiled. The emitted code
+  // verifies the guess with a compare against memory, so dependent
+  // instructions can consume the immediate without waiting for the load; if
+  // the location has changed, far code falls back to the freshly loaded value.
+  // The intended targets are the constant tables (trig, colour ramps) games
+  // address via lis/addi sequences: for those the compare never fails and the
+  // load drops out of the dependency chain entirely. Trampolines are excluded
+  // because they are only generated once a fastmem access has already faulted.
+  if (opAddress.IsImm() && accessSize <= 32 && !slowmem && !g_jit->js.generatingTrampoline &&
+      !(flags & SAFE_LOADSTORE_NO_SWAP))
+  {
+    u32 address = opAddress.Imm32() + offset;
+    if (PowerPC::IsOptimizableRAMAddress(address))
+    {
+      u32 value = 0;
+      OpArg swapped_imm;
+      switch (accessSize)
+      {
+      case 32:
+        value = PowerPC::HostRead_U32(address);
+        swapped_imm = Imm32(Common::swap32(value));
+        break;
+      case 16:
+        value = PowerPC::HostRead_U16(address);
+        swapped_imm = Imm16(Common::swap16(static_cast<u16>(value)));
+        break;
+      case 8:
+        value = PowerPC::HostRead_U8(address);
+        swapped_imm = Imm8(static_cast<u8>(value));
+        break;
+      }
+      if (signExtend && accessSize < 32)
+        value = accessSize == 16 ? static_cast<u32>(static_cast<s32>(static_cast<s16>(value))) :
+                                   static_cast<u32>(static_cast<s32>(static_cast<s8>(value)));
+
+      MOV(32, R(reg_value), Imm32(address));
+      CMP(accessSize, MRegSum(RMEM, reg_value), swapped_imm);
+      FixupBranch changed = J_CC(CC_NE, m_far_code.Enabled());
+      MOV(32, R(reg_value), Imm32(value));
+
+      FixupBranch exit;
+      if (m_far_code.Enabled())
+        SwitchToFarCode();
+      else
+        exit = J(true);
+      SetJumpTarget(changed);
+      LoadAndSwap(accessSize, reg_value, MRegSum(RMEM, reg_value), signExtend);
+      if (m_far_code.Enabled())
+      {
+        exit = J(true);
+        SwitchToNearCode();
+      }
+      SetJumpTarget(exit);
+      return;
+    }
+  }
+
   if (g_jit->jo.fastmem && !(flags & SAFE_LOADSTORE_NO_FASTMEM) && !slowmem)
   {
     u8* backpatchStart = GetWritableCodePtr();
@@ -478,7 +642,9 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
                                      BitSet32 registersInUse, int flags)
 {
   bool swap = !(flags & SAFE_LOADSTORE_NO_SWAP);
-  bool slowmem = (flags & SAFE_LOADSTORE_FORCE_SLOWMEM) != 0;
+  bool slowmem = (flags & SAFE_LOADSTORE_FORCE_SLOWMEM) != 0 ||
+                 g_jit->js.slowmemAddresses.find(g_jit->js.compilerPC) !=
+                     g_jit->js.slowmemAddresses.end();
 
   // set the correct immediate format
   reg_value = FixImmediate(accessSize, reg_value);
@@ -602,6 +768,7 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
                                        BitSet32 registersInUse)
 {
   arg = FixImmediate(accessSize, arg);
+  u32 mmioAddress = 0;
 
   // If we already know the address through constant folding, we can do some
   // fun tricks...
@@ -619,8 +786,7 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     // And store it in the gather pipe
     MOV(64, R(RSCRATCH2), PPCSTATE(gather_pipe_ptr));
     SwapAndStore(accessSize, MatR(RSCRATCH2), arg_reg);
-    ADD(64, R(RSCRATCH2), Imm8(accessSize >> 3));
-    MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
+    ADD(64, PPCSTATE(gather_pipe_ptr), Imm8(accessSize >> 3));
 
     g_jit->js.fifoBytesSinceCheck += accessSize >> 3;
     return false;
@@ -630,6 +796,14 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
   }
+  else if (accessSize != 64 && (mmioAddress = PowerPC::IsOptimizableMMIOAccess(address, accessSize)) != 0)
+  {
+    // Known MMIO register: specialize against the handler instead of going
+    // through the full dispatch. Spin-loop acks and polled registers turn
+    // into a plain store (or nothing at all for dropped writes).
+    MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmioAddress, accessSize);
+    return false;
+  }
   else
   {
     // Helps external systems know which instruction triggered the write
@@ -66,6 +66,8 @@ public:
   // call for known addresses in MMIO range (MMIO::IsMMIOAddress).
   void MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value, BitSet32 registers_in_use,
                      u32 address, int access_size, bool sign_extend);
+  void MMIOWriteRegToAddr(MMIO::Mapping* mmio, Gen::OpArg src, BitSet32 registers_in_use,
+                          u32 address, int access_size);
 
   enum SafeLoadStoreFlags
   {
@@ -122,6 +122,18 @@ bool Jitx86Base::BackPatch(u32 emAddress, SContext* ctx)
     *ptr -= static_cast<u32>(info.offset);
   }
 
+  // A site only faults once per compile: the patch above routes it through
+  // the trampoline from now on. Repeated faults at the same PPC instruction
+  // therefore mean the surrounding block keeps getting recompiled, as happens
+  // around MMIO-polling loops during boot. Once a site has faulted often
+  // enough, pin it to slowmem and recompile the block now, so it stops paying
+  // a fault (and a fresh trampoline) per recompile.
+  if (++js.fastmemFaultCounts[info.pc] >= FASTMEM_FAULT_THRESHOLD &&
+      js.slowmemAddresses.insert(info.pc).second)
+  {
+    GetBlockCache()->InvalidateICache(info.pc, 4, true);
+  }
+
   ctx->CTX_PC = reinterpret_cast<u64>(trampoline);
 
   return true;
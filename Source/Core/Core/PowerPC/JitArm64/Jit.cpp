@@ -668,7 +668,11 @@ void JitArm64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock*
     bool gatherPipeIntCheck =
         js.fifoWriteAddresses.find(ops[i].address) != js.fifoWriteAddresses.end();
 
-    if (jo.optimizeGatherPipe && (js.fifoBytesSinceCheck >= 32 || js.mustCheckFifo))
+    // Same deferral bound as Jit64: the backing buffer is
+    // GATHER_PIPE_EXTRA_SIZE bytes, so checking every 256 bytes cannot
+    // overflow it even with the drain leftovers and one more store on top.
+    if (jo.optimizeGatherPipe &&
+        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE * 8 || js.mustCheckFifo))
     {
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
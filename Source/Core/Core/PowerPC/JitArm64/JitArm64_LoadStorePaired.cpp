@@ -31,7 +31,10 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   // X2 is a temporary
   // Q0 is the return register
   // Q1 is a temporary
-  bool update = inst.OPCD == 57;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 57 || (indexed && (inst.SUBOP6 & 32));
+  int i = indexed ? inst.Ix : inst.I;
+  int w = indexed ? inst.Wx : inst.W;
   s32 offset = inst.SIMM_12;
 
   gpr.Lock(W0, W1, W2, W30);
@@ -43,7 +46,14 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   ARM64Reg type_reg = W2;
   ARM64Reg VS;
 
-  if (inst.RA || update)  // Always uses the register on update
+  if (indexed)
+  {
+    if (inst.RA)
+      ADD(addr_reg, arm_addr, gpr.R(inst.RB));
+    else
+      MOV(addr_reg, gpr.R(inst.RB));
+  }
+  else if (inst.RA || update)  // Always uses the register on update
   {
     if (offset >= 0)
       ADD(addr_reg, arm_addr, offset);
@@ -64,7 +74,7 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   if (js.assumeNoPairedQuantize)
   {
     VS = fpr.RW(inst.RS, REG_REG_SINGLE);
-    if (!inst.W)
+    if (!w)
     {
       ADD(EncodeRegTo64(addr_reg), EncodeRegTo64(addr_reg), MEM_REG);
       m_float_emit.LD1(32, 1, EncodeRegToDouble(VS), EncodeRegTo64(addr_reg));
@@ -77,11 +87,11 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   }
   else
   {
-    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
+    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + i]));
     UBFM(type_reg, scale_reg, 16, 18);   // Type
     UBFM(scale_reg, scale_reg, 24, 29);  // Scale
 
-    MOVP2R(X30, inst.W ? singleLoadQuantized : pairedLoadQuantized);
+    MOVP2R(X30, w ? singleLoadQuantized : pairedLoadQuantized);
     LDR(X30, X30, ArithOption(EncodeRegTo64(type_reg), true));
     BLR(X30);
 
@@ -89,7 +99,7 @@ void JitArm64::psq_l(UGeckoInstruction inst)
     m_float_emit.ORR(EncodeRegToDouble(VS), D0, D0);
   }
 
-  if (inst.W)
+  if (w)
   {
     m_float_emit.FMOV(S0, 0x70);  // 1.0 as a Single
     m_float_emit.INS(32, VS, 1, Q0, 0);
@@ -113,7 +123,10 @@ void JitArm64::psq_st(UGeckoInstruction inst)
   // X1 is the address
   // Q0 is the store register
 
-  bool update = inst.OPCD == 61;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 61 || (indexed && (inst.SUBOP6 & 32));
+  int i = indexed ? inst.Ix : inst.I;
+  int w = indexed ? inst.Wx : inst.W;
   s32 offset = inst.SIMM_12;
 
   gpr.Lock(W0, W1, W2, W30);
@@ -135,7 +148,14 @@ void JitArm64::psq_st(UGeckoInstruction inst)
   gprs_in_use &= BitSet32(~7);
   fprs_in_use &= BitSet32(~3);
 
-  if (inst.RA || update)  // Always uses the register on update
+  if (indexed)
+  {
+    if (inst.RA)
+      ADD(addr_reg, gpr.R(inst.RA), gpr.R(inst.RB));
+    else
+      MOV(addr_reg, gpr.R(inst.RB));
+  }
+  else if (inst.RA || update)  // Always uses the register on update
   {
     if (offset >= 0)
       ADD(addr_reg, gpr.R(inst.RA), offset);
@@ -158,9 +178,9 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     u32 flags = BackPatchInfo::FLAG_STORE;
 
     if (single)
-      flags |= (inst.W ? BackPatchInfo::FLAG_SIZE_F32I : BackPatchInfo::FLAG_SIZE_F32X2I);
+      flags |= (w ? BackPatchInfo::FLAG_SIZE_F32I : BackPatchInfo::FLAG_SIZE_F32X2I);
     else
-      flags |= (inst.W ? BackPatchInfo::FLAG_SIZE_F32 : BackPatchInfo::FLAG_SIZE_F32X2);
+      flags |= (w ? BackPatchInfo::FLAG_SIZE_F32 : BackPatchInfo::FLAG_SIZE_F32X2);
 
     EmitBackpatchRoutine(flags, jo.fastmem, jo.fastmem, VS, EncodeRegTo64(addr_reg), gprs_in_use,
                          fprs_in_use);
@@ -173,13 +193,13 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     }
     else
     {
-      if (inst.W)
+      if (w)
         m_float_emit.FCVT(32, 64, D0, VS);
       else
         m_float_emit.FCVTN(32, D0, VS);
     }
 
-    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
+    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + i]));
     UBFM(type_reg, scale_reg, 0, 2);    // Type
     UBFM(scale_reg, scale_reg, 8, 13);  // Scale
 
@@ -192,7 +212,7 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SwitchToFarCode();
     SetJumpTarget(fail);
     // Slow
-    MOVP2R(X30, &pairedStoreQuantized[16 + inst.W * 8]);
+    MOVP2R(X30, &pairedStoreQuantized[16 + w * 8]);
     LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
 
     ABI_PushRegisters(gprs_in_use);
@@ -205,7 +225,7 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SetJumpTarget(pass);
 
     // Fast
-    MOVP2R(X30, &pairedStoreQuantized[inst.W * 8]);
+    MOVP2R(X30, &pairedStoreQuantized[w * 8]);
     LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
     BLR(EncodeRegTo64(type_reg));
 
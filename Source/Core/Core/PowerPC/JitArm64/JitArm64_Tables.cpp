@@ -158,10 +158,10 @@ constexpr GekkoOPTemplate table4_2[] = {
 };
 
 constexpr GekkoOPTemplate table4_3[] = {
-    {6, &JitArm64::FallBackToInterpreter},   // psq_lx
-    {7, &JitArm64::FallBackToInterpreter},   // psq_stx
-    {38, &JitArm64::FallBackToInterpreter},  // psq_lux
-    {39, &JitArm64::FallBackToInterpreter},  // psq_stux
+    {6, &JitArm64::psq_l},    // psq_lx
+    {7, &JitArm64::psq_st},   // psq_stx
+    {38, &JitArm64::psq_l},   // psq_lux
+    {39, &JitArm64::psq_st},  // psq_stux
 };
 
 constexpr GekkoOPTemplate table19[] = {
@@ -0,0 +1,205 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PowerPC/JitCacheDump.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include "Common/PerformanceCounter.h"
+#endif
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/Hooks.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+namespace JitCacheDump
+{
+namespace
+{
+constexpr u32 DUMP_VERSION = 1;
+
+#pragma pack(push, 1)
+struct DumpHeader
+{
+  char magic[4];
+  u32 version;
+  u64 counts_per_sec;
+  u32 block_count;
+};
+
+struct BlockRecord
+{
+  u32 effective_address;
+  u32 physical_address;
+  u32 msr_bits;
+  u32 code_size;
+  u32 original_size;
+  u32 num_links;
+  u64 host_checked_entry;
+  u64 host_normal_entry;
+  u64 run_count;
+  u64 downcount_counter;
+  u64 tic_counter;
+};
+
+struct LinkRecord
+{
+  u32 exit_address;
+  u32 flags;
+};
+#pragma pack(pop)
+
+// Watchdog state, written by the FrameEnd hook on the video thread. The
+// same warmup rationale as PerfProfile applies: boot, shader compilation
+// and loading screens must not pollute the baseline.
+constexpr u32 WARMUP_FRAMES = 600;
+// Frames averaged to establish the session's steady-state frame time.
+constexpr u32 BASELINE_FRAMES = 900;
+// A stall is this many consecutive frames at more than twice the baseline;
+// at 60fps this is about two seconds, long enough to ignore one-off hitches
+// like texture uploads or savestate writes.
+constexpr u32 STALL_FRAMES = 120;
+
+static Hooks::HookID s_hook = 0;
+static u64 s_last_end_us;
+static u32 s_warmup_left;
+static u64 s_baseline_sum_us;
+static u32 s_baseline_frames;
+static u32 s_stall_streak;
+static bool s_dumped;
+
+void OnFrameEnd(const std::string&)
+{
+  const u64 now = Common::Timer::GetTimeUs();
+  const u64 last = s_last_end_us;
+  s_last_end_us = now;
+  if (last == 0)
+    return;
+
+  if (s_warmup_left > 0)
+  {
+    s_warmup_left--;
+    return;
+  }
+
+  const u64 duration = now - last;
+  if (s_baseline_frames < BASELINE_FRAMES)
+  {
+    s_baseline_sum_us += duration;
+    s_baseline_frames++;
+    return;
+  }
+
+  const u64 baseline = s_baseline_sum_us / s_baseline_frames;
+  if (duration > baseline * 2)
+    s_stall_streak++;
+  else
+    s_stall_streak = 0;
+
+  if (s_stall_streak < STALL_FRAMES || s_dumped)
+    return;
+
+  // One dump per session; queue it to the host thread so the pause in
+  // WriteDump never runs on the video thread that fired this hook.
+  s_dumped = true;
+  const std::string filename = File::GetUserPath(D_DUMP_IDX) + "jitcache-" +
+                               SConfig::GetInstance().GetGameID() + ".bin";
+  WARN_LOG(POWERPC, "Sustained stall detected (%" PRIu64 "us frames, baseline %" PRIu64
+                    "us), dumping JIT cache to %s",
+           duration, baseline, filename.c_str());
+  Core::QueueHostJob([filename] { WriteDump(filename); });
+}
+}  // Anonymous namespace
+
+void WriteDump(const std::string& filename)
+{
+  if (!g_jit)
+    return;
+
+  File::IOFile f(filename, "wb");
+  if (!f)
+  {
+    ERROR_LOG(POWERPC, "Failed to open %s for JIT cache dump", filename.c_str());
+    return;
+  }
+
+  Core::State old_state = Core::GetState();
+  if (old_state == Core::State::Running)
+    Core::SetState(Core::State::Paused);
+
+  DumpHeader header = {};
+  std::memcpy(header.magic, "DJCD", sizeof(header.magic));
+  header.version = DUMP_VERSION;
+  QueryPerformanceFrequency((LARGE_INTEGER*)&header.counts_per_sec);
+  g_jit->GetBlockCache()->RunOnBlocks([&header](const JitBlock&) { header.block_count++; });
+  f.WriteBytes(&header, sizeof(header));
+
+  g_jit->GetBlockCache()->RunOnBlocks([&f](const JitBlock& block) {
+    BlockRecord record = {};
+    record.effective_address = block.effectiveAddress;
+    record.physical_address = block.physicalAddress;
+    record.msr_bits = block.msrBits;
+    record.code_size = block.codeSize;
+    record.original_size = block.originalSize;
+    record.num_links = static_cast<u32>(block.linkData.size());
+    record.host_checked_entry = reinterpret_cast<u64>(block.checkedEntry);
+    record.host_normal_entry = reinterpret_cast<u64>(block.normalEntry);
+    record.run_count = block.profile_data.runCount;
+    record.downcount_counter = block.profile_data.downcountCounter;
+    record.tic_counter = block.profile_data.ticCounter;
+    f.WriteBytes(&record, sizeof(record));
+
+    for (const auto& link : block.linkData)
+    {
+      LinkRecord link_record = {};
+      link_record.exit_address = link.exitAddress;
+      link_record.flags = (link.linkStatus ? 1 : 0) | (link.call ? 2 : 0);
+      f.WriteBytes(&link_record, sizeof(link_record));
+    }
+
+    f.WriteBytes(block.checkedEntry, block.codeSize);
+  });
+
+  if (old_state == Core::State::Running)
+    Core::SetState(Core::State::Running);
+
+  NOTICE_LOG(POWERPC, "Dumped %u JIT blocks to %s", header.block_count, filename.c_str());
+}
+
+void StartWatchdog()
+{
+  if (!SConfig::GetInstance().m_JitCacheDumpOnStall || s_hook != 0)
+    return;
+
+  s_last_end_us = 0;
+  s_warmup_left = WARMUP_FRAMES;
+  s_baseline_sum_us = 0;
+  s_baseline_frames = 0;
+  s_stall_streak = 0;
+  s_dumped = false;
+  s_hook = Hooks::Register(Hooks::Event::FrameEnd, OnFrameEnd);
+}
+
+void StopWatchdog()
+{
+  if (s_hook == 0)
+    return;
+  Hooks::Unregister(s_hook);
+  s_hook = 0;
+}
+}
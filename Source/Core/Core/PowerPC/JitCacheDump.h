@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+// Dumps the JIT block cache - origin PCs, link graph, profile counters and
+// the emitted host code bytes - to a compact binary so codegen regressions
+// reported from machines we cannot reproduce on can still be analyzed
+// offline. Unlike the tab-separated output of
+// JitInterface::WriteProfileResults, the dump carries the machine code
+// itself, so an external script can disassemble any block and rank blocks
+// by the cycles they consumed.
+//
+// Binary layout (host endian, no padding):
+//   header:  magic "DJCD", u32 version, u64 counts_per_sec, u32 block_count
+//   per block:
+//     u32 effective_address, u32 physical_address, u32 msr_bits
+//     u32 code_size, u32 original_size, u32 num_links
+//     u64 host_checked_entry, u64 host_normal_entry
+//     u64 run_count, u64 downcount_counter, u64 tic_counter
+//     num_links * { u32 exit_address, u32 flags (bit 0 linked, bit 1 call) }
+//     code_size bytes of host code, starting at the checked entry
+namespace JitCacheDump
+{
+// Writes a dump of the current code cache. Pauses the core for the duration,
+// like JitInterface::GetProfileResults. Callable on demand, e.g. from a
+// Hooks callback owned by an automation frontend. No-op without a JIT core.
+void WriteDump(const std::string& filename);
+
+// Starts the stall watchdog: a FrameEnd hook that learns the session's
+// steady-state frame time and, on a sustained slowdown, writes one dump to
+// the Dump directory automatically. No-op unless JitCacheDumpOnStall is
+// enabled. Called from the emu thread next to PerfProfile::StartSession.
+void StartWatchdog();
+
+// Unregisters the watchdog hook. Safe to call without a matching
+// StartWatchdog.
+void StopWatchdog();
+}
@@ -9,6 +9,7 @@
 //#define JIT_LOG_FPR     // Enables logging of the PPC floating point regs
 
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "Common/CommonTypes.h"
@@ -99,6 +100,14 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+
+    // Load/store sites that keep faulting their way through the fastmem guard
+    // pages. Faults are counted per PPC instruction; once a site crosses
+    // FASTMEM_FAULT_THRESHOLD it lands in slowmemAddresses and is compiled
+    // with a slowmem access up front, instead of taking another fault every
+    // time the surrounding block is recompiled. Both survive cache clears.
+    std::unordered_map<u32, u32> fastmemFaultCounts;
+    std::unordered_set<u32> slowmemAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -108,6 +117,10 @@ protected:
 
   void UpdateMemoryOptions();
 
+  // Number of guard-page faults a single load/store may take across
+  // recompiles before it is compiled as a slowmem access instead.
+  static constexpr u32 FASTMEM_FAULT_THRESHOLD = 8;
+
 public:
   // This should probably be removed from public:
   JitOptions jo{};
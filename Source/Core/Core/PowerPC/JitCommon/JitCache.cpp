@@ -18,6 +18,7 @@
 #include <utility>
 
 #include "Common/CommonTypes.h"
+#include "Common/FlightRecorder.h"
 #include "Common/JitRegister.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -62,6 +63,9 @@ void JitBaseBlockCache::Clear()
 #if defined(_DEBUG) || defined(DEBUGFAST)
   Core::DisplayMessage("Clearing code cache.", 3000);
 #endif
+  // fastmemFaultCounts and slowmemAddresses deliberately survive the clear:
+  // a full cache clear is exactly when every faulting site would otherwise
+  // start its fault storm over.
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   for (auto& e : block_map)
@@ -75,6 +79,8 @@ void JitBaseBlockCache::Clear()
   valid_block.ClearAll();
 
   fast_block_map.fill(nullptr);
+
+  m_generation++;
 }
 
 void JitBaseBlockCache::Reset()
@@ -107,13 +113,18 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
-                                      const std::set<u32>& physical_addresses)
+                                      const PPCAnalyst::PhysicalAddressSet& physical_addresses)
 {
   size_t index = FastLookupIndexForAddress(block.effectiveAddress);
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
 
-  block.physical_addresses = physical_addresses;
+  Common::FlightRecorder::Count(Common::FlightRecorder::Counter::JitBlocksCompiled);
+
+  // The JitBlock outlives the analysis arena's next reset, so this copies
+  // the addresses into heap-backed storage.
+  block.physical_addresses.clear();
+  block.physical_addresses.insert(physical_addresses.begin(), physical_addresses.end());
 
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
   for (u32 addr : physical_addresses)
@@ -172,6 +183,10 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
 
 const u8* JitBaseBlockCache::Dispatch()
 {
+  std::unique_lock<std::recursive_mutex> guard;
+  if (m_compile_lock)
+    guard = std::unique_lock<std::recursive_mutex>(*m_compile_lock);
+
   JitBlock* block = fast_block_map[FastLookupIndexForAddress(PC)];
 
   if (!block || block->effectiveAddress != PC || block->msrBits != (MSR & JIT_CACHE_MSR_MASK))
@@ -185,6 +200,10 @@ const u8* JitBaseBlockCache::Dispatch()
 
 void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
 {
+  std::unique_lock<std::recursive_mutex> guard;
+  if (m_compile_lock)
+    guard = std::unique_lock<std::recursive_mutex>(*m_compile_lock);
+
   auto translated = PowerPC::JitCache_TranslateAddress(address);
   if (!translated.valid)
     return;
@@ -215,6 +234,8 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
       {
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
+        m_jit.js.fastmemFaultCounts.erase(i);
+        m_jit.js.slowmemAddresses.erase(i);
       }
     }
   }
@@ -222,6 +243,10 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
+  std::unique_lock<std::recursive_mutex> guard;
+  if (m_compile_lock)
+    guard = std::unique_lock<std::recursive_mutex>(*m_compile_lock);
+
   // Iterate over all macro blocks which overlap the given range.
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
   auto start = block_range_map.lower_bound(address & range_mask);
@@ -269,6 +294,68 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   }
 }
 
+void JitBaseBlockCache::EraseCodeRange(const u8* start, const u8* end)
+{
+  std::unique_lock<std::recursive_mutex> guard;
+  if (m_compile_lock)
+    guard = std::unique_lock<std::recursive_mutex>(*m_compile_lock);
+
+  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  auto iter = block_map.begin();
+  while (iter != block_map.end())
+  {
+    JitBlock& block = iter->second;
+    if (block.checkedEntry >= start && block.checkedEntry < end)
+    {
+      // As in ErasePhysicalRange, this may leave empty macro blocks behind,
+      // but they can be reused or are dropped on the next full clear.
+      for (u32 addr : block.physical_addresses)
+        block_range_map[addr & range_mask].erase(&block);
+
+      DestroyBlock(block);
+      iter = block_map.erase(iter);
+    }
+    else
+    {
+      iter++;
+    }
+  }
+}
+
+void JitBaseBlockCache::EraseSingleBlock(u32 em_address, u32 msr)
+{
+  std::unique_lock<std::recursive_mutex> guard;
+  if (m_compile_lock)
+    guard = std::unique_lock<std::recursive_mutex>(*m_compile_lock);
+
+  u32 translated_addr = em_address;
+  if (UReg_MSR(msr).IR)
+  {
+    auto translated = PowerPC::JitCache_TranslateAddress(em_address);
+    if (!translated.valid)
+      return;
+    translated_addr = translated.address;
+  }
+
+  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  auto iter = block_map.equal_range(translated_addr);
+  for (; iter.first != iter.second; iter.first++)
+  {
+    JitBlock& block = iter.first->second;
+    if (block.effectiveAddress != em_address || block.msrBits != (msr & JIT_CACHE_MSR_MASK))
+      continue;
+
+    // As in ErasePhysicalRange, this may leave empty macro blocks behind,
+    // but they can be reused or are dropped on the next full clear.
+    for (u32 addr : block.physical_addresses)
+      block_range_map[addr & range_mask].erase(&block);
+
+    DestroyBlock(block);
+    block_map.erase(iter.first);
+    return;
+  }
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -345,6 +432,9 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   if (fast_block_map[block.fast_block_map_index] == &block)
     fast_block_map[block.fast_block_map_index] = nullptr;
 
+  // Invalidate any inline caches which may still point at this block.
+  m_generation++;
+
   UnlinkBlock(block);
 
   // Delete linking addresses
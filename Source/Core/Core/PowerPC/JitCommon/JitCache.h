@@ -10,10 +10,13 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/SmallVector.h"
+#include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
 
@@ -59,11 +62,18 @@ struct JitBlock
     bool linkStatus;  // is it already linked?
     bool call;
   };
-  std::vector<LinkData> linkData;
+  // Blocks rarely have more than two exits, so keep them inline instead of
+  // paying a heap allocation per compiled block.
+  Common::SmallVector<LinkData, 2> linkData;
 
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // Decremented by the block prologue on every execution; when it hits zero,
+  // the JIT recompiles the block with a larger inlining budget (see
+  // Jit64::RecompileHotBlock).
+  u32 hot_countdown = 0;
+
   // Block profiling data, structure is inlined in Jit.cpp
   struct ProfileData
   {
@@ -134,7 +144,8 @@ public:
   void RunOnBlocks(std::function<void(const JitBlock&)> f);
 
   JitBlock* AllocateBlock(u32 em_address);
-  void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  void FinalizeBlock(JitBlock& block, bool block_link,
+                     const PPCAnalyst::PhysicalAddressSet& physical_addresses);
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -149,6 +160,27 @@ public:
 
   void InvalidateICache(u32 address, u32 length, bool forced);
   void ErasePhysicalRange(u32 address, u32 length);
+  // Removes the block starting at the given address (if any) from the cache,
+  // so a recompiled version can take its place. The host code of the old
+  // block stays valid until its region is recycled, which lets the JIT
+  // replace a block from within that block's own prologue.
+  void EraseSingleBlock(u32 em_address, u32 msr);
+  // Destroys every block whose host code was emitted inside [start, end).
+  // Lets a JIT recycle a slice of its code region without a full clear.
+  void EraseCodeRange(const u8* start, const u8* end);
+
+  // Monotonic counter which is bumped whenever a block is destroyed or the
+  // cache is cleared. JITs which cache block entry points inside emitted code
+  // (e.g. inline caches at indirect exits) tag each cached entry with this
+  // counter so a single increment invalidates all of them at once.
+  u64 GetGeneration() const { return m_generation; }
+  const u64* GetGenerationPtr() const { return &m_generation; }
+
+  // When a JIT implementation compiles blocks outside the CPU thread, it
+  // provides its compile lock here so dispatch misses and invalidations are
+  // serialized against the background compiler. Not set (and therefore free)
+  // for purely synchronous JITs.
+  void SetCompileLock(std::recursive_mutex* lock) { m_compile_lock = lock; }
 
   u32* GetBlockBitSet() const;
 
@@ -190,4 +222,11 @@ private:
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
   std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map;  // start_addr & mask -> number
+
+  // See GetGeneration(). Starts at 1 so zero-initialized inline cache
+  // entries never match.
+  u64 m_generation = 1;
+
+  // See SetCompileLock().
+  std::recursive_mutex* m_compile_lock = nullptr;
 };
@@ -163,13 +163,81 @@ static void EFB_Write(u32 data, u32 addr)
 BatTable ibat_table;
 BatTable dbat_table;
 
+// Host-pointer translation cache for full-MMU titles.
+//
+// When MSR.DR is set and fastmem can't be used, every access pays for
+// TranslateAddress (BAT lookup, TLB lookup, possibly a page table walk) plus
+// the physical region dispatch below. This direct-mapped effective-page ->
+// host-page table caches the combined result, so the common hit case is an
+// index, a tag compare and a memcpy. Entries are only created for pages whose
+// translation lands in plain memory (never MMIO, EFB or the gather pipe,
+// which must keep taking the dispatch path). The generation counter
+// invalidates the whole table in O(1) whenever anything that can affect
+// translations changes: tlbie, BAT updates, SDR1 updates and savestate loads
+// (which call the BAT update functions).
+struct TranslationCacheEntry
+{
+  static constexpr u32 INVALID_TAG = 0xFFFFFFFF;
+
+  u32 tag = INVALID_TAG;  // effective address >> HW_PAGE_INDEX_SHIFT
+  u64 generation = 0;
+  u8* host_page = nullptr;
+};
+constexpr size_t TRANSLATION_CACHE_SIZE = 0x1000;  // 4096 pages of reach per table
+
+// [0] = reads, [1] = writes. Write entries are only created after a
+// successful Write-flag translation, which has already set the PTE's C bit.
+static TranslationCacheEntry s_translation_cache[2][TRANSLATION_CACHE_SIZE];
+static u64 s_translation_cache_generation = 1;
+
+static void InvalidateTranslationCache()
+{
+  s_translation_cache_generation++;
+}
+
+static u8* LookupTranslationCache(bool write, u32 em_address)
+{
+  const TranslationCacheEntry& entry =
+      s_translation_cache[write][(em_address >> HW_PAGE_INDEX_SHIFT) & (TRANSLATION_CACHE_SIZE - 1)];
+  if (entry.tag != em_address >> HW_PAGE_INDEX_SHIFT ||
+      entry.generation != s_translation_cache_generation)
+  {
+    return nullptr;
+  }
+  return entry.host_page + (em_address & (HW_PAGE_SIZE - 1));
+}
+
+// host points at the translated location of em_address within a plain memory
+// bank; the whole 4 KiB page around it is safe to access directly.
+static void UpdateTranslationCache(bool write, u32 em_address, u8* host)
+{
+  TranslationCacheEntry& entry =
+      s_translation_cache[write][(em_address >> HW_PAGE_INDEX_SHIFT) & (TRANSLATION_CACHE_SIZE - 1)];
+  entry.tag = em_address >> HW_PAGE_INDEX_SHIFT;
+  entry.generation = s_translation_cache_generation;
+  entry.host_page = host - (em_address & (HW_PAGE_SIZE - 1));
+}
+
 static void GenerateDSIException(u32 _EffectiveAddress, bool _bWrite);
 
 template <XCheckTLBFlag flag, typename T, bool never_translate = false>
 static T ReadFromHardware(u32 em_address)
 {
-  if (!never_translate && UReg_MSR(MSR).DR)
+  const bool translated = !never_translate && UReg_MSR(MSR).DR;
+  const u32 effective_address = em_address;
+  if (translated)
   {
+    if (flag == XCheckTLBFlag::Read && !PowerPC::memchecks.HasAny() &&
+        (em_address & (HW_PAGE_SIZE - 1)) <= HW_PAGE_SIZE - sizeof(T))
+    {
+      if (const u8* host = LookupTranslationCache(false, em_address))
+      {
+        T value;
+        std::memcpy(&value, host, sizeof(T));
+        return bswap(value);
+      }
+    }
+
     auto translated_addr = TranslateAddress<flag>(em_address);
     if (!translated_addr.Success())
     {
@@ -206,38 +274,38 @@ static T ReadFromHardware(u32 em_address)
 
   // TODO: Make sure these are safe for unaligned addresses.
 
+  u8* host = nullptr;
   if ((em_address & 0xF8000000) == 0x00000000)
   {
     // Handle RAM; the masking intentionally discards bits (essentially creating
     // mirrors of memory).
     // TODO: Only the first REALRAM_SIZE is supposed to be backed by actual memory.
-    T value;
-    std::memcpy(&value, &Memory::m_pRAM[em_address & Memory::RAM_MASK], sizeof(T));
-    return bswap(value);
+    host = &Memory::m_pRAM[em_address & Memory::RAM_MASK];
   }
-
-  if (Memory::m_pEXRAM && (em_address >> 28) == 0x1 &&
-      (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
+  else if (Memory::m_pEXRAM && (em_address >> 28) == 0x1 &&
+           (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
   {
-    T value;
-    std::memcpy(&value, &Memory::m_pEXRAM[em_address & 0x0FFFFFFF], sizeof(T));
-    return bswap(value);
+    host = &Memory::m_pEXRAM[em_address & 0x0FFFFFFF];
   }
-
   // Locked L1 technically doesn't have a fixed address, but games all use 0xE0000000.
-  if ((em_address >> 28) == 0xE && (em_address < (0xE0000000 + Memory::L1_CACHE_SIZE)))
+  else if ((em_address >> 28) == 0xE && (em_address < (0xE0000000 + Memory::L1_CACHE_SIZE)))
   {
-    T value;
-    std::memcpy(&value, &Memory::m_pL1Cache[em_address & 0x0FFFFFFF], sizeof(T));
-    return bswap(value);
+    host = &Memory::m_pL1Cache[em_address & 0x0FFFFFFF];
   }
   // In Fake-VMEM mode, we need to map the memory somewhere into
   // physical memory for BAT translation to work; we currently use
   // [0x7E000000, 0x80000000).
-  if (Memory::m_pFakeVMEM && ((em_address & 0xFE000000) == 0x7E000000))
+  else if (Memory::m_pFakeVMEM && ((em_address & 0xFE000000) == 0x7E000000))
   {
+    host = &Memory::m_pFakeVMEM[em_address & Memory::RAM_MASK];
+  }
+
+  if (host)
+  {
+    if (translated && flag == XCheckTLBFlag::Read && !PowerPC::memchecks.HasAny())
+      UpdateTranslationCache(false, effective_address, host);
     T value;
-    std::memcpy(&value, &Memory::m_pFakeVMEM[em_address & Memory::RAM_MASK], sizeof(T));
+    std::memcpy(&value, host, sizeof(T));
     return bswap(value);
   }
 
@@ -256,8 +324,22 @@ static T ReadFromHardware(u32 em_address)
 template <XCheckTLBFlag flag, typename T, bool never_translate = false>
 static void WriteToHardware(u32 em_address, const T data)
 {
-  if (!never_translate && UReg_MSR(MSR).DR)
+  const bool translated = !never_translate && UReg_MSR(MSR).DR;
+  const u32 effective_address = em_address;
+  if (translated)
   {
+    if (flag == XCheckTLBFlag::Write && !PowerPC::memchecks.HasAny() &&
+        !((em_address & (sizeof(T) - 1)) &&
+          (em_address & (HW_PAGE_SIZE - 1)) > HW_PAGE_SIZE - sizeof(T)))
+    {
+      if (u8* host = LookupTranslationCache(true, em_address))
+      {
+        const T swapped_data = bswap(data);
+        std::memcpy(host, &swapped_data, sizeof(T));
+        return;
+      }
+    }
+
     auto translated_addr = TranslateAddress<flag>(em_address);
     if (!translated_addr.Success())
     {
@@ -295,39 +377,38 @@ static void WriteToHardware(u32 em_address, const T data)
 
   // TODO: Make sure these are safe for unaligned addresses.
 
+  u8* host = nullptr;
   if ((em_address & 0xF8000000) == 0x00000000)
   {
     // Handle RAM; the masking intentionally discards bits (essentially creating
     // mirrors of memory).
     // TODO: Only the first REALRAM_SIZE is supposed to be backed by actual memory.
-    const T swapped_data = bswap(data);
-    std::memcpy(&Memory::m_pRAM[em_address & Memory::RAM_MASK], &swapped_data, sizeof(T));
-    return;
+    host = &Memory::m_pRAM[em_address & Memory::RAM_MASK];
   }
-
-  if (Memory::m_pEXRAM && (em_address >> 28) == 0x1 &&
-      (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
+  else if (Memory::m_pEXRAM && (em_address >> 28) == 0x1 &&
+           (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
   {
-    const T swapped_data = bswap(data);
-    std::memcpy(&Memory::m_pEXRAM[em_address & 0x0FFFFFFF], &swapped_data, sizeof(T));
-    return;
+    host = &Memory::m_pEXRAM[em_address & 0x0FFFFFFF];
   }
-
   // Locked L1 technically doesn't have a fixed address, but games all use 0xE0000000.
-  if ((em_address >> 28 == 0xE) && (em_address < (0xE0000000 + Memory::L1_CACHE_SIZE)))
+  else if ((em_address >> 28 == 0xE) && (em_address < (0xE0000000 + Memory::L1_CACHE_SIZE)))
   {
-    const T swapped_data = bswap(data);
-    std::memcpy(&Memory::m_pL1Cache[em_address & 0x0FFFFFFF], &swapped_data, sizeof(T));
-    return;
+    host = &Memory::m_pL1Cache[em_address & 0x0FFFFFFF];
   }
-
   // In Fake-VMEM mode, we need to map the memory somewhere into
   // physical memory for BAT translation to work; we currently use
   // [0x7E000000, 0x80000000).
-  if (Memory::m_pFakeVMEM && ((em_address & 0xFE000000) == 0x7E000000))
+  else if (Memory::m_pFakeVMEM && ((em_address & 0xFE000000) == 0x7E000000))
+  {
+    host = &Memory::m_pFakeVMEM[em_address & Memory::RAM_MASK];
+  }
+
+  if (host)
   {
+    if (translated && flag == XCheckTLBFlag::Write && !PowerPC::memchecks.HasAny())
+      UpdateTranslationCache(true, effective_address, host);
     const T swapped_data = bswap(data);
-    std::memcpy(&Memory::m_pFakeVMEM[em_address & Memory::RAM_MASK], &swapped_data, sizeof(T));
+    std::memcpy(host, &swapped_data, sizeof(T));
     return;
   }
 
@@ -762,6 +843,30 @@ void ClearCacheLine(u32 address)
     address = translated_address.address;
   }
 
+  // Games use dcbz in memset-style loops, so clear the whole line with one
+  // store into the backing memory instead of dispatching four u64 writes
+  // through WriteToHardware. The line is 32-byte aligned, so it cannot
+  // straddle two banks, and zeroes don't need byteswapping.
+  if (!PowerPC::memchecks.HasAny())
+  {
+    u8* base = nullptr;
+    if ((address & 0xF8000000) == 0x00000000)
+      base = &Memory::m_pRAM[address & Memory::RAM_MASK];
+    else if (Memory::m_pEXRAM && (address >> 28) == 0x1 &&
+             (address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
+      base = &Memory::m_pEXRAM[address & 0x0FFFFFFF];
+    else if ((address >> 28) == 0xE && address < 0xE0000000 + Memory::L1_CACHE_SIZE)
+      base = &Memory::m_pL1Cache[address & 0x0FFFFFFF];
+    else if (Memory::m_pFakeVMEM && (address & 0xFE000000) == 0x7E000000)
+      base = &Memory::m_pFakeVMEM[address & Memory::RAM_MASK];
+
+    if (base)
+    {
+      std::memset(base, 0, 32);
+      return;
+    }
+  }
+
   // TODO: This isn't precisely correct for non-RAM regions, but the difference
   // is unlikely to matter.
   for (u32 i = 0; i < 32; i += 8)
@@ -959,6 +1064,7 @@ void SDRUpdated()
   }
   PowerPC::ppcState.pagetable_base = htaborg << 16;
   PowerPC::ppcState.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+  InvalidateTranslationCache();
 }
 
 enum class TLBLookupResult
@@ -1036,6 +1142,10 @@ static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 addre
 
 void InvalidateTLBEntry(u32 address)
 {
+  // tlbie invalidates a whole congruence class, which maps to many slots of
+  // the larger host-pointer cache; dropping it entirely is cheap and correct.
+  InvalidateTranslationCache();
+
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
   TLBEntry& tlbe = ppcState.tlb[0][entry_index];
@@ -1250,6 +1360,7 @@ void DBATUpdated()
 
   // IsOptimizable*Address and dcbz depends on the BAT mapping, so we need a flush here.
   JitInterface::ClearSafe();
+  InvalidateTranslationCache();
 }
 
 void IBATUpdated()
@@ -1266,6 +1377,7 @@ void IBATUpdated()
     UpdateFakeMMUBat(ibat_table, 0x70000000);
   }
   JitInterface::ClearSafe();
+  InvalidateTranslationCache();
 }
 
 // Translate effective address using BAT or PAT.  Returns 0 if the address cannot be translated.
@@ -37,10 +37,20 @@ namespace PPCAnalyst
 constexpr int CODEBUFFER_SIZE = 32000;
 
 // 0 does not perform block merging
-constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
-
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
+Common::Arena& GetAnalysisArena()
+{
+  // Covers the node storage of even maximum-size blocks; an overflow just
+  // falls back to the heap inside ArenaAllocator.
+  static Common::Arena arena(512 * 1024);
+  return arena;
+}
+
+CodeBlock::CodeBlock() : m_physical_addresses(Common::ArenaAllocator<u32>(&GetAnalysisArena()))
+{
+}
+
 CodeBuffer::CodeBuffer(int size)
 {
   codebuffer = new PPCAnalyst::CodeOp[size];
@@ -683,6 +693,178 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
+// Walks the code at a statically known block successor and collects the GPRs
+// and FPRs it reads before overwriting them. Unconditional branches are
+// followed so the scan covers a function-shaped region rather than a single
+// block. The result seeds the liveness scan of the current block; see
+// OPTION_CROSS_BLOCK_LIVENESS.
+static void ScanSuccessorRegisterUsage(u32 address, BitSet32* gprs, BitSet32* fprs)
+{
+  // A couple of blocks worth of lookahead is plenty; the hints only matter
+  // for values that are still live near the current block's exit.
+  constexpr u32 MAX_LOOKAHEAD_INSTRUCTIONS = 64;
+  constexpr u32 MAX_FOLLOWED_BRANCHES = 2;
+
+  BitSet32 gpr_defined, fpr_defined;
+  u32 follows = 0;
+  for (u32 i = 0; i < MAX_LOOKAHEAD_INSTRUCTIONS; i++)
+  {
+    auto result = PowerPC::TryReadInstruction(address);
+    if (!result.valid)
+      return;
+    UGeckoInstruction inst = result.hex;
+    GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst);
+    if (!opinfo)
+      return;
+
+    BitSet32 regs_in, regs_out;
+    if (opinfo->flags & FL_OUT_A)
+      regs_out[inst.RA] = true;
+    if (opinfo->flags & FL_OUT_D)
+      regs_out[inst.RD] = true;
+    if ((opinfo->flags & FL_IN_A) || ((opinfo->flags & FL_IN_A0) && inst.RA != 0))
+      regs_in[inst.RA] = true;
+    if (opinfo->flags & FL_IN_B)
+      regs_in[inst.RB] = true;
+    if (opinfo->flags & FL_IN_C)
+      regs_in[inst.RC] = true;
+    if (opinfo->flags & FL_IN_S)
+      regs_in[inst.RS] = true;
+    if (inst.OPCD == 46)  // lmw
+    {
+      for (u32 reg = inst.RD; reg < 32; ++reg)
+        regs_out[reg] = true;
+    }
+    else if (inst.OPCD == 47)  // stmw
+    {
+      for (u32 reg = inst.RS; reg < 32; ++reg)
+        regs_in[reg] = true;
+    }
+    *gprs |= regs_in & ~gpr_defined;
+    gpr_defined |= regs_out;
+
+    BitSet32 fregs_in;
+    if (opinfo->flags & FL_IN_FLOAT_A)
+      fregs_in[inst.FA] = true;
+    if (opinfo->flags & FL_IN_FLOAT_B)
+      fregs_in[inst.FB] = true;
+    if (opinfo->flags & FL_IN_FLOAT_C)
+      fregs_in[inst.FC] = true;
+    if (opinfo->flags & FL_IN_FLOAT_D)
+      fregs_in[inst.FD] = true;
+    if (opinfo->flags & FL_IN_FLOAT_S)
+      fregs_in[inst.FS] = true;
+    *fprs |= fregs_in & ~fpr_defined;
+    if (opinfo->flags & FL_OUT_FLOAT_D)
+      fpr_defined[inst.FD] = true;
+
+    if (inst.OPCD == 18)
+    {
+      // Keep scanning through unconditional bx (including calls).
+      if (follows++ >= MAX_FOLLOWED_BRANCHES)
+        return;
+      address = SignExt26(inst.LI << 2) + (inst.AA ? 0 : address);
+      continue;
+    }
+    if (opinfo->flags & FL_ENDBLOCK)
+      return;
+    address += 4;
+  }
+}
+
+// Which CR fields this instruction writes. Only the forms that can appear in
+// a busy-wait loop (Rc bits and compares) are modelled; everything else is
+// filtered out by opcode type before this is consulted.
+static u32 CRFieldsWritten(const CodeOp& op)
+{
+  const int flags = op.opinfo->flags;
+  u32 fields = 0;
+  if (flags & FL_SET_CRn)
+    fields |= 1u << op.inst.CRFD;
+  if ((flags & FL_SET_CR0) || ((flags & FL_RC_BIT) && (op.inst.hex & 1)))
+    fields |= 1u << 0;
+  if ((flags & FL_SET_CR1) || ((flags & FL_RC_BIT_F) && (op.inst.hex & 1)))
+    fields |= 1u << 1;
+  return fields;
+}
+
+// Detects busy-wait loops beyond the single-instruction patterns the JITs
+// special-case: the instructions from the start of the block up to (and
+// including) the backwards branch at branch_index do nothing but recompute a
+// set of registers from loop-invariant inputs and watched memory loads.
+// Iterations of such a loop are interchangeable, so the taken branch can be
+// turned into a CoreTiming sleep until the next event may have changed the
+// watched location.
+static bool IsBusyWaitLoop(const CodeOp* code, size_t branch_index)
+{
+  // Union of everything the loop body writes. A register that is read before
+  // this iteration recomputed it carries state between iterations (a counter,
+  // an accumulating flag, an updated address) and disqualifies the loop.
+  BitSet32 loop_writes;
+  u32 loop_cr_writes = 0;
+  bool loop_writes_ca = false;
+  for (size_t i = 0; i <= branch_index; i++)
+  {
+    loop_writes |= code[i].regsOut;
+    loop_cr_writes |= CRFieldsWritten(code[i]);
+    loop_writes_ca |= code[i].outputCA;
+  }
+
+  BitSet32 written;
+  u32 cr_written = 0;
+  bool ca_written = false;
+  for (size_t i = 0; i <= branch_index; i++)
+  {
+    const CodeOp& op = code[i];
+    const int flags = op.opinfo->flags;
+
+    switch (op.opinfo->type)
+    {
+    case OpType::Integer:
+    case OpType::Load:
+      break;
+    case OpType::Branch:
+      // Only the closing branch itself; an inner branch means the body is
+      // not necessarily re-executed as a whole.
+      if (i != branch_index)
+        return false;
+      break;
+    default:
+      // Stores, FPU, cache and system instructions all have effects beyond
+      // the register file.
+      return false;
+    }
+
+    // mftb makes the loop exit on its own, and the OE forms leave a sticky
+    // XER.SO behind.
+    if (flags & (FL_TIMER | FL_CHECKEXCEPTIONS | FL_EVIL | FL_SET_OE))
+      return false;
+    if (i != branch_index && (flags & FL_ENDBLOCK))
+      return false;
+
+    if (op.regsIn & loop_writes & ~written)
+      return false;
+    if (op.wantsCA && loop_writes_ca && !ca_written)
+      return false;
+
+    written |= op.regsOut;
+    cr_written |= CRFieldsWritten(op);
+    ca_written |= op.outputCA;
+  }
+
+  // The condition the branch tests follows the same rule as the GPRs: it must
+  // either be loop-invariant or have been computed by this iteration.
+  const UGeckoInstruction branch = code[branch_index].inst;
+  if ((branch.BO & BO_DONT_CHECK_CONDITION) == 0)
+  {
+    const u32 field = branch.BI >> 2;
+    if ((loop_cr_writes & (1u << field)) && !(cr_written & (1u << field)))
+      return false;
+  }
+
+  return true;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32 blockSize)
 {
   // Clear block stats
@@ -703,7 +885,10 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
   block->m_memory_exception = false;
   block->m_num_instructions = 0;
   block->m_gqr_used = BitSet8(0);
+  // The previous block's addresses were copied out by FinalizeBlock, so the
+  // whole arena can be recycled for this compilation.
   block->m_physical_addresses.clear();
+  GetAnalysisArena().Reset();
 
   CodeOp* code = buffer->codebuffer;
 
@@ -712,6 +897,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
   size_t caller = 0;
   u32 numFollows = 0;
   u32 num_inst = 0;
+  u32 exit_target = INVALID_BRANCH_TARGET;
+  u32 exit_fallthrough = INVALID_BRANCH_TARGET;
 
   for (u32 i = 0; i < blockSize; ++i)
   {
@@ -739,6 +926,16 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
 
     SetInstructionStats(block, &code[i], opinfo, i);
 
+    // A conditional branch closing a loop over the start of the block may be
+    // a multi-instruction spin on memory; flag it so the JITs can sleep until
+    // the next event instead of burning a host core on the polls. CTR and LR
+    // forms are excluded outright: both make the loop body carry state.
+    if (inst.OPCD == 16 && !inst.LK && (inst.BO & BO_DONT_DECREMENT_FLAG) &&
+        EvaluateBranchTarget(inst, code[i].address) == block->m_address)
+    {
+      code[i].branchIsIdleLoop = IsBusyWaitLoop(code, i);
+    }
+
     bool follow = false;
     u32 destination = 0;
 
@@ -748,7 +945,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
     //       If it is small, the performance will be down.
     //       If it is big, the size of generated code will be big and
     //       cache clearning will happen many times.
-    if (HasOption(OPTION_BRANCH_FOLLOW) && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (HasOption(OPTION_BRANCH_FOLLOW) && numFollows < m_branch_follow_threshold)
     {
       if (inst.OPCD == 18 && blockSize > 1)
       {
@@ -845,6 +1042,14 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
       if (!conditional_continue && opinfo->flags & FL_ENDBLOCK)  // right now we stop early
       {
         found_exit = true;
+        // Remember the statically known successor(s) of the final branch for
+        // the cross-block liveness seeding below.
+        exit_target = EvaluateBranchTarget(inst, code[i].address);
+        if (inst.OPCD == 16 && ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0 ||
+                                (inst.BO & BO_DONT_CHECK_CONDITION) == 0))
+        {
+          exit_fallthrough = code[i].address + 4;
+        }
         break;
       }
       if (conditional_continue)
@@ -871,6 +1076,19 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
   // wants flags, to be safe.
   bool wantsCR0 = true, wantsCR1 = true, wantsFPRF = true, wantsCA = true;
   BitSet32 fprInUse, gprInUse, gprInReg, fprInXmm;
+  if (HasOption(OPTION_CROSS_BLOCK_LIVENESS))
+  {
+    // Seed the scan with what the statically known successor(s) read, so the
+    // register caches keep those values bound through the block's tail. Tight
+    // loops branching back to their own head profit the most, since the
+    // successor's inputs are then this block's own inputs.
+    if (exit_target != INVALID_BRANCH_TARGET)
+      ScanSuccessorRegisterUsage(exit_target, &gprInUse, &fprInUse);
+    if (exit_fallthrough != INVALID_BRANCH_TARGET)
+      ScanSuccessorRegisterUsage(exit_fallthrough, &gprInUse, &fprInUse);
+    gprInReg = gprInUse;
+    fprInXmm = fprInUse;
+  }
   for (int i = block->m_num_instructions - 1; i >= 0; i--)
   {
     bool opWantsCR0 = code[i].wantsCR0;
@@ -13,6 +13,7 @@
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
 #include "Core/PowerPC/PPCTables.h"
 
 class PPCSymbolDB;
@@ -44,6 +45,10 @@ struct CodeOp  // 16B
   bool canEndBlock;
   bool skipLRStack;
   bool skip;  // followed BL-s for example
+  // branch closing a busy-wait loop over the start of the block; the JITs
+  // turn these into a CoreTiming sleep instead of spinning (see
+  // IsBusyWaitLoop in PPCAnalyst.cpp).
+  bool branchIsIdleLoop;
   // which registers are still needed after this instruction in this block
   BitSet32 fprInUse;
   BitSet32 gprInUse;
@@ -130,8 +135,17 @@ private:
   int size_;
 };
 
+// Arena backing the transient analysis-phase containers. Analyze() resets it
+// at the start of each block, so nodes are bump-allocated instead of hitting
+// malloc once per cache line during recompile storms.
+Common::Arena& GetAnalysisArena();
+
+using PhysicalAddressSet = std::set<u32, std::less<u32>, Common::ArenaAllocator<u32>>;
+
 struct CodeBlock
 {
+  CodeBlock();
+
   // Beginning PPC address.
   u32 m_address;
 
@@ -160,8 +174,9 @@ struct CodeBlock
   // Which GPRs this block reads from before defining, if any.
   BitSet32 m_gpr_inputs;
 
-  // Which memory locations are occupied by this block.
-  std::set<u32> m_physical_addresses;
+  // Which memory locations are occupied by this block. Only lives until
+  // FinalizeBlock() copies it into the JitBlock, so it can use the arena.
+  PhysicalAddressSet m_physical_addresses;
 };
 
 class PPCAnalyzer
@@ -181,6 +196,9 @@ private:
   // Options
   u32 m_options;
 
+  // Branch-follow budget for Analyze(); raised while recompiling hot blocks.
+  u32 m_branch_follow_threshold = BRANCH_FOLLOWING_THRESHOLD;
+
 public:
   enum AnalystOption
   {
@@ -218,13 +236,27 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Peek at the statically known successor(s) of the block's final branch
+    // and seed the liveness scan with the registers they read, so values the
+    // next block immediately needs stay bound through this block's tail.
+    // Hints are additive only; flag wants stay conservative because the
+    // architectural state must be complete at the block boundary.
+    OPTION_CROSS_BLOCK_LIVENESS = (1 << 7),
   };
 
+  // Default number of unconditional branches Analyze() follows through when
+  // flattening a block.
+  static constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+
   PPCAnalyzer() : m_options(0) {}
   // Option setting/getting
   void SetOption(AnalystOption option) { m_options |= option; }
   void ClearOption(AnalystOption option) { m_options &= ~(option); }
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
+  // Hot blocks get recompiled with a larger budget so their whole loop body
+  // lands in one register allocation region (see Jit64::RecompileHotBlock).
+  void SetBranchFollowingThreshold(u32 threshold) { m_branch_follow_threshold = threshold; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32 blockSize);
 };
 
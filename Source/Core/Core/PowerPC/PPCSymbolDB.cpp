@@ -46,6 +46,7 @@ Symbol* PPCSymbolDB::AddFunction(u32 start_addr)
   Symbol* ptr = &functions[start_addr];
   ptr->type = Symbol::Type::Function;
   checksumToFunction[ptr->hash].insert(ptr);
+  MarkAddrIndexDirty();
   return ptr;
 }
 
@@ -80,25 +81,12 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
     }
     functions[startAddr] = tf;
   }
+  MarkAddrIndexDirty();
 }
 
 Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-  XFuncMap::iterator it = functions.lower_bound(addr);
-  if (it == functions.end())
-    return nullptr;
-
-  // If the address is exactly the start address of a symbol, we're done.
-  if (it->second.address == addr)
-    return &it->second;
-
-  // Otherwise, check whether the address is within the bounds of a symbol.
-  if (it != functions.begin())
-    --it;
-  if (addr >= it->second.address && addr < it->second.address + it->second.size)
-    return &it->second;
-
-  return nullptr;
+  return LookupByAddr(addr);
 }
 
 std::string PPCSymbolDB::GetDescription(u32 addr)
@@ -498,3 +486,100 @@ bool PPCSymbolDB::SaveCodeMap(const std::string& filename) const
   }
   return true;
 }
+
+namespace
+{
+constexpr u32 SYMBOL_INDEX_MAGIC = 0x58444953;  // "SIDX"
+constexpr u32 SYMBOL_INDEX_VERSION = 1;
+
+struct SymbolIndexHeader
+{
+  u32 magic;
+  u32 version;
+  u64 key_hash;
+  u32 count;
+  u32 reserved;
+};
+
+struct SymbolIndexEntry
+{
+  u32 address;
+  u32 size;
+  u32 hash;
+  u32 flags;
+  u32 type;
+  u32 name_length;
+};
+}  // namespace
+
+bool PPCSymbolDB::LoadSymbolIndex(const std::string& filename, u64 key_hash)
+{
+  File::IOFile f(filename, "rb");
+  if (!f)
+    return false;
+
+  SymbolIndexHeader header = {};
+  if (!f.ReadArray(&header, 1) || header.magic != SYMBOL_INDEX_MAGIC ||
+      header.version != SYMBOL_INDEX_VERSION || header.key_hash != key_hash)
+    return false;
+
+  Clear();
+  for (u32 i = 0; i < header.count; i++)
+  {
+    SymbolIndexEntry entry = {};
+    std::string name;
+    if (!f.ReadArray(&entry, 1) || entry.name_length > 1024)
+    {
+      Clear();
+      return false;
+    }
+    name.resize(entry.name_length);
+    if (!f.ReadBytes(&name[0], entry.name_length))
+    {
+      Clear();
+      return false;
+    }
+
+    Symbol symbol;
+    symbol.Rename(name);
+    symbol.address = entry.address;
+    symbol.size = static_cast<int>(entry.size);
+    symbol.hash = entry.hash;
+    symbol.flags = entry.flags;
+    symbol.type = static_cast<Symbol::Type>(entry.type);
+    symbol.analyzed = true;
+    functions[symbol.address] = std::move(symbol);
+    Symbol* ptr = &functions[entry.address];
+    if (ptr->type == Symbol::Type::Function)
+      checksumToFunction[ptr->hash].insert(ptr);
+  }
+
+  MarkAddrIndexDirty();
+  Index();
+  NOTICE_LOG(OSHLE, "Loaded %u symbols from index %s", header.count, filename.c_str());
+  return true;
+}
+
+bool PPCSymbolDB::SaveSymbolIndex(const std::string& filename, u64 key_hash) const
+{
+  File::IOFile f(filename, "wb");
+  if (!f)
+    return false;
+
+  SymbolIndexHeader header = {SYMBOL_INDEX_MAGIC, SYMBOL_INDEX_VERSION, key_hash,
+                              static_cast<u32>(functions.size()), 0};
+  f.WriteArray(&header, 1);
+  for (const auto& function : functions)
+  {
+    const Symbol& symbol = function.second;
+    SymbolIndexEntry entry = {symbol.address,
+                              static_cast<u32>(symbol.size),
+                              symbol.hash,
+                              symbol.flags,
+                              static_cast<u32>(symbol.type),
+                              static_cast<u32>(symbol.name.size())};
+    f.WriteArray(&entry, 1);
+    f.WriteBytes(symbol.name.data(), symbol.name.size());
+  }
+  return f.IsGood();
+}
@@ -34,6 +34,13 @@ public:
 
   bool LoadMap(const std::string& filename, bool bad = false);
   bool SaveSymbolMap(const std::string& filename) const;
+
+  // Binary per-title symbol index, written to the cache directory after the
+  // first successful map load. Loading it skips the per-function code
+  // analysis and checksumming entirely; key_hash ties the index to the data
+  // it was built from, so a stale index falls back to the slow path.
+  bool LoadSymbolIndex(const std::string& filename, u64 key_hash);
+  bool SaveSymbolIndex(const std::string& filename, u64 key_hash) const;
   bool SaveCodeMap(const std::string& filename) const;
 
   void PrintCalls(u32 funcAddr) const;
@@ -4,17 +4,346 @@
 
 #include "Core/PowerPC/Profiler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "Common/File.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
 #include "Common/PerformanceCounter.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
 
 namespace Profiler
 {
 bool g_ProfileBlocks = false;
 
+static std::thread s_sample_thread;
+static std::atomic<bool> s_sampling{false};
+static u32 s_sample_interval_us = 1000;
+static std::mutex s_sample_lock;
+// (caller, pc) -> hits. Raw addresses, not symbols; symbolization happens at
+// write time so a map file loaded later still applies.
+static std::map<std::pair<u32, u32>, u64> s_samples;
+
+static void SamplerThread()
+{
+  Common::SetCurrentThreadName("PPC sampler");
+  // Aggregate into a thread-local map and merge once at the end, so the
+  // sampling loop never contends with the CPU thread or the writer.
+  std::map<std::pair<u32, u32>, u64> samples;
+  while (s_sampling.load(std::memory_order_relaxed))
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(s_sample_interval_us));
+    // Racy reads by design: a stale or torn sample misattributes a single
+    // hit, which the aggregate drowns out. Under the JIT the PC is only
+    // synced at block boundaries, so attribution is block-granular.
+    const u32 pc = PowerPC::ppcState.pc;
+    const u32 lr = PowerPC::ppcState.spr[SPR_LR];
+    samples[std::make_pair(lr, pc)]++;
+  }
+  std::lock_guard<std::mutex> guard(s_sample_lock);
+  for (const auto& sample : samples)
+    s_samples[sample.first] += sample.second;
+}
+
+void StartSampling(u32 interval_us)
+{
+  if (s_sampling.load(std::memory_order_relaxed))
+    return;
+  {
+    std::lock_guard<std::mutex> guard(s_sample_lock);
+    s_samples.clear();
+  }
+  s_sample_interval_us = interval_us;
+  s_sampling.store(true, std::memory_order_relaxed);
+  s_sample_thread = std::thread(SamplerThread);
+}
+
+void StopSampling()
+{
+  if (!s_sampling.exchange(false, std::memory_order_relaxed))
+    return;
+  if (s_sample_thread.joinable())
+    s_sample_thread.join();
+}
+
+bool IsSampling()
+{
+  return s_sampling.load(std::memory_order_relaxed);
+}
+
+static std::string SampleSymbol(u32 addr)
+{
+  Symbol* symbol = g_symbolDB.GetSymbolFromAddr(addr);
+  if (symbol)
+    return symbol->name;
+  return StringFromFormat("0x%08x", addr);
+}
+
+static std::string EscapeJSONString(const std::string& str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+      result += '\\';
+    result += c;
+  }
+  return result;
+}
+
+void WriteSampleResults(const std::string& path_prefix)
+{
+  StopSampling();
+
+  std::map<std::pair<u32, u32>, u64> samples;
+  {
+    std::lock_guard<std::mutex> guard(s_sample_lock);
+    samples = s_samples;
+  }
+  if (samples.empty())
+    return;
+
+  // Collapse addresses to symbols; hits on different addresses of the same
+  // (caller, function) pair merge into one stack.
+  std::map<std::pair<std::string, std::string>, u64> stacks;
+  for (const auto& sample : samples)
+  {
+    stacks[std::make_pair(SampleSymbol(sample.first.first), SampleSymbol(sample.first.second))] +=
+        sample.second;
+  }
+
+  File::IOFile folded(path_prefix + ".folded", "w");
+  if (!folded)
+  {
+    PanicAlert("Failed to open %s.folded", path_prefix.c_str());
+    return;
+  }
+  for (const auto& stack : stacks)
+  {
+    fprintf(folded.GetHandle(), "%s;%s %" PRIu64 "\n", stack.first.first.c_str(),
+            stack.first.second.c_str(), stack.second);
+  }
+
+  File::IOFile json(path_prefix + ".speedscope.json", "w");
+  if (!json)
+  {
+    PanicAlert("Failed to open %s.speedscope.json", path_prefix.c_str());
+    return;
+  }
+  std::map<std::string, size_t> frame_indices;
+  std::vector<std::string> frames;
+  auto frame_index = [&](const std::string& name) {
+    auto iter = frame_indices.find(name);
+    if (iter == frame_indices.end())
+    {
+      iter = frame_indices.emplace(name, frames.size()).first;
+      frames.push_back(name);
+    }
+    return iter->second;
+  };
+  u64 total_weight = 0;
+  std::string samples_json;
+  std::string weights_json;
+  for (const auto& stack : stacks)
+  {
+    if (!samples_json.empty())
+    {
+      samples_json += ',';
+      weights_json += ',';
+    }
+    samples_json += StringFromFormat("[%u,%u]", static_cast<u32>(frame_index(stack.first.first)),
+                                     static_cast<u32>(frame_index(stack.first.second)));
+    weights_json += StringFromFormat("%" PRIu64, stack.second);
+    total_weight += stack.second;
+  }
+  fprintf(json.GetHandle(),
+          "{\"$schema\":\"https://www.speedscope.app/file-format-schema.json\",\"shared\":{"
+          "\"frames\":[");
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    fprintf(json.GetHandle(), "%s{\"name\":\"%s\"}", i == 0 ? "" : ",",
+            EscapeJSONString(frames[i]).c_str());
+  }
+  fprintf(json.GetHandle(),
+          "]},\"profiles\":[{\"type\":\"sampled\",\"name\":\"PowerPC samples\",\"unit\":\"none\","
+          "\"startValue\":0,\"endValue\":%" PRIu64 ",\"samples\":[%s],\"weights\":[%s]}]}\n",
+          total_weight, samples_json.c_str(), weights_json.c_str());
+}
+
 void WriteProfileResults(const std::string& filename)
 {
   JitInterface::WriteProfileResults(filename);
 }
 
+static std::thread s_server_thread;
+static std::atomic<bool> s_server_running{false};
+static int s_server_socket = -1;
+
+static void CloseServerSocket(int socket_fd)
+{
+#ifdef _WIN32
+  closesocket(socket_fd);
+#else
+  close(socket_fd);
+#endif
+}
+
+// One report per connection: a header with the totals, then one line per
+// guest function, hottest first. Blocks without a symbol are reported under
+// their own address, so an unloaded map file degrades to block granularity
+// rather than dropping data.
+static std::string BuildFunctionReport()
+{
+  ProfileStats stats;
+  JitInterface::GetProfileResults(&stats);
+
+  struct FunctionAgg
+  {
+    u64 cycles = 0;
+    u64 ticks = 0;
+    u64 calls = 0;
+    u64 runs = 0;
+    u32 blocks = 0;
+  };
+  std::map<u32, FunctionAgg> functions;
+  for (const BlockStat& stat : stats.block_stats)
+  {
+    Symbol* symbol = g_symbolDB.GetSymbolFromAddr(stat.addr);
+    const u32 key = symbol ? symbol->address : stat.addr;
+    FunctionAgg& func = functions[key];
+    func.cycles += stat.cost;
+    func.ticks += stat.tick_counter;
+    func.runs += stat.run_count;
+    func.blocks++;
+    // The entry block's run count approximates the call count; blocks without
+    // a symbol are their own entry.
+    if (!symbol || stat.addr == symbol->address)
+      func.calls += stat.run_count;
+  }
+
+  std::vector<std::pair<u32, FunctionAgg>> sorted(functions.begin(), functions.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.ticks > rhs.second.ticks; });
+
+  std::string report = StringFromFormat("# ticks_per_sec %" PRIu64 " total_cycles %" PRIu64
+                                        " total_ticks %" PRIu64 " functions %u\n"
+                                        "addr\tname\tcycles\tticks\tcalls\truns\tblocks\n",
+                                        stats.countsPerSec, stats.cost_sum, stats.timecost_sum,
+                                        static_cast<u32>(sorted.size()));
+  for (const auto& entry : sorted)
+  {
+    report += StringFromFormat("%08x\t%s\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64
+                               "\t%u\n",
+                               entry.first, SampleSymbol(entry.first).c_str(), entry.second.cycles,
+                               entry.second.ticks, entry.second.calls, entry.second.runs,
+                               entry.second.blocks);
+  }
+  return report;
+}
+
+static void SendAll(int socket_fd, const std::string& data)
+{
+  size_t sent = 0;
+  while (sent < data.size())
+  {
+    const int result =
+        send(socket_fd, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+    if (result <= 0)
+      return;
+    sent += static_cast<size_t>(result);
+  }
+}
+
+static void ServerThread()
+{
+  Common::SetCurrentThreadName("PPC profile server");
+  while (s_server_running.load(std::memory_order_relaxed))
+  {
+    const int client = static_cast<int>(accept(s_server_socket, nullptr, nullptr));
+    if (client < 0)
+      continue;
+    if (s_server_running.load(std::memory_order_relaxed))
+      SendAll(client, BuildFunctionReport());
+    CloseServerSocket(client);
+  }
+}
+
+void StartServer(u32 port)
+{
+  if (s_server_running.load(std::memory_order_relaxed))
+    return;
+
+#ifdef _WIN32
+  WSADATA init_data;
+  WSAStartup(MAKEWORD(2, 2), &init_data);
+#endif
+
+  const int server = static_cast<int>(socket(PF_INET, SOCK_STREAM, 0));
+  if (server < 0)
+  {
+    ERROR_LOG(POWERPC, "Failed to create profile server socket");
+    return;
+  }
+
+  int on = 1;
+  setsockopt(server, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&on), sizeof(on));
+
+  // Local tooling only; never listen on external interfaces.
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(static_cast<u16>(port));
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(server, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0 ||
+      listen(server, 1) < 0)
+  {
+    ERROR_LOG(POWERPC, "Failed to bind profile server to port %u", port);
+    CloseServerSocket(server);
+    return;
+  }
+
+  // Blocks compiled from here on carry the profiling prologue; the server is
+  // started before the CPU enters its run loop, so this covers everything.
+  g_ProfileBlocks = true;
+  JitInterface::ClearCache();
+
+  s_server_socket = server;
+  s_server_running.store(true, std::memory_order_relaxed);
+  s_server_thread = std::thread(ServerThread);
+  NOTICE_LOG(POWERPC, "Guest function profile server listening on 127.0.0.1:%u", port);
+}
+
+void StopServer()
+{
+  if (!s_server_running.exchange(false, std::memory_order_relaxed))
+    return;
+  // Closing the listen socket unblocks the accept call.
+  CloseServerSocket(s_server_socket);
+  s_server_socket = -1;
+  if (s_server_thread.joinable())
+    s_server_thread.join();
+}
+
 }  // namespace
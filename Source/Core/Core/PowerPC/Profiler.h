@@ -37,4 +37,23 @@ namespace Profiler
 extern bool g_ProfileBlocks;
 
 void WriteProfileResults(const std::string& filename);
+
+// Sampling profiler. A timer thread periodically samples the guest PC and LR
+// and aggregates hit counts per (caller, function) pair, so hot guest code
+// can be attributed to symbols without instrumenting the emitted blocks.
+void StartSampling(u32 interval_us);
+void StopSampling();
+bool IsSampling();
+// Stops sampling if needed and writes <path_prefix>.folded (collapsed stacks,
+// flamegraph.pl input) and <path_prefix>.speedscope.json. No-op without
+// samples.
+void WriteSampleResults(const std::string& path_prefix);
+
+// Profile server: serves the block profile aggregated per guest function
+// (symbols from PPCSymbolDB) over a localhost TCP socket, one tab-separated
+// report per connection, so external tooling can graph hot guest functions
+// live without the debugger UI. Enabled with PerfServerPort in the General
+// section; starting the server turns block profiling on.
+void StartServer(u32 port);
+void StopServer();
 }
@@ -4,9 +4,13 @@
 
 #include "Core/State.h"
 
+#include <atomic>
+#include <cstring>
 #include <lzo/lzo1x.h>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 #include <utility>
@@ -17,10 +21,12 @@
 #include "Common/Event.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
@@ -30,6 +36,7 @@
 #include "Core/GeckoCode.h"
 #include "Core/HW/HW.h"
 #include "Core/HW/Wiimote.h"
+#include "Core/Hooks.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
@@ -51,12 +58,26 @@ static const u32 IN_LEN = 128 * 1024u;
 
 static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
-static unsigned char __LZO_MMODEL out[OUT_LEN];
-
 #define HEAP_ALLOC(var, size)                                                                      \
   lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+// Work memory and chunk output buffer for one compression worker.
+struct CompressionContext
+{
+  HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+  unsigned char __LZO_MMODEL out[OUT_LEN];
+};
+
+static std::vector<std::unique_ptr<CompressionContext>> s_compression_contexts;
+
+// The contexts persist across saves so repeated saving does not pay for
+// allocating the work memory again. Saves are serialized by Flush(), so the
+// pool is only touched by one save at a time.
+static void EnsureCompressionContexts(u32 count)
+{
+  while (s_compression_contexts.size() < count)
+    s_compression_contexts.push_back(std::make_unique<CompressionContext>());
+}
 
 static std::string g_last_filename;
 
@@ -74,7 +95,7 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 static std::thread g_save_thread;
 
 // Don't forget to increase this after doing changes on the savestate system
-static const u32 STATE_VERSION = 94;  // Last changed in PR 6456
+static const u32 STATE_VERSION = 96;  // Last changed: element size stamp in container streams
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -230,6 +251,504 @@ void SaveToBuffer(std::vector<u8>& buffer)
     DoState(p);
   });
 }
+// Granularity of the dirty-page diff used by the delta state API.
+static const u32 DELTA_PAGE_SIZE = 4096;
+
+// First byte of a delta buffer: 1 for a keyframe holding the full serialized
+// state, 0 for a sparse page diff against the base snapshot.
+static const u8 DELTA_KEYFRAME = 1;
+static const u8 DELTA_DIFF = 0;
+
+static void AppendToBuffer(std::vector<u8>& buffer, u32 value)
+{
+  const u8* bytes = reinterpret_cast<const u8*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+static u32 ReadFromBuffer(const std::vector<u8>& buffer, size_t& offset)
+{
+  u32 value = 0;
+  memcpy(&value, &buffer[offset], sizeof(value));
+  offset += sizeof(value);
+  return value;
+}
+
+void SaveDeltaToBuffer(const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  std::vector<u8> current;
+  SaveToBuffer(current);
+
+  // The serialized layout only matches between snapshots of the same size, so
+  // without a usable base the delta degenerates to a keyframe.
+  if (base.size() != current.size())
+  {
+    delta.clear();
+    delta.push_back(DELTA_KEYFRAME);
+    delta.insert(delta.end(), current.begin(), current.end());
+    return;
+  }
+
+  const u32 page_count = (u32)((current.size() + DELTA_PAGE_SIZE - 1) / DELTA_PAGE_SIZE);
+  std::vector<u32> dirty_pages;
+  for (u32 page = 0; page < page_count; page++)
+  {
+    const size_t offset = (size_t)page * DELTA_PAGE_SIZE;
+    const size_t len = std::min<size_t>(DELTA_PAGE_SIZE, current.size() - offset);
+    if (memcmp(&current[offset], &base[offset], len) != 0)
+      dirty_pages.push_back(page);
+  }
+
+  delta.clear();
+  delta.push_back(DELTA_DIFF);
+  AppendToBuffer(delta, (u32)current.size());
+  AppendToBuffer(delta, (u32)dirty_pages.size());
+  for (u32 page : dirty_pages)
+    AppendToBuffer(delta, page);
+
+  // XOR instead of storing the new page contents verbatim, so a later
+  // compression pass over the history only has to keep the changed bits.
+  for (u32 page : dirty_pages)
+  {
+    const size_t offset = (size_t)page * DELTA_PAGE_SIZE;
+    const size_t len = std::min<size_t>(DELTA_PAGE_SIZE, current.size() - offset);
+    const size_t pos = delta.size();
+    delta.resize(pos + len);
+    for (size_t j = 0; j < len; j++)
+      delta[pos + j] = current[offset + j] ^ base[offset + j];
+  }
+}
+
+void LoadFromDeltaBuffer(const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  if (delta.empty())
+    return;
+
+  if (delta[0] == DELTA_KEYFRAME)
+  {
+    std::vector<u8> state(delta.begin() + 1, delta.end());
+    LoadFromBuffer(state);
+    return;
+  }
+
+  size_t offset = 1;
+  const u32 state_size = ReadFromBuffer(delta, offset);
+  const u32 dirty_count = ReadFromBuffer(delta, offset);
+  if (base.size() != state_size)
+  {
+    Core::DisplayMessage("Delta state does not match its base snapshot", 2000);
+    return;
+  }
+
+  std::vector<u8> state = base;
+  std::vector<u32> dirty_pages(dirty_count);
+  for (u32& page : dirty_pages)
+    page = ReadFromBuffer(delta, offset);
+
+  for (u32 page : dirty_pages)
+  {
+    const size_t page_offset = (size_t)page * DELTA_PAGE_SIZE;
+    const size_t len = std::min<size_t>(DELTA_PAGE_SIZE, state.size() - page_offset);
+    for (size_t j = 0; j < len; j++)
+      state[page_offset + j] ^= delta[offset + j];
+    offset += len;
+  }
+
+  LoadFromBuffer(state);
+}
+
+// Rotating auto-save store. One file per game holds content-addressed blocks
+// followed by snapshot records that reference them; blocks shared between
+// snapshots are stored once, so each additional restore point only costs the
+// blocks that actually changed since the earlier ones.
+static const u32 ROTATION_MAGIC = 0x544F5244;  // "DROT"
+static const u32 ROTATION_VERSION = 1;
+static const u32 ROTATION_BLOCK_SIZE = 64 * 1024;
+static const u8 ROTATION_RECORD_BLOCK = 'B';
+static const u8 ROTATION_RECORD_SNAPSHOT = 'S';
+
+#pragma pack(push, 1)
+struct RotationFileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 block_size;
+  char gameID[6];
+  u16 reserved;
+};
+#pragma pack(pop)
+
+struct RotationBlock
+{
+  u64 hash;
+  u64 file_offset;  // of the payload, not the record tag
+  u32 length;
+};
+
+struct RotationSnapshot
+{
+  double time;
+  std::vector<u32> blocks;
+};
+
+static std::string MakeRotationFilename()
+{
+  return StringFromFormat("%s%s.rot", File::GetUserPath(D_STATESAVES_IDX).c_str(),
+                          SConfig::GetInstance().GetGameID().c_str());
+}
+
+static void FillRotationHeader(RotationFileHeader* header)
+{
+  memset(header, 0, sizeof(*header));
+  header->magic = ROTATION_MAGIC;
+  header->version = ROTATION_VERSION;
+  header->block_size = ROTATION_BLOCK_SIZE;
+  strncpy(header->gameID, SConfig::GetInstance().GetGameID().c_str(), 6);
+}
+
+// Reads every intact record. A damaged or truncated tail (e.g. from a crash
+// mid-append) is not fatal: valid_end reports how far the file is good, and
+// the writer cuts it back there before appending.
+static bool ParseRotationFile(File::IOFile& f, std::vector<RotationBlock>* blocks,
+                              std::vector<RotationSnapshot>* snapshots, u64* valid_end)
+{
+  RotationFileHeader header;
+  RotationFileHeader expected;
+  FillRotationHeader(&expected);
+  f.Seek(0, SEEK_SET);
+  if (!f.ReadArray(&header, 1) || memcmp(&header, &expected, sizeof(header)) != 0)
+  {
+    f.Clear();
+    return false;
+  }
+
+  *valid_end = f.Tell();
+  const u64 file_size = f.GetSize();
+  while (f.Tell() < file_size)
+  {
+    u8 tag;
+    if (!f.ReadArray(&tag, 1))
+      break;
+
+    if (tag == ROTATION_RECORD_BLOCK)
+    {
+      RotationBlock block;
+      if (!f.ReadArray(&block.hash, 1) || !f.ReadArray(&block.length, 1) || block.length == 0 ||
+          block.length > ROTATION_BLOCK_SIZE)
+        break;
+      block.file_offset = f.Tell();
+      if (block.file_offset + block.length > file_size)
+        break;
+      f.Seek(block.length, SEEK_CUR);
+      blocks->push_back(block);
+    }
+    else if (tag == ROTATION_RECORD_SNAPSHOT)
+    {
+      RotationSnapshot snapshot;
+      u32 count;
+      if (!f.ReadArray(&snapshot.time, 1) || !f.ReadArray(&count, 1) || count == 0)
+        break;
+      snapshot.blocks.resize(count);
+      if (!f.ReadArray(snapshot.blocks.data(), count))
+        break;
+      bool valid = true;
+      for (u32 index : snapshot.blocks)
+        valid &= index < blocks->size();
+      if (!valid)
+        break;
+      snapshots->push_back(std::move(snapshot));
+    }
+    else
+    {
+      break;
+    }
+
+    *valid_end = f.Tell();
+  }
+
+  f.Clear();
+  return true;
+}
+
+static bool ReadRotationSnapshot(File::IOFile& f, const std::vector<RotationBlock>& blocks,
+                                 const RotationSnapshot& snapshot, std::vector<u8>* state)
+{
+  size_t total = 0;
+  for (u32 index : snapshot.blocks)
+    total += blocks[index].length;
+  state->resize(total);
+
+  size_t pos = 0;
+  for (u32 index : snapshot.blocks)
+  {
+    const RotationBlock& block = blocks[index];
+    if (!f.Seek(block.file_offset, SEEK_SET) || !f.ReadBytes(&(*state)[pos], block.length))
+      return false;
+    pos += block.length;
+  }
+  return true;
+}
+
+// Rewrites the store with only the blocks the kept snapshots still reference.
+// Done to a temporary file and renamed over, so a crash during compaction
+// loses nothing.
+static void CompactRotationFile(const std::string& filename, File::IOFile& f,
+                                const std::vector<RotationBlock>& blocks,
+                                std::vector<RotationSnapshot> snapshots, u32 keep_count)
+{
+  if (snapshots.size() > keep_count)
+    snapshots.erase(snapshots.begin(), snapshots.end() - keep_count);
+
+  const std::string temp_filename = filename + ".tmp";
+  File::IOFile out(temp_filename, "wb");
+  if (!out)
+    return;
+
+  RotationFileHeader header;
+  FillRotationHeader(&header);
+  out.WriteArray(&header, 1);
+
+  std::map<u32, u32> remap;
+  std::vector<u8> payload(ROTATION_BLOCK_SIZE);
+  for (const RotationSnapshot& snapshot : snapshots)
+  {
+    for (u32 index : snapshot.blocks)
+    {
+      if (remap.count(index))
+        continue;
+      const RotationBlock& block = blocks[index];
+      if (!f.Seek(block.file_offset, SEEK_SET) || !f.ReadBytes(payload.data(), block.length))
+      {
+        out.Close();
+        File::Delete(temp_filename);
+        return;
+      }
+      out.WriteArray(&ROTATION_RECORD_BLOCK, 1);
+      out.WriteArray(&block.hash, 1);
+      out.WriteArray(&block.length, 1);
+      out.WriteBytes(payload.data(), block.length);
+
+      const u32 new_index = static_cast<u32>(remap.size());
+      remap.emplace(index, new_index);
+    }
+  }
+
+  for (const RotationSnapshot& snapshot : snapshots)
+  {
+    out.WriteArray(&ROTATION_RECORD_SNAPSHOT, 1);
+    out.WriteArray(&snapshot.time, 1);
+    const u32 count = static_cast<u32>(snapshot.blocks.size());
+    out.WriteArray(&count, 1);
+    for (u32 index : snapshot.blocks)
+    {
+      const u32 remapped = remap[index];
+      out.WriteArray(&remapped, 1);
+    }
+  }
+
+  const bool good = out.IsGood();
+  f.Close();
+  out.Close();
+  if (!good || !File::Rename(temp_filename, filename))
+    File::Delete(temp_filename);
+}
+
+void WriteRotationSnapshot(const std::string filename, u32 keep_count, std::vector<u8> state)
+{
+  Common::SetCurrentThreadName("SaveState thread");
+
+  std::vector<RotationBlock> blocks;
+  std::vector<RotationSnapshot> snapshots;
+  u64 valid_end = 0;
+
+  File::IOFile f(filename, "r+b");
+  if (!f || !ParseRotationFile(f, &blocks, &snapshots, &valid_end))
+  {
+    // Missing, damaged beyond the header or belonging to another game:
+    // start a fresh store.
+    blocks.clear();
+    snapshots.clear();
+    f.Close();
+    if (!f.Open(filename, "w+b"))
+    {
+      Core::DisplayMessage("Failed to write rotating auto-save", 2000);
+      return;
+    }
+    RotationFileHeader header;
+    FillRotationHeader(&header);
+    f.WriteArray(&header, 1);
+    valid_end = f.Tell();
+  }
+
+  if (f.GetSize() != valid_end)
+    f.Resize(valid_end);
+
+  std::multimap<u64, u32> by_hash;
+  for (u32 i = 0; i < static_cast<u32>(blocks.size()); i++)
+    by_hash.emplace(blocks[i].hash, i);
+
+  // First pass, reads only: decide for every chunk of the new state whether
+  // an identical block is already stored. Hashes can collide, so every
+  // candidate is verified against the actual bytes.
+  const u32 chunk_count =
+      static_cast<u32>((state.size() + ROTATION_BLOCK_SIZE - 1) / ROTATION_BLOCK_SIZE);
+  RotationSnapshot snapshot;
+  snapshot.time = Common::Timer::GetDoubleTime();
+  snapshot.blocks.resize(chunk_count);
+  std::map<u32, u32> pending;  // new block index -> chunk it will be written from
+  std::vector<u8> existing(ROTATION_BLOCK_SIZE);
+  for (u32 i = 0; i < chunk_count; i++)
+  {
+    const size_t offset = static_cast<size_t>(i) * ROTATION_BLOCK_SIZE;
+    const u32 len = static_cast<u32>(std::min<size_t>(ROTATION_BLOCK_SIZE, state.size() - offset));
+    const u64 hash = GetHash64(&state[offset], len, 0);
+
+    u32 match = static_cast<u32>(-1);
+    const auto range = by_hash.equal_range(hash);
+    for (auto it = range.first; it != range.second && match == static_cast<u32>(-1); ++it)
+    {
+      const RotationBlock& candidate = blocks[it->second];
+      if (candidate.length != len)
+        continue;
+
+      const auto pending_it = pending.find(it->second);
+      if (pending_it != pending.end())
+      {
+        // Not on disk yet; compare against the chunk it will be written from.
+        const size_t other = static_cast<size_t>(pending_it->second) * ROTATION_BLOCK_SIZE;
+        if (memcmp(&state[other], &state[offset], len) == 0)
+          match = it->second;
+        continue;
+      }
+
+      if (!f.Seek(candidate.file_offset, SEEK_SET) || !f.ReadBytes(existing.data(), len))
+      {
+        f.Clear();
+        continue;
+      }
+      if (memcmp(existing.data(), &state[offset], len) == 0)
+        match = it->second;
+    }
+
+    if (match == static_cast<u32>(-1))
+    {
+      match = static_cast<u32>(blocks.size());
+      RotationBlock block;
+      block.hash = hash;
+      block.file_offset = 0;  // patched during the append below
+      block.length = len;
+      blocks.push_back(block);
+      by_hash.emplace(hash, match);
+      pending.emplace(match, i);
+    }
+    snapshot.blocks[i] = match;
+  }
+
+  // Second pass, writes only: append the new blocks and the snapshot record.
+  f.Seek(0, SEEK_END);
+  for (const auto& entry : pending)
+  {
+    RotationBlock& block = blocks[entry.first];
+    const size_t offset = static_cast<size_t>(entry.second) * ROTATION_BLOCK_SIZE;
+    f.WriteArray(&ROTATION_RECORD_BLOCK, 1);
+    f.WriteArray(&block.hash, 1);
+    f.WriteArray(&block.length, 1);
+    block.file_offset = f.Tell();
+    f.WriteBytes(&state[offset], block.length);
+  }
+  f.WriteArray(&ROTATION_RECORD_SNAPSHOT, 1);
+  f.WriteArray(&snapshot.time, 1);
+  f.WriteArray(&chunk_count, 1);
+  f.WriteArray(snapshot.blocks.data(), chunk_count);
+  snapshots.push_back(std::move(snapshot));
+
+  if (!f.IsGood())
+  {
+    Core::DisplayMessage("Failed to write rotating auto-save", 2000);
+    return;
+  }
+
+  // Blocks referenced only by snapshots past the keep count are dead weight;
+  // rewrite the store once they outweigh the live data. Until then the extra
+  // restore points stay loadable for free.
+  if (snapshots.size() > keep_count)
+  {
+    std::set<u32> live;
+    for (size_t i = snapshots.size() - keep_count; i < snapshots.size(); i++)
+      for (u32 index : snapshots[i].blocks)
+        live.insert(index);
+
+    u64 live_bytes = 0;
+    u64 dead_bytes = 0;
+    for (u32 i = 0; i < static_cast<u32>(blocks.size()); i++)
+    {
+      if (live.count(i))
+        live_bytes += blocks[i].length;
+      else
+        dead_bytes += blocks[i].length;
+    }
+
+    if (dead_bytes * 2 > live_bytes)
+      CompactRotationFile(filename, f, blocks, std::move(snapshots), keep_count);
+  }
+
+  Core::DisplayMessage(StringFromFormat("Auto-saved to %s", filename.c_str()), 2000);
+}
+
+void SaveRotation(u32 keep_count)
+{
+  // Wait for any save still in flight before taking over the save thread.
+  Flush();
+
+  std::vector<u8> current;
+  SaveToBuffer(current);
+  if (current.empty())
+    return;
+
+  const std::string filename = MakeRotationFilename();
+  g_save_thread = std::thread(WriteRotationSnapshot, filename, keep_count, std::move(current));
+  Hooks::Fire(Hooks::Event::StateSave, filename);
+}
+
+bool ReadRotationSnapshotFile(const std::string& filename, u32 age, std::vector<u8>* state,
+                              u32* count)
+{
+  *count = 0;
+
+  File::IOFile f(filename, "rb");
+  std::vector<RotationBlock> blocks;
+  std::vector<RotationSnapshot> snapshots;
+  u64 valid_end = 0;
+  if (!f || !ParseRotationFile(f, &blocks, &snapshots, &valid_end))
+    return false;
+
+  *count = static_cast<u32>(snapshots.size());
+  if (age >= snapshots.size())
+    return false;
+
+  return ReadRotationSnapshot(f, blocks, snapshots[snapshots.size() - 1 - age], state);
+}
+
+void LoadFromRotation(u32 age)
+{
+  Flush();
+
+  std::vector<u8> state;
+  u32 count = 0;
+  if (!ReadRotationSnapshotFile(MakeRotationFilename(), age, &state, &count))
+  {
+    if (count == 0)
+      Core::DisplayMessage("No rotating auto-save found", 2000);
+    else if (age >= count)
+      Core::DisplayMessage(StringFromFormat("Only %u auto-save restore points available", count),
+                           2000);
+    else
+      Core::DisplayMessage("Rotating auto-save is damaged", 2000);
+    return;
+  }
+
+  LoadFromBuffer(state);
+}
+
 // return state number not in map
 static int GetEmptySlot(std::map<double, int> m)
 {
@@ -277,6 +796,37 @@ static std::map<double, int> GetSavedStates()
   return m;
 }
 
+// Compresses savestate chunks [chunk_begin, chunk_end) into a stream of
+// length-prefixed frames. The result is byte-identical to what the serial
+// compression loop used to write for the same chunk range.
+static void CompressChunkRange(const u8* buffer_data, size_t buffer_size, u32 chunk_begin,
+                               u32 chunk_end, CompressionContext& ctx, std::vector<u8>& result)
+{
+  for (u32 chunk = chunk_begin; chunk < chunk_end; chunk++)
+  {
+    const size_t i = (size_t)chunk * IN_LEN;
+    lzo_uint32 cur_len = 0;
+    lzo_uint out_len = 0;
+
+    if ((i + IN_LEN) >= buffer_size)
+    {
+      cur_len = (lzo_uint32)(buffer_size - i);
+    }
+    else
+    {
+      cur_len = IN_LEN;
+    }
+
+    if (lzo1x_1_compress(buffer_data + i, cur_len, ctx.out, &out_len, ctx.wrkmem) != LZO_E_OK)
+      PanicAlertT("Internal LZO Error - compression failed");
+
+    const lzo_uint32 frame_len = (lzo_uint32)out_len;
+    const u8* frame_len_bytes = reinterpret_cast<const u8*>(&frame_len);
+    result.insert(result.end(), frame_len_bytes, frame_len_bytes + sizeof(frame_len));
+    result.insert(result.end(), ctx.out, ctx.out + out_len);
+  }
+}
+
 struct CompressAndDumpState_args
 {
   std::vector<u8>* buffer_vector;
@@ -345,33 +895,37 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
+    // The chunks are compressed independently, so they can be spread over the
+    // worker threads and written out in order afterwards.
+    const u32 chunk_count = (u32)(buffer_size / IN_LEN) + 1;
+    const u32 slices = (u32)std::min<size_t>(Common::ThreadPool::GetThreadCount() + 1, chunk_count);
+    const u32 chunks_per_slice = chunk_count / slices;
+    EnsureCompressionContexts(slices);
+
+    std::vector<std::vector<u8>> results(slices);
+    std::atomic<u32> finished_slices = {0};
+    u32 chunk = 0;
+    for (u32 slice = 0; slice + 1 < slices; slice++)
     {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
-
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
-
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
+      const u32 chunk_begin = chunk;
+      const u32 chunk_end = chunk + chunks_per_slice;
+      CompressionContext* ctx = s_compression_contexts[slice].get();
+      std::vector<u8>* result = &results[slice];
+      Common::AsyncWorker::ExecuteAsync([=, &finished_slices]() {
+        CompressChunkRange(buffer_data, buffer_size, chunk_begin, chunk_end, *ctx, *result);
+        finished_slices.fetch_add(1);
+      });
+      chunk = chunk_end;
+    }
+    CompressChunkRange(buffer_data, buffer_size, chunk, chunk_count,
+                       *s_compression_contexts[slices - 1], results[slices - 1]);
 
-      if (cur_len != IN_LEN)
-        break;
+    size_t yield_count = 0;
+    while (finished_slices.load() < slices - 1)
+      Common::cYield(yield_count++);
 
-      i += cur_len;
-    }
+    for (const auto& result : results)
+      f.WriteBytes(result.data(), result.size());
   }
   else  // uncompressed
   {
@@ -384,6 +938,11 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
 void SaveAs(const std::string& filename, bool wait)
 {
+  // Wait for a previous save to finish before pausing the core, so a save
+  // issued while the last one is still compressing does not stall emulation
+  // for the whole compression.
+  Flush();
+
   Core::RunAsCPUThread([&] {
     // Measure the size of the buffer.
     u8* ptr = nullptr;
@@ -410,11 +969,11 @@ void SaveAs(const std::string& filename, bool wait)
       save_args.filename = filename;
       save_args.wait = wait;
 
-      Flush();
       g_save_thread = std::thread(CompressAndDumpState, save_args);
       g_compressAndDumpStateSyncEvent.Wait();
 
       g_last_filename = filename;
+      Hooks::Fire(Hooks::Event::StateSave, filename);
     }
     else
     {
@@ -479,27 +1038,47 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
+    // Every frame except the final one decompresses to exactly IN_LEN bytes,
+    // so each frame's destination offset is known up front and frames can be
+    // handed to the worker threads while the file is still being read.
+    std::vector<std::vector<u8>> frames;
+    std::atomic<u32> pending_frames = {0};
+    std::atomic<bool> decompress_error = {false};
+
     lzo_uint i = 0;
     while (true)
     {
       lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
 
       if (!f.ReadArray(&cur_len, 1))
         break;
 
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
-      {
-        // This doesn't seem to happen anymore.
-        PanicAlertT("Internal LZO Error - decompression failed (%d) (%li, %li) \n"
-                    "Try loading the state again",
-                    res, i, new_len);
-        return;
-      }
+      frames.emplace_back(cur_len);
+      u8* src = frames.back().data();
+      f.ReadBytes(src, cur_len);
+
+      u8* dst = buffer.data() + i;
+      pending_frames.fetch_add(1);
+      Common::AsyncWorker::ExecuteAsync([=, &pending_frames, &decompress_error]() {
+        lzo_uint new_len = 0;  // number of bytes to write
+        if (lzo1x_decompress(src, cur_len, dst, &new_len, nullptr) != LZO_E_OK)
+          decompress_error.store(true);
+        pending_frames.fetch_sub(1);
+      });
 
-      i += new_len;
+      i += IN_LEN;
+    }
+
+    size_t yield_count = 0;
+    while (pending_frames.load() != 0)
+      Common::cYield(yield_count++);
+
+    if (decompress_error.load())
+    {
+      // This doesn't seem to happen anymore.
+      PanicAlertT("Internal LZO Error - decompression failed\n"
+                  "Try loading the state again");
+      return;
     }
   }
   else  // uncompressed
@@ -573,6 +1152,8 @@ void LoadAs(const std::string& filename)
         else if (!Movie::IsJustStartingRecordingInputFromSaveState() &&
                  !Movie::IsJustStartingPlayingInputFromSaveState())
           Movie::EndPlayInput(false);
+
+        Hooks::Fire(Hooks::Event::StateLoad, filename);
       }
       else
       {
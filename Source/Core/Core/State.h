@@ -50,6 +50,30 @@ void LoadAs(const std::string& filename);
 void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 
+// Delta states for rewind/rollback history. The delta stores only the pages
+// of the serialized state that differ from the base snapshot (XOR-diffed at
+// page granularity), or a full keyframe when no usable base exists. A delta
+// can only be applied on top of the exact base it was created against.
+void SaveDeltaToBuffer(const std::vector<u8>& base, std::vector<u8>& delta);
+void LoadFromDeltaBuffer(const std::vector<u8>& base, std::vector<u8>& delta);
+
+// Rotating auto-save store: one file per game keeping the last keep_count
+// snapshots. Snapshots are split into fixed-size blocks deduplicated by
+// content hash, so repeated auto-saves only write what changed since the
+// restore points already stored. age 0 loads the most recent snapshot,
+// 1 the one before it, and so on.
+void SaveRotation(u32 keep_count = NUM_STATES);
+void LoadFromRotation(u32 age = 0);
+
+// Host-pure pieces of the rotation store, exposed so the on-disk logic can be
+// unit tested without a running core. WriteRotationSnapshot adds one
+// serialized state to the store at filename (SaveRotation runs it on the save
+// thread); ReadRotationSnapshotFile reads back the snapshot age steps before
+// the newest, with count receiving the number of restore points found.
+void WriteRotationSnapshot(std::string filename, u32 keep_count, std::vector<u8> state);
+bool ReadRotationSnapshotFile(const std::string& filename, u32 age, std::vector<u8>* state,
+                              u32* count);
+
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
 void UndoSaveState();
@@ -4,12 +4,17 @@
 
 #include "Core/TitleDatabase.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -118,12 +123,13 @@ static bool LoadMap(const std::string& file_path, Map& gc_map, Map& wii_map)
   return true;
 }
 
-TitleDatabase::TitleDatabase()
+// Builds the merged title maps from the text databases, in priority order.
+static void ParseTextDatabases(Map& gc_map, Map& wii_map)
 {
   // Load the user databases.
   const std::string& load_directory = File::GetUserPath(D_LOAD_IDX);
-  if (!LoadMap(load_directory + "wiitdb.txt", m_gc_title_map, m_wii_title_map))
-    LoadMap(load_directory + "titles.txt", m_gc_title_map, m_wii_title_map);
+  if (!LoadMap(load_directory + "wiitdb.txt", gc_map, wii_map))
+    LoadMap(load_directory + "titles.txt", gc_map, wii_map);
 
   if (!SConfig::GetInstance().m_use_builtin_title_database)
     return;
@@ -133,37 +139,219 @@ TitleDatabase::TitleDatabase()
   // so instead, we use Japanese names iff the games are NTSC-J.
   const std::string gc_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(false));
   const std::string wii_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(true));
-  LoadMap(File::GetSysDirectory() + "wiitdb-ja.txt", m_gc_title_map, IsJapaneseGCTitle);
+  LoadMap(File::GetSysDirectory() + "wiitdb-ja.txt", gc_map, IsJapaneseGCTitle);
   if (gc_code != "en")
   {
-    LoadMap(File::GetSysDirectory() + "wiitdb-" + gc_code + ".txt", m_gc_title_map,
+    LoadMap(File::GetSysDirectory() + "wiitdb-" + gc_code + ".txt", gc_map,
       IsNonJapaneseGCTitle);
   }
   if (wii_code != "en")
-    LoadMap(File::GetSysDirectory() + "wiitdb-" + wii_code + ".txt", m_wii_title_map, IsWiiTitle);
+    LoadMap(File::GetSysDirectory() + "wiitdb-" + wii_code + ".txt", wii_map, IsWiiTitle);
 
   // Load the English database as the base database.
-  LoadMap(File::GetSysDirectory() + "wiitdb-en.txt", m_gc_title_map, m_wii_title_map);
+  LoadMap(File::GetSysDirectory() + "wiitdb-en.txt", gc_map, wii_map);
+}
+
+static constexpr u32 TITLEDB_CACHE_REVISION = 1;
+
+// Identifies the exact set of text databases a compiled cache was built from:
+// every path that ParseTextDatabases would consult, with its modification
+// time (0 when the file doesn't exist). A cache whose fingerprint doesn't
+// match the current files is discarded and rebuilt from the text.
+static std::string GetDatabaseFingerprint()
+{
+  const std::string& load_directory = File::GetUserPath(D_LOAD_IDX);
+  std::vector<std::string> paths{ load_directory + "wiitdb.txt", load_directory + "titles.txt" };
+  if (SConfig::GetInstance().m_use_builtin_title_database)
+  {
+    const std::string gc_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(false));
+    const std::string wii_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(true));
+    paths.push_back(File::GetSysDirectory() + "wiitdb-ja.txt");
+    if (gc_code != "en")
+      paths.push_back(File::GetSysDirectory() + "wiitdb-" + gc_code + ".txt");
+    if (wii_code != "en")
+      paths.push_back(File::GetSysDirectory() + "wiitdb-" + wii_code + ".txt");
+    paths.push_back(File::GetSysDirectory() + "wiitdb-en.txt");
+  }
+
+  std::string fingerprint;
+  for (const std::string& path : paths)
+  {
+    fingerprint += StringFromFormat("%s=%" PRIu64 "\n", path.c_str(),
+      File::FileInfo(path).GetModificationTime());
+  }
+  return fingerprint;
+}
+
+TitleDatabase::TitleDatabase()
+{
+  const std::string cache_path = File::GetUserPath(D_CACHE_IDX) + "titledb.cache";
+  const std::string fingerprint = GetDatabaseFingerprint();
+
+  if (!LoadFromCache(cache_path, fingerprint))
+  {
+    Map gc_map, wii_map;
+    ParseTextDatabases(gc_map, wii_map);
+    BuildIndex(gc_map, &m_gc_index);
+    BuildIndex(wii_map, &m_wii_index);
+    SaveToCache(cache_path, fingerprint);
+  }
 
   // Titles that cannot be part of the Wii TDB,
   // but common enough to justify having entries for them.
-
-  // i18n: "Wii Menu" (or System Menu) refers to the Wii's main menu,
-  // which is (usually) the first thing users see when a Wii console starts.
-  m_wii_title_map.emplace("0000000100000002", GetStringT("Wii Menu"));
-  for (const auto& id : { "HAXX", "JODI", "00010001af1bf516", "LULZ", "OHBC" })
-    m_wii_title_map.emplace(id, "The Homebrew Channel");
+  // These contain a translated string, so they aren't part of the cache.
+  if (SConfig::GetInstance().m_use_builtin_title_database)
+  {
+    // i18n: "Wii Menu" (or System Menu) refers to the Wii's main menu,
+    // which is (usually) the first thing users see when a Wii console starts.
+    m_extra_wii_titles.emplace("0000000100000002", GetStringT("Wii Menu"));
+    for (const auto& id : { "HAXX", "JODI", "00010001af1bf516", "LULZ", "OHBC" })
+      m_extra_wii_titles.emplace(id, "The Homebrew Channel");
+  }
 }
 
 TitleDatabase::~TitleDatabase() = default;
 
+int TitleDatabase::CompareKey(const char* blob, const Entry& entry, const char* key,
+  size_t key_length)
+{
+  const size_t common_length = std::min<size_t>(entry.key_length, key_length);
+  const int order = std::memcmp(blob + entry.key_offset, key, common_length);
+  if (order != 0)
+    return order;
+  if (entry.key_length != key_length)
+    return entry.key_length < key_length ? -1 : 1;
+  return 0;
+}
+
+std::string TitleDatabase::Lookup(const Index& index, const std::string& key) const
+{
+  const char* blob = m_blob.data();
+  const auto it = std::lower_bound(index.begin(), index.end(), key,
+    [blob](const Entry& entry, const std::string& k) {
+      return CompareKey(blob, entry, k.data(), k.size()) < 0;
+    });
+  if (it == index.end() || CompareKey(blob, *it, key.data(), key.size()) != 0)
+    return "";
+  return std::string(blob + it->value_offset, it->value_length);
+}
+
+void TitleDatabase::BuildIndex(const std::unordered_map<std::string, std::string>& map,
+  Index* index)
+{
+  index->reserve(map.size());
+  for (const auto& entry : map)
+  {
+    Entry compiled;
+    compiled.key_offset = static_cast<u32>(m_blob.size());
+    compiled.key_length = static_cast<u32>(entry.first.size());
+    m_blob.insert(m_blob.end(), entry.first.begin(), entry.first.end());
+    compiled.value_offset = static_cast<u32>(m_blob.size());
+    compiled.value_length = static_cast<u32>(entry.second.size());
+    m_blob.insert(m_blob.end(), entry.second.begin(), entry.second.end());
+    index->push_back(compiled);
+  }
+
+  const char* blob = m_blob.data();
+  std::sort(index->begin(), index->end(), [blob](const Entry& a, const Entry& b) {
+    return CompareKey(blob, a, blob + b.key_offset, b.key_length) < 0;
+  });
+}
+
+bool TitleDatabase::LoadFromCache(const std::string& cache_path, const std::string& fingerprint)
+{
+  File::IOFile file(cache_path, "rb");
+  if (!file)
+    return false;
+
+  u32 revision = 0;
+  u32 fingerprint_size = 0;
+  if (!file.ReadArray(&revision, 1) || revision != TITLEDB_CACHE_REVISION ||
+    !file.ReadArray(&fingerprint_size, 1) || fingerprint_size != fingerprint.size())
+  {
+    return false;
+  }
+
+  std::string file_fingerprint(fingerprint.size(), '\0');
+  if (!file.ReadBytes(&file_fingerprint[0], file_fingerprint.size()) ||
+    file_fingerprint != fingerprint)
+  {
+    return false;
+  }
+
+  u32 gc_count = 0;
+  u32 wii_count = 0;
+  u32 blob_size = 0;
+  if (!file.ReadArray(&gc_count, 1) || !file.ReadArray(&wii_count, 1) ||
+    !file.ReadArray(&blob_size, 1))
+  {
+    return false;
+  }
+
+  m_gc_index.resize(gc_count);
+  m_wii_index.resize(wii_count);
+  m_blob.resize(blob_size);
+  bool success = (gc_count == 0 || file.ReadArray(m_gc_index.data(), gc_count)) &&
+    (wii_count == 0 || file.ReadArray(m_wii_index.data(), wii_count)) &&
+    (blob_size == 0 || file.ReadBytes(m_blob.data(), blob_size));
+
+  // Reject a truncated or corrupted cache rather than reading past the blob.
+  for (const Index* index : { &m_gc_index, &m_wii_index })
+  {
+    for (const Entry& entry : *index)
+    {
+      if (static_cast<u64>(entry.key_offset) + entry.key_length > blob_size ||
+        static_cast<u64>(entry.value_offset) + entry.value_length > blob_size)
+      {
+        success = false;
+      }
+    }
+  }
+
+  if (!success)
+  {
+    m_gc_index.clear();
+    m_wii_index.clear();
+    m_blob.clear();
+  }
+  return success;
+}
+
+void TitleDatabase::SaveToCache(const std::string& cache_path, const std::string& fingerprint) const
+{
+  File::IOFile file(cache_path, "wb");
+  if (!file)
+    return;
+
+  const u32 revision = TITLEDB_CACHE_REVISION;
+  const u32 fingerprint_size = static_cast<u32>(fingerprint.size());
+  const u32 gc_count = static_cast<u32>(m_gc_index.size());
+  const u32 wii_count = static_cast<u32>(m_wii_index.size());
+  const u32 blob_size = static_cast<u32>(m_blob.size());
+  file.WriteArray(&revision, 1);
+  file.WriteArray(&fingerprint_size, 1);
+  file.WriteBytes(fingerprint.data(), fingerprint.size());
+  file.WriteArray(&gc_count, 1);
+  file.WriteArray(&wii_count, 1);
+  file.WriteArray(&blob_size, 1);
+  file.WriteArray(m_gc_index.data(), m_gc_index.size());
+  file.WriteArray(m_wii_index.data(), m_wii_index.size());
+  file.WriteBytes(m_blob.data(), m_blob.size());
+}
+
 std::string TitleDatabase::GetTitleName(const std::string& game_id, TitleType type) const
 {
-  const auto& map = IsWiiTitle(game_id) ? m_wii_title_map : m_gc_title_map;
+  const Index& index = IsWiiTitle(game_id) ? m_wii_index : m_gc_index;
   const std::string key =
     type == TitleType::Channel && game_id.length() == 6 ? game_id.substr(0, 4) : game_id;
-  const auto iterator = map.find(key);
-  return iterator != map.end() ? iterator->second : "";
+  std::string name = Lookup(index, key);
+  if (name.empty() && IsWiiTitle(game_id))
+  {
+    const auto iterator = m_extra_wii_titles.find(key);
+    if (iterator != m_extra_wii_titles.end())
+      return iterator->second;
+  }
+  return name;
 }
 
 std::string TitleDatabase::GetChannelName(u64 title_id) const
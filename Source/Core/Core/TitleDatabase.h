@@ -6,6 +6,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -35,7 +36,33 @@ public:
   std::string Describe(const std::string& game_id, TitleType = TitleType::Other) const;
 
 private:
-  std::unordered_map<std::string, std::string> m_wii_title_map;
-  std::unordered_map<std::string, std::string> m_gc_title_map;
+  // The database is kept as one string blob plus tables of offsets into it,
+  // sorted by key for binary search. This compiled form is written to a cache
+  // file so later launches can read it back in a handful of allocations
+  // instead of re-parsing the text databases.
+  struct Entry
+  {
+    u32 key_offset;
+    u32 key_length;
+    u32 value_offset;
+    u32 value_length;
+  };
+  using Index = std::vector<Entry>;
+
+  static int CompareKey(const char* blob, const Entry& entry, const char* key, size_t key_length);
+  std::string Lookup(const Index& index, const std::string& key) const;
+
+  void BuildIndex(const std::unordered_map<std::string, std::string>& map, Index* index);
+
+  bool LoadFromCache(const std::string& cache_path, const std::string& fingerprint);
+  void SaveToCache(const std::string& cache_path, const std::string& fingerprint) const;
+
+  std::vector<char> m_blob;
+  Index m_gc_index;
+  Index m_wii_index;
+
+  // Titles that cannot be part of the Wii TDB; these contain a translated
+  // string, so they are added at construction rather than cached.
+  std::unordered_map<std::string, std::string> m_extra_wii_titles;
 };
 }  // namespace Core
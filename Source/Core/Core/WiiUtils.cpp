@@ -5,6 +5,7 @@
 #include "Core/WiiUtils.h"
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cinttypes>
 #include <cstddef>
@@ -28,6 +29,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "Common/Swap.h"
 #include "Common/SysConf.h"
 #include "Core/CommonTitles.h"
@@ -85,13 +87,43 @@ static bool ImportWAD(IOS::HLE::Kernel& ios, const DiscIO::WiiWAD& wad)
 
   const bool contents_imported = [&]() {
     const u64 title_id = tmd.GetTitleId();
-    for (const IOS::ES::Content& content : tmd.GetContents())
+    const std::vector<IOS::ES::Content> contents = tmd.GetContents();
+
+    // Read each content one step ahead on the thread pool, so pulling the
+    // next one out of the WAD overlaps with decrypting, hashing and writing
+    // the current one to the NAND.
+    std::vector<u8> data;
+    if (!contents.empty())
+      data = wad.GetContent(contents[0].index);
+    for (size_t i = 0; i < contents.size(); ++i)
     {
-      const std::vector<u8> data = wad.GetContent(content.index);
+      const IOS::ES::Content& content = contents[i];
+      const bool has_next = i + 1 < contents.size();
+      std::vector<u8> next_data;
+      std::atomic<bool> next_ready{false};
+      if (has_next)
+      {
+        const u16 next_index = contents[i + 1].index;
+        Common::AsyncWorker::ExecuteAsync([&wad, &next_data, &next_ready, next_index]() {
+          next_data = wad.GetContent(next_index);
+          next_ready.store(true, std::memory_order_release);
+        });
+      }
 
-      if (es->ImportContentBegin(context, title_id, content.id) < 0 ||
-        es->ImportContentData(context, 0, data.data(), static_cast<u32>(data.size())) < 0 ||
-        es->ImportContentEnd(context, 0) < 0)
+      const bool imported =
+        es->ImportContentBegin(context, title_id, content.id) >= 0 &&
+        es->ImportContentData(context, 0, data.data(), static_cast<u32>(data.size())) >= 0 &&
+        es->ImportContentEnd(context, 0) >= 0;
+
+      if (has_next)
+      {
+        u32 loopcount = 0;
+        while (!next_ready.load(std::memory_order_acquire))
+          Common::cYield(loopcount++);
+        data = std::move(next_data);
+      }
+
+      if (!imported)
       {
         PanicAlertT("WAD installation failed: Could not import content %08x.", content.id);
         return false;
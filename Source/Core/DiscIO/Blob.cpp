@@ -19,6 +19,7 @@
 #include "DiscIO/DirectoryBlob.h"
 #include "DiscIO/DriveBlob.h"
 #include "DiscIO/FileBlob.h"
+#include "DiscIO/LZOBlob.h"
 #include "DiscIO/TGCBlob.h"
 #include "DiscIO/WbfsBlob.h"
 
@@ -52,7 +53,7 @@ const SectorReader::Cache* SectorReader::FindCacheLine(u64 block_num)
   if (itr == m_cache.end())
     return nullptr;
 
-  itr->MarkUsed();
+  itr->MarkUsed(++m_lru_counter);
   return &*itr;
 }
 
@@ -60,15 +61,11 @@ SectorReader::Cache* SectorReader::GetEmptyCacheLine()
 {
   Cache* oldest = &m_cache[0];
   // Find the Least Recently Used cache line to replace.
-  std::for_each(m_cache.begin() + 1, m_cache.end(), [&](Cache& line) {
+  for (Cache& line : m_cache)
+  {
     if (line.IsLessRecentlyUsedThan(*oldest))
-    {
-      oldest->ShiftLRU();
       oldest = &line;
-      return;
-    }
-    line.ShiftLRU();
-  });
+  }
   oldest->Reset();
   return oldest;
 }
@@ -85,7 +82,7 @@ const SectorReader::Cache* SectorReader::GetCacheLine(u64 block_num)
   u32 blocks_read = ReadChunk(cache->data.data(), chunk_idx);
   if (!blocks_read)
     return nullptr;
-  cache->Fill(chunk_idx * m_chunk_blocks, blocks_read);
+  cache->Fill(chunk_idx * m_chunk_blocks, blocks_read, ++m_lru_counter);
 
   // Secondary check for out-of-bounds read.
   // If we got less than m_chunk_blocks, we may still have missed.
@@ -195,9 +192,11 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
   switch (magic)
   {
   case CISO_MAGIC:
-    return CISOFileReader::Create(std::move(file));
+    return CISOFileReader::Create(std::move(file), filename);
   case GCZ_MAGIC:
     return CompressedBlobReader::Create(std::move(file), filename);
+  case LZB_MAGIC:
+    return LZOBlobReader::Create(std::move(file), filename);
   case TGC_MAGIC:
     return TGCFileReader::Create(std::move(file));
   case WBFS_MAGIC:
@@ -206,7 +205,7 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     if (auto directory_blob = DirectoryBlobReader::Create(filename))
       return std::move(directory_blob);
 
-    return PlainFileReader::Create(std::move(file));
+    return PlainFileReader::Create(std::move(file), filename);
   }
 }
 
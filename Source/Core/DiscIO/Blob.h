@@ -34,7 +34,8 @@ enum class BlobType
   GCZ,
   CISO,
   WBFS,
-  TGC
+  TGC,
+  LZO
 };
 
 class BlobReader
@@ -101,33 +102,26 @@ private:
     u64 block_idx = 0;
     u32 num_blocks = 0;
 
-    // [Pseudo-] Least Recently Used Shift Register
-    // When an empty cache line is needed, the line with the lowest value
-    // is taken and reset; the LRU register is then shifted down 1 place
-    // on all lines (low bit discarded). When a line is used, the high bit
-    // is set marking it as most recently used.
-    u32 lru_sreg = 0;
+    // Timestamp of the last hit, from the monotonic counter below. The line
+    // with the smallest value is the least recently used one; empty lines
+    // have 0 and therefore get filled first.
+    u64 last_used = 0;
 
     void Reset()
     {
       block_idx = 0;
       num_blocks = 0;
-      lru_sreg = 0;
+      last_used = 0;
     }
-    void Fill(u64 block, u32 count)
+    void Fill(u64 block, u32 count, u64 stamp)
     {
       block_idx = block;
       num_blocks = count;
-      // NOTE: Setting only the high bit means the newest line will
-      //   be selected for eviction if every line in the cache was
-      //   touched. This gives MRU behavior which is probably
-      //   desirable in that case.
-      MarkUsed();
+      MarkUsed(stamp);
     }
     bool Contains(u64 block) const { return block >= block_idx && block - block_idx < num_blocks; }
-    void MarkUsed() { lru_sreg |= 0x80000000; }
-    void ShiftLRU() { lru_sreg >>= 1; }
-    bool IsLessRecentlyUsedThan(const Cache& other) const { return lru_sreg < other.lru_sreg; }
+    void MarkUsed(u64 stamp) { last_used = stamp; }
+    bool IsLessRecentlyUsedThan(const Cache& other) const { return last_used < other.last_used; }
   };
 
   // Gets the cache line that contains the given block, or nullptr.
@@ -151,6 +145,7 @@ private:
   static constexpr int CACHE_LINES = 32;
   u32 m_block_size = 0;    // Bytes in a sector/block
   u32 m_chunk_blocks = 1;  // Number of sectors/blocks in a chunk
+  u64 m_lru_counter = 0;   // Bumped on every cache hit and fill.
   std::array<Cache, CACHE_LINES> m_cache;
 };
 
@@ -165,4 +160,11 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 bool DecompressBlobToFile(const std::string& infile_path, const std::string& outfile_path,
                           CompressCB callback = nullptr, void* arg = nullptr);
 
+// Reads a GCZ file back block by block, checking every block hash and that
+// every compressed block still inflates to a whole block. Unlike the blob
+// reader it reports corruption through the return value instead of popping up
+// alerts, so it can run unattended after a batch conversion.
+bool VerifyBlobIntegrity(const std::string& path, CompressCB callback = nullptr,
+                         void* arg = nullptr);
+
 }  // namespace
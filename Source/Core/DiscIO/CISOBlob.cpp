@@ -4,7 +4,9 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "Common/CommonTypes.h"
@@ -13,9 +15,11 @@
 
 namespace DiscIO
 {
-CISOFileReader::CISOFileReader(File::IOFile file) : m_file(std::move(file))
+CISOFileReader::CISOFileReader(File::IOFile file, const std::string& filename)
+    : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+  m_mapping = Common::MappedFile::Open(filename);
 
   CISOHeader header;
   m_file.Seek(0, SEEK_SET);
@@ -28,11 +32,12 @@ CISOFileReader::CISOFileReader(File::IOFile file) : m_file(std::move(file))
     m_ciso_map[idx] = (1 == header.map[idx]) ? count++ : UNUSED_BLOCK_ID;
 }
 
-std::unique_ptr<CISOFileReader> CISOFileReader::Create(File::IOFile file)
+std::unique_ptr<CISOFileReader> CISOFileReader::Create(File::IOFile file,
+                                                       const std::string& filename)
 {
   CISOHeader header;
   if (file.Seek(0, SEEK_SET) && file.ReadArray(&header, 1) && header.magic == CISO_MAGIC)
-    return std::unique_ptr<CISOFileReader>(new CISOFileReader(std::move(file)));
+    return std::unique_ptr<CISOFileReader>(new CISOFileReader(std::move(file), filename));
 
   return nullptr;
 }
@@ -53,14 +58,28 @@ bool CISOFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   {
     u64 const block = offset / m_block_size;
     u64 const data_offset = offset % m_block_size;
-    u64 const bytes_to_read = std::min(m_block_size - data_offset, nbytes);
+    u64 bytes_to_read = std::min(m_block_size - data_offset, nbytes);
 
     if (block < CISO_MAP_SIZE && UNUSED_BLOCK_ID != m_ciso_map[block])
     {
+      // Extend the run over blocks stored back to back in the file, so a
+      // large read becomes one host read instead of one read per block.
+      u64 run_end = block + 1;
+      while (run_end < CISO_MAP_SIZE && UNUSED_BLOCK_ID != m_ciso_map[run_end] &&
+             m_ciso_map[run_end] == m_ciso_map[run_end - 1] + 1)
+      {
+        run_end++;
+      }
+      bytes_to_read = std::min(run_end * (u64)m_block_size - offset, nbytes);
+
       // calculate the base address
       u64 const file_off = CISO_HEADER_SIZE + m_ciso_map[block] * (u64)m_block_size + data_offset;
 
-      if (!(m_file.Seek(file_off, SEEK_SET) && m_file.ReadArray(out_ptr, bytes_to_read)))
+      if (m_mapping && file_off + bytes_to_read <= m_mapping->Size())
+      {
+        std::memcpy(out_ptr, m_mapping->Data() + file_off, bytes_to_read);
+      }
+      else if (!(m_file.Seek(file_off, SEEK_SET) && m_file.ReadArray(out_ptr, bytes_to_read)))
       {
         m_file.Clear();
         return false;
@@ -68,6 +87,14 @@ bool CISOFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
     }
     else
     {
+      // Unused blocks read as zero; coalesce those runs too.
+      u64 run_end = block + 1;
+      while (run_end < CISO_MAP_SIZE && UNUSED_BLOCK_ID == m_ciso_map[run_end])
+        run_end++;
+      if (block < CISO_MAP_SIZE)
+        bytes_to_read = std::min(run_end * (u64)m_block_size - offset, nbytes);
+      else
+        bytes_to_read = nbytes;
       std::fill_n(out_ptr, bytes_to_read, 0);
     }
 
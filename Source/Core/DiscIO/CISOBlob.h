@@ -10,6 +10,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -34,7 +35,7 @@ struct CISOHeader
 class CISOFileReader : public BlobReader
 {
 public:
-  static std::unique_ptr<CISOFileReader> Create(File::IOFile file);
+  static std::unique_ptr<CISOFileReader> Create(File::IOFile file, const std::string& filename);
 
   BlobType GetBlobType() const override { return BlobType::CISO; }
   // The CISO format does not save the original file size.
@@ -45,12 +46,16 @@ public:
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
 
 private:
-  CISOFileReader(File::IOFile file);
+  CISOFileReader(File::IOFile file, const std::string& filename);
 
   typedef u16 MapType;
   static const MapType UNUSED_BLOCK_ID = UINT16_MAX;
 
   File::IOFile m_file;
+  // Shared read-only mapping of the same file; reads are served from it when
+  // it could be established, leaving read-ahead to the OS page cache. m_file
+  // remains the fallback.
+  std::unique_ptr<Common::MappedFile> m_mapping;
   u64 m_size;
   u32 m_block_size;
   MapType m_ciso_map[CISO_MAP_SIZE];
@@ -57,6 +57,13 @@ public:
 private:
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+  // Verifies the hash of one stored block and inflates (or copies) it.
+  bool DecompressBlock(const u8* in_ptr, u32 comp_block_size, bool uncompressed, u64 block_num,
+                       u8* out_ptr) const;
+  // Reads the compressed data of the whole span sequentially, then
+  // decompresses the blocks in parallel on the thread pool.
+  bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
+
   CompressedBlobHeader m_header;
   std::vector<u64> m_block_pointers;
   std::vector<u32> m_hashes;
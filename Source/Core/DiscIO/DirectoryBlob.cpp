@@ -58,6 +58,77 @@ constexpr u8 ENTRY_SIZE = 0x0c;
 constexpr u8 FILE_ENTRY = 0;
 constexpr u8 DIRECTORY_ENTRY = 1;
 
+DiscContentFileCache::CachedFile* DiscContentFileCache::FindOrOpen(const std::string& path)
+{
+  CachedFile* oldest = &m_files[0];
+  for (CachedFile& cached_file : m_files)
+  {
+    if (cached_file.path == path)
+    {
+      cached_file.last_used = ++m_use_counter;
+      return &cached_file;
+    }
+    if (cached_file.last_used < oldest->last_used)
+      oldest = &cached_file;
+  }
+
+  // Evict the least recently used entry and open the requested file.
+  oldest->file = File::IOFile(path, "rb");
+  oldest->data.clear();
+  oldest->buffered = false;
+  oldest->position = static_cast<u64>(-1);
+  if (!oldest->file)
+  {
+    oldest->path.clear();
+    return nullptr;
+  }
+  oldest->path = path;
+  oldest->last_used = ++m_use_counter;
+
+  const u64 size = oldest->file.GetSize();
+  if (size <= BUFFER_THRESHOLD)
+  {
+    oldest->data.resize(size);
+    if (oldest->file.ReadBytes(oldest->data.data(), size))
+      oldest->buffered = true;
+    else
+      oldest->file.Clear();
+  }
+
+  return oldest;
+}
+
+bool DiscContentFileCache::Read(const std::string& path, u64 offset, u64 length, u8* buffer)
+{
+  CachedFile* cached_file = FindOrOpen(path);
+  if (!cached_file)
+    return false;
+
+  if (cached_file->buffered)
+  {
+    if (offset + length > cached_file->data.size())
+      return false;
+    std::copy(cached_file->data.begin() + offset, cached_file->data.begin() + offset + length,
+              buffer);
+    return true;
+  }
+
+  // Sequential requests continue where the previous one left off,
+  // so the seek can usually be skipped.
+  if (offset != cached_file->position && !cached_file->file.Seek(offset, SEEK_SET))
+    return false;
+
+  if (!cached_file->file.ReadBytes(buffer, length))
+  {
+    cached_file->file.Clear();
+    cached_file->position = static_cast<u64>(-1);
+    return false;
+  }
+
+  cached_file->position = offset + length;
+  return true;
+}
+
 DiscContent::DiscContent(u64 offset, u64 size, const std::string& path)
     : m_offset(offset), m_size(size), m_content_source(path)
 {
@@ -87,7 +158,8 @@ u64 DiscContent::GetSize() const
   return m_size;
 }
 
-bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
+bool DiscContent::Read(u64* offset, u64* length, u8** buffer,
+                       DiscContentFileCache* file_cache) const
 {
   if (m_size == 0)
     return true;
@@ -101,9 +173,8 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
 
     if (std::holds_alternative<std::string>(m_content_source))
     {
-      File::IOFile file(std::get<std::string>(m_content_source), "rb");
-      file.Seek(offset_in_content, SEEK_SET);
-      if (!file.ReadBytes(*buffer, bytes_to_read))
+      if (!file_cache->Read(std::get<std::string>(m_content_source), offset_in_content,
+                            bytes_to_read, *buffer))
         return false;
     }
     else
@@ -156,7 +227,7 @@ bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer) const
     // Zero fill to start of DiscContent data
     PadToAddress(it->GetOffset(), &offset, &length, &buffer);
 
-    if (!it->Read(&offset, &length, &buffer))
+    if (!it->Read(&offset, &length, &buffer, &m_file_cache))
       return false;
 
     ++it;
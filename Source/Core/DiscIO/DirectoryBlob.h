@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -14,6 +15,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "DiscIO/Blob.h"
 
@@ -30,6 +32,39 @@ enum class PartitionType : u32;
 // Returns true if the path is inside a DirectoryBlob and doesn't represent the DirectoryBlob itself
 bool ShouldHideFromGameList(const std::string& volume_path);
 
+// Keeps the most recently used content files open between reads, and serves
+// small files from an in-memory copy, so that reading a directory blob does
+// not pay a file open/close (or any I/O at all) for every request.
+class DiscContentFileCache
+{
+public:
+  bool Read(const std::string& path, u64 offset, u64 length, u8* buffer);
+
+private:
+  // Files up to this size are read once and then served from memory.
+  static constexpr u64 BUFFER_THRESHOLD = 256 * 1024;
+  static constexpr size_t MAX_OPEN_FILES = 8;
+
+  struct CachedFile
+  {
+    std::string path;
+    File::IOFile file;
+    std::vector<u8> data;  // Only used for files up to BUFFER_THRESHOLD
+    bool buffered = false;
+    // Forces a seek before the first unbuffered read
+    u64 position = static_cast<u64>(-1);
+    u64 last_used = 0;
+  };
+
+  // Returns the cache entry for the file, evicting the least recently
+  // used entry if the file is not open yet. Returns nullptr if the file
+  // can't be opened.
+  CachedFile* FindOrOpen(const std::string& path);
+
+  std::array<CachedFile, MAX_OPEN_FILES> m_files;
+  u64 m_use_counter = 0;
+};
+
 class DiscContent
 {
 public:
@@ -44,7 +79,7 @@ public:
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
-  bool Read(u64* offset, u64* length, u8** buffer) const;
+  bool Read(u64* offset, u64* length, u8** buffer, DiscContentFileCache* file_cache) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
   bool operator!=(const DiscContent& other) const { return !(*this == other); }
@@ -75,6 +110,8 @@ public:
 
 private:
   std::set<DiscContent> m_contents;
+  // mutable because opening/buffering files is transparent to the caller
+  mutable DiscContentFileCache m_file_cache;
 };
 
 class DirectoryBlobPartition
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -15,16 +16,29 @@ PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
   m_size = m_file.GetSize();
 }
 
-std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
+std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file,
+                                                         const std::string& filename)
 {
-  if (file)
-    return std::unique_ptr<PlainFileReader>(new PlainFileReader(std::move(file)));
+  if (!file)
+    return nullptr;
 
-  return nullptr;
+  std::unique_ptr<PlainFileReader> reader(new PlainFileReader(std::move(file)));
+
+  // Prefer a shared read-only mapping so multiple instances running the same
+  // image share its pages. Buffered reads remain as the fallback for files
+  // that cannot be mapped.
+  reader->m_mapping = Common::MappedFile::Open(filename);
+  return reader;
 }
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapping && offset + nbytes <= m_mapping->Size() && offset + nbytes >= offset)
+  {
+    std::memcpy(out_ptr, m_mapping->Data() + offset, static_cast<size_t>(nbytes));
+    return true;
+  }
+
   if (m_file.Seek(offset, SEEK_SET) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
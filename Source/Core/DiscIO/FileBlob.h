@@ -10,6 +10,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -17,7 +18,7 @@ namespace DiscIO
 class PlainFileReader : public BlobReader
 {
 public:
-  static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  static std::unique_ptr<PlainFileReader> Create(File::IOFile file, const std::string& filename);
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   u64 GetDataSize() const override { return m_size; }
@@ -29,6 +30,11 @@ private:
 
   File::IOFile m_file;
   s64 m_size;
+
+  // Read-only shared mapping of the image, so concurrently running instances
+  // of the same title share one copy of its pages. Reads fall back to m_file
+  // when the file could not be mapped.
+  std::unique_ptr<Common::MappedFile> m_mapping;
 };
 
 }  // namespace
@@ -15,9 +15,12 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
 #include "DiscIO/FileSystemGCWii.h"
 #include "DiscIO/Filesystem.h"
@@ -184,6 +187,68 @@ bool FileInfoGCWii::IsValid(u64 fst_size, const FileInfoGCWii& parent_directory)
   return true;
 }
 
+// The FST cache only covers formats where reading the table costs real work
+// (decompressing or decrypting every block it spans), and never virtual
+// filesystems whose contents can change behind our back.
+static bool ShouldCacheFST(const Volume& volume, const Partition& partition)
+{
+  switch (volume.GetBlobType())
+  {
+  case BlobType::DIRECTORY:
+  case BlobType::DRIVE:
+    return false;
+  case BlobType::PLAIN:
+    // Unencrypted images are a plain file read; only encrypted Wii
+    // partitions benefit.
+    return partition != PARTITION_NONE;
+  default:
+    return true;
+  }
+}
+
+// The sidecar is keyed by the FST's location, size and first entries in
+// addition to the game ID, so two images that share an ID but differ
+// (modified dumps, revisions) cannot hit each other's cache. Returns an
+// empty string when the key cannot be computed.
+static std::string FSTCachePath(const Volume& volume, const Partition& partition, u64 fst_offset,
+                                u64 fst_size)
+{
+  u8 head[64] = {};
+  const u64 head_size = std::min<u64>(fst_size, sizeof(head));
+  if (!volume.Read(fst_offset, head_size, head, partition))
+    return "";
+
+  const u64 key[3] = {fst_offset, fst_size, partition.offset};
+  const u64 hash = GetMurmurHash3(head, static_cast<u32>(head_size), 0) ^
+                   GetMurmurHash3(reinterpret_cast<const u8*>(key), sizeof(key), 0);
+  return File::GetUserPath(D_CACHE_IDX) + volume.GetGameID(partition) +
+         StringFromFormat("-%016" PRIx64 ".fst", hash);
+}
+
+// The expected size doubles as an integrity check; together with the hashed
+// file name, a sidecar of the right size can only disagree with the disc if
+// the file itself was damaged, which the caller detects by validating.
+static bool LoadCachedFST(const std::string& path, u64 fst_size, std::vector<u8>* fst)
+{
+  File::IOFile file(path, "rb");
+  if (!file || file.GetSize() != fst_size)
+    return false;
+  fst->resize(fst_size);
+  return file.ReadBytes(fst->data(), fst->size());
+}
+
+static void SaveCachedFST(const std::string& path, const std::vector<u8>& fst)
+{
+  File::CreateFullPath(path);
+  File::IOFile file(path, "wb");
+  // Never leave a truncated cache behind.
+  if (file && !file.WriteBytes(fst.data(), fst.size()))
+  {
+    file.Close();
+    File::Delete(path);
+  }
+}
+
 FileSystemGCWii::FileSystemGCWii(const Volume* volume, const Partition& partition)
     : m_valid(false), m_root(nullptr, 0, 0, 0)
 {
@@ -218,36 +283,58 @@ FileSystemGCWii::FileSystemGCWii(const Volume* volume, const Partition& partitio
     return;
   }
 
-  // Read the whole FST
-  m_file_system_table.resize(*fst_size);
-  if (!volume->Read(*fst_offset, *fst_size, m_file_system_table.data(), partition))
-  {
-    ERROR_LOG(DISCIO, "Couldn't read file system table");
-    return;
-  }
+  const auto validate = [this, fst_size = *fst_size, offset_shift]() {
+    // Create the root object
+    m_root = FileInfoGCWii(m_file_system_table.data(), offset_shift);
+    if (!m_root.IsDirectory())
+    {
+      ERROR_LOG(DISCIO, "File system root is not a directory");
+      return false;
+    }
 
-  // Create the root object
-  m_root = FileInfoGCWii(m_file_system_table.data(), offset_shift);
-  if (!m_root.IsDirectory())
-  {
-    ERROR_LOG(DISCIO, "File system root is not a directory");
-    return;
-  }
+    if (FST_ENTRY_SIZE * m_root.GetSize() > fst_size)
+    {
+      ERROR_LOG(DISCIO, "File system has too many entries for its size");
+      return false;
+    }
+
+    // If the FST's final byte isn't 0, FileInfoGCWii::GetName() can read past the end
+    if (m_file_system_table[fst_size - 1] != 0)
+    {
+      ERROR_LOG(DISCIO, "File system does not end with a null byte");
+      return false;
+    }
+
+    return m_root.IsValid(fst_size, m_root);
+  };
 
-  if (FST_ENTRY_SIZE * m_root.GetSize() > *fst_size)
+  std::string cache_path;
+  if (ShouldCacheFST(*volume, partition))
+    cache_path = FSTCachePath(*volume, partition, *fst_offset, *fst_size);
+
+  if (!cache_path.empty() && LoadCachedFST(cache_path, *fst_size, &m_file_system_table))
   {
-    ERROR_LOG(DISCIO, "File system has too many entries for its size");
-    return;
+    if (validate())
+    {
+      m_valid = true;
+      return;
+    }
+    // A stale or damaged sidecar must never make a good disc unreadable.
+    WARN_LOG(DISCIO, "Discarding corrupt FST cache %s", cache_path.c_str());
+    File::Delete(cache_path);
   }
 
-  // If the FST's final byte isn't 0, FileInfoGCWii::GetName() can read past the end
-  if (m_file_system_table[*fst_size - 1] != 0)
+  // Read the whole FST
+  m_file_system_table.resize(*fst_size);
+  if (!volume->Read(*fst_offset, *fst_size, m_file_system_table.data(), partition))
   {
-    ERROR_LOG(DISCIO, "File system does not end with a null byte");
+    ERROR_LOG(DISCIO, "Couldn't read file system table");
     return;
   }
 
-  m_valid = m_root.IsValid(*fst_size, m_root);
+  m_valid = validate();
+  if (m_valid && !cache_path.empty())
+    SaveCachedFST(cache_path, m_file_system_table);
 }
 
 FileSystemGCWii::~FileSystemGCWii() = default;
@@ -257,43 +344,103 @@ const FileInfo& FileSystemGCWii::GetRoot() const
   return m_root;
 }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path) const
+// Byte-wise ASCII folding, matching what strcasecmp did for the old
+// per-component search. Non-ASCII name bytes are compared as-is.
+static char FoldCase(char c)
 {
-  if (!IsValid())
-    return nullptr;
-
-  return FindFileInfo(path, m_root);
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
 }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path,
-                                                        const FileInfo& file_info) const
+void FileSystemGCWii::BuildPathIndex() const
 {
-  // Given a path like "directory1/directory2/fileA.bin", this function will
-  // find directory1 and then call itself to search for "directory2/fileA.bin".
+  const u32 fst_entries = m_root.GetSize();
+  if (fst_entries < 2)
+    return;
+  m_path_index.reserve(fst_entries - 1);
+
+  // The end index and folded path prefix length of each directory that the
+  // current entry is inside, so the walk is a single pass over the table.
+  std::vector<std::pair<u32, u32>> directory_stack;
+  std::string prefix;
+  for (u32 i = 1; i < fst_entries; ++i)
+  {
+    while (!directory_stack.empty() && i >= directory_stack.back().first)
+    {
+      directory_stack.pop_back();
+      prefix.resize(directory_stack.empty() ? 0 : directory_stack.back().second);
+    }
 
-  const size_t name_start = path.find_first_not_of('/');
-  if (name_start == std::string::npos)
-    return file_info.clone();  // We're done
+    const FileInfoGCWii file_info(m_root, i);
+    const std::string name = file_info.GetName();
 
-  const size_t name_end = path.find('/', name_start);
-  const std::string name = path.substr(name_start, name_end - name_start);
-  const std::string rest_of_path = (name_end != std::string::npos) ? path.substr(name_end + 1) : "";
+    PathIndexEntry entry;
+    entry.path_offset = static_cast<u32>(m_path_blob.size());
+    entry.path_length = static_cast<u32>(prefix.size() + name.size());
+    entry.fst_index = i;
+    m_path_blob += prefix;
+    for (char c : name)
+      m_path_blob += FoldCase(c);
+    m_path_index.push_back(entry);
 
-  for (const FileInfo& child : file_info)
-  {
-    if (!strcasecmp(child.GetName().c_str(), name.c_str()))
+    if (file_info.IsDirectory())
     {
-      // A match is found. The rest of the path is passed on to finish the search.
-      std::unique_ptr<FileInfo> result = FindFileInfo(rest_of_path, child);
+      // For directories, GetSize() is the index of the next entry that isn't
+      // inside the directory.
+      prefix.assign(m_path_blob, entry.path_offset, entry.path_length);
+      prefix += '/';
+      directory_stack.emplace_back(file_info.GetSize(), static_cast<u32>(prefix.size()));
+    }
+  }
+
+  std::sort(m_path_index.begin(), m_path_index.end(),
+            [this](const PathIndexEntry& a, const PathIndexEntry& b) {
+              const int compare =
+                  m_path_blob.compare(a.path_offset, a.path_length, m_path_blob, b.path_offset,
+                                      b.path_length);
+              return compare != 0 ? compare < 0 : a.fst_index < b.fst_index;
+            });
+}
 
-      // If the search wasn't successful, the loop continues, just in case there's a second
-      // file info that matches searching_for (which probably won't happen in practice)
-      if (result)
-        return result;
+std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path) const
+{
+  if (!IsValid())
+    return nullptr;
+
+  // Normalize the way the old recursive search did: redundant slashes are
+  // skipped and ASCII case is ignored.
+  std::string needle;
+  for (char c : path)
+  {
+    if (c == '/')
+    {
+      if (!needle.empty() && needle.back() != '/')
+        needle += '/';
+    }
+    else
+    {
+      needle += FoldCase(c);
     }
   }
+  if (!needle.empty() && needle.back() == '/')
+    needle.pop_back();
+  if (needle.empty())
+    return m_root.clone();
+
+  if (m_path_index.empty())
+    BuildPathIndex();
+
+  const auto it = std::lower_bound(m_path_index.begin(), m_path_index.end(), needle,
+                                   [this](const PathIndexEntry& entry, const std::string& value) {
+                                     return m_path_blob.compare(entry.path_offset,
+                                                                entry.path_length, value) < 0;
+                                   });
+  if (it == m_path_index.end() ||
+      m_path_blob.compare(it->path_offset, it->path_length, needle) != 0)
+  {
+    return nullptr;
+  }
 
-  return nullptr;
+  return std::make_unique<FileInfoGCWii>(m_root, it->fst_index);
 }
 
 std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(u64 disc_offset) const
@@ -312,13 +459,18 @@ std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(u64 disc_offset) const
       {
         const u32 size = file_info.GetSize();
         if (size != 0)
-          m_offset_file_info_cache.emplace(file_info.GetOffset() + size, i);
+          m_offset_file_info_cache.emplace_back(file_info.GetOffset() + size, i);
       }
     }
+    std::sort(m_offset_file_info_cache.begin(), m_offset_file_info_cache.end());
   }
 
   // Get the first file that ends after disc_offset
-  const auto it = m_offset_file_info_cache.upper_bound(disc_offset);
+  const auto it =
+      std::upper_bound(m_offset_file_info_cache.begin(), m_offset_file_info_cache.end(),
+                       disc_offset, [](u64 offset, const std::pair<u64, u32>& entry) {
+                         return offset < entry.first;
+                       });
   if (it == m_offset_file_info_cache.end())
     return nullptr;
   std::unique_ptr<FileInfo> result(std::make_unique<FileInfoGCWii>(m_root, it->second));
@@ -5,10 +5,10 @@
 #pragma once
 
 #include <cstddef>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -97,10 +97,22 @@ private:
   bool m_valid;
   std::vector<u8> m_file_system_table;
   FileInfoGCWii m_root;
-  // Maps the end offset of files to FST indexes
-  mutable std::map<u64, u32> m_offset_file_info_cache;
+  // Maps the end offset of files to FST indexes, sorted by end offset
+  mutable std::vector<std::pair<u64, u32>> m_offset_file_info_cache;
 
-  std::unique_ptr<FileInfo> FindFileInfo(const std::string& path, const FileInfo& file_info) const;
+  // Every entry's full path, ASCII case-folded, stored back to back in one
+  // string blob and indexed by entries sorted by path bytes, so path lookups
+  // are a binary search instead of a per-component scan of the tree.
+  struct PathIndexEntry
+  {
+    u32 path_offset;
+    u32 path_length;
+    u32 fst_index;
+  };
+  mutable std::string m_path_blob;
+  mutable std::vector<PathIndexEntry> m_path_index;
+
+  void BuildPathIndex() const;
 };
 
 }  // namespace
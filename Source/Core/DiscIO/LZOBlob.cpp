@@ -0,0 +1,377 @@
+// Copyright 2008 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <lzo/lzo1x.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscScrubber.h"
+#include "DiscIO/LZOBlob.h"
+
+namespace DiscIO
+{
+static bool InitLZO()
+{
+  static bool initialized = lzo_init() == LZO_E_OK;
+  if (!initialized)
+    PanicAlertT("Internal LZO Error - lzo_init() failed");
+  return initialized;
+}
+
+// The worst-case expansion for incompressible input, from the LZO FAQ.
+static size_t WorstCaseCompressedSize(size_t block_size)
+{
+  return block_size + block_size / 16 + 64 + 3;
+}
+
+LZOBlobReader::LZOBlobReader(File::IOFile file, const std::string& filename)
+    : m_file(std::move(file)), m_file_name(filename)
+{
+  m_file_size = m_file.GetSize();
+  m_file.Seek(0, SEEK_SET);
+  m_file.ReadArray(&m_header, 1);
+
+  SetSectorSize(m_header.block_size);
+
+  // cache block pointers and hashes
+  m_block_pointers.resize(m_header.num_blocks);
+  m_file.ReadArray(m_block_pointers.data(), m_header.num_blocks);
+  m_hashes.resize(m_header.num_blocks);
+  m_file.ReadArray(m_hashes.data(), m_header.num_blocks);
+
+  m_data_offset = (sizeof(LZOBlobHeader)) +
+                  (sizeof(u64)) * m_header.num_blocks     // skip block pointers
+                  + (sizeof(u64)) * m_header.num_blocks;  // skip hashes
+
+  // A stored block is never longer than the decompressed block size, since
+  // blocks that don't shrink are stored as-is.
+  m_lzo_buffer.resize(m_header.block_size + 64);
+}
+
+std::unique_ptr<LZOBlobReader> LZOBlobReader::Create(File::IOFile file, const std::string& filename)
+{
+  if (IsLZOBlob(file) && InitLZO())
+    return std::unique_ptr<LZOBlobReader>(new LZOBlobReader(std::move(file), filename));
+
+  return nullptr;
+}
+
+LZOBlobReader::~LZOBlobReader()
+{
+}
+
+u64 LZOBlobReader::GetBlockCompressedSize(u64 block_num) const
+{
+  u64 start = m_block_pointers[block_num];
+  if (block_num < m_header.num_blocks - 1)
+    return m_block_pointers[block_num + 1] - start;
+  else if (block_num == m_header.num_blocks - 1)
+    return m_header.compressed_data_size - start;
+  else
+    PanicAlert("GetBlockCompressedSize - illegal block number %i", (int)block_num);
+  return 0;
+}
+
+bool LZOBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+{
+  bool uncompressed = false;
+  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
+  u64 offset = m_block_pointers[block_num] + m_data_offset;
+
+  if (offset & (1ULL << 63))
+  {
+    if (comp_block_size != m_header.block_size)
+      PanicAlert("Uncompressed block with wrong size");
+    uncompressed = true;
+    offset &= ~(1ULL << 63);
+  }
+
+  m_file.Seek(offset, SEEK_SET);
+  if (!m_file.ReadBytes(m_lzo_buffer.data(), comp_block_size))
+  {
+    PanicAlertT("The disc image \"%s\" is truncated, some of the data is missing.",
+                m_file_name.c_str());
+    m_file.Clear();
+    return false;
+  }
+
+  // First, check hash.
+  const u64 block_hash = GetMurmurHash3(m_lzo_buffer.data(), comp_block_size, 0);
+  if (block_hash != m_hashes[block_num])
+  {
+    PanicAlertT("The disc image \"%s\" is corrupt.\n"
+                "Hash of block %" PRIu64 " is %016" PRIx64 " instead of %016" PRIx64 ".",
+                m_file_name.c_str(), block_num, block_hash, m_hashes[block_num]);
+  }
+
+  if (uncompressed)
+  {
+    std::copy(m_lzo_buffer.begin(), m_lzo_buffer.begin() + comp_block_size, out_ptr);
+  }
+  else
+  {
+    lzo_uint uncomp_size = m_header.block_size;
+    if (lzo1x_decompress(m_lzo_buffer.data(), comp_block_size, out_ptr, &uncomp_size, nullptr) !=
+        LZO_E_OK)
+    {
+      PanicAlert("Failure reading block %" PRIu64 " - decompression failed.", block_num);
+      return false;
+    }
+    if (uncomp_size != m_header.block_size)
+    {
+      PanicAlert("Wrong block size");
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CompressFileToLZOBlob(const std::string& infile_path, const std::string& outfile_path,
+                           u32 sub_type, int block_size, CompressCB callback, void* arg)
+{
+  bool scrubbing = false;
+
+  if (!InitLZO())
+    return false;
+
+  File::IOFile infile(infile_path, "rb");
+  if (IsLZOBlob(infile))
+  {
+    PanicAlertT("\"%s\" is already compressed! Cannot compress it further.", infile_path.c_str());
+    return false;
+  }
+
+  if (!infile)
+  {
+    PanicAlertT("Failed to open the input file \"%s\".", infile_path.c_str());
+    return false;
+  }
+
+  File::IOFile outfile(outfile_path, "wb");
+  if (!outfile)
+  {
+    PanicAlertT("Failed to open the output file \"%s\".\n"
+                "Check that you have permissions to write the target folder and that the media can "
+                "be written.",
+                outfile_path.c_str());
+    return false;
+  }
+
+  // DiscScrubber wants its block size to divide its cluster size, which our
+  // blocks are far larger than, so feed it cluster-sized blocks and read
+  // several of them per LZB block.
+  constexpr size_t SCRUB_CLUSTER_SIZE = 0x8000;  // Matches CLUSTER_SIZE in DiscScrubber.cpp.
+  DiscScrubber disc_scrubber;
+  if (sub_type == 1)
+  {
+    if (block_size % SCRUB_CLUSTER_SIZE != 0 ||
+        !disc_scrubber.SetupScrub(infile_path, SCRUB_CLUSTER_SIZE))
+    {
+      PanicAlertT("\"%s\" failed to be scrubbed. Probably the image is corrupt.",
+                  infile_path.c_str());
+      return false;
+    }
+
+    scrubbing = true;
+  }
+
+  callback(GetStringT("Files opened, ready to compress."), 0, arg);
+
+  LZOBlobHeader header;
+  header.magic_cookie = LZB_MAGIC;
+  header.sub_type = sub_type;
+  header.block_size = block_size;
+  header.data_size = infile.GetSize();
+  header.version = 1;
+  header.reserved = 0;
+
+  // round upwards!
+  header.num_blocks = (u32)((header.data_size + (block_size - 1)) / block_size);
+
+  std::vector<u64> offsets(header.num_blocks);
+  std::vector<u64> hashes(header.num_blocks);
+
+  // seek past the header (we will write it at the end)
+  outfile.Seek(sizeof(LZOBlobHeader), SEEK_CUR);
+  // seek past the offset and hash tables (we will write them at the end)
+  outfile.Seek((sizeof(u64) + sizeof(u64)) * header.num_blocks, SEEK_CUR);
+  // seek to the start of the input file to make sure we get everything
+  infile.Seek(0, SEEK_SET);
+
+  // Reading and writing stay sequential on this thread, but the compression
+  // itself is spread over a batch of blocks per iteration, one worker thread
+  // per core.
+  const u32 num_threads = std::max(1u, std::thread::hardware_concurrency());
+  const u32 batch_blocks = num_threads * 4;
+
+  std::vector<std::vector<u8>> in_bufs(batch_blocks);
+  std::vector<std::vector<u8>> out_bufs(batch_blocks);
+  std::vector<lzo_uint> comp_sizes(batch_blocks);
+  std::vector<u8> block_stored(batch_blocks);
+  for (u32 i = 0; i < batch_blocks; i++)
+  {
+    in_bufs[i].resize(block_size);
+    out_bufs[i].resize(WorstCaseCompressedSize(block_size));
+  }
+
+  // Now we are ready to write compressed data!
+  u64 position = 0;
+  bool success = true;
+
+  for (u32 first_block = 0; first_block < header.num_blocks && success;
+       first_block += batch_blocks)
+  {
+    const u32 blocks_in_batch = std::min(batch_blocks, header.num_blocks - first_block);
+
+    {
+      const u64 inpos = infile.Tell();
+      int ratio = 0;
+      if (inpos != 0)
+        ratio = (int)(100 * position / inpos);
+
+      std::string temp =
+          StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(),
+                           first_block, header.num_blocks, ratio);
+      bool was_cancelled =
+          !callback(temp, (float)first_block / (float)header.num_blocks, arg);
+      if (was_cancelled)
+      {
+        success = false;
+        break;
+      }
+    }
+
+    for (u32 i = 0; i < blocks_in_batch; i++)
+    {
+      if (scrubbing)
+      {
+        for (u32 c = 0; c < header.block_size / SCRUB_CLUSTER_SIZE; c++)
+        {
+          u8* cluster_ptr = in_bufs[i].data() + c * SCRUB_CLUSTER_SIZE;
+          const size_t read_bytes = disc_scrubber.GetNextBlock(infile, cluster_ptr);
+          if (read_bytes < SCRUB_CLUSTER_SIZE)
+            std::fill(cluster_ptr + read_bytes, cluster_ptr + SCRUB_CLUSTER_SIZE, 0);
+        }
+      }
+      else
+      {
+        size_t read_bytes;
+        infile.ReadArray(in_bufs[i].data(), header.block_size, &read_bytes);
+        if (read_bytes < header.block_size)
+          std::fill(in_bufs[i].begin() + read_bytes, in_bufs[i].begin() + header.block_size, 0);
+      }
+    }
+
+    std::atomic<u32> next_block{0};
+    std::vector<std::thread> workers;
+    for (u32 t = 0; t < std::min(num_threads, blocks_in_batch); t++)
+    {
+      workers.emplace_back([&] {
+        std::vector<lzo_align_t> wrkmem(
+            (LZO1X_1_MEM_COMPRESS + sizeof(lzo_align_t) - 1) / sizeof(lzo_align_t));
+        u32 i;
+        while ((i = next_block.fetch_add(1)) < blocks_in_batch)
+        {
+          lzo_uint out_len = 0;
+          if (lzo1x_1_compress(in_bufs[i].data(), header.block_size, out_bufs[i].data(), &out_len,
+                               wrkmem.data()) != LZO_E_OK ||
+              out_len >= header.block_size)
+          {
+            // Let's store uncompressed; hash what will actually be written.
+            block_stored[i] = 1;
+            hashes[first_block + i] = GetMurmurHash3(in_bufs[i].data(), header.block_size, 0);
+          }
+          else
+          {
+            block_stored[i] = 0;
+            comp_sizes[i] = out_len;
+            hashes[first_block + i] = GetMurmurHash3(out_bufs[i].data(), (u32)out_len, 0);
+          }
+        }
+      });
+    }
+    for (auto& worker : workers)
+      worker.join();
+
+    for (u32 i = 0; i < blocks_in_batch; i++)
+    {
+      offsets[first_block + i] = position;
+
+      u8* write_buf;
+      u32 write_size;
+      if (block_stored[i])
+      {
+        write_buf = in_bufs[i].data();
+        offsets[first_block + i] |= 0x8000000000000000ULL;
+        write_size = header.block_size;
+      }
+      else
+      {
+        write_buf = out_bufs[i].data();
+        write_size = (u32)comp_sizes[i];
+      }
+
+      if (!outfile.WriteBytes(write_buf, write_size))
+      {
+        PanicAlertT("Failed to write the output file \"%s\".\n"
+                    "Check that you have enough space available on the target drive.",
+                    outfile_path.c_str());
+        success = false;
+        break;
+      }
+
+      position += write_size;
+    }
+  }
+
+  header.compressed_data_size = position;
+
+  if (!success)
+  {
+    // Remove the incomplete output file.
+    outfile.Close();
+    File::Delete(outfile_path);
+  }
+  else
+  {
+    // Okay, go back and fill in headers
+    outfile.Seek(0, SEEK_SET);
+    outfile.WriteArray(&header, 1);
+    outfile.WriteArray(offsets.data(), header.num_blocks);
+    outfile.WriteArray(hashes.data(), header.num_blocks);
+
+    callback(GetStringT("Done compressing disc image."), 1.0f, arg);
+  }
+
+  return success;
+}
+
+bool IsLZOBlob(File::IOFile& file)
+{
+  const u64 position = file.Tell();
+  if (!file.Seek(0, SEEK_SET))
+    return false;
+  LZOBlobHeader header;
+  bool is_lzb = file.ReadArray(&header, 1) && header.magic_cookie == LZB_MAGIC;
+  file.Seek(position, SEEK_SET);
+  return is_lzb;
+}
+
+}  // namespace
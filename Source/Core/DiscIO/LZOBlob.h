@@ -0,0 +1,81 @@
+// Copyright 2008 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// WARNING Code not big-endian safe.
+
+// To create new LZO-compressed BLOBs, use CompressFileToLZOBlob.
+
+// A faster sibling of the GCZ format (see CompressedBlob.h): same overall
+// layout of header, block pointer table and data, but with much larger blocks,
+// LZO1X instead of zlib (roughly an order of magnitude faster to decompress)
+// and a 64-bit hash per stored block.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "DiscIO/Blob.h"
+
+namespace DiscIO
+{
+static constexpr u32 LZB_MAGIC = 0xB10BFA57;
+
+// LZB file structure:
+// LZOBlobHeader
+// u64 offsetsToBlocks[n], top bit specifies whether the block is compressed, or not.
+// u64 hashes[n], hash of the stored (possibly compressed) block data.
+// compressed data
+
+// Blocks that don't get any smaller from compression are stored as-is.
+struct LZOBlobHeader  // 40 bytes
+{
+  u32 magic_cookie;  // 0xB10BFA57
+  u32 sub_type;      // GC image, whatever
+  u64 compressed_data_size;
+  u64 data_size;
+  u32 block_size;
+  u32 num_blocks;
+  u32 version;  // 1
+  u32 reserved;
+};
+
+class LZOBlobReader : public SectorReader
+{
+public:
+  static std::unique_ptr<LZOBlobReader> Create(File::IOFile file, const std::string& filename);
+  ~LZOBlobReader();
+  const LZOBlobHeader& GetHeader() const { return m_header; }
+  BlobType GetBlobType() const override { return BlobType::LZO; }
+  u64 GetDataSize() const override { return m_header.data_size; }
+  u64 GetRawSize() const override { return m_file_size; }
+  u64 GetBlockCompressedSize(u64 block_num) const;
+  bool GetBlock(u64 block_num, u8* out_ptr) override;
+
+private:
+  LZOBlobReader(File::IOFile file, const std::string& filename);
+
+  LZOBlobHeader m_header;
+  std::vector<u64> m_block_pointers;
+  std::vector<u64> m_hashes;
+  int m_data_offset;
+  File::IOFile m_file;
+  u64 m_file_size;
+  std::vector<u8> m_lzo_buffer;
+  std::string m_file_name;
+};
+
+bool IsLZOBlob(File::IOFile& file);
+
+// Compresses all worker threads' worth of blocks in parallel; the default
+// block size is chosen so streaming reads stay cheap while keeping the block
+// pointer table small.
+bool CompressFileToLZOBlob(const std::string& infile_path, const std::string& outfile_path,
+                           u32 sub_type = 0, int block_size = 512 * 1024,
+                           CompressCB callback = nullptr, void* arg = nullptr);
+
+}  // namespace
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <map>
@@ -22,6 +23,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
@@ -36,11 +38,12 @@ namespace DiscIO
 constexpr u64 PARTITION_DATA_OFFSET = 0x20000;
 
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
-    : m_pReader(std::move(reader)), m_game_partition(PARTITION_NONE),
-      m_last_decrypted_block(UINT64_MAX)
+    : m_pReader(std::move(reader)), m_game_partition(PARTITION_NONE)
 {
   ASSERT(m_pReader);
 
+  std::fill(std::begin(m_cached_blocks), std::end(m_cached_blocks), UINT64_MAX);
+
   if (m_pReader->ReadSwapped<u32>(0x60) != u32(0))
   {
     // No partitions - just read unencrypted data like with a GC disc
@@ -148,27 +151,62 @@ bool VolumeWii::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, const Partition
   if (!aes_context)
     return false;
 
-  std::vector<u8> read_buffer(BLOCK_TOTAL_SIZE);
+  std::vector<u8> read_buffer;
   while (_Length > 0)
   {
     // Calculate offsets
-    u64 block_offset_on_disc =
-        partition.offset + PARTITION_DATA_OFFSET + _ReadOffset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
+    u64 block_index = _ReadOffset / BLOCK_DATA_SIZE;
+    u64 block_offset_on_disc = partition.offset + PARTITION_DATA_OFFSET +
+        block_index * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = _ReadOffset % BLOCK_DATA_SIZE;
+    u32 slot = static_cast<u32>(block_index % BLOCK_CACHE_SIZE);
 
-    if (m_last_decrypted_block != block_offset_on_disc)
+    if (m_cached_blocks[slot] != block_offset_on_disc)
     {
-      // Read the current block
-      if (!m_pReader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.data()))
+      // Fetch the run of consecutive blocks this read still needs with one
+      // blob read, then decrypt them. Consecutive block indices map to
+      // distinct cache slots as long as the run is no longer than the cache.
+      u64 blocks_remaining =
+          (data_offset_in_block + _Length + BLOCK_DATA_SIZE - 1) / BLOCK_DATA_SIZE;
+      u32 run = static_cast<u32>(std::min<u64>(blocks_remaining, BLOCK_CACHE_SIZE));
+      read_buffer.resize(run * static_cast<size_t>(BLOCK_TOTAL_SIZE));
+      if (!m_pReader->Read(block_offset_on_disc, read_buffer.size(), read_buffer.data()))
         return false;
 
-      // Decrypt the block's data.
+      // Decrypt a block's data into its cache slot.
       // 0x3D0 - 0x3DF in read_buffer will be overwritten,
       // but that won't affect anything, because we won't
       // use the content of read_buffer anymore after this
-      mbedtls_aes_crypt_cbc(aes_context, MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE, &read_buffer[0x3D0],
-                            &read_buffer[BLOCK_HEADER_SIZE], m_last_decrypted_block_data);
-      m_last_decrypted_block = block_offset_on_disc;
+      auto decrypt_block = [&](u32 i) {
+        u8* raw = &read_buffer[i * static_cast<size_t>(BLOCK_TOTAL_SIZE)];
+        u32 dst_slot = static_cast<u32>((block_index + i) % BLOCK_CACHE_SIZE);
+        mbedtls_aes_crypt_cbc(aes_context, MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE, &raw[0x3D0],
+                              &raw[BLOCK_HEADER_SIZE], m_cached_block_data[dst_slot]);
+        m_cached_blocks[dst_slot] = block_offset_on_disc + i * BLOCK_TOTAL_SIZE;
+      };
+
+      // CBC chains only within a block, so blocks decrypt independently.
+      // The AES context is read-only during decryption, which makes it safe
+      // to share across the pool workers.
+      if (run >= 4)
+      {
+        std::atomic<u32> finished_blocks{0};
+        for (u32 i = 0; i < run; i++)
+        {
+          Common::AsyncWorker::ExecuteAsync([&, i]() {
+            decrypt_block(i);
+            finished_blocks.fetch_add(1);
+          });
+        }
+        u32 loopcount = 0;
+        while (finished_blocks.load() < run)
+          Common::cYield(loopcount++);
+      }
+      else
+      {
+        for (u32 i = 0; i < run; i++)
+          decrypt_block(i);
+      }
 
       // The only thing we currently use from the 0x000 - 0x3FF part
       // of the block is the IV (at 0x3D0), but it also contains SHA-1
@@ -178,7 +216,7 @@ bool VolumeWii::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, const Partition
 
     // Copy the decrypted data
     u64 copy_size = std::min(_Length, BLOCK_DATA_SIZE - data_offset_in_block);
-    memcpy(_pBuffer, &m_last_decrypted_block_data[data_offset_in_block],
+    memcpy(_pBuffer, &m_cached_block_data[slot][data_offset_in_block],
            static_cast<size_t>(copy_size));
 
     // Update offsets
@@ -77,12 +77,17 @@ private:
     u32 type;
   };
 
+  // Direct-mapped cache of decrypted partition blocks, indexed by disc block
+  // number. Runs of consecutive blocks are read and decrypted in one batch,
+  // so its size also bounds how many blocks one batch may cover.
+  static constexpr unsigned int BLOCK_CACHE_SIZE = 32;
+
   std::unique_ptr<BlobReader> m_pReader;
   std::map<Partition, PartitionDetails> m_partitions;
   Partition m_game_partition;
 
-  mutable u64 m_last_decrypted_block;
-  mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE];
+  mutable u64 m_cached_blocks[BLOCK_CACHE_SIZE];
+  mutable u8 m_cached_block_data[BLOCK_CACHE_SIZE][BLOCK_DATA_SIZE];
 };
 
 }  // namespace
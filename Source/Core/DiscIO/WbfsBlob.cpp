@@ -28,7 +28,7 @@ static const u64 WII_DISC_HEADER_SIZE = 256;
 WbfsFileReader::WbfsFileReader(File::IOFile file, const std::string& path)
     : m_size(0), m_good(false)
 {
-  if (!AddFileToList(std::move(file)))
+  if (!AddFileToList(std::move(file), path))
     return;
   OpenAdditionalFiles(path);
   if (!ReadHeader())
@@ -67,18 +67,19 @@ void WbfsFileReader::OpenAdditionalFiles(const std::string& path)
       return;
     std::string current_path = path;
     current_path.back() = static_cast<char>('0' + m_files.size());
-    if (!AddFileToList(File::IOFile(current_path, "rb")))
+    if (!AddFileToList(File::IOFile(current_path, "rb"), current_path))
       return;
   }
 }
 
-bool WbfsFileReader::AddFileToList(File::IOFile file)
+bool WbfsFileReader::AddFileToList(File::IOFile file, const std::string& path)
 {
   if (!file.IsOpen())
     return false;
 
   const u64 file_size = file.GetSize();
   m_files.emplace_back(std::move(file), m_size, file_size);
+  m_files.back().mapping = Common::MappedFile::Open(path);
   m_size += file_size;
 
   return true;
@@ -117,16 +118,25 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
   while (nbytes)
   {
-    u64 read_size;
-    File::IOFile& data_file = SeekToCluster(offset, &read_size);
-    if (read_size == 0)
+    u64 file_offset;
+    u64 available;
+    FileEntry* file_entry = TranslateOffset(offset, &file_offset, &available);
+    if (!file_entry)
       return false;
-    read_size = std::min(read_size, nbytes);
+    const u64 read_size = std::min(available, nbytes);
 
-    if (!data_file.ReadBytes(out_ptr, read_size))
+    if (file_entry->mapping && file_offset + read_size <= file_entry->mapping->Size())
     {
-      data_file.Clear();
-      return false;
+      std::memcpy(out_ptr, file_entry->mapping->Data() + file_offset, read_size);
+    }
+    else
+    {
+      file_entry->file.Seek(file_offset, SEEK_SET);
+      if (!file_entry->file.ReadBytes(out_ptr, read_size))
+      {
+        file_entry->file.Clear();
+        return false;
+      }
     }
 
     out_ptr += read_size;
@@ -137,7 +147,8 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   return true;
 }
 
-File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64* available)
+WbfsFileReader::FileEntry* WbfsFileReader::TranslateOffset(u64 offset, u64* file_offset,
+                                                           u64* available)
 {
   u64 base_cluster = (offset >> m_header.wbfs_sector_shift);
   if (base_cluster < m_blocks_per_disc)
@@ -146,28 +157,31 @@ File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64* available)
     u64 cluster_offset = offset & (m_wbfs_sector_size - 1);
     u64 final_address = cluster_address + cluster_offset;
 
+    // Extend the run over wbfs sectors that are stored back to back, so a
+    // large read becomes one host read instead of one read per sector.
+    // Sequentially written discs are mostly contiguous.
+    u64 run_end_cluster = base_cluster + 1;
+    while (run_end_cluster < m_blocks_per_disc &&
+           m_wlba_table[run_end_cluster] == m_wlba_table[run_end_cluster - 1] + 1)
+    {
+      run_end_cluster++;
+    }
+
     for (FileEntry& file_entry : m_files)
     {
       if (final_address < (file_entry.base_address + file_entry.size))
       {
-        file_entry.file.Seek(final_address - file_entry.base_address, SEEK_SET);
-        if (available)
-        {
-          u64 till_end_of_file = file_entry.size - (final_address - file_entry.base_address);
-          u64 till_end_of_sector = m_wbfs_sector_size - cluster_offset;
-          *available = std::min(till_end_of_file, till_end_of_sector);
-        }
-
-        return file_entry.file;
+        *file_offset = final_address - file_entry.base_address;
+        u64 till_end_of_file = file_entry.size - *file_offset;
+        u64 till_end_of_run = (run_end_cluster << m_header.wbfs_sector_shift) - offset;
+        *available = std::min(till_end_of_file, till_end_of_run);
+        return &file_entry;
       }
     }
   }
 
   PanicAlert("Read beyond end of disc");
-  if (available)
-    *available = 0;
-  m_files[0].file.Seek(0, SEEK_SET);
-  return m_files[0].file;
+  return nullptr;
 }
 
 std::unique_ptr<WbfsFileReader> WbfsFileReader::Create(File::IOFile file, const std::string& path)
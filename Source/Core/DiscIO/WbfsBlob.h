@@ -10,6 +10,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -36,10 +37,9 @@ private:
   WbfsFileReader(File::IOFile file, const std::string& path);
 
   void OpenAdditionalFiles(const std::string& path);
-  bool AddFileToList(File::IOFile file);
+  bool AddFileToList(File::IOFile file, const std::string& path);
   bool ReadHeader();
 
-  File::IOFile& SeekToCluster(u64 offset, u64* available);
   bool IsGood() { return m_good; }
   struct FileEntry
   {
@@ -49,10 +49,20 @@ private:
     }
 
     File::IOFile file;
+    // Shared read-only mapping of the same file; reads are served from it
+    // when it could be established, leaving read-ahead to the OS page cache.
+    // file remains the fallback.
+    std::unique_ptr<Common::MappedFile> mapping;
     u64 base_address;
     u64 size;
   };
 
+  // Translates a disc offset to the split file and file offset holding it.
+  // available receives the number of bytes readable as one contiguous host
+  // read; physically consecutive wbfs sectors are coalesced into one run.
+  // Returns nullptr for reads beyond the end of the disc.
+  FileEntry* TranslateOffset(u64 offset, u64* file_offset, u64* available);
+
   std::vector<FileEntry> m_files;
 
   u64 m_size;
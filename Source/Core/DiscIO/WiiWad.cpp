@@ -83,8 +83,10 @@ bool WiiWAD::ParseWAD()
   offset += Common::AlignUp(*ticket_size, 0x40);
   m_tmd.SetBytes(CreateWADEntry(*m_reader, *tmd_size, offset));
   offset += Common::AlignUp(*tmd_size, 0x40);
+  // The data app is not read here; GetContent streams individual contents
+  // from the reader on demand, so there is no point pulling the whole blob
+  // (potentially hundreds of MiB) into memory just to open the WAD.
   m_data_app_offset = offset;
-  m_data_app = CreateWADEntry(*m_reader, *data_app_size, offset);
   offset += Common::AlignUp(*data_app_size, 0x40);
   m_footer = CreateWADEntry(*m_reader, *footer_size, offset);
   offset += Common::AlignUp(*footer_size, 0x40);
@@ -28,7 +28,6 @@ public:
   const std::vector<u8>& GetCertificateChain() const { return m_certificate_chain; }
   const IOS::ES::TicketReader& GetTicket() const { return m_ticket; }
   const IOS::ES::TMDReader& GetTMD() const { return m_tmd; }
-  const std::vector<u8>& GetDataApp() const { return m_data_app; }
   const std::vector<u8>& GetFooter() const { return m_footer; }
   std::vector<u8> GetContent(u16 index) const;
 
@@ -43,7 +42,6 @@ private:
   std::vector<u8> m_certificate_chain;
   IOS::ES::TicketReader m_ticket;
   IOS::ES::TMDReader m_tmd;
-  std::vector<u8> m_data_app;
   std::vector<u8> m_footer;
 };
 }
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <optional>
 #include <signal.h>
 #include <string>
 #include <thread>
@@ -22,11 +23,15 @@
 #include "Core/BootManager.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/STM/STM.h"
+#include "Core/Movie.h"
 #include "Core/State.h"
 
+#include "RegressionRunner.h"
+
 #include "UICommon/CommandLineParse.h"
 #include "UICommon/UICommon.h"
 
@@ -398,6 +403,53 @@ int main(int argc, char* argv[])
     user_directory = static_cast<const char*>(options.get("user"));
   }
 
+  // Headless FIFO benchmark: loops a .dff capture and writes timing statistics.
+  if (options.is_set("benchmark_loops"))
+  {
+    const int loops = static_cast<int>(options.get("benchmark_loops"));
+    if (loops <= 0)
+    {
+      fprintf(stderr, "benchmark_loops must be positive\n");
+      return 1;
+    }
+    std::string benchmark_output = "fifo_benchmark.json";
+    if (options.is_set("benchmark_output"))
+      benchmark_output = static_cast<const char*>(options.get("benchmark_output"));
+    FifoPlayer::GetInstance().SetBenchmarkMode(static_cast<u32>(loops), benchmark_output);
+    if (options.is_set("benchmark_skip"))
+    {
+      const std::string skip_class = static_cast<const char*>(options.get("benchmark_skip"));
+      if (!FifoPlayer::GetInstance().SetBenchmarkSkipClass(skip_class))
+      {
+        fprintf(stderr, "Unknown state write class '%s'\n", skip_class.c_str());
+        return 1;
+      }
+    }
+  }
+
+  // Headless regression run: savestate in, N frames with fixed input, report out.
+  RegressionRunner::Config regression;
+  std::string regression_movie;
+  if (options.is_set("regression_frames"))
+  {
+    const int frames = static_cast<int>(options.get("regression_frames"));
+    if (frames <= 0)
+    {
+      fprintf(stderr, "regression_frames must be positive\n");
+      return 1;
+    }
+    regression.frames = static_cast<u64>(frames);
+    regression.report_path = "regression_report.json";
+    if (options.is_set("regression_output"))
+      regression.report_path = static_cast<const char*>(options.get("regression_output"));
+    if (options.is_set("regression_save"))
+      regression.savestate = static_cast<const char*>(options.get("regression_save"));
+    if (options.is_set("regression_trace"))
+      regression.trace_path = static_cast<const char*>(options.get("regression_trace"));
+    if (options.is_set("regression_movie"))
+      regression_movie = static_cast<const char*>(options.get("regression_movie"));
+  }
+
   platform = GetPlatform();
   if (!platform)
   {
@@ -424,6 +476,20 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance()->ReportDolphinStart("nogui");
 
+  if (!regression_movie.empty())
+  {
+    std::optional<std::string> movie_savestate;
+    if (!Movie::PlayInput(regression_movie, &movie_savestate))
+    {
+      fprintf(stderr, "Could not play movie %s\n", regression_movie.c_str());
+      return 1;
+    }
+    // A movie recorded from a savestate names the state it needs; let an
+    // explicit --regression_save override it.
+    if (movie_savestate && regression.savestate.empty())
+      regression.savestate = *movie_savestate;
+  }
+
   if (!BootManager::BootCore(std::move(boot)))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -436,10 +502,14 @@ int main(int argc, char* argv[])
     updateMainFrameEvent.Wait();
   }
 
+  if (regression.frames != 0)
+    RegressionRunner::Start(std::move(regression));
+
   if (s_running.IsSet())
     platform->MainLoop();
   Core::Stop();
 
+  RegressionRunner::Shutdown();
   Core::Shutdown();
   platform->Shutdown();
   UICommon::Shutdown();
@@ -0,0 +1,110 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "RegressionRunner.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "Common/File.h"
+#include "Common/Hash.h"
+#include "Common/Profiler.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/Host.h"
+#include "Core/Movie.h"
+#include "Core/State.h"
+
+namespace RegressionRunner
+{
+static std::thread s_monitor_thread;
+
+static void MonitorThread(Config config)
+{
+  // The frontend starts us once booting is under way; wait for the core to
+  // actually run before touching savestates.
+  while (Core::GetState() != Core::State::Running)
+  {
+    if (Core::GetState() == Core::State::Uninitialized)
+      return;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  if (!config.savestate.empty())
+  {
+    State::LoadAs(config.savestate);
+    State::Flush();
+  }
+
+  // Movie::FrameUpdate() runs on every VI frame whether or not a movie is
+  // active, so the frame counter works as a retired-frame count here.
+  const u64 start_frame = Movie::GetCurrentFrame();
+  const u64 start_us = Common::Timer::GetTimeUs();
+  if (!config.trace_path.empty())
+    Common::Tracer::Start();
+
+  while (Core::GetState() == Core::State::Running &&
+         Movie::GetCurrentFrame() - start_frame < config.frames)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  const u64 elapsed_us = Common::Timer::GetTimeUs() - start_us;
+  const u64 frames_run = Movie::GetCurrentFrame() - start_frame;
+
+  if (!config.trace_path.empty())
+    Common::Tracer::Stop(config.trace_path);
+
+  // Hash emulated RAM with the CPU paused for the determinism check.
+  u64 ram_hash = 0;
+  u64 exram_hash = 0;
+  Core::RunAsCPUThread([&] {
+    ram_hash = GetHash64(Memory::m_pRAM, Memory::RAM_SIZE, 0);
+    if (SConfig::GetInstance().bWii)
+      exram_hash = GetHash64(Memory::m_pEXRAM, Memory::EXRAM_SIZE, 0);
+  });
+
+  std::string report = "{\n";
+  report +=
+      StringFromFormat("  \"game_id\": \"%s\",\n", SConfig::GetInstance().GetGameID().c_str());
+  report += StringFromFormat("  \"savestate\": \"%s\",\n", config.savestate.c_str());
+  report += StringFromFormat("  \"movie\": %s,\n", Movie::IsPlayingInput() ? "true" : "false");
+  report += StringFromFormat("  \"frames\": %llu,\n", static_cast<unsigned long long>(frames_run));
+  report +=
+      StringFromFormat("  \"wall_time_us\": %llu,\n", static_cast<unsigned long long>(elapsed_us));
+  report += StringFromFormat("  \"vps\": %.2f,\n",
+                             elapsed_us != 0 ? frames_run * 1000000.0 / elapsed_us : 0.0);
+  report += StringFromFormat("  \"ram_hash\": \"%016llx\",\n",
+                             static_cast<unsigned long long>(ram_hash));
+  report += StringFromFormat("  \"exram_hash\": \"%016llx\"",
+                             static_cast<unsigned long long>(exram_hash));
+  if (!config.trace_path.empty())
+    report += StringFromFormat(",\n  \"trace\": \"%s\"", config.trace_path.c_str());
+  report += "\n}\n";
+
+  File::IOFile file(config.report_path, "wb");
+  if (file.IsOpen() && file.WriteBytes(report.data(), report.size()))
+    printf("Regression report written to %s\n", config.report_path.c_str());
+  else
+    fprintf(stderr, "Failed to write regression report to %s\n", config.report_path.c_str());
+
+  Host_Message(WM_USER_STOP);
+}
+
+void Start(Config config)
+{
+  s_monitor_thread = std::thread(MonitorThread, std::move(config));
+}
+
+void Shutdown()
+{
+  if (s_monitor_thread.joinable())
+    s_monitor_thread.join();
+}
+}
@@ -0,0 +1,28 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace RegressionRunner
+{
+struct Config
+{
+  u64 frames = 0;
+  std::string savestate;
+  std::string report_path;
+  std::string trace_path;
+};
+
+// Spawns a monitor thread that waits for the core to run, optionally loads a
+// savestate, lets the configured number of frames retire, writes the report
+// and then requests emulator shutdown via Host_Message(WM_USER_STOP).
+void Start(Config config);
+
+// Joins the monitor thread. Call during frontend shutdown.
+void Shutdown();
+}
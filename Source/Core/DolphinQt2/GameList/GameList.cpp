@@ -36,6 +36,16 @@
 
 static bool CompressCB(const std::string&, float, void*);
 
+// Progress state for the batch conversion queue: every file owns a fixed
+// span of the dialog's range so the bar keeps moving forwards across files.
+struct BatchCompressProgress
+{
+  QProgressDialog* dialog;
+  int base;
+};
+
+static bool BatchCompressCB(const std::string& text, float percent, void* ptr);
+
 GameList::GameList(QWidget* parent) : QStackedWidget(parent)
 {
   m_model = Settings::Instance().GetGameListModel();
@@ -67,7 +77,7 @@ void GameList::MakeListView()
   m_list = new QTableView(this);
   m_list->setModel(m_list_proxy);
 
-  m_list->setSelectionMode(QAbstractItemView::SingleSelection);
+  m_list->setSelectionMode(QAbstractItemView::ExtendedSelection);
   m_list->setSelectionBehavior(QAbstractItemView::SelectRows);
   m_list->setAlternatingRowColors(true);
   m_list->setShowGrid(false);
@@ -147,6 +157,7 @@ void GameList::MakeGridView()
   m_grid->setViewMode(QListView::IconMode);
   m_grid->setResizeMode(QListView::Adjust);
   m_grid->setUniformItemSizes(true);
+  m_grid->setSelectionMode(QAbstractItemView::ExtendedSelection);
   m_grid->setContextMenuPolicy(Qt::CustomContextMenu);
   m_grid->setFrameStyle(QFrame::NoFrame);
   connect(m_grid, &QTableView::customContextMenuRequested, this, &GameList::ShowContextMenu);
@@ -158,9 +169,21 @@ void GameList::MakeGridView()
 
 void GameList::ShowContextMenu(const QPoint&)
 {
-  const auto game = GetSelectedGame();
-  if (!game)
+  const auto games = GetSelectedGames();
+  if (games.isEmpty())
+    return;
+
+  // With several games selected, offer the batch conversion queue instead of
+  // the per-game actions.
+  if (games.size() > 1)
+  {
+    QMenu* batch_menu = new QMenu(this);
+    AddAction(batch_menu, tr("Convert Selected ISOs..."), this, &GameList::ConvertSelectedISOs);
+    batch_menu->exec(QCursor::pos());
     return;
+  }
+
+  const auto game = games[0];
 
   QMenu* menu = new QMenu(this);
   DiscIO::Platform platform = game->GetPlatform();
@@ -173,7 +196,7 @@ void GameList::ShowContextMenu(const QPoint&)
     AddAction(menu, tr("Set as &default ISO"), this, &GameList::SetDefaultISO);
     const auto blob_type = game->GetBlobType();
 
-    if (blob_type == DiscIO::BlobType::GCZ)
+    if (blob_type == DiscIO::BlobType::GCZ || blob_type == DiscIO::BlobType::LZO)
       AddAction(menu, tr("Decompress ISO..."), this, &GameList::CompressISO);
     else if (blob_type == DiscIO::BlobType::PLAIN)
       AddAction(menu, tr("Compress ISO..."), this, &GameList::CompressISO);
@@ -276,7 +299,8 @@ void GameList::CompressISO()
   auto file = GetSelectedGame();
   const auto original_path = file->GetFilePath();
 
-  const bool compressed = (file->GetBlobType() == DiscIO::BlobType::GCZ);
+  const bool compressed = file->GetBlobType() == DiscIO::BlobType::GCZ ||
+                          file->GetBlobType() == DiscIO::BlobType::LZO;
 
   if (!compressed && file->GetPlatform() == DiscIO::Platform::WiiDisc)
   {
@@ -321,6 +345,13 @@ void GameList::CompressISO()
     good = DiscIO::CompressFileToBlob(original_path, dst_path.toStdString(),
                                       file->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0,
                                       16384, &CompressCB, &progress_dialog);
+
+    if (good)
+    {
+      QProgressDialog verify_dialog(tr("Verifying..."), tr("Abort"), 0, 100, this);
+      verify_dialog.setWindowModality(Qt::WindowModal);
+      good = DiscIO::VerifyBlobIntegrity(dst_path.toStdString(), &CompressCB, &verify_dialog);
+    }
   }
 
   if (good)
@@ -335,6 +366,118 @@ void GameList::CompressISO()
   }
 }
 
+void GameList::ConvertSelectedISOs()
+{
+  QList<std::shared_ptr<const UICommon::GameFile>> queue;
+  bool wii_warning_needed = false;
+  for (const auto& game : GetSelectedGames())
+  {
+    if (game->GetPlatform() != DiscIO::Platform::GameCubeDisc &&
+        game->GetPlatform() != DiscIO::Platform::WiiDisc)
+      continue;
+    const auto blob_type = game->GetBlobType();
+    if (blob_type != DiscIO::BlobType::PLAIN && blob_type != DiscIO::BlobType::GCZ &&
+        blob_type != DiscIO::BlobType::LZO)
+      continue;
+    if (blob_type == DiscIO::BlobType::PLAIN &&
+        game->GetPlatform() == DiscIO::Platform::WiiDisc)
+      wii_warning_needed = true;
+    queue.push_back(game);
+  }
+
+  if (queue.isEmpty())
+    return;
+
+  if (wii_warning_needed)
+  {
+    QMessageBox wii_warning(this);
+    wii_warning.setIcon(QMessageBox::Warning);
+    wii_warning.setText(tr("Are you sure?"));
+    wii_warning.setInformativeText(
+        tr("Compressing a Wii disc image will irreversibly change the compressed copy by removing "
+           "padding data. Your disc image will still work. Continue?"));
+    wii_warning.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+
+    if (wii_warning.exec() == QMessageBox::No)
+      return;
+  }
+
+  QString dst_dir = QFileDialog::getExistingDirectory(
+      this, tr("Select where you want to save the converted images"),
+      QFileInfo(QString::fromStdString(queue[0]->GetFilePath())).dir().absolutePath());
+
+  if (dst_dir.isEmpty())
+    return;
+
+  // Each file gets 200 progress units: conversion, then the verification
+  // pass for newly written GCZ files.
+  QProgressDialog progress_dialog(tr("Converting..."), tr("Abort"), 0, queue.size() * 200, this);
+  progress_dialog.setWindowModality(Qt::WindowModal);
+
+  int converted = 0;
+  QStringList skipped;
+  QStringList failed;
+  for (int i = 0; i < queue.size(); i++)
+  {
+    const auto& game = queue[i];
+    const bool compressed = game->GetBlobType() != DiscIO::BlobType::PLAIN;
+    const QString src_path = QString::fromStdString(game->GetFilePath());
+    const QString dst_path = QDir(dst_dir).absoluteFilePath(
+        QFileInfo(src_path).completeBaseName() +
+        (compressed ? QStringLiteral(".gcm") : QStringLiteral(".gcz")));
+
+    // The queue runs unattended, so never overwrite silently; report skipped
+    // files in the summary instead of stopping to ask.
+    if (QFileInfo::exists(dst_path))
+    {
+      skipped.push_back(dst_path);
+      progress_dialog.setValue((i + 1) * 200);
+      continue;
+    }
+
+    BatchCompressProgress progress{&progress_dialog, i * 200};
+    bool good;
+    if (compressed)
+    {
+      good = DiscIO::DecompressBlobToFile(src_path.toStdString(), dst_path.toStdString(),
+                                          &BatchCompressCB, &progress);
+    }
+    else
+    {
+      good = DiscIO::CompressFileToBlob(src_path.toStdString(), dst_path.toStdString(),
+                                        game->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0,
+                                        16384, &BatchCompressCB, &progress);
+      if (good)
+      {
+        progress.base += 100;
+        good = DiscIO::VerifyBlobIntegrity(dst_path.toStdString(), &BatchCompressCB, &progress);
+      }
+    }
+
+    if (progress_dialog.wasCanceled())
+      break;
+
+    if (good)
+      converted++;
+    else
+      failed.push_back(src_path);
+    progress_dialog.setValue((i + 1) * 200);
+  }
+  progress_dialog.setValue(queue.size() * 200);
+
+  QMessageBox summary(this);
+  summary.setIcon(failed.isEmpty() ? QMessageBox::Information : QMessageBox::Critical);
+  summary.setText(tr("Converted %1 of %2 images.").arg(converted).arg(queue.size()));
+  QStringList details;
+  if (!skipped.isEmpty())
+    details.push_back(tr("Skipped, output already exists:\n%1").arg(skipped.join(QStringLiteral("\n"))));
+  if (!failed.isEmpty())
+    details.push_back(tr("Failed to convert or verify:\n%1").arg(failed.join(QStringLiteral("\n"))));
+  if (!details.isEmpty())
+    summary.setInformativeText(details.join(QStringLiteral("\n\n")));
+  summary.exec();
+}
+
 void GameList::InstallWAD()
 {
   QMessageBox result_dialog(this);
@@ -454,6 +597,26 @@ std::shared_ptr<const UICommon::GameFile> GameList::GetSelectedGame() const
   return {};
 }
 
+QList<std::shared_ptr<const UICommon::GameFile>> GameList::GetSelectedGames() const
+{
+  QAbstractItemView* view;
+  QSortFilterProxyModel* proxy;
+  if (currentWidget() == m_list)
+  {
+    view = m_list;
+    proxy = m_list_proxy;
+  }
+  else
+  {
+    view = m_grid;
+    proxy = m_grid_proxy;
+  }
+  QList<std::shared_ptr<const UICommon::GameFile>> selection;
+  for (const QModelIndex& index : view->selectionModel()->selectedRows())
+    selection.push_back(m_model->GetGameFile(proxy->mapToSource(index).row()));
+  return selection;
+}
+
 void GameList::SetPreferredView(bool list)
 {
   m_prefer_list = list;
@@ -516,6 +679,17 @@ static bool CompressCB(const std::string& text, float percent, void* ptr)
   return !progress_dialog->wasCanceled();
 }
 
+static bool BatchCompressCB(const std::string& text, float percent, void* ptr)
+{
+  if (ptr == nullptr)
+    return false;
+  auto* progress = static_cast<BatchCompressProgress*>(ptr);
+
+  progress->dialog->setLabelText(QString::fromStdString(text));
+  progress->dialog->setValue(progress->base + static_cast<int>(percent * 100));
+  return !progress->dialog->wasCanceled();
+}
+
 void GameList::OnHeaderViewChanged()
 {
   Settings::GetQSettings().setValue(QStringLiteral("tableheader/state"),
@@ -23,6 +23,7 @@ class GameList final : public QStackedWidget
 public:
   explicit GameList(QWidget* parent = nullptr);
   std::shared_ptr<const UICommon::GameFile> GetSelectedGame() const;
+  QList<std::shared_ptr<const UICommon::GameFile>> GetSelectedGames() const;
 
   void SetListView() { SetPreferredView(true); }
   void SetGridView() { SetPreferredView(false); }
@@ -49,6 +50,7 @@ private:
   void UninstallWAD();
   void ExportWiiSave();
   void CompressISO();
+  void ConvertSelectedISOs();
   void ChangeDisc();
   void OnHeaderViewChanged();
 
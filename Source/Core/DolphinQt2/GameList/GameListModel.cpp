@@ -15,8 +15,18 @@
 
 const QSize GAMECUBE_BANNER_SIZE(96, 32);
 
-GameListModel::GameListModel(QObject* parent) : QAbstractTableModel(parent)
+GameListModel::GameListModel(QObject* parent)
+    : QAbstractTableModel(parent),
+      m_thumbnails([this](const std::string& path, const UICommon::GameThumbnail& thumbnail) {
+        // Runs on the thumbnail worker thread; QImage construction is safe
+        // there, QPixmap conversion has to wait until the UI thread.
+        QImage image;
+        if (!thumbnail.empty())
+          image = ToQImage(thumbnail.pixels, thumbnail.width, thumbnail.height);
+        emit ThumbnailReady(QString::fromStdString(path), image);
+      })
 {
+  connect(this, &GameListModel::ThumbnailReady, this, &GameListModel::OnThumbnailReady);
   connect(&m_tracker, &GameTracker::GameLoaded, this, &GameListModel::UpdateGame);
   connect(&m_tracker, &GameTracker::GameRemoved, this,
           [this](const QString& path) { RemoveGame(path.toStdString()); });
@@ -65,7 +75,7 @@ QVariant GameListModel::data(const QModelIndex& index, int role) const
     if (role == Qt::DecorationRole)
     {
       // GameCube banners are 96x32, but Wii banners are 192x64.
-      QPixmap banner = ToQPixmap(game.GetBannerImage());
+      QPixmap banner = m_banners.value(QString::fromStdString(game.GetFilePath()));
       if (banner.isNull())
         banner = Resources::GetMisc(Resources::BANNER_MISSING);
 
@@ -226,6 +236,17 @@ void GameListModel::UpdateGame(const std::shared_ptr<const UICommon::GameFile>&
     m_games[index] = game;
     emit dataChanged(createIndex(index, 0), createIndex(index + 1, columnCount(QModelIndex())));
   }
+  m_thumbnails.RequestThumbnail(game);
+}
+
+void GameListModel::OnThumbnailReady(const QString& path, const QImage& image)
+{
+  if (image.isNull())
+    return;
+  m_banners[path] = QPixmap::fromImage(image);
+  const int index = FindGame(path.toStdString());
+  if (index >= 0)
+    emit dataChanged(createIndex(index, COL_BANNER), createIndex(index, COL_BANNER));
 }
 
 void GameListModel::RemoveGame(const std::string& path)
@@ -237,6 +258,7 @@ void GameListModel::RemoveGame(const std::string& path)
   beginRemoveRows(QModelIndex(), entry, entry);
   m_games.removeAt(entry);
   endRemoveRows();
+  m_banners.remove(QString::fromStdString(path));
 }
 
 int GameListModel::FindGame(const std::string& path) const
@@ -8,10 +8,14 @@
 #include <string>
 
 #include <QAbstractTableModel>
+#include <QImage>
+#include <QMap>
+#include <QPixmap>
 #include <QString>
 
 #include "DolphinQt2/GameList/GameTracker.h"
 #include "UICommon/GameFile.h"
+#include "UICommon/ThumbnailCache.h"
 
 class GameListModel final : public QAbstractTableModel
 {
@@ -56,11 +60,21 @@ public:
   void UpdateGame(const std::shared_ptr<const UICommon::GameFile>& game);
   void RemoveGame(const std::string& path);
 
+signals:
+  // Emitted from the thumbnail worker thread; connect with a queued
+  // connection (the default for cross-thread signals).
+  void ThumbnailReady(const QString& path, const QImage& image);
+
 private:
+  void OnThumbnailReady(const QString& path, const QImage& image);
   // Index in m_games, or -1 if it isn't found
   int FindGame(const std::string& path) const;
 
   GameTracker m_tracker;
   QList<std::shared_ptr<const UICommon::GameFile>> m_games;
+  UICommon::ThumbnailCache m_thumbnails;
+  // Thumbnails that have been delivered, converted to pixmaps once instead of
+  // per paint.
+  QMap<QString, QPixmap> m_banners;
   QString m_term;
 };
@@ -6,6 +6,7 @@
 
 #include <vector>
 
+#include <QImage>
 #include <QPixmap>
 
 #include "Common/CommonTypes.h"
@@ -17,6 +18,11 @@ QPixmap ToQPixmap(const UICommon::GameBanner& banner)
 }
 
 QPixmap ToQPixmap(const std::vector<u32>& buffer, int width, int height)
+{
+  return QPixmap::fromImage(ToQImage(buffer, width, height));
+}
+
+QImage ToQImage(const std::vector<u32>& buffer, int width, int height)
 {
   QImage image(width, height, QImage::Format_RGB888);
   for (int y = 0; y < height; y++)
@@ -29,5 +35,5 @@ QPixmap ToQPixmap(const std::vector<u32>& buffer, int width, int height)
     }
   }
 
-  return QPixmap::fromImage(image);
+  return image;
 }
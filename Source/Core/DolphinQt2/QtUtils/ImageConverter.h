@@ -8,6 +8,7 @@
 
 #include "Common/CommonTypes.h"
 
+class QImage;
 class QPixmap;
 
 namespace UICommon
@@ -17,3 +18,5 @@ struct GameBanner;
 
 QPixmap ToQPixmap(const UICommon::GameBanner& banner);
 QPixmap ToQPixmap(const std::vector<u32>& buffer, int width, int height);
+// Unlike QPixmap, QImage may be created outside the UI thread.
+QImage ToQImage(const std::vector<u32>& buffer, int width, int height);
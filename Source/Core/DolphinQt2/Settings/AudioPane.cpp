@@ -71,6 +71,7 @@ void AudioPane::CreateWidgets()
   m_backend_label = new QLabel(tr("Audio Backend:"));
   m_backend_combo = new QComboBox();
   m_dolby_pro_logic = new QCheckBox(tr("Dolby Pro Logic II Decoder"));
+  m_hq_resampler = new QCheckBox(tr("High Quality Resampler"));
 
   if (m_latency_control_supported)
   {
@@ -84,11 +85,14 @@ void AudioPane::CreateWidgets()
 
   m_dolby_pro_logic->setToolTip(
       tr("Enables Dolby Pro Logic II emulation using 5.1 surround. Certain backends only."));
+  m_hq_resampler->setToolTip(
+      tr("Resamples audio with a cubic filter instead of linear interpolation."));
 
   backend_layout->addRow(m_backend_label, m_backend_combo);
   if (m_latency_control_supported)
     backend_layout->addRow(m_latency_label, m_latency_spin);
   backend_layout->addRow(m_dolby_pro_logic);
+  backend_layout->addRow(m_hq_resampler);
 
   auto* stretching_box = new QGroupBox(tr("Audio Stretching Settings"));
   auto* stretching_layout = new QGridLayout;
@@ -134,6 +138,7 @@ void AudioPane::ConnectWidgets()
   }
   connect(m_stretching_buffer_slider, &QSlider::valueChanged, this, &AudioPane::SaveSettings);
   connect(m_dolby_pro_logic, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
+  connect(m_hq_resampler, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
   connect(m_stretching_enable, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_hle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_lle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
@@ -176,6 +181,9 @@ void AudioPane::LoadSettings()
   if (m_latency_control_supported)
     m_latency_spin->setValue(SConfig::GetInstance().iLatency);
 
+  // HQ resampler
+  m_hq_resampler->setChecked(SConfig::GetInstance().m_audio_hq_resampler);
+
   // Stretch
   m_stretching_enable->setChecked(SConfig::GetInstance().m_audio_stretch);
   m_stretching_buffer_slider->setValue(SConfig::GetInstance().m_audio_stretch_max_latency);
@@ -216,6 +224,9 @@ void AudioPane::SaveSettings()
   if (m_latency_control_supported)
     SConfig::GetInstance().iLatency = m_latency_spin->value();
 
+  // HQ resampler
+  SConfig::GetInstance().m_audio_hq_resampler = m_hq_resampler->isChecked();
+
   // Stretch
   SConfig::GetInstance().m_audio_stretch = m_stretching_enable->isChecked();
   SConfig::GetInstance().m_audio_stretch_max_latency = m_stretching_buffer_slider->value();
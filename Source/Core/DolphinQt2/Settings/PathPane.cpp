@@ -39,7 +39,7 @@ void PathPane::BrowseDefaultGame()
 {
   QString file = QFileDialog::getOpenFileName(
       this, tr("Select a Game"), QDir::currentPath(),
-      tr("All GC/Wii files (*.elf *.dol *.gcm *.iso *.tgc *.wbfs *.ciso *.gcz *.wad);;"
+      tr("All GC/Wii files (*.elf *.dol *.gcm *.iso *.tgc *.wbfs *.ciso *.gcz *.lzb *.wad);;"
          "All Files (*)"));
   if (!file.isEmpty())
   {
@@ -52,6 +52,7 @@ void AudioConfigPane::InitializeGUI()
     m_audio_latency_label = new wxStaticText(this, wxID_ANY, _("Latency (ms):"));
   }
   m_stretch_checkbox = new wxCheckBox(this, wxID_ANY, _("Enable Audio Stretching"));
+  m_hq_resampler_checkbox = new wxCheckBox(this, wxID_ANY, _("High Quality Resampler"));
   m_stretch_label = new wxStaticText(this, wxID_ANY, _("Buffer Size:"));
   m_stretch_slider =
     new DolphinSlider(this, wxID_ANY, 80, 5, 300, wxDefaultPosition, wxDefaultSize);
@@ -64,6 +65,8 @@ void AudioConfigPane::InitializeGUI()
   m_dpl2_decoder_checkbox->SetToolTip(
     _("Enables Dolby Pro Logic II emulation using 5.1 surround. Certain backends only."));
   m_stretch_checkbox->SetToolTip(_("Enables stretching of the audio to match emulation speed."));
+  m_hq_resampler_checkbox->SetToolTip(
+    _("Resamples audio with a cubic filter instead of linear interpolation."));
   m_stretch_slider->SetToolTip(_("Size of stretch buffer in milliseconds. "
     "Values too low may cause audio crackling."));
 
@@ -81,11 +84,13 @@ void AudioConfigPane::InitializeGUI()
     wxALIGN_CENTER_VERTICAL);
   backend_grid_sizer->Add(m_dpl2_decoder_checkbox, wxGBPosition(1, 0), wxGBSpan(1, 2),
     wxALIGN_CENTER_VERTICAL);
+  backend_grid_sizer->Add(m_hq_resampler_checkbox, wxGBPosition(2, 0), wxGBSpan(1, 2),
+    wxALIGN_CENTER_VERTICAL);
   if (m_latency_control_supported)
   {
-    backend_grid_sizer->Add(m_audio_latency_label, wxGBPosition(2, 0), wxDefaultSpan,
+    backend_grid_sizer->Add(m_audio_latency_label, wxGBPosition(3, 0), wxDefaultSpan,
       wxALIGN_CENTER_VERTICAL);
-    backend_grid_sizer->Add(m_audio_latency_spinctrl, wxGBPosition(2, 1), wxDefaultSpan,
+    backend_grid_sizer->Add(m_audio_latency_spinctrl, wxGBPosition(3, 1), wxDefaultSpan,
       wxALIGN_CENTER_VERTICAL);
   }
   wxStaticBoxSizer* const backend_static_box_sizer =
@@ -151,6 +156,7 @@ void AudioConfigPane::LoadGUIValues()
     m_audio_latency_spinctrl->SetValue(startup_params.iLatency);
   }
   m_stretch_checkbox->SetValue(startup_params.m_audio_stretch);
+  m_hq_resampler_checkbox->SetValue(startup_params.m_audio_hq_resampler);
   m_stretch_slider->Enable(startup_params.m_audio_stretch);
   m_stretch_slider->SetValue(startup_params.m_audio_stretch_max_latency);
   m_stretch_text->Enable(startup_params.m_audio_stretch);
@@ -193,6 +199,8 @@ void AudioConfigPane::BindEvents()
     m_audio_latency_spinctrl->Bind(wxEVT_UPDATE_UI, &WxEventUtils::OnEnableIfCoreNotRunning);
   }
   m_stretch_checkbox->Bind(wxEVT_CHECKBOX, &AudioConfigPane::OnStretchCheckBoxChanged, this);
+  m_hq_resampler_checkbox->Bind(wxEVT_CHECKBOX, &AudioConfigPane::OnHQResamplerCheckBoxChanged,
+    this);
   m_stretch_slider->Bind(wxEVT_SLIDER, &AudioConfigPane::OnStretchSliderChanged, this);
 }
 
@@ -239,6 +247,11 @@ void AudioConfigPane::OnStretchCheckBoxChanged(wxCommandEvent& event)
   m_stretch_label->Enable(stretch_enabled);
 }
 
+void AudioConfigPane::OnHQResamplerCheckBoxChanged(wxCommandEvent&)
+{
+  SConfig::GetInstance().m_audio_hq_resampler = m_hq_resampler_checkbox->IsChecked();
+}
+
 void AudioConfigPane::OnStretchSliderChanged(wxCommandEvent& event)
 {
   SConfig::GetInstance().m_audio_stretch_max_latency = m_stretch_slider->GetValue();
@@ -35,6 +35,7 @@ private:
   void OnAudioBackendChanged(wxCommandEvent&);
   void OnLatencySpinCtrlChanged(wxCommandEvent&);
   void OnStretchCheckBoxChanged(wxCommandEvent&);
+  void OnHQResamplerCheckBoxChanged(wxCommandEvent&);
   void OnStretchSliderChanged(wxCommandEvent&);
 
   wxArrayString m_dsp_engine_strings;
@@ -48,6 +49,7 @@ private:
   wxSpinCtrl* m_audio_latency_spinctrl;
   wxStaticText* m_audio_latency_label;
   wxCheckBox* m_stretch_checkbox;
+  wxCheckBox* m_hq_resampler_checkbox;
   wxStaticText* m_stretch_label;
   DolphinSlider* m_stretch_slider;
   wxStaticText* m_stretch_text;
@@ -136,10 +136,25 @@ void CCodeWindow::OnProfilerMenu(wxCommandEvent& event)
     Profiler::g_ProfileBlocks = GetParentMenuBar()->IsChecked(IDM_PROFILE_BLOCKS);
     Core::SetState(Core::State::Running);
     break;
+  case IDM_PROFILE_SAMPLES:
+    // Sampling doesn't touch the emitted code, so no pause or cache clear.
+    if (GetParentMenuBar()->IsChecked(IDM_PROFILE_SAMPLES))
+      Profiler::StartSampling(1000);
+    else
+      Profiler::StopSampling();
+    break;
   case IDM_WRITE_PROFILE:
     if (Core::GetState() == Core::State::Running)
       Core::SetState(Core::State::Paused);
 
+    if (Profiler::IsSampling())
+      GetParentMenuBar()->Check(IDM_PROFILE_SAMPLES, false);
+    {
+      std::string sample_prefix = File::GetUserPath(D_DUMP_IDX) + "Debug/profiler";
+      File::CreateFullPath(sample_prefix);
+      Profiler::WriteSampleResults(sample_prefix);
+    }
+
     if (Core::GetState() == Core::State::Paused && PowerPC::GetMode() == PowerPC::CoreMode::JIT)
     {
       std::string filename = File::GetUserPath(D_DUMP_IDX) + "Debug/profiler.txt";
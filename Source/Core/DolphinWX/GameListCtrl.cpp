@@ -14,6 +14,7 @@
 #include <wx/app.h>
 #include <wx/bitmap.h>
 #include <wx/buffer.h>
+#include <wx/choicdlg.h>
 #include <wx/colour.h>
 #include <wx/dirdlg.h>
 #include <wx/filedlg.h>
@@ -52,6 +53,7 @@
 #include "Core/WiiUtils.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
+#include "DiscIO/LZOBlob.h"
 #include "DiscIO/Volume.h"
 #include "DolphinWX/Frame.h"
 #include "DolphinWX/GameListCtrl.h"
@@ -982,7 +984,8 @@ void GameListCtrl::OnRightClick(wxMouseEvent& event)
 
       if (platform == DiscIO::Platform::GameCubeDisc || platform == DiscIO::Platform::WiiDisc)
       {
-        if (selected_iso->GetBlobType() == DiscIO::BlobType::GCZ)
+        if (selected_iso->GetBlobType() == DiscIO::BlobType::GCZ ||
+            selected_iso->GetBlobType() == DiscIO::BlobType::LZO)
           popupMenu.Append(IDM_COMPRESS_ISO, _("Decompress ISO..."));
         else if (selected_iso->GetBlobType() == DiscIO::BlobType::PLAIN)
           popupMenu.Append(IDM_COMPRESS_ISO, _("Compress ISO..."));
@@ -1203,14 +1206,15 @@ void GameListCtrl::CompressSelection(bool _compress)
       iso->GetPlatform() != DiscIO::Platform::WiiDisc)
       continue;
     if (iso->GetBlobType() != DiscIO::BlobType::PLAIN &&
-      iso->GetBlobType() != DiscIO::BlobType::GCZ)
+      iso->GetBlobType() != DiscIO::BlobType::GCZ &&
+      iso->GetBlobType() != DiscIO::BlobType::LZO)
       continue;
 
     items_to_compress.push_back(iso);
 
     // Show the Wii compression warning if it's relevant and it hasn't been shown already
     if (!wii_compression_warning_accepted && _compress &&
-      iso->GetBlobType() != DiscIO::BlobType::GCZ &&
+      iso->GetBlobType() == DiscIO::BlobType::PLAIN &&
       iso->GetPlatform() == DiscIO::Platform::WiiDisc)
     {
       if (WiiCompressWarning())
@@ -1228,6 +1232,21 @@ void GameListCtrl::CompressSelection(bool _compress)
   if (browseDialog.ShowModal() != wxID_OK)
     return;
 
+  // When compressing, let the user pick between the zlib-based GCZ format
+  // and the LZO-based LZB format.
+  bool use_lzo = false;
+  if (_compress)
+  {
+    wxArrayString format_choices;
+    format_choices.Add(_("GCZ (zlib, smaller files)"));
+    format_choices.Add(_("LZB (LZO, faster reads and conversion)"));
+    wxSingleChoiceDialog format_dialog(this, _("Choose the compressed format"), _("Compress ISO"),
+      format_choices);
+    if (format_dialog.ShowModal() != wxID_OK)
+      return;
+    use_lzo = format_dialog.GetSelection() == 1;
+  }
+
   bool all_good = true;
 
   {
@@ -1241,12 +1260,12 @@ void GameListCtrl::CompressSelection(bool _compress)
 
     for (const UICommon::GameFile* iso : items_to_compress)
     {
-      if (iso->GetBlobType() != DiscIO::BlobType::GCZ && _compress)
+      if (iso->GetBlobType() == DiscIO::BlobType::PLAIN && _compress)
       {
         std::string FileName;
         SplitPath(iso->GetFilePath(), nullptr, &FileName, nullptr);
         progress.current_filename = FileName;
-        FileName.append(".gcz");
+        FileName.append(use_lzo ? ".lzb" : ".gcz");
 
         std::string OutputFileName;
         BuildCompleteFilename(OutputFileName, WxStrToStr(browseDialog.GetPath()), FileName);
@@ -1258,12 +1277,20 @@ void GameListCtrl::CompressSelection(bool _compress)
             _("Confirm File Overwrite"), wxYES_NO) == wxNO)
           continue;
 
-        all_good &=
-          DiscIO::CompressFileToBlob(iso->GetFilePath(), OutputFileName,
-          (iso->GetPlatform() == DiscIO::Platform::WiiDisc) ? 1 : 0,
-            16384, &MultiCompressCB, &progress);
+        if (use_lzo)
+          all_good &=
+            DiscIO::CompressFileToLZOBlob(iso->GetFilePath(), OutputFileName,
+            (iso->GetPlatform() == DiscIO::Platform::WiiDisc) ? 1 : 0,
+              512 * 1024, &MultiCompressCB, &progress);
+        else
+          all_good &=
+            DiscIO::CompressFileToBlob(iso->GetFilePath(), OutputFileName,
+            (iso->GetPlatform() == DiscIO::Platform::WiiDisc) ? 1 : 0,
+              16384, &MultiCompressCB, &progress);
       }
-      else if (iso->GetBlobType() == DiscIO::BlobType::GCZ && !_compress)
+      else if ((iso->GetBlobType() == DiscIO::BlobType::GCZ ||
+                iso->GetBlobType() == DiscIO::BlobType::LZO) &&
+               !_compress)
       {
         std::string FileName;
         SplitPath(iso->GetFilePath(), nullptr, &FileName, nullptr);
@@ -1308,7 +1335,8 @@ void GameListCtrl::OnCompressISO(wxCommandEvent& WXUNUSED(event))
   if (!iso)
     return;
 
-  bool is_compressed = iso->GetBlobType() == DiscIO::BlobType::GCZ;
+  bool is_compressed = iso->GetBlobType() == DiscIO::BlobType::GCZ ||
+                       iso->GetBlobType() == DiscIO::BlobType::LZO;
   wxString path;
 
   std::string FileName, FilePath, FileExtension;
@@ -1335,8 +1363,10 @@ void GameListCtrl::OnCompressISO(wxCommandEvent& WXUNUSED(event))
 
       path = wxFileSelector(_("Save compressed GCM/ISO"), StrToWxStr(FilePath),
         StrToWxStr(FileName) + ".gcz", wxEmptyString,
-        _("All compressed GC/Wii ISO files (gcz)") +
-        wxString::Format("|*.gcz|%s", wxGetTranslation(wxALL_FILES)),
+        _("Compressed GC/Wii ISO files, zlib (gcz)") +
+        wxString::Format("|*.gcz|") +
+        _("Compressed GC/Wii ISO files, LZO (lzb)") +
+        wxString::Format("|*.lzb|%s", wxGetTranslation(wxALL_FILES)),
         wxFD_SAVE, this);
     }
     if (!path)
@@ -1358,6 +1388,11 @@ void GameListCtrl::OnCompressISO(wxCommandEvent& WXUNUSED(event))
     if (is_compressed)
       all_good =
       DiscIO::DecompressBlobToFile(iso->GetFilePath(), WxStrToStr(path), &CompressCB, &dialog);
+    else if (path.Lower().EndsWith(".lzb"))
+      all_good = DiscIO::CompressFileToLZOBlob(
+        iso->GetFilePath(), WxStrToStr(path),
+        (iso->GetPlatform() == DiscIO::Platform::WiiDisc) ? 1 : 0, 512 * 1024, &CompressCB,
+        &dialog);
     else
       all_good = DiscIO::CompressFileToBlob(
         iso->GetFilePath(), WxStrToStr(path),
@@ -254,6 +254,7 @@ enum
 
   // Profiler
   IDM_PROFILE_BLOCKS,
+  IDM_PROFILE_SAMPLES,
   IDM_WRITE_PROFILE,
   // --------------------------------------------------------------
 
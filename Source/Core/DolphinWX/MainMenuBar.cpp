@@ -511,6 +511,8 @@ wxMenu* MainMenuBar::CreateProfilerMenu() const
   auto* const profiler_menu = new wxMenu;
   // i18n: "Profile" is used as a verb, not a noun.
   profiler_menu->AppendCheckItem(IDM_PROFILE_BLOCKS, _("&Profile Blocks"));
+  // i18n: Samples the guest program counter instead of instrumenting blocks.
+  profiler_menu->AppendCheckItem(IDM_PROFILE_SAMPLES, _("Profile &Samples"));
   profiler_menu->AppendSeparator();
   profiler_menu->Append(IDM_WRITE_PROFILE, _("&Write to profile.txt, Show"));
 
@@ -84,6 +84,9 @@ void ControllerInterface::RefreshDevices()
   if (!m_is_init)
     return;
 
+  // Clear the working list but deliberately do not republish it: realtime
+  // readers keep polling the previous snapshot while the backends enumerate,
+  // so a refresh never presents an empty device list to the CPU thread.
   {
     std::lock_guard<std::mutex> lk(m_devices_mutex);
     m_devices.clear();
@@ -117,6 +120,12 @@ void ControllerInterface::RefreshDevices()
   ciface::Pipes::PopulateDevices();
 #endif
 
+  // Publish the rebuilt list in one step, replacing the pre-refresh snapshot.
+  {
+    std::lock_guard<std::mutex> lk(m_devices_mutex);
+    PublishDevices();
+  }
+
   m_is_populating_devices = false;
   InvokeDevicesChangedCallbacks();
 }
@@ -142,6 +151,7 @@ void ControllerInterface::Shutdown()
     }
 
     m_devices.clear();
+    PublishDevices();
   }
 
 #ifdef CIFACE_USE_XINPUT
@@ -193,6 +203,11 @@ void ControllerInterface::AddDevice(std::shared_ptr<ciface::Core::Device> device
 
     NOTICE_LOG(SERIALINTERFACE, "Added device: %s", device->GetQualifiedName().c_str());
     m_devices.emplace_back(std::move(device));
+
+    // Hotplug additions are published as a delta right away; during a full
+    // refresh the single publication at the end of RefreshDevices wins.
+    if (!m_is_populating_devices)
+      PublishDevices();
   }
 
   if (!m_is_populating_devices)
@@ -212,6 +227,9 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
       return false;
     });
     m_devices.erase(it, m_devices.end());
+
+    if (!m_is_populating_devices)
+      PublishDevices();
   }
 
   if (!m_is_populating_devices)
@@ -225,13 +243,16 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
 //
 void ControllerInterface::UpdateInput()
 {
-  // Don't block the UI or CPU thread (to avoid a short but noticeable frame drop)
-  if (m_devices_mutex.try_lock())
-  {
-    std::lock_guard<std::mutex> lk(m_devices_mutex, std::adopt_lock);
-    for (const auto& d : m_devices)
-      d->UpdateInput();
-  }
+  // Poll an immutable snapshot instead of locking m_devices_mutex: device
+  // enumeration on another thread can then never block the UI or CPU thread,
+  // and unlike the old try_lock this never skips a poll during a refresh.
+  // Devices removed in the meantime stay alive until the snapshot is dropped.
+  const auto devices = GetDeviceSnapshot();
+  if (!devices)
+    return;
+
+  for (const auto& d : *devices)
+    d->UpdateInput();
 }
 
 //
@@ -144,6 +144,23 @@ bool DeviceQualifier::operator!=(const DeviceQualifier& devq) const
   return !operator==(devq);
 }
 
+//
+// DeviceContainer :: PublishDevices
+//
+// Swap in a fresh immutable copy of the device list. Readers that grabbed the
+// previous snapshot keep a reference to it (and to the devices it names), so
+// they can finish polling even while the list is being rebuilt.
+//
+void DeviceContainer::PublishDevices()
+{
+  std::atomic_store(&m_devices_snapshot, std::make_shared<const DeviceSnapshot>(m_devices));
+}
+
+std::shared_ptr<const DeviceContainer::DeviceSnapshot> DeviceContainer::GetDeviceSnapshot() const
+{
+  return std::atomic_load(&m_devices_snapshot);
+}
+
 std::shared_ptr<Device> DeviceContainer::FindDevice(const DeviceQualifier& devq) const
 {
   std::lock_guard<std::mutex> lk(m_devices_mutex);
@@ -149,6 +149,8 @@ public:
 class DeviceContainer
 {
 public:
+  using DeviceSnapshot = std::vector<std::shared_ptr<Device>>;
+
   Device::Input* FindInput(const std::string& name, const Device* def_dev) const;
   Device::Output* FindOutput(const std::string& name, const Device* def_dev) const;
 
@@ -159,8 +161,18 @@ public:
   bool HasConnectedDevice(const DeviceQualifier& qualifier) const;
 
 protected:
+  // Republish m_devices for lock-free readers. Must be called with
+  // m_devices_mutex held after every change that should become visible.
+  void PublishDevices();
+  // Immutable copy of the device list, readable from any thread without
+  // taking m_devices_mutex. May be null before the first publication.
+  std::shared_ptr<const DeviceSnapshot> GetDeviceSnapshot() const;
+
   mutable std::mutex m_devices_mutex;
   std::vector<std::shared_ptr<Device>> m_devices;
+
+private:
+  std::shared_ptr<const DeviceSnapshot> m_devices_snapshot;
 };
 }
 }
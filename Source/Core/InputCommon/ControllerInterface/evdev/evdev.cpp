@@ -7,9 +7,11 @@
 #include <libudev.h>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unistd.h>
 
+#include <sys/epoll.h>
 #include <sys/eventfd.h>
 
 #include "Common/Assert.h"
@@ -29,6 +31,16 @@ static std::thread s_hotplug_thread;
 static Common::Flag s_hotplug_thread_running;
 static int s_wakeup_eventfd;
 
+// A single input thread drains events from every device as they arrive, so
+// the per-frame UpdateInput pass doesn't have to read each device file under
+// the device mutex anymore.
+static std::thread s_input_thread;
+static Common::Flag s_input_thread_running;
+static int s_input_wakeup_eventfd;
+static int s_epoll_fd = -1;
+static std::mutex s_input_devices_mutex;
+static std::map<int, evdevDevice*> s_input_devices;
+
 // There is no easy way to get the device name from only a dev node
 // during a device removed event, since libevdev can't work on removed devices;
 // sysfs is not stable, so this is probably the easiest way to get a name for a node.
@@ -50,6 +62,89 @@ static std::string GetName(const std::string& devnode)
   return res;
 }
 
+static void InputThreadFunc()
+{
+  Common::SetCurrentThreadName("evdev Input Thread");
+  NOTICE_LOG(SERIALINTERFACE, "evdev input thread started");
+
+  while (s_input_thread_running.IsSet())
+  {
+    epoll_event events[16];
+    const int num_events = epoll_wait(s_epoll_fd, events, 16, -1);
+    for (int i = 0; i < num_events; i++)
+    {
+      if (events[i].data.fd == s_input_wakeup_eventfd)
+      {
+        uint64_t value;
+        if (read(s_input_wakeup_eventfd, &value, sizeof(uint64_t)) < 0)
+        {
+        }
+        continue;
+      }
+
+      // The lock keeps the device alive while its events are being drained;
+      // removal unregisters under the same lock before destruction.
+      std::lock_guard<std::mutex> lk(s_input_devices_mutex);
+      const auto it = s_input_devices.find(events[i].data.fd);
+      if (it != s_input_devices.end())
+        it->second->DrainEvents();
+    }
+  }
+  NOTICE_LOG(SERIALINTERFACE, "evdev input thread stopped");
+}
+
+static void RegisterInputDevice(int fd, evdevDevice* device)
+{
+  std::lock_guard<std::mutex> lk(s_input_devices_mutex);
+  if (s_epoll_fd == -1)
+    return;
+  s_input_devices.emplace(fd, device);
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = fd;
+  epoll_ctl(s_epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+}
+
+static void UnregisterInputDevice(int fd)
+{
+  std::lock_guard<std::mutex> lk(s_input_devices_mutex);
+  if (s_input_devices.erase(fd) && s_epoll_fd != -1)
+    epoll_ctl(s_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+static void StartInputThread()
+{
+  if (!s_input_thread_running.TestAndSet())
+    return;
+
+  s_epoll_fd = epoll_create1(0);
+  ASSERT_MSG(PAD, s_epoll_fd != -1, "Couldn't create epoll fd.");
+  s_input_wakeup_eventfd = eventfd(0, 0);
+  ASSERT_MSG(PAD, s_input_wakeup_eventfd != -1, "Couldn't create eventfd.");
+
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = s_input_wakeup_eventfd;
+  epoll_ctl(s_epoll_fd, EPOLL_CTL_ADD, s_input_wakeup_eventfd, &ev);
+
+  s_input_thread = std::thread(InputThreadFunc);
+}
+
+static void StopInputThread()
+{
+  if (!s_input_thread_running.TestAndClear())
+    return;
+  // Write something to efd so that epoll_wait() stops blocking.
+  uint64_t value = 1;
+  if (write(s_input_wakeup_eventfd, &value, sizeof(uint64_t)) < 0)
+  {
+  }
+  s_input_thread.join();
+  close(s_input_wakeup_eventfd);
+  close(s_epoll_fd);
+  s_epoll_fd = -1;
+}
+
 static void HotplugThreadFunc()
 {
   Common::SetCurrentThreadName("evdev Hotplug Thread");
@@ -142,6 +237,7 @@ static void StopHotplugThread()
 void Init()
 {
   s_devnode_name_map.clear();
+  StartInputThread();
   StartHotplugThread();
 }
 
@@ -192,11 +288,12 @@ void PopulateDevices()
 void Shutdown()
 {
   StopHotplugThread();
+  StopInputThread();
 }
 
 evdevDevice::evdevDevice(const std::string& devnode) : m_devfile(devnode)
 {
-  // The device file will be read on one of the main threads, so we open in non-blocking mode.
+  // The device file is drained on the input thread, so we open in non-blocking mode.
   m_fd = open(devnode.c_str(), O_RDWR | O_NONBLOCK);
   int ret = libevdev_new_from_fd(m_fd, &m_dev);
 
@@ -210,19 +307,28 @@ evdevDevice::evdevDevice(const std::string& devnode) : m_devfile(devnode)
 
   m_name = StripSpaces(libevdev_get_name(m_dev));
 
+  for (auto& value : m_key_values)
+    value.store(0);
+  for (auto& value : m_abs_values)
+    value.store(0);
+
   // Controller buttons (and keyboard keys)
   int num_buttons = 0;
   for (int key = 0; key < KEY_MAX; key++)
     if (libevdev_has_event_code(m_dev, EV_KEY, key))
-      AddInput(new Button(num_buttons++, key, m_dev));
+    {
+      m_key_values[key].store(libevdev_get_event_value(m_dev, EV_KEY, key));
+      AddInput(new Button(num_buttons++, key, this));
+    }
 
   // Absolute axis (thumbsticks)
   int num_axis = 0;
   for (int axis = 0; axis < 0x100; axis++)
     if (libevdev_has_event_code(m_dev, EV_ABS, axis))
     {
-      AddAnalogInputs(new Axis(num_axis, axis, false, m_dev),
-        new Axis(num_axis, axis, true, m_dev));
+      m_abs_values[axis].store(libevdev_get_event_value(m_dev, EV_ABS, axis));
+      AddAnalogInputs(new Axis(num_axis, axis, false, this, m_dev),
+        new Axis(num_axis, axis, true, this, m_dev));
       num_axis++;
     }
 
@@ -242,22 +348,24 @@ evdevDevice::evdevDevice(const std::string& devnode) : m_devfile(devnode)
 
   m_initialized = true;
   m_interesting = num_axis >= 2 || num_buttons >= 8;
+
+  RegisterInputDevice(m_fd, this);
 }
 
 evdevDevice::~evdevDevice()
 {
   if (m_initialized)
   {
+    UnregisterInputDevice(m_fd);
     libevdev_free(m_dev);
     close(m_fd);
   }
 }
 
-void evdevDevice::UpdateInput()
+void evdevDevice::DrainEvents()
 {
-  // Run through all evdev events
-  // libevdev will keep track of the actual controller state internally which can be queried
-  // later with libevdev_fetch_event_value()
+  // Run through all pending evdev events and store the latest value of each
+  // event code, so GetState never has to touch the device file itself.
   input_event ev;
   int rc = LIBEVDEV_READ_STATUS_SUCCESS;
   do
@@ -266,9 +374,28 @@ void evdevDevice::UpdateInput()
       rc = libevdev_next_event(m_dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
     else
       rc = libevdev_next_event(m_dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+    if (rc == LIBEVDEV_READ_STATUS_SUCCESS || rc == LIBEVDEV_READ_STATUS_SYNC)
+      StoreEventValue(ev.type, ev.code, ev.value);
   } while (rc >= 0);
 }
 
+void evdevDevice::StoreEventValue(u16 type, u16 code, s32 value)
+{
+  if (type == EV_KEY && code < m_key_values.size())
+    m_key_values[code].store(value, std::memory_order_relaxed);
+  else if (type == EV_ABS && code < m_abs_values.size())
+    m_abs_values[code].store(value, std::memory_order_relaxed);
+}
+
+s32 evdevDevice::GetEventValue(u16 type, u16 code) const
+{
+  if (type == EV_KEY && code < m_key_values.size())
+    return m_key_values[code].load(std::memory_order_relaxed);
+  if (type == EV_ABS && code < m_abs_values.size())
+    return m_abs_values[code].load(std::memory_order_relaxed);
+  return 0;
+}
+
 bool evdevDevice::IsValid() const
 {
   int current_fd = libevdev_get_fd(m_dev);
@@ -301,16 +428,14 @@ std::string evdevDevice::Button::GetName() const
 
 ControlState evdevDevice::Button::GetState() const
 {
-  int value = 0;
-  libevdev_fetch_event_value(m_dev, EV_KEY, m_code, &value);
-  return value;
+  return m_device->GetEventValue(EV_KEY, m_code);
 }
 
-evdevDevice::Axis::Axis(u8 index, u16 code, bool upper, libevdev* dev)
-  : m_code(code), m_index(index), m_upper(upper), m_dev(dev)
+evdevDevice::Axis::Axis(u8 index, u16 code, bool upper, const evdevDevice* device, libevdev* dev)
+  : m_code(code), m_index(index), m_upper(upper), m_device(device)
 {
-  m_min = libevdev_get_abs_minimum(m_dev, m_code);
-  m_range = libevdev_get_abs_maximum(m_dev, m_code) - m_min;
+  m_min = libevdev_get_abs_minimum(dev, m_code);
+  m_range = libevdev_get_abs_maximum(dev, m_code) - m_min;
 }
 
 std::string evdevDevice::Axis::GetName() const
@@ -320,8 +445,7 @@ std::string evdevDevice::Axis::GetName() const
 
 ControlState evdevDevice::Axis::GetState() const
 {
-  int value = 0;
-  libevdev_fetch_event_value(m_dev, EV_ABS, m_code, &value);
+  const int value = m_device->GetEventValue(EV_ABS, m_code);
 
   // Value from 0.0 to 1.0
   ControlState fvalue = MathUtil::Clamp(double(value - m_min) / double(m_range), 0.0, 1.0);
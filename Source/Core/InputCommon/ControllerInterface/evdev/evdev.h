@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <libevdev/libevdev.h>
 #include <string>
 #include <vector>
@@ -25,20 +27,23 @@ private:
   {
   public:
     std::string GetName() const override;
-    Button(u8 index, u16 code, libevdev* dev) : m_index(index), m_code(code), m_dev(dev) {}
+    Button(u8 index, u16 code, const evdevDevice* device)
+      : m_index(index), m_code(code), m_device(device)
+    {
+    }
     ControlState GetState() const override;
 
   private:
     const u8 m_index;
     const u16 m_code;
-    libevdev* m_dev;
+    const evdevDevice* m_device;
   };
 
   class Axis : public Core::Device::Input
   {
   public:
     std::string GetName() const override;
-    Axis(u8 index, u16 code, bool upper, libevdev* dev);
+    Axis(u8 index, u16 code, bool upper, const evdevDevice* device, libevdev* dev);
     ControlState GetState() const override;
 
   private:
@@ -47,7 +52,7 @@ private:
     const bool m_upper;
     int m_range;
     int m_min;
-    libevdev* m_dev;
+    const evdevDevice* m_device;
   };
 
   class ForceFeedback : public Core::Device::Output
@@ -65,22 +70,32 @@ private:
   };
 
 public:
-  void UpdateInput() override;
   bool IsValid() const override;
 
   evdevDevice(const std::string& devnode);
   ~evdevDevice();
 
+  // Called by the input thread whenever epoll reports the device file is readable.
+  void DrainEvents();
+  s32 GetEventValue(u16 type, u16 code) const;
+
   std::string GetName() const override { return m_name; }
   std::string GetSource() const override { return "evdev"; }
   bool IsInteresting() const { return m_initialized && m_interesting; }
 private:
+  void StoreEventValue(u16 type, u16 code, s32 value);
+
   const std::string m_devfile;
   int m_fd;
   libevdev* m_dev;
   std::string m_name;
   bool m_initialized;
   bool m_interesting;
+
+  // Latest value of every event code, written by the input thread and read
+  // from whichever thread queries the inputs.
+  std::array<std::atomic<s32>, KEY_MAX> m_key_values;
+  std::array<std::atomic<s32>, 0x100> m_abs_values;
 };
 }
 }
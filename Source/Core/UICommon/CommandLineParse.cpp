@@ -89,6 +89,48 @@ std::unique_ptr<optparse::OptionParser> CreateParser(ParserOptions options)
       .metavar("<System>.<Section>.<Key>=<Value>")
       .type("string")
       .help("Set a configuration option");
+  parser->add_option("--benchmark_loops")
+      .action("store")
+      .metavar("<N>")
+      .type("int")
+      .help("Replay a FIFO log N times, write frame timing statistics, then exit");
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Output path for FIFO benchmark statistics (default: fifo_benchmark.json)");
+  parser->add_option("--benchmark_skip")
+      .action("store")
+      .metavar("<class>")
+      .type("string")
+      .help("Replay with one class of state writes NOPed out, for differential "
+            "cost attribution (tev, texture, scissor, pixel, efb_copy, bp_other, "
+            "xf_matrix, xf_viewport, xf_other)");
+  parser->add_option("--regression_frames")
+      .action("store")
+      .metavar("<N>")
+      .type("int")
+      .help("Run N frames after boot, write a determinism/performance report, then exit");
+  parser->add_option("--regression_save")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Savestate to load before the regression run starts counting frames");
+  parser->add_option("--regression_movie")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Input movie (DTM) to play back during the regression run");
+  parser->add_option("--regression_output")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Output path for the regression report (default: regression_report.json)");
+  parser->add_option("--regression_trace")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Also capture the run as chrome://tracing JSON for per-subsystem timing");
 
   if (options == ParserOptions::IncludeGUIOptions)
   {
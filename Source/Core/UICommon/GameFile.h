@@ -78,6 +78,7 @@ public:
   const std::string& GetIssues() const { return m_emu_state.issues; }
   int GetEmuState() const { return m_emu_state.rating; }
   u64 GetFileSize() const { return m_file_size; }
+  u64 GetFileMTime() const { return m_file_mtime; }
   u64 GetVolumeSize() const { return m_volume_size; }
   const GameBanner& GetBannerImage() const { return m_volume_banner; }
   void DoState(PointerWrap& p);
@@ -115,6 +116,7 @@ private:
   std::string m_file_name{};
 
   u64 m_file_size{};
+  u64 m_file_mtime{};
   u64 m_volume_size{};
 
   std::map<DiscIO::Language, std::string> m_short_names{};
@@ -5,6 +5,7 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
@@ -15,10 +16,12 @@
 #include <vector>
 
 #include "Common/ChunkFile.h"
+#include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/TitleDatabase.h"
 
@@ -28,13 +31,22 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 8;  // Last changed in PR 6560
+static constexpr u32 CACHE_REVISION = 10;  // Last changed when the modification time was added
+
+// Returns true if the file on disk no longer matches the cached entry, so the
+// metadata has to be re-extracted. The modification time is the key; the cached
+// file size can't be compared against a single stat, because for split blobs it
+// covers all the parts.
+static bool CachedEntryIsStale(const GameFile& file)
+{
+  return File::FileInfo(file.GetFilePath()).GetModificationTime() != file.GetFileMTime();
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
 {
   static const std::vector<std::string> search_extensions = {
-      ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wad", ".dol", ".elf"};
+      ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".lzb", ".wbfs", ".wad", ".dol", ".elf"};
 
   // TODO: We could process paths iteratively as they are found
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
@@ -59,7 +71,20 @@ std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
       m_cached_files.begin(), m_cached_files.end(),
       [&path](const std::shared_ptr<GameFile>& file) { return file->GetFilePath() == path; });
   const bool found = it != m_cached_files.cend();
-  if (!found)
+  if (found && CachedEntryIsStale(**it))
+  {
+    // The file changed since it was cached (for example, it was replaced with
+    // a different dump), so the cached metadata can't be trusted.
+    std::shared_ptr<GameFile> game = std::make_shared<GameFile>(path);
+    *cache_changed = true;
+    if (!game->IsValid())
+    {
+      m_cached_files.erase(it);
+      return nullptr;
+    }
+    *it = std::move(game);
+  }
+  else if (!found)
   {
     std::shared_ptr<UICommon::GameFile> game = std::make_shared<GameFile>(path);
     if (!game->IsValid())
@@ -98,7 +123,19 @@ bool GameFileCache::Update(const std::vector<std::string>& all_game_paths)
     {
       if (game_paths.erase((*it)->GetFilePath()))
       {
-        ++it;
+        // Files that changed on disk since they were cached go back into
+        // game_paths so that their metadata gets re-extracted below.
+        if (CachedEntryIsStale(**it))
+        {
+          cache_changed = true;
+          game_paths.insert((*it)->GetFilePath());
+          --end;
+          *it = std::move(*end);
+        }
+        else
+        {
+          ++it;
+        }
       }
       else
       {
@@ -112,13 +149,42 @@ bool GameFileCache::Update(const std::vector<std::string>& all_game_paths)
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const auto& path : game_paths)
+  // Extracting the metadata opens every file to read headers and banners,
+  // which dominates scan time on large or remote libraries, so the files are
+  // split between the worker pool and the calling thread.
+  if (!game_paths.empty())
   {
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+    std::vector<std::shared_ptr<GameFile>> new_files(new_paths.size());
+    const size_t slices =
+        std::min<size_t>(Common::ThreadPool::GetThreadCount() + 1, new_paths.size());
+    std::atomic<u32> finished_slices = {0};
+    for (size_t slice = 0; slice + 1 < slices; slice++)
+    {
+      const size_t begin = new_paths.size() * slice / slices;
+      const size_t end = new_paths.size() * (slice + 1) / slices;
+      Common::AsyncWorker::ExecuteAsync([&new_paths, &new_files, &finished_slices, begin, end]() {
+        for (size_t i = begin; i < end; i++)
+          new_files[i] = std::make_shared<GameFile>(new_paths[i]);
+        finished_slices.fetch_add(1);
+      });
+    }
+    // Extract the last slice on the calling thread.
+    for (size_t i = new_paths.size() * (slices - 1) / slices; i < new_paths.size(); i++)
+      new_files[i] = std::make_shared<GameFile>(new_paths[i]);
+    u32 loopcount = 0;
+    while (finished_slices.load() < slices - 1)
     {
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+      Common::cYield(loopcount++);
+    }
+
+    for (auto& file : new_files)
+    {
+      if (file->IsValid())
+      {
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      }
     }
   }
 
@@ -0,0 +1,169 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "UICommon/ThumbnailCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+#include "UICommon/GameFile.h"
+
+namespace UICommon
+{
+namespace
+{
+// Bumped when the file format or the thumbnail dimensions change; stale
+// entries are simply regenerated.
+constexpr u32 THUMBNAIL_CACHE_REVISION = 1;
+
+struct ThumbnailHeader
+{
+  u32 revision;
+  u32 width;
+  u32 height;
+};
+
+std::string GetThumbnailPath(const GameFile& game)
+{
+  if (game.GetGameID().empty())
+    return "";
+  return File::GetUserPath(D_CACHE_IDX) + "GameThumbnails" DIR_SEP +
+         StringFromFormat("%s_%u.thumb", game.GetGameID().c_str(), game.GetRevision());
+}
+
+bool LoadThumbnail(const std::string& path, GameThumbnail* thumbnail)
+{
+  File::IOFile file(path, "rb");
+  if (!file)
+    return false;
+
+  ThumbnailHeader header;
+  if (!file.ReadArray(&header, 1) || header.revision != THUMBNAIL_CACHE_REVISION ||
+      header.width == 0 || header.width > ThumbnailCache::THUMBNAIL_WIDTH || header.height == 0 ||
+      header.height > ThumbnailCache::THUMBNAIL_HEIGHT)
+  {
+    return false;
+  }
+
+  const size_t pixel_count = header.width * header.height;
+  if (file.GetSize() != sizeof(ThumbnailHeader) + pixel_count * sizeof(u32))
+    return false;
+
+  thumbnail->pixels.resize(pixel_count);
+  if (!file.ReadArray(thumbnail->pixels.data(), pixel_count))
+  {
+    thumbnail->pixels.clear();
+    return false;
+  }
+  thumbnail->width = header.width;
+  thumbnail->height = header.height;
+  return true;
+}
+
+void SaveThumbnail(const std::string& path, const GameThumbnail& thumbnail)
+{
+  if (!File::CreateFullPath(path))
+    return;
+
+  File::IOFile file(path, "wb");
+  if (!file)
+    return;
+
+  const ThumbnailHeader header{THUMBNAIL_CACHE_REVISION, thumbnail.width, thumbnail.height};
+  if (!file.WriteArray(&header, 1) ||
+      !file.WriteArray(thumbnail.pixels.data(), thumbnail.pixels.size()))
+  {
+    file.Close();
+    File::Delete(path);
+  }
+}
+
+// Bilinear resample of the banner to fit within the thumbnail dimensions
+// while keeping the aspect ratio. GameCube banners (96x32) scale up to the
+// size of Wii ones, so every thumbnail ends up the same height and the views
+// never rescale per paint.
+void ScaleBanner(const GameBanner& banner, GameThumbnail* thumbnail)
+{
+  const u32 src_width = static_cast<u32>(banner.width);
+  const u32 src_height = static_cast<u32>(banner.height);
+  const float scale = std::min(static_cast<float>(ThumbnailCache::THUMBNAIL_WIDTH) / src_width,
+                               static_cast<float>(ThumbnailCache::THUMBNAIL_HEIGHT) / src_height);
+  const u32 width = std::max(1u, static_cast<u32>(src_width * scale));
+  const u32 height = std::max(1u, static_cast<u32>(src_height * scale));
+
+  thumbnail->width = width;
+  thumbnail->height = height;
+  thumbnail->pixels.resize(width * height);
+
+  for (u32 y = 0; y < height; y++)
+  {
+    const float sample_y = (y + 0.5f) * src_height / height - 0.5f;
+    const u32 y0 = static_cast<u32>(std::max(0.0f, sample_y));
+    const u32 y1 = std::min(y0 + 1, src_height - 1);
+    const float y_frac = std::max(0.0f, sample_y - y0);
+    for (u32 x = 0; x < width; x++)
+    {
+      const float sample_x = (x + 0.5f) * src_width / width - 0.5f;
+      const u32 x0 = static_cast<u32>(std::max(0.0f, sample_x));
+      const u32 x1 = std::min(x0 + 1, src_width - 1);
+      const float x_frac = std::max(0.0f, sample_x - x0);
+
+      u32 channels[3];
+      for (u32 c = 0; c < 3; c++)
+      {
+        const u32 shift = 16 - 8 * c;
+        const float top = ((banner.buffer[y0 * src_width + x0] >> shift) & 0xFF) * (1 - x_frac) +
+                          ((banner.buffer[y0 * src_width + x1] >> shift) & 0xFF) * x_frac;
+        const float bottom = ((banner.buffer[y1 * src_width + x0] >> shift) & 0xFF) * (1 - x_frac) +
+                             ((banner.buffer[y1 * src_width + x1] >> shift) & 0xFF) * x_frac;
+        channels[c] = static_cast<u32>(top * (1 - y_frac) + bottom * y_frac + 0.5f);
+      }
+      thumbnail->pixels[y * width + x] = (channels[0] << 16) | (channels[1] << 8) | channels[2];
+    }
+  }
+}
+
+}  // Anonymous namespace
+
+ThumbnailCache::ThumbnailCache(ThumbnailCallback callback) : m_callback(std::move(callback))
+{
+  m_worker.Reset(
+      [this](std::shared_ptr<const GameFile> game) { ProcessRequest(game); });
+}
+
+void ThumbnailCache::RequestThumbnail(std::shared_ptr<const GameFile> game)
+{
+  m_worker.EmplaceItem(std::move(game));
+}
+
+void ThumbnailCache::ProcessRequest(const std::shared_ptr<const GameFile>& game)
+{
+  const std::string cache_path = GetThumbnailPath(*game);
+
+  GameThumbnail thumbnail;
+  if (cache_path.empty() || !LoadThumbnail(cache_path, &thumbnail))
+  {
+    const GameBanner& banner = game->GetBannerImage();
+    if (!banner.empty())
+    {
+      ScaleBanner(banner, &thumbnail);
+      if (!cache_path.empty())
+        SaveThumbnail(cache_path, thumbnail);
+    }
+  }
+
+  m_callback(game->GetFilePath(), thumbnail);
+}
+
+}  // namespace UICommon
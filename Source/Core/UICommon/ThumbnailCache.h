@@ -0,0 +1,57 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+namespace UICommon
+{
+class GameFile;
+
+struct GameThumbnail
+{
+  std::vector<u32> pixels{};  // 0x00RRGGBB, same layout as GameBanner
+  u32 width{};
+  u32 height{};
+  bool empty() const { return pixels.empty(); }
+};
+
+// Serves pre-scaled banner thumbnails without blocking the UI thread. Each
+// request is handled on a worker thread: served from a compact disk cache
+// keyed by game ID and revision when possible, otherwise scaled from the
+// GameFile's banner and written back to the cache for the next launch. The
+// callback runs on the worker thread, so the frontend is responsible for
+// getting the result back onto its UI thread.
+class ThumbnailCache
+{
+public:
+  // Thumbnails are scaled to fit within these dimensions (the size of a
+  // native Wii banner).
+  static constexpr u32 THUMBNAIL_WIDTH = 192;
+  static constexpr u32 THUMBNAIL_HEIGHT = 64;
+
+  using ThumbnailCallback = std::function<void(const std::string& path, const GameThumbnail&)>;
+
+  explicit ThumbnailCache(ThumbnailCallback callback);
+  ~ThumbnailCache() = default;
+
+  // Asynchronously produces a thumbnail for the game and hands it to the
+  // callback. Games without a banner get an empty thumbnail.
+  void RequestThumbnail(std::shared_ptr<const GameFile> game);
+
+private:
+  void ProcessRequest(const std::shared_ptr<const GameFile>& game);
+
+  ThumbnailCallback m_callback;
+  Common::WorkQueueThread<std::shared_ptr<const GameFile>> m_worker;
+};
+
+}  // namespace UICommon
@@ -492,9 +492,13 @@ void CreateDescriptorHeaps()
     static constexpr size_t MAX_ACTIVE_TEXTURES = 4096;
     static constexpr size_t MAX_DRAWS_PER_FRAME = 4096;
     static constexpr size_t TEMPORARY_SLOTS = MAX_DRAWS_PER_FRAME * 8;
+    // Persistent 8-wide SRV tables cached across draws and command lists by
+    // the texture cache; see TextureCache::BindTextures.
+    static constexpr size_t CACHED_TEXTURE_GROUPS = 2048;
     gpu_descriptor_heap_mgr = D3DDescriptorHeapManager::Create(
       device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE,
-      TEMPORARY_SLOTS + MAX_ACTIVE_TEXTURES, TEMPORARY_SLOTS);
+      TEMPORARY_SLOTS + CACHED_TEXTURE_GROUPS * 8 + MAX_ACTIVE_TEXTURES, TEMPORARY_SLOTS,
+      CACHED_TEXTURE_GROUPS, 8);
     if (!gpu_descriptor_heap_mgr)
       PanicAlert("Failed to create descriptor heap");
 
@@ -111,14 +111,26 @@ void D3DCommandListManager::GetCommandList(ID3D12GraphicsCommandList** command_l
 }
 void D3DCommandListManager::EnsureDrawLimit()
 {
+  // How often the background thread is let loose on the queued items. Without
+  // these kicks it only starts recording when the command list is executed,
+  // so on draw-heavy frames the whole queue is replayed in one burst instead
+  // of overlapping the rest of the frame.
+  constexpr unsigned int draws_per_queue_kick = 64;
+
   ++m_draws_since_last_execution;
   ++m_this_frame_draws;
+  ++m_draws_since_last_kick;
   u32 max_draws = m_last_frame_draws >> (m_cpu_access_last_frame ? 2 : 1);
   max_draws = std::max(max_draws, 64u);
   if (m_draws_since_last_execution > max_draws)
   {
     ExecuteQueuedWork();
   }
+  else if (g_ActiveConfig.bBackendMultithreading && m_draws_since_last_kick >= draws_per_queue_kick)
+  {
+    m_queued_command_list->KickQueue();
+    m_draws_since_last_kick = 0;
+  }
 }
 
 void D3DCommandListManager::ExecuteQueuedWork(bool wait_for_gpu_completion, bool terminate_worker_tread)
@@ -156,6 +168,7 @@ void D3DCommandListManager::ExecuteQueuedWork(bool wait_for_gpu_completion, bool
     SetInitialCommandListState();
   }
   m_draws_since_last_execution = 0;
+  m_draws_since_last_kick = 0;
 }
 
 void D3DCommandListManager::ExecuteQueuedWorkAndPresent(IDXGISwapChain* swap_chain, UINT sync_interval, UINT flags)
@@ -194,6 +207,7 @@ void D3DCommandListManager::ExecuteQueuedWorkAndPresent(IDXGISwapChain* swap_cha
   m_this_frame_draws = 0;
   m_cpu_access_this_frame = false;
   m_draws_since_last_execution = 0;
+  m_draws_since_last_kick = 0;
 }
 
 void D3DCommandListManager::DestroyAllPendingResources()
@@ -408,6 +422,7 @@ void D3DCommandListManager::CPUAccessNotify()
   m_cpu_access_last_frame = true;
   m_cpu_access_this_frame = true;
   m_draws_since_last_execution = 0;
+  m_draws_since_last_kick = 0;
 };
 
 ID3D12Fence* D3DCommandListManager::RegisterQueueFenceCallback(void* owning_object, PFN_QUEUE_FENCE_CALLBACK* callback_function)
@@ -20,7 +20,10 @@ enum COMMAND_LIST_STATE
   COMMAND_LIST_STATE_VS_CBV = 8,
   COMMAND_LIST_STATE_PSO = 16,
   COMMAND_LIST_STATE_SAMPLERS = 32,
-  COMMAND_LIST_STATE_VERTEX_BUFFER = 64
+  COMMAND_LIST_STATE_VERTEX_BUFFER = 64,
+  // The temporary descriptor group the texture cache copied the bound SRVs
+  // into; only valid for the lifetime of the current command list.
+  COMMAND_LIST_STATE_SRV = 128
 };
 
 class D3DDescriptorHeapManager;
@@ -74,6 +77,7 @@ private:
   using PendingDescriptorFree = std::pair<D3DDescriptorHeapManager*, size_t>;
 
   unsigned int m_draws_since_last_execution = 0;
+  unsigned int m_draws_since_last_kick = 0;
   unsigned int m_this_frame_draws = 0;
   unsigned int m_last_frame_draws = 0;
   bool m_cpu_access_last_frame = false;
@@ -13,21 +13,24 @@ D3DDescriptorHeapManager::D3DDescriptorHeapManager(ID3D12DescriptorHeap* descrip
   ID3D12DescriptorHeap* shadow_descriptor_heap,
   size_t num_descriptors,
   size_t descriptor_increment_size,
-  size_t temporary_slots)
+  size_t temporary_slots,
+  size_t group_slots,
+  size_t group_width)
   : m_descriptor_heap(descriptor_heap), m_shadow_descriptor_heap(shadow_descriptor_heap),
   m_num_descriptors(num_descriptors), m_descriptor_increment_size(descriptor_increment_size),
-  m_temporary_slots(temporary_slots),
+  m_temporary_slots(temporary_slots), m_group_slots(group_slots), m_group_width(group_width),
   m_heap_base_cpu(descriptor_heap->GetCPUDescriptorHandleForHeapStart()),
   m_heap_base_gpu(descriptor_heap->GetGPUDescriptorHandleForHeapStart()),
-  m_slots(num_descriptors - temporary_slots)
+  m_slots(num_descriptors - temporary_slots - group_slots * group_width),
+  m_groups(group_slots)
 {
   if (shadow_descriptor_heap)
     m_shadow_heap_base = shadow_descriptor_heap->GetCPUDescriptorHandleForHeapStart();
 
-  // Uses temporary slots?
-  if (temporary_slots > 0)
+  // Temporary slots and deferred group frees both need queue fence tracking.
+  if (temporary_slots > 0 || group_slots > 0)
   {
-    ASSERT(temporary_slots <= num_descriptors);
+    ASSERT(temporary_slots + group_slots * group_width <= num_descriptors);
     // Set up fence tracking callback.
     m_fence = D3D::command_list_mgr->RegisterQueueFenceCallback(this, &D3DDescriptorHeapManager::QueueFenceCallback);
   }
@@ -49,7 +52,7 @@ bool D3DDescriptorHeapManager::Allocate(size_t* out_index,
   int index = m_slots.AllocateSlot();
   if (index > -1)
   {
-    index += static_cast<int>(m_temporary_slots);
+    index += static_cast<int>(m_temporary_slots + GroupRegionSize());
     if (out_index)
       *out_index = index;
     if (out_cpu_handle)
@@ -67,8 +70,67 @@ bool D3DDescriptorHeapManager::Allocate(size_t* out_index,
 
 void D3DDescriptorHeapManager::Free(size_t index)
 {
-  ASSERT(index < m_num_descriptors && index >= m_temporary_slots);
-  m_slots.ReleaseSlot(static_cast<int>(index - m_temporary_slots));
+  ASSERT(index < m_num_descriptors && index >= m_temporary_slots + GroupRegionSize());
+  m_slots.ReleaseSlot(static_cast<int>(index - m_temporary_slots - GroupRegionSize()));
+}
+
+bool D3DDescriptorHeapManager::AllocateGroup(size_t* out_base_index,
+  D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
+  D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle)
+{
+  if (TryAllocateGroup(out_base_index, out_cpu_base_handle, out_gpu_base_handle))
+    return true;
+
+  // All groups taken; reclaim deferred frees the GPU is already past.
+  ReclaimDeferredGroups(false);
+  if (TryAllocateGroup(out_base_index, out_cpu_base_handle, out_gpu_base_handle))
+    return true;
+
+  // Still nothing; wait for the outstanding fences like the temporary ring
+  // does before giving up.
+  ReclaimDeferredGroups(true);
+  return TryAllocateGroup(out_base_index, out_cpu_base_handle, out_gpu_base_handle);
+}
+
+bool D3DDescriptorHeapManager::TryAllocateGroup(size_t* out_base_index,
+  D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
+  D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle)
+{
+  int group = m_groups.AllocateSlot();
+  if (group < 0)
+    return false;
+
+  size_t base_index = m_temporary_slots + group * m_group_width;
+  if (out_base_index)
+    *out_base_index = base_index;
+  if (out_cpu_base_handle)
+    out_cpu_base_handle->ptr = m_heap_base_cpu.ptr + base_index * m_descriptor_increment_size;
+  if (out_gpu_base_handle)
+    out_gpu_base_handle->ptr = m_heap_base_gpu.ptr + base_index * m_descriptor_increment_size;
+  return true;
+}
+
+void D3DDescriptorHeapManager::FreeGroupDeferred(size_t base_index)
+{
+  ASSERT(base_index >= m_temporary_slots && base_index < m_temporary_slots + GroupRegionSize());
+  m_pending_group_frees.push_back(base_index);
+}
+
+void D3DDescriptorHeapManager::ReclaimDeferredGroups(bool wait)
+{
+  while (!m_inflight_group_frees.empty())
+  {
+    const auto& front = m_inflight_group_frees.front();
+    if (m_fence->GetCompletedValue() < front.first)
+    {
+      if (!wait)
+        return;
+      D3D::command_list_mgr->WaitOnCPUForFence(m_fence, front.first);
+    }
+    for (size_t base_index : front.second)
+      m_groups.ReleaseSlot(static_cast<int>((base_index - m_temporary_slots) / m_group_width));
+    m_inflight_group_frees.pop_front();
+  }
 }
 
 bool D3DDescriptorHeapManager::AllocateTemporary(size_t num_handles,
@@ -155,6 +217,15 @@ void D3DDescriptorHeapManager::QueueFenceCallback(void* owner, u64 fence_value)
 {
   D3DDescriptorHeapManager* this_ptr = reinterpret_cast<D3DDescriptorHeapManager*>(owner);
 
+  // Group frees queued since the last fence can be released once this fence
+  // passes.
+  if (!this_ptr->m_pending_group_frees.empty())
+  {
+    this_ptr->m_inflight_group_frees.emplace_back(fence_value,
+      std::move(this_ptr->m_pending_group_frees));
+    this_ptr->m_pending_group_frees.clear();
+  }
+
   // Don't add a new entry when the offset doesn't change.
   size_t current_index = this_ptr->m_current_temporary_descriptor_index;
   if (!this_ptr->m_fences.empty() && this_ptr->m_fences.back().second == current_index)
@@ -167,7 +238,9 @@ std::unique_ptr<D3DDescriptorHeapManager> D3DDescriptorHeapManager::Create(ID3D1
   D3D12_DESCRIPTOR_HEAP_TYPE type,
   D3D12_DESCRIPTOR_HEAP_FLAGS flags,
   size_t num_descriptors,
-  size_t temporary_slots)
+  size_t temporary_slots,
+  size_t group_slots,
+  size_t group_width)
 {
   D3D12_DESCRIPTOR_HEAP_DESC desc = {
       type,                               // D3D12_DESCRIPTOR_HEAP_TYPE Type
@@ -235,7 +308,9 @@ std::unique_ptr<D3DDescriptorHeapManager> D3DDescriptorHeapManager::Create(ID3D1
     shadow_descriptor_heap,
     num_descriptors,
     increment_size,
-    temporary_slots);
+    temporary_slots,
+    group_slots,
+    group_width);
 }
 
 D3DSamplerHeapManager::D3DSamplerHeapManager(std::array<ID3D12DescriptorHeap*, HEAP_COUNT>& descriptor_heap,
@@ -5,8 +5,10 @@
 #pragma once
 
 #include <d3d12.h>
+#include <deque>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/AllocationMap.h"
 #include "VideoBackends/D3D12/D3DState.h"
@@ -24,7 +26,9 @@ public:
     ID3D12DescriptorHeap* shadow_descriptor_heap,
     size_t num_descriptors,
     size_t descriptor_increment_size,
-    size_t temporary_slots);
+    size_t temporary_slots,
+    size_t group_slots,
+    size_t group_width);
   ~D3DDescriptorHeapManager();
 
   ID3D12DescriptorHeap* GetDescriptorHeap() const { return m_descriptor_heap; }
@@ -40,11 +44,25 @@ public:
     D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
     D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle);
 
+  // Persistent, contiguous runs of group_width descriptors for cached
+  // descriptor tables that outlive a single command list (see
+  // TextureCache::BindTextures). Returns false once the group region is
+  // exhausted and nothing can be reclaimed.
+  bool AllocateGroup(size_t* out_base_index,
+    D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
+    D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle);
+
+  // Queues a group for release once the GPU has consumed every command list
+  // queued so far; in-flight draws may still reference its descriptors.
+  void FreeGroupDeferred(size_t base_index);
+
   static std::unique_ptr<D3DDescriptorHeapManager> Create(ID3D12Device* device,
     D3D12_DESCRIPTOR_HEAP_TYPE type,
     D3D12_DESCRIPTOR_HEAP_FLAGS flags,
     size_t num_descriptors,
-    size_t temporary_slots = 0);
+    size_t temporary_slots = 0,
+    size_t group_slots = 0,
+    size_t group_width = 0);
 
 private:
   static void QueueFenceCallback(void* owner, u64 fence_value);
@@ -53,17 +71,31 @@ private:
     D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
     D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle);
 
+  bool TryAllocateGroup(size_t* out_base_index,
+    D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu_base_handle,
+    D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu_base_handle);
+  // Releases deferred group frees whose fence has passed; when wait is set,
+  // blocks on the oldest outstanding fence first.
+  void ReclaimDeferredGroups(bool wait);
+
+  size_t GroupRegionSize() const { return m_group_slots * m_group_width; }
+
   ID3D12DescriptorHeap* m_descriptor_heap;
   ID3D12DescriptorHeap* m_shadow_descriptor_heap;
   size_t m_num_descriptors;
   size_t m_descriptor_increment_size;
   size_t m_temporary_slots;
+  size_t m_group_slots;
+  size_t m_group_width;
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_CPU_DESCRIPTOR_HANDLE m_shadow_heap_base = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
 
   Common::AllocationMap m_slots;
+  // Allocated at group granularity; group g occupies heap indices
+  // [m_temporary_slots + g * m_group_width, ... + m_group_width).
+  Common::AllocationMap m_groups;
 
   size_t m_current_temporary_descriptor_index = 0;
   size_t m_gpu_temporary_descriptor_index = 0;
@@ -71,6 +103,11 @@ private:
   // Fences tracking GPU index
   std::deque<std::pair<u64, size_t>> m_fences;
   ID3D12Fence* m_fence = nullptr;
+
+  // Group frees waiting for the next queue fence, and, once a fence is
+  // issued, for the GPU to pass it.
+  std::vector<size_t> m_pending_group_frees;
+  std::deque<std::pair<u64, std::vector<size_t>>> m_inflight_group_frees;
 };
 
 class D3DSamplerHeapManager
@@ -415,7 +415,9 @@ ID3D12QueuedCommandList::ID3D12QueuedCommandList(ID3D12GraphicsCommandList* back
 
   m_queue_array_back = m_queue_array;
 
-  m_begin_execution_event = CreateSemaphore(nullptr, 0, 256, nullptr);
+  // The max count has to cover every kick that can be outstanding at once;
+  // with per-draw-batch kicks that can run into the hundreds on heavy frames.
+  m_begin_execution_event = CreateSemaphore(nullptr, 0, 16384, nullptr);
   m_stop_execution_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 
   m_background_thread = std::thread(BackgroundThreadFunction, this);
@@ -453,6 +455,26 @@ void ID3D12QueuedCommandList::ResetQueueOverflowTracking()
   m_queue_array_back_at_start_of_frame = m_queue_array_back;
 }
 
+void ID3D12QueuedCommandList::KickQueue()
+{
+  // The Stop item is only a safe read boundary for the background thread -
+  // items past it may still be mid-write on this thread. It carries none of
+  // the stop flags, so the background thread records everything up to it
+  // into the backing command list and then waits for the next kick.
+  D3DQueueItem* item = reinterpret_cast<D3DQueueItem*>(m_queue_array_back);
+
+  item->Type = D3DQueueItemType::Stop;
+  item->Stop.eligible_to_move_to_front_of_queue = false;
+  item->Stop.signal_stop_event = false;
+  item->Stop.terminate_worker_thread = false;
+
+  m_queue_array_back += BufferOffsetForQueueItemType<StopArguments>();
+
+  ReleaseSemaphore(m_begin_execution_event, 1, nullptr);
+
+  CheckForOverflow();
+}
+
 void ID3D12QueuedCommandList::QueueExecute()
 {
   reinterpret_cast<D3DQueueItem*>(m_queue_array_back)->Type = D3DQueueItemType::ExecuteCommandList;
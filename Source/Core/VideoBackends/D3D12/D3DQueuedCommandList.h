@@ -284,6 +284,11 @@ public:
 
   void ProcessQueuedItems(bool eligible_to_move_to_front_of_queue = false, bool wait_for_stop = false, bool terminate_worker_thread = false);
 
+  // Publishes the items queued so far to the background thread without
+  // closing or executing the command list, so recording into the backing
+  // command list overlaps the rest of the frame.
+  void KickQueue();
+
   void QueueExecute();
   void QueueFenceGpuSignal(ID3D12Fence* fence_to_signal, UINT64 fence_value);
   void QueueFenceCpuSignal(ID3D12Fence* fence_to_signal, UINT64 fence_value);
@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <vector>
+
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
@@ -28,8 +30,94 @@ namespace DX12
 {
 
 static bool s_cache_is_corrupted = false;
+// Number of entries whose cached blobs the driver rejected during the last read
+// (typically after a driver or hardware change). The disk keys themselves are
+// driver independent, so these pipelines can be rebuilt instead of being lost.
+static u32 s_outdated_blob_count = 0;
+// Every key read from the current file, kept so the cache can be rewritten with
+// fresh blobs when the old ones have gone stale.
+static std::vector<SmallPsoDiskDesc> s_loaded_descs;
 LinearDiskCache<SmallPsoDiskDesc, u8> s_pso_disk_cache;
 
+// Rebuilds the full pipeline description from the driver-independent disk key.
+// Returns false if the shader modules referenced by the key are missing, which
+// indicates the file itself is corrupt.
+static bool ReconstructPsoFromDiskDesc(const SmallPsoDiskDesc& key,
+  D3D12_GRAPHICS_PIPELINE_STATE_DESC* pso_desc, SmallPsoDesc* out_small_desc)
+{
+  D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc = *pso_desc;
+  desc = {};
+  desc.GS = ShaderCache::GetGeometryShaderFromUid(key.gs_uid);
+  if (key.using_uber_pixel_shader)
+  {
+    desc.PS = ShaderCache::GetPixelUberShaderFromUid(key.pus_uid);
+  }
+  else
+  {
+    desc.PS = ShaderCache::GetPixelShaderFromUid(key.ps_uid);
+  }
+  if (key.using_uber_vertex_shader)
+  {
+    desc.VS = ShaderCache::GetVertexUberShaderFromUid(key.vus_uid);
+  }
+  else
+  {
+    desc.VS = ShaderCache::GetVertexShaderFromUid(key.vs_uid);
+  }
+  desc.HS = ShaderCache::GetHullShaderFromUid(key.hds_uid);
+  desc.DS = ShaderCache::GetDomainShaderFromUid(key.hds_uid);
+  D3D::SetRootSignature(desc.GS.pShaderBytecode != nullptr, desc.HS.pShaderBytecode != nullptr, false);
+  desc.pRootSignature = D3D::GetRootSignature(static_cast<size_t>(key.root_signature_index));
+  desc.RTVFormats[0] = key.rtformat; // This state changes in PSTextureEncoder::Encode.
+  desc.DSVFormat = DXGI_FORMAT_D32_FLOAT; // This state changes in PSTextureEncoder::Encode.
+  desc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
+  desc.NumRenderTargets = 1;
+  desc.SampleMask = UINT_MAX;
+  desc.SampleDesc = key.sample_desc;
+
+  if (!desc.PS.pShaderBytecode || !desc.VS.pShaderBytecode)
+  {
+    return false;
+  }
+
+  BlendingState blend_state = {};
+  blend_state.hex = key.blend_state_hex;
+  desc.BlendState = StateCache::GetDesc(blend_state);
+
+  DepthState depth_stencil_state = {};
+  depth_stencil_state.hex = key.depth_stencil_state_hex;
+  desc.DepthStencilState = StateCache::GetDesc(depth_stencil_state);
+
+  RasterizationState rasterizer_state = {};
+  rasterizer_state.hex = key.rasterizer_state_hex;
+  desc.RasterizerState = StateCache::GetDesc(rasterizer_state);
+
+  desc.PrimitiveTopologyType = key.topology;
+
+  // search for a cached native vertex format
+  const PortableVertexDeclaration& native_vtx_decl = key.vertex_declaration;
+  NativeVertexFormat* native = VertexLoaderManager::GetOrCreateMatchingFormat(native_vtx_decl);
+
+  desc.InputLayout = static_cast<D3DVertexFormat*>(native)->GetActiveInputLayout();
+
+  SmallPsoDesc& small_desc = *out_small_desc;
+  small_desc = {};
+  small_desc.using_uber_pixel_shader = key.using_uber_pixel_shader;
+  small_desc.using_uber_vertex_shader = key.using_uber_vertex_shader;
+  small_desc.blend_state.hex = key.blend_state_hex;
+  small_desc.depth_stencil_state.hex = key.depth_stencil_state_hex;
+  small_desc.rasterizer_state.hex = key.rasterizer_state_hex;
+  small_desc.gs_bytecode = desc.GS;
+  small_desc.vs_bytecode = desc.VS;
+  small_desc.ps_bytecode = desc.PS;
+  small_desc.hs_bytecode = desc.HS;
+  small_desc.ds_bytecode = desc.DS;
+  small_desc.input_Layout = static_cast<D3DVertexFormat*>(native);
+  small_desc.sample_count = key.sample_desc.Count;
+  small_desc.rtformat = key.rtformat;
+  return true;
+}
+
 class PipelineStateCacheInserter : public LinearDiskCacheReader<SmallPsoDiskDesc, u8>
 {
 public:
@@ -39,59 +127,14 @@ public:
       return;
 
     D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
-    desc.GS = ShaderCache::GetGeometryShaderFromUid(key.gs_uid);
-    if (key.using_uber_pixel_shader)
-    {
-      desc.PS = ShaderCache::GetPixelUberShaderFromUid(key.pus_uid);
-    }
-    else
-    {
-      desc.PS = ShaderCache::GetPixelShaderFromUid(key.ps_uid);
-    }
-    if (key.using_uber_vertex_shader)
-    {
-      desc.VS = ShaderCache::GetVertexShaderFromUid(key.vs_uid);
-    }
-    else
-    {
-      desc.VS = ShaderCache::GetVertexUberShaderFromUid(key.vus_uid);
-    }
-    desc.HS = ShaderCache::GetHullShaderFromUid(key.hds_uid);
-    desc.DS = ShaderCache::GetDomainShaderFromUid(key.hds_uid);
-    D3D::SetRootSignature(desc.GS.pShaderBytecode != nullptr, desc.HS.pShaderBytecode != nullptr, false);
-    desc.pRootSignature = D3D::GetRootSignature(static_cast<size_t>(key.root_signature_index));
-    desc.RTVFormats[0] = key.rtformat; // This state changes in PSTextureEncoder::Encode.
-    desc.DSVFormat = DXGI_FORMAT_D32_FLOAT; // This state changes in PSTextureEncoder::Encode.
-    desc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
-    desc.NumRenderTargets = 1;
-    desc.SampleMask = UINT_MAX;
-    desc.SampleDesc = key.sample_desc;
-
-    if (!desc.PS.pShaderBytecode || !desc.VS.pShaderBytecode)
+    SmallPsoDesc small_desc = {};
+    if (!ReconstructPsoFromDiskDesc(key, &desc, &small_desc))
     {
       s_cache_is_corrupted = true;
       return;
     }
 
-    BlendingState blend_state = {};
-    blend_state.hex = key.blend_state_hex;
-    desc.BlendState = StateCache::GetDesc(blend_state);
-
-    DepthState depth_stencil_state = {};
-    depth_stencil_state.hex = key.depth_stencil_state_hex;
-    desc.DepthStencilState = StateCache::GetDesc(depth_stencil_state);
-
-    RasterizationState rasterizer_state = {};
-    rasterizer_state.hex = key.rasterizer_state_hex;
-    desc.RasterizerState = StateCache::GetDesc(rasterizer_state);
-
-    desc.PrimitiveTopologyType = key.topology;
-
-    // search for a cached native vertex format
-    const PortableVertexDeclaration& native_vtx_decl = key.vertex_declaration;
-    NativeVertexFormat* native = VertexLoaderManager::GetOrCreateMatchingFormat(native_vtx_decl);
-
-    desc.InputLayout = static_cast<D3DVertexFormat*>(native)->GetActiveInputLayout();
+    s_loaded_descs.push_back(key);
 
     desc.CachedPSO.CachedBlobSizeInBytes = value_size;
     desc.CachedPSO.pCachedBlob = value;
@@ -101,26 +144,13 @@ public:
 
     if (FAILED(hr))
     {
-      // Failure can occur if disk cache is corrupted, or a driver upgrade invalidates the existing blobs.
-      // In this case, we need to clear the disk cache.
-      s_cache_is_corrupted = true;
+      // The blob was produced by a different driver/HW revision. The key still
+      // fully describes the pipeline, so rebuild it from scratch after the read
+      // instead of throwing the whole cache away.
+      s_outdated_blob_count++;
       return;
     }
 
-    SmallPsoDesc small_desc = {};
-    small_desc.using_uber_pixel_shader = key.using_uber_pixel_shader;
-    small_desc.using_uber_vertex_shader = key.using_uber_vertex_shader;
-    small_desc.blend_state.hex = key.blend_state_hex;
-    small_desc.depth_stencil_state.hex = key.depth_stencil_state_hex;
-    small_desc.rasterizer_state.hex = key.rasterizer_state_hex;
-    small_desc.gs_bytecode = desc.GS;
-    small_desc.vs_bytecode = desc.VS;
-    small_desc.ps_bytecode = desc.PS;
-    small_desc.hs_bytecode = desc.HS;
-    small_desc.ds_bytecode = desc.DS;
-    small_desc.input_Layout = static_cast<D3DVertexFormat*>(native);
-    small_desc.sample_count = key.sample_desc.Count;
-    small_desc.rtformat = key.rtformat;
     s_gx_state_cache.m_small_pso_map[small_desc] = pso;
   }
 };
@@ -144,15 +174,15 @@ void StateCache::LoadFromDisk()
   std::string cache_filename = GetDiskShaderCacheFileName(API_D3D11, "pso", true, true);
 
   PipelineStateCacheInserter inserter;
+  s_loaded_descs.clear();
+  s_outdated_blob_count = 0;
   s_pso_disk_cache.OpenAndRead(cache_filename, inserter);
 
   if (s_cache_is_corrupted)
   {
-    // If a PSO fails to create, that means either:
-    // - The file itself is corrupt.
-    // - A driver/HW change has occured, causing the existing cache blobs to be invalid.
-    // 
-    // In either case, we want to re-create the disk cache. This should not be a frequent occurence.
+    // A key referenced shader modules that don't exist, so the file itself is
+    // corrupt and nothing in it can be trusted. Re-create the disk cache.
+    // This should not be a frequent occurence.
 
     s_pso_disk_cache.Close();
 
@@ -163,7 +193,56 @@ void StateCache::LoadFromDisk()
     s_pso_disk_cache.OpenAndRead(cache_filename, inserter);
 
     s_cache_is_corrupted = false;
+    s_loaded_descs.clear();
+    s_outdated_blob_count = 0;
+    return;
   }
+
+  if (s_outdated_blob_count > 0)
+  {
+    // A driver/HW change invalidated the cached blobs, but the keys still
+    // record the complete pipeline set this game has used. Rebuild every PSO
+    // from its key and rewrite the file with blobs the current driver accepts,
+    // so the warm-up survives driver upgrades instead of starting cold.
+    INFO_LOG(VIDEO, "Rebuilding %u outdated PSO cache blobs (%u total pipelines).",
+      s_outdated_blob_count, static_cast<u32>(s_loaded_descs.size()));
+
+    s_pso_disk_cache.Close();
+    File::Delete(cache_filename);
+    s_pso_disk_cache.OpenAndRead(cache_filename, inserter);
+
+    for (const SmallPsoDiskDesc& key : s_loaded_descs)
+    {
+      D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
+      SmallPsoDesc small_desc = {};
+      if (!ReconstructPsoFromDiskDesc(key, &desc, &small_desc))
+        continue;
+
+      ComPtr<ID3D12PipelineState> pso;
+      auto it = s_gx_state_cache.m_small_pso_map.find(small_desc);
+      if (it != s_gx_state_cache.m_small_pso_map.end())
+      {
+        pso = it->second;
+      }
+      else
+      {
+        HRESULT hr = D3D::device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pso.ReleaseAndGetAddressOf()));
+        if (FAILED(hr))
+          continue;
+        s_gx_state_cache.m_small_pso_map[small_desc] = pso;
+      }
+
+      ComPtr<ID3DBlob> pso_blob;
+      if (SUCCEEDED(pso->GetCachedBlob(pso_blob.ReleaseAndGetAddressOf())))
+      {
+        s_pso_disk_cache.Append(key, reinterpret_cast<const u8*>(pso_blob->GetBufferPointer()),
+          static_cast<u32>(pso_blob->GetBufferSize()));
+      }
+    }
+  }
+
+  s_loaded_descs.clear();
+  s_outdated_blob_count = 0;
 }
 
 void StateCache::Reload()
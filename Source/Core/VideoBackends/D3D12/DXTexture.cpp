@@ -16,8 +16,10 @@
 #include "VideoBackends/D3D12/D3DTexture.h"
 #include "VideoBackends/D3D12/DXTexture.h"
 #include "VideoBackends/D3D12/StaticShaderCache.h"
+#include "VideoBackends/D3D12/TextureCache.h"
 
 #include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/TextureDumpQueue.h"
 #include "VideoCommon/TextureConfig.h"
 
 namespace DX12
@@ -88,6 +90,13 @@ DXTexture::DXTexture(const TextureConfig& tex_config) : HostTexture(tex_config)
 
 DXTexture::~DXTexture()
 {
+  // The texture cache's descriptor groups may reference this texture; make
+  // sure the next BindTextures() rebuilds them instead of reusing a group
+  // whose SRV slot gets recycled.
+  if (D3D::command_list_mgr)
+    D3D::command_list_mgr->SetCommandListDirtyState(COMMAND_LIST_STATE_SRV, true);
+  if (D3D::gpu_descriptor_heap_mgr && m_texture && m_texture->GetSRVCPUShadow().ptr)
+    TextureCache::InvalidateSRVCache(m_texture->GetSRVCPUShadow().ptr);
   m_texture->Release();
 }
 
@@ -153,10 +162,11 @@ bool DXTexture::Save(const std::string& filename, u32 level)
   D3D12_RANGE read_range = { 0, required_readback_buffer_size };
   CheckHR(readback_buffer->Map(0, &read_range, &readback_texture_map));
 
-  bool saved = false;
+  // The queue copies the pixel data before returning, so the readback buffer
+  // can be released right away while the encode runs in the background.
   if (this->compressed)
   {
-    saved = TextureToDDS(
+    TextureDumpQueue::QueueDDS(
       static_cast<u8*>(readback_texture_map),
       dst_location.PlacedFootprint.Footprint.RowPitch,
       filename,
@@ -166,7 +176,7 @@ bool DXTexture::Save(const std::string& filename, u32 level)
   }
   else
   {
-    saved = TextureToPng(
+    TextureDumpQueue::QueuePNG(
       static_cast<u8*>(readback_texture_map),
       dst_location.PlacedFootprint.Footprint.RowPitch,
       filename,
@@ -178,7 +188,7 @@ bool DXTexture::Save(const std::string& filename, u32 level)
   D3D12_RANGE write_range = {};
   readback_buffer->Unmap(0, &write_range);
   readback_buffer->Release();
-  return saved;
+  return true;
 }
 
 void DXTexture::CopyTexture(D3DTexture2D* source, D3DTexture2D* destination,
@@ -16,6 +16,7 @@
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/HLSLCompiler.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/ObjectUsageProfiler.h"
 
 namespace DX12
@@ -86,6 +87,7 @@ static UberShader::PixelUberShaderUid s_last_pixel_uber_shader_uid;
 static UberShader::VertexUberShaderUid s_last_vertex_uber_shader_uid;
 static bool s_use_pixel_uber_shader = false;
 static bool s_use_vertex_uber_shader = false;
+static bool s_last_tessellation_enabled = false;
 
 static HLSLAsyncCompiler *s_compiler;
 
@@ -960,6 +962,7 @@ void ShaderCache::PrepareShaders(PIXEL_SHADER_RENDER_MODE render_mode,
   bool tessellationenabled = false;
   if (gs_primitive_type == PrimitiveType::Triangles
     && g_ActiveConfig.TessellationEnabled()
+    && !TessellationShaderManager::DrawSkipped()
     && xfr.projection.type == GX_PERSPECTIVE
     && (g_ActiveConfig.bForcedLighting || g_ActiveConfig.PixelLightingEnabled(xfr, components)))
   {
@@ -975,9 +978,13 @@ void ShaderCache::PrepareShaders(PIXEL_SHADER_RENDER_MODE render_mode,
   gs_changed = gs_uid != s_last_geometry_shader_uid;
   ps_changed = ps_uid != s_last_pixel_shader_uid;
   vs_changed = vs_uid != s_last_vertex_shader_uid;
-  ts_changed = tessellationenabled && ts_uid != s_last_tessellation_shader_uid;
+  // A toggle with an unchanged uid (the per-draw coverage skip, or the
+  // projection type flipping) still has to swap the hull/domain bytecodes.
+  const bool ts_toggled = tessellationenabled != s_last_tessellation_enabled;
+  s_last_tessellation_enabled = tessellationenabled;
+  ts_changed = tessellationenabled && (ts_toggled || ts_uid != s_last_tessellation_shader_uid);
 
-  if (!gs_changed && !ps_changed && !vs_changed && !ts_changed)
+  if (!gs_changed && !ps_changed && !vs_changed && !ts_changed && !ts_toggled)
   {
     return;
   }
@@ -2,7 +2,10 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <unordered_map>
 
 #include "Common/Align.h"
 
@@ -39,6 +42,40 @@ static u32 s_efb_copy_last_cbuf_id = UINT_MAX;
 static D3D12_GPU_DESCRIPTOR_HANDLE s_group_base_texture_gpu_handle = { 0 };
 static bool s_handle_changed = false;
 
+// The SRVs the last descriptor group was built from. Consecutive flushes
+// usually draw with the same textures; as long as the command list (and with
+// it the temporary descriptor ring) is still the same, the group can be bound
+// again without allocating and copying descriptors. SRV shadow slots are
+// compared rather than cache entries because entry objects can be freed and
+// reallocated while their textures survive in the pool.
+static std::array<SIZE_T, 8> s_last_bound_srvs{};
+static u32 s_last_bound_mask = 0;
+
+// Persistent descriptor groups: each distinct set of bound SRVs gets a stable
+// 8-wide run in the descriptor heap, built once and rebound by handle on
+// later draws, even across command lists. Games cycle through a small set of
+// texture combinations per frame, so without this every set change re-copied
+// eight descriptors into the transient ring.
+struct CachedTextureGroup
+{
+  size_t base_index;
+  D3D12_GPU_DESCRIPTOR_HANDLE gpu_handle;
+};
+
+struct TextureGroupHash
+{
+  size_t operator()(const std::array<SIZE_T, 8>& srvs) const
+  {
+    size_t hash = 0;
+    for (SIZE_T ptr : srvs)
+      hash = hash * 31 + std::hash<SIZE_T>()(ptr);
+    return hash;
+  }
+};
+
+static std::unordered_map<std::array<SIZE_T, 8>, CachedTextureGroup, TextureGroupHash>
+  s_texture_group_cache;
+
 D3D12_GPU_DESCRIPTOR_HANDLE TextureCache::GetTextureGroupHandle()
 {
   D3D12_GPU_DESCRIPTOR_HANDLE Handle = { 0 };
@@ -410,6 +447,10 @@ TextureCache::TextureCache()
 
 TextureCache::~TextureCache()
 {
+  for (const auto& entry : s_texture_group_cache)
+    D3D::gpu_descriptor_heap_mgr->FreeGroupDeferred(entry.second.base_index);
+  s_texture_group_cache.clear();
+
   s_encoder->Shutdown();
   s_encoder.reset();
 
@@ -423,11 +464,18 @@ void TextureCache::BindTextures()
 {
   const bool use_materials = g_ActiveConfig.HiresMaterialMapsEnabled();
   size_t last_texture = bound_textures.size();
+  u32 bound_mask = 0;
+  std::array<SIZE_T, 8> bound_srvs{};
   for (size_t i = 0; i < bound_textures.size(); ++i)
   {
     if (IsValidBindPoint(static_cast<u32>(i)) && bound_textures[i] != nullptr)
     {
       last_texture = i;
+      bound_mask |= 1u << i;
+      bound_srvs[i] = static_cast<DXTexture*>(bound_textures[i]->texture.get())
+                        ->GetRawTexIdentifier()
+                        ->GetSRVCPUShadow()
+                        .ptr;
     }
   }
   if (last_texture == bound_textures.size())
@@ -445,10 +493,54 @@ void TextureCache::BindTextures()
     return;
   }
 
+  // Same texture set on the same command list: the group copied last time is
+  // still valid in the temporary descriptor ring, so just point the root
+  // table back at it instead of allocating and copying eight descriptors.
+  // The dirty bit resets whenever a command list is executed, and texture
+  // destruction sets it (see DXTexture's destructor) so a recycled entry
+  // pointer cannot alias a stale group.
+  if (!D3D::command_list_mgr->GetCommandListDirtyState(COMMAND_LIST_STATE_SRV) &&
+      bound_mask == s_last_bound_mask && bound_srvs == s_last_bound_srvs)
+  {
+    DX12::D3D::current_command_list->SetGraphicsRootDescriptorTable(DESCRIPTOR_TABLE_PS_SRV,
+      s_group_base_texture_gpu_handle);
+    return;
+  }
+
+  // A group built for this exact SRV set earlier (possibly on a previous
+  // command list) is still valid: the slots are persistent and entries are
+  // dropped when a member texture is destroyed (see InvalidateSRVCache).
+  const auto cached_group = s_texture_group_cache.find(bound_srvs);
+  if (cached_group != s_texture_group_cache.end())
+  {
+    s_group_base_texture_gpu_handle = cached_group->second.gpu_handle;
+    DX12::D3D::current_command_list->SetGraphicsRootDescriptorTable(DESCRIPTOR_TABLE_PS_SRV,
+      s_group_base_texture_gpu_handle);
+    s_last_bound_mask = bound_mask;
+    s_last_bound_srvs = bound_srvs;
+    D3D::command_list_mgr->SetCommandListDirtyState(COMMAND_LIST_STATE_SRV, false);
+    return;
+  }
+
   // If more than one texture, allocate space for group.
   D3D12_CPU_DESCRIPTOR_HANDLE s_group_base_texture_cpu_handle;
   const u32 num_handles = 8;
-  if (!D3D::gpu_descriptor_heap_mgr->AllocateTemporary(num_handles, &s_group_base_texture_cpu_handle, &s_group_base_texture_gpu_handle))
+  size_t group_base_index = 0;
+  bool persistent_group = D3D::gpu_descriptor_heap_mgr->AllocateGroup(
+    &group_base_index, &s_group_base_texture_cpu_handle, &s_group_base_texture_gpu_handle);
+  if (!persistent_group)
+  {
+    // Group region exhausted: retire the whole cache (the frees only take
+    // effect once the GPU is past the in-flight command lists) and rebuild
+    // it on demand.
+    for (const auto& entry : s_texture_group_cache)
+      D3D::gpu_descriptor_heap_mgr->FreeGroupDeferred(entry.second.base_index);
+    s_texture_group_cache.clear();
+    persistent_group = D3D::gpu_descriptor_heap_mgr->AllocateGroup(
+      &group_base_index, &s_group_base_texture_cpu_handle, &s_group_base_texture_gpu_handle);
+  }
+  if (!persistent_group &&
+    !D3D::gpu_descriptor_heap_mgr->AllocateTemporary(num_handles, &s_group_base_texture_cpu_handle, &s_group_base_texture_gpu_handle))
   {
     // Kick command buffer before attempting to allocate again. This is slow.
     D3D::command_list_mgr->ExecuteQueuedWork();
@@ -486,6 +578,33 @@ void TextureCache::BindTextures()
   // Actually bind the textures.
   DX12::D3D::current_command_list->SetGraphicsRootDescriptorTable(DESCRIPTOR_TABLE_PS_SRV,
     s_group_base_texture_gpu_handle);
+
+  if (persistent_group)
+  {
+    s_texture_group_cache.emplace(
+      bound_srvs, CachedTextureGroup{group_base_index, s_group_base_texture_gpu_handle});
+  }
+
+  s_last_bound_mask = bound_mask;
+  s_last_bound_srvs = bound_srvs;
+  D3D::command_list_mgr->SetCommandListDirtyState(COMMAND_LIST_STATE_SRV, false);
+}
+
+void TextureCache::InvalidateSRVCache(SIZE_T srv_shadow_ptr)
+{
+  for (auto iter = s_texture_group_cache.begin(); iter != s_texture_group_cache.end();)
+  {
+    const std::array<SIZE_T, 8>& srvs = iter->first;
+    if (std::find(srvs.begin(), srvs.end(), srv_shadow_ptr) != srvs.end())
+    {
+      D3D::gpu_descriptor_heap_mgr->FreeGroupDeferred(iter->second.base_index);
+      iter = s_texture_group_cache.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
 }
 
 }
@@ -19,6 +19,10 @@ public:
   ~TextureCache();
   static D3D12_GPU_DESCRIPTOR_HANDLE GetTextureGroupHandle();
   virtual void BindTextures();
+  // Drops every cached descriptor group containing the given SRV shadow
+  // slot; called when a texture is destroyed so a recycled slot cannot match
+  // a stale group.
+  static void InvalidateSRVCache(SIZE_T srv_shadow_ptr);
 private: 
 
   HostTextureFormat GetHostTextureFormat(const s32 texformat, const TlutFormat tlutfmt, u32 width, u32 height) override;
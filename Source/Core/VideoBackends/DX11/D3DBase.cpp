@@ -393,6 +393,19 @@ HRESULT Create(HWND wnd)
   hr = factory->MakeWindowAssociation(wnd, DXGI_MWA_NO_WINDOW_CHANGES);
   if (FAILED(hr)) MessageBox(wnd, _T("Failed to associate the window"), _T("Dolphin Direct3D 11 backend"), MB_OK | MB_ICONERROR);
 
+  // DXGI lets Present() queue up to three frames ahead of the GPU by
+  // default, which turns into that many refresh intervals of input latency
+  // once the queue fills. One frame in flight is all the pipelining the
+  // backend needs; anything beyond it only buys latency.
+  {
+    IDXGIDevice1* dxgi_device = nullptr;
+    if (SUCCEEDED(device->QueryInterface(__uuidof(IDXGIDevice1), (void**)&dxgi_device)))
+    {
+      dxgi_device->SetMaximumFrameLatency(1);
+      dxgi_device->Release();
+    }
+  }
+
   SetDebugObjectName(context, "device context");
   SAFE_RELEASE(factory);
   SAFE_RELEASE(output);
@@ -22,6 +22,7 @@
 #include "VideoBackends/DX11/GeometryShaderCache.h"
 
 #include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/TextureDumpQueue.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureConfig.h"
 
@@ -155,19 +156,20 @@ bool DXTexture::Save(const std::string& filename, u32 level)
     return false;
   }
 
-  bool encode_result = false;
+  // The queue copies the pixel data before returning, so the staging texture
+  // can be unmapped right away while the encode runs in the background.
   if (this->compressed)
   {
-    encode_result = TextureToDDS(reinterpret_cast<u8*>(map.pData), map.RowPitch, filename, mip_width, mip_height);
+    TextureDumpQueue::QueueDDS(reinterpret_cast<u8*>(map.pData), map.RowPitch, filename, mip_width, mip_height);
   }
   else
   {
-    encode_result = TextureToPng(reinterpret_cast<u8*>(map.pData), map.RowPitch, filename, mip_width, mip_height);
+    TextureDumpQueue::QueuePNG(reinterpret_cast<u8*>(map.pData), map.RowPitch, filename, mip_width, mip_height);
   }
   D3D::context->Unmap(staging_texture, 0);
   staging_texture->Release();
 
-  return encode_result;
+  return true;
 }
 
 void DXTexture::CopyTexture(D3DTexture2D* source, D3DTexture2D* destination,
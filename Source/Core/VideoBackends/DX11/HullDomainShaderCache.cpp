@@ -277,6 +277,7 @@ void HullDomainShaderCache::PrepareShader(
 {
   if (!(primitiveType == PrimitiveType::Triangles
     && g_ActiveConfig.TessellationEnabled()
+    && !TessellationShaderManager::DrawSkipped()
     && xfr.projection.type == GX_PERSPECTIVE
     && (g_ActiveConfig.bForcedLighting || g_ActiveConfig.PixelLightingEnabled(xfr, components))))
   {
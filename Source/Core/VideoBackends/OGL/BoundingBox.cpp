@@ -19,6 +19,13 @@ alignas(128) static s32 s_values[4];
 static bool s_cpu_dirty;
 static bool s_gpu_dirty;
 
+// Snapshot of the SSBO taken right after the last bounding box draw. Reading
+// the SSBO directly in Get() drains the whole pipeline; copying it into a
+// staging buffer at draw time and fencing means the copy has usually long
+// retired by the time the game queries the result.
+static GLuint s_readback_buffer_id;
+static GLsync s_readback_fence;
+
 namespace OGL
 {
 
@@ -31,6 +38,11 @@ void BBox::Init()
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_bbox_buffer_id);
     glBufferData(GL_SHADER_STORAGE_BUFFER, 4 * sizeof(s32), s_values, GL_DYNAMIC_DRAW);
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, s_bbox_buffer_id);
+    glGenBuffers(1, &s_readback_buffer_id);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, s_readback_buffer_id);
+    glBufferData(GL_COPY_WRITE_BUFFER, 4 * sizeof(s32), nullptr, GL_STREAM_READ);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    s_readback_fence = nullptr;
     s_cpu_dirty = true;
     s_gpu_dirty = true;
   }
@@ -39,7 +51,15 @@ void BBox::Init()
 void BBox::Shutdown()
 {
   if (g_ActiveConfig.backend_info.bSupportsBBox)
+  {
+    if (s_readback_fence)
+    {
+      glDeleteSync(s_readback_fence);
+      s_readback_fence = nullptr;
+    }
+    glDeleteBuffers(1, &s_readback_buffer_id);
     glDeleteBuffers(1, &s_bbox_buffer_id);
+  }
 }
 
 void BBox::Update()
@@ -57,6 +77,26 @@ void BBox::Update()
   }
 }
 
+void BBox::StartReadback()
+{
+  if (g_ActiveConfig.backend_info.bSupportsBBox
+    && g_ActiveConfig.iBBoxMode == BBoxGPU
+    && BoundingBox::active
+    && s_gpu_dirty)
+  {
+    // Each snapshot supersedes the previous one, so a single staging buffer
+    // is enough; queries only ever want the most recent values.
+    if (s_readback_fence)
+      glDeleteSync(s_readback_fence);
+    glBindBuffer(GL_COPY_READ_BUFFER, s_bbox_buffer_id);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, s_readback_buffer_id);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, 4 * sizeof(s32));
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    s_readback_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+}
+
 void BBox::Set(s32 index, s32 value)
 {
   if (s_values[index] != value)
@@ -70,6 +110,22 @@ s32 BBox::Get(s32 index)
 {
   if (s_gpu_dirty && g_ActiveConfig.iBBoxMode == BBoxGPU)
   {
+    if (s_readback_fence)
+    {
+      // The snapshot was taken after the last bounding box draw, so by now the
+      // fence has usually signalled and this returns immediately instead of
+      // draining the pipeline the way a readback of the live SSBO would.
+      glClientWaitSync(s_readback_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+      glDeleteSync(s_readback_fence);
+      s_readback_fence = nullptr;
+      // The staging buffer has no in-flight GPU writes at this point, so a
+      // plain glGetBufferSubData is cheap on every driver.
+      glBindBuffer(GL_COPY_WRITE_BUFFER, s_readback_buffer_id);
+      glGetBufferSubData(GL_COPY_WRITE_BUFFER, 0, 4 * sizeof(s32), s_values);
+      glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+      s_gpu_dirty = false;
+      return s_values[index];
+    }
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_bbox_buffer_id);
     if (!DriverDetails::HasBug(DriverDetails::BUG_SLOW_GETBUFFERSUBDATA))
     {
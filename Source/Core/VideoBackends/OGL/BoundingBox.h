@@ -14,6 +14,7 @@ public:
   static void Shutdown();
 
   static void Update();
+  static void StartReadback();
   static void Set(s32 index, s32 value);
   static s32 Get(s32 index);
 };
@@ -15,6 +15,7 @@
 
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureDumpQueue.h"
 
 namespace OGL
 {
@@ -226,19 +227,18 @@ bool OGLTexture::Save(const std::string& filename, u32 level)
   std::vector<u8> data(size);
   glActiveTexture(GL_TEXTURE9);
   glBindTexture(GL_TEXTURE_2D_ARRAY, m_texId);
-  bool saved = false;
   if (compressed)
   {
     glGetCompressedTexImage(GL_TEXTURE_2D_ARRAY, level, data.data());
-    saved = TextureToDDS(data.data(), width * 4, filename, width, height);
+    TextureDumpQueue::QueueDDS(data.data(), width * 4, filename, width, height);
   }
   else
   {
     glGetTexImage(GL_TEXTURE_2D_ARRAY, level, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-    saved = TextureToPng(data.data(), width * 4, filename, width, height);
+    TextureDumpQueue::QueuePNG(data.data(), width * 4, filename, width, height);
   }
   OGLTexture::SetStage();
-  return saved;
+  return true;
 }
 
 void OGLTexture::CopyRectangleFromTexture(const HostTexture* source,
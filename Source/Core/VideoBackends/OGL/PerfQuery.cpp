@@ -28,7 +28,7 @@ std::unique_ptr<PerfQueryBase> GetPerfQuery()
 }
 
 PerfQuery::PerfQuery()
-  : m_query_read_pos()
+  : m_query_read_pos(), m_flushed_count()
 {
   ResetQuery();
 }
@@ -57,6 +57,7 @@ void PerfQuery::FlushResults()
 void PerfQuery::ResetQuery()
 {
   m_query_count = 0;
+  m_flushed_count = 0;
   std::fill_n(m_results, ArraySize(m_results), 0);
 }
 
@@ -81,6 +82,14 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
     result = m_results[PQG_EFB_COPY_CLOCKS];
   }
 
+  // Reads no longer wait for every query to complete; scale the completed
+  // sum by the fraction of issued queries that have been retrieved, so an
+  // early read sees an estimate of the full count instead of a partial one.
+  const u32 pending = m_query_count;
+  const u32 flushed = m_flushed_count;
+  if (pending != 0 && flushed != 0)
+    result = static_cast<u32>(static_cast<u64>(result) * (flushed + pending) / flushed);
+
   return result;
 }
 
@@ -170,6 +179,7 @@ void PerfQueryGL::FlushOne()
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   --m_query_count;
+  ++m_flushed_count;
 }
 
 // TODO: could selectively flush things, but I don't think that will do much
@@ -258,6 +268,7 @@ void PerfQueryGLESNV::FlushOne()
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   --m_query_count;
+  ++m_flushed_count;
 }
 
 // TODO: could selectively flush things, but I don't think that will do much
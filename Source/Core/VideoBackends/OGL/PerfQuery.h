@@ -42,6 +42,9 @@ protected:
   // This contains gl query objects with unretrieved results.
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer;
   u32 m_query_read_pos;
+  // How many queries have been retrieved since the last reset; together with
+  // m_query_count this gives the completed fraction used for extrapolation.
+  volatile u32 m_flushed_count;
 
 private:
   // Implementation
@@ -2,12 +2,15 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <string>
 
 #include "Common/Align.h"
 #include "Common/Common.h"
+#include "Common/Hash.h"
 #include "Common/MathUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/Timer.h"
 
 #include "Core/Host.h"
 #include "Core/ConfigManager.h"
@@ -22,6 +25,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/ShaderCompileTelemetry.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -172,6 +176,13 @@ void SHADER::Bind()
   }
 }
 
+// Constants stream into a ring buffer (persistently mapped where
+// ARB_buffer_storage is available, see StreamBuffer::Create) and each draw
+// binds its slice with glBindBufferRange, so a dirty stage costs one memcpy
+// and no map/unmap. The full UBO layout has to be written each time - the
+// bound range must cover everything the shader declares - which is why the
+// fine-grained dirty regions the managers can track are only maintained for
+// the D3D9 backend (see VideoBackendBase::InitializeShared).
 void ProgramShaderCache::UploadConstants()
 {
   s32 required_size = 0;
@@ -386,6 +397,8 @@ std::future<bool> ProgramShaderCache::CompileShader(
 bool ProgramShaderCache::CompileShaderWorker(
     SHADER& shader, const char* vcode, const char* pcode, const char* gcode)
 {
+  const u64 compile_start = Common::Timer::GetTimeUs();
+
   GLuint vsid = CompileSingleShader(GL_VERTEX_SHADER, vcode);
   GLuint psid = CompileSingleShader(GL_FRAGMENT_SHADER, pcode);
 
@@ -461,6 +474,14 @@ bool ProgramShaderCache::CompileShaderWorker(
 
   shader.SetProgramVariables();
   shader.glprogid = pid;
+
+  // The pixel shader source alone distinguishes nearly every program; XOR in
+  // the vertex source so programs sharing a pixel shader still differ.
+  const u64 uid_hash =
+      GetHash64(reinterpret_cast<const u8*>(pcode), static_cast<u32>(strlen(pcode)), 0) ^
+      GetHash64(reinterpret_cast<const u8*>(vcode), static_cast<u32>(strlen(vcode)), 0);
+  ShaderCompileTelemetry::RecordCompile("gl-prog", uid_hash,
+    static_cast<u32>(Common::Timer::GetTimeUs() - compile_start));
   return true;
 }
 
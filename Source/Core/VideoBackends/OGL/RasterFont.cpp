@@ -194,7 +194,9 @@ RasterFont::~RasterFont()
 void RasterFont::printMultilineText(const std::string& text, double start_x, double start_y,
   double z, int bbWidth, int bbHeight, u32 color)
 {
-  std::vector<GLfloat> vertices(text.length() * 6 * 4);
+  // resize() keeps the allocation from previous calls around
+  m_vertices.resize(text.length() * 6 * 4);
+  std::vector<GLfloat>& vertices = m_vertices;
 
   int usage = 0;
   GLfloat delta_x = GLfloat(2 * CHARACTER_WIDTH) / GLfloat(bbWidth);
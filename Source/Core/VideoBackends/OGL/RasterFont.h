@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -26,5 +27,7 @@ private:
   u32 texture;
   u32 uniform_color_id;
   u32 uniform_offset_id;
+  // reused between calls so steady-state text rendering doesn't allocate
+  std::vector<float> m_vertices;
 };
 }
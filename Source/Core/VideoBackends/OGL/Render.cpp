@@ -85,6 +85,8 @@ static bool s_efbCacheValid[2][EFB_CACHE_WIDTH * EFB_CACHE_HEIGHT];
 static bool s_efbCacheIsCleared = false;
 static std::vector<u32>
 s_efbCache[2][EFB_CACHE_WIDTH * EFB_CACHE_HEIGHT];  // 2 for PEEK_Z and PEEK_COLOR
+// EFB-space copy of the current scissor rectangle, for scoped cache invalidation.
+static EFBRectangle s_efbScissorRect(0, 0, EFB_WIDTH, EFB_HEIGHT);
 
 static void APIENTRY ErrorCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
   GLsizei length, const char* message, const void* userParam)
@@ -898,6 +900,7 @@ void Renderer::SetScissorRect(const EFBRectangle& trc)
 {
   m_bScissorRectChanged = true;
   m_ScissorRect = trc;
+  s_efbScissorRect = trc;
 }
 
 void Renderer::_SetColorMask()
@@ -917,6 +920,29 @@ void ClearEFBCache()
   }
 }
 
+void ClearEFBCacheScissor()
+{
+  if (s_efbCacheIsCleared)
+    return;
+
+  // Draws are clipped to the scissor rectangle, so only the tiles it overlaps
+  // can have become stale. Games that peek one EFB region while drawing to
+  // another (hit-testing, pictograph) keep their cached tiles this way.
+  u32 tileLeft = static_cast<u32>(s_efbScissorRect.left) / EFB_CACHE_RECT_SIZE;
+  u32 tileTop = static_cast<u32>(s_efbScissorRect.top) / EFB_CACHE_RECT_SIZE;
+  u32 tileRight = std::min<u32>((s_efbScissorRect.right + EFB_CACHE_RECT_SIZE - 1) / EFB_CACHE_RECT_SIZE, EFB_CACHE_WIDTH);
+  u32 tileBottom = std::min<u32>((s_efbScissorRect.bottom + EFB_CACHE_RECT_SIZE - 1) / EFB_CACHE_RECT_SIZE, EFB_CACHE_HEIGHT);
+
+  for (u32 yTile = tileTop; yTile < tileBottom; ++yTile)
+  {
+    for (u32 xTile = tileLeft; xTile < tileRight; ++xTile)
+    {
+      s_efbCacheValid[0][yTile * EFB_CACHE_WIDTH + xTile] = false;
+      s_efbCacheValid[1][yTile * EFB_CACHE_WIDTH + xTile] = false;
+    }
+  }
+}
+
 void Renderer::UpdateEFBCache(EFBAccessType type, u32 cacheRectIdx, const EFBRectangle& efbPixelRc,
   const TargetRectangle& targetPixelRc, const void* data)
 {
@@ -929,30 +955,34 @@ void Renderer::UpdateEFBCache(EFBAccessType type, u32 cacheRectIdx, const EFBRec
   u32 efbPixelRcHeight = efbPixelRc.bottom - efbPixelRc.top;
   u32 efbPixelRcWidth = efbPixelRc.right - efbPixelRc.left;
 
+  // Both readbacks arrive as 32-bit values in the layout the cache stores
+  // (depth is read back as 24.8 fixed point and just trimmed below), so
+  // filling a cache rect is a gather of plain loads. The scaled-x mapping
+  // only depends on the column; compute it once per rect, not per pixel.
+  u32 x_map[EFB_CACHE_RECT_SIZE];
+  for (u32 xCache = 0; xCache < efbPixelRcWidth; ++xCache)
+  {
+    u32 xEFB = efbPixelRc.left + xCache;
+    x_map[xCache] = (EFBToScaledX(xEFB) + EFBToScaledX(xEFB + 1)) / 2 - targetPixelRc.left;
+  }
+
   for (u32 yCache = 0; yCache < efbPixelRcHeight; ++yCache)
   {
     u32 yEFB = efbPixelRc.top + yCache;
     u32 yPixel = (EFBToScaledY(EFB_HEIGHT - yEFB) + EFBToScaledY(EFB_HEIGHT - yEFB - 1)) / 2;
     u32 yData = yPixel - targetPixelRc.bottom;
 
-    for (u32 xCache = 0; xCache < efbPixelRcWidth; ++xCache)
+    const u32* src = static_cast<const u32*>(data) + yData * targetPixelRcWidth;
+    u32* dst = &s_efbCache[cacheType][cacheRectIdx][yCache * EFB_CACHE_RECT_SIZE];
+    if (type == EFBAccessType::PeekZ)
     {
-      u32 xEFB = efbPixelRc.left + xCache;
-      u32 xPixel = (EFBToScaledX(xEFB) + EFBToScaledX(xEFB + 1)) / 2;
-      u32 xData = xPixel - targetPixelRc.left;
-      u32 value;
-      if (type == EFBAccessType::PeekZ)
-      {
-        float* ptr = (float*)data;
-        value = MathUtil::Clamp<u32>((u32)(ptr[yData * targetPixelRcWidth + xData] * 16777216.0f),
-          0, 0xFFFFFF);
-      }
-      else
-      {
-        u32* ptr = (u32*)data;
-        value = ptr[yData * targetPixelRcWidth + xData];
-      }
-      s_efbCache[cacheType][cacheRectIdx][yCache * EFB_CACHE_RECT_SIZE + xCache] = value;
+      for (u32 xCache = 0; xCache < efbPixelRcWidth; ++xCache)
+        dst[xCache] = src[x_map[xCache]] >> 8;
+    }
+    else
+    {
+      for (u32 xCache = 0; xCache < efbPixelRcWidth; ++xCache)
+        dst[xCache] = src[x_map[xCache]];
     }
   }
 
@@ -1018,10 +1048,13 @@ u32 Renderer::AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data)
         RestoreAPIState();
       }
 
-      std::unique_ptr<float[]> depthMap(new float[targetPixelRcWidth * targetPixelRcHeight]);
+      // Have the driver deliver fixed-point depth; the float-to-integer
+      // conversion happens GPU/driver-side and the cache fill above ends up
+      // as a load and a shift per pixel instead of a float multiply + clamp.
+      std::unique_ptr<u32[]> depthMap(new u32[targetPixelRcWidth * targetPixelRcHeight]);
 
       glReadPixels(targetPixelRc.left, targetPixelRc.bottom, targetPixelRcWidth,
-        targetPixelRcHeight, GL_DEPTH_COMPONENT, GL_FLOAT, depthMap.get());
+        targetPixelRcHeight, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, depthMap.get());
 
       UpdateEFBCache(type, cacheRectIdx, efbPixelRc, targetPixelRc, depthMap.get());
     }
@@ -1625,7 +1658,6 @@ void Renderer::FlushFrameDump()
   if (!m_last_frame_exported)
     return;
 
-  FinishFrameData();
   glBindBuffer(GL_PIXEL_PACK_BUFFER, m_frame_dumping_pbo[0]);
   m_frame_pbo_is_mapped[0] = true;
   void* data = glMapBufferRange(
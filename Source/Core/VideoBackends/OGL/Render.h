@@ -13,6 +13,9 @@ struct XFBSourceBase;
 namespace OGL
 {
 void ClearEFBCache();
+// Invalidates only the cache tiles the current scissor rectangle touches;
+// draws cannot write EFB pixels outside of it.
+void ClearEFBCacheScissor();
 
 enum GLSL_VERSION
 {
@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <vector>
+
 #include "Common/Align.h"
 #include "Common/MemoryUtil.h"
 #include "Common/GL/GLUtil.h"
@@ -24,18 +26,10 @@ static u32 GenBuffer()
 }
 
 StreamBuffer::StreamBuffer(u32 type, u32 size, u32 align_size, bool need_cpu_buffer)
-  : m_buffer(GenBuffer()),
-  m_buffertype(type),
-  m_size(Common::AlignUpSizePow2(ROUND_UP_POW2(size), align_size)),
-  m_bit_per_slot(IntLog2(Common::AlignUpSizePow2(ROUND_UP_POW2(size), align_size) / SYNC_POINTS))
+  : StreamBufferRing(Common::AlignUpSizePow2(ROUND_UP_POW2(size), align_size)),
+  m_buffer(GenBuffer()),
+  m_buffertype(type)
 {
-  m_iterator = 0;
-  m_used_iterator = 0;
-  m_free_iterator = 0;
-  for (int i = 0; i < SYNC_POINTS; i++)
-  {
-    m_fences[i] = 0;
-  }
 }
 
 
@@ -44,89 +38,24 @@ StreamBuffer::~StreamBuffer()
   glDeleteBuffers(1, &m_buffer);
 }
 
-/* Shared synchronization code for ring buffers
-*
-* The next three functions are to create/delete/use the OpenGL synchronization.
-* ARB_sync (OpenGL 3.2) is used and required.
-*
-* To reduce overhead, the complete buffer is splitted up into SYNC_POINTS chunks.
-* For each of this chunks, there is a fence which checks if this chunk is still in use.
-*
-* As our API allows to alloc more memory then it has to use, we have to catch how much is already written.
-*
-* m_iterator      - writing position
-* m_free_iterator - last position checked if free
-* m_used_iterator - last position known to be written
-*
-* So on alloc, we have to wait for all slots between m_free_iterator and m_iterator (and set m_free_iterator to m_iterator afterwards).
-*
-* We also assume that this buffer is accessed by the GPU between the Unmap and Map function,
-* so we may create the fences on the start of mapping.
-* Some here, new fences for the chunks between m_used_iterator and m_iterator (also update m_used_iterator).
-*
-* As ring buffers have an ugly behavior on rollover, have fun to read this code ;)
+/* The ring allocation and rollover logic lives in StreamBufferRing; these
+* three primitives map it onto ARB_sync (OpenGL 3.2), which is required.
 */
 
-void StreamBuffer::CreateFences()
+StreamBuffer::FenceHandle StreamBuffer::InsertFence()
 {
-  for (int i = 0; i < SYNC_POINTS; i++)
-  {
-    m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-  }
+  return reinterpret_cast<uintptr_t>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
 }
-void StreamBuffer::DeleteFences()
+
+void StreamBuffer::WaitFence(FenceHandle fence)
 {
-  for (int i = 0; i < SYNC_POINTS; i++)
-  {
-    if (m_fences[i])
-    {
-      glDeleteSync(m_fences[i]);
-    }
-    m_fences[i] = 0;
-  }
+  glClientWaitSync(reinterpret_cast<GLsync>(static_cast<uintptr_t>(fence)),
+    GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
 }
-void StreamBuffer::AllocMemory(u32 size)
-{
-  // insert waiting slots for used memory
-  for (int i = Slot(m_used_iterator); i < Slot(m_iterator); i++)
-  {
-    if (!m_fences[i])
-    {
-      m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-    }
-  }
-  m_used_iterator = m_iterator;
-  u32 start_fence = Slot(m_free_iterator) + 1;
-  // if buffer is full
-  if (m_iterator + size >= m_size)
-  {
-    // insert waiting slots in unused space at the end of the buffer
-    for (int i = Slot(m_used_iterator); i < SYNC_POINTS; i++)
-    {
-      if (!m_fences[i])
-      {
-        glDeleteSync(m_fences[i]);
-      }
-      m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-    }
-
-    // move to the start
-    m_used_iterator = m_iterator = 0; // offset 0 is always aligned
 
-    // wait for space at the start
-    start_fence = 0;
-  }
-  u32 end_fence = std::min(Slot(m_iterator + size), SYNC_POINTS - 1);
-  for (u32 i = start_fence; i <= end_fence; i++)
-  {
-    if (m_fences[i])
-    {
-      glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
-      glDeleteSync(m_fences[i]);
-      m_fences[i] = 0;
-    }
-  }
-  m_free_iterator = m_iterator + size;
+void StreamBuffer::ReleaseFence(FenceHandle fence)
+{
+  glDeleteSync(reinterpret_cast<GLsync>(static_cast<uintptr_t>(fence)));
 }
 
 /* The usual way to stream data to the GPU.
@@ -164,6 +93,27 @@ public:
     glUnmapBuffer(m_buffertype);
     return iter;
   }
+
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    glBindBuffer(m_buffertype, m_buffer);
+    if (m_iterator + size >= m_size)
+    {
+      glBufferData(m_buffertype, m_size, nullptr, GL_STREAM_DRAW);
+      m_iterator = 0;
+    }
+    u8* pointer = (u8*)glMapBufferRange(m_buffertype, m_iterator, size,
+      GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    return std::make_pair(pointer, m_iterator);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    glBindBuffer(m_buffertype, m_buffer);
+    glFlushMappedBufferRange(m_buffertype, 0, used_size);
+    glUnmapBuffer(m_buffertype);
+    m_iterator += used_size;
+  }
 };
 
 /* A modified streaming way without reallocation
@@ -200,6 +150,23 @@ public:
     glUnmapBuffer(m_buffertype);
     return iter;
   }
+
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    AllocMemory(size);
+    glBindBuffer(m_buffertype, m_buffer);
+    u8* pointer = (u8*)glMapBufferRange(m_buffertype, m_iterator, size,
+      GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    return std::make_pair(pointer, m_iterator);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    glBindBuffer(m_buffertype, m_buffer);
+    glFlushMappedBufferRange(m_buffertype, 0, used_size);
+    glUnmapBuffer(m_buffertype);
+    m_iterator += used_size;
+  }
 };
 
 /* Streaming fifo without mapping overhead.
@@ -251,6 +218,22 @@ public:
     return iter;
   }
 
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    AllocMemory(size);
+    return std::make_pair(m_pointer + m_iterator, m_iterator);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    if (!coherent)
+    {
+      glBindBuffer(m_buffertype, m_buffer);
+      glFlushMappedBufferRange(m_buffertype, m_iterator, used_size);
+    }
+    m_iterator += used_size;
+  }
+
   u8* m_pointer;
   const bool coherent;
 };
@@ -293,6 +276,17 @@ public:
     return iter;
   }
 
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    AllocMemory(size);
+    return std::make_pair(m_pointer + m_iterator, m_iterator);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    m_iterator += used_size;
+  }
+
   u8* m_pointer;
   static constexpr u32 ALIGN_PINNED_MEMORY = 4096;
 };
@@ -305,7 +299,7 @@ public:
 class BufferSubData : public StreamBuffer
 {
 public:
-  BufferSubData(u32 type, u32 size) : StreamBuffer(type, size)
+  BufferSubData(u32 type, u32 size) : StreamBuffer(type, size), m_cpu_buffer(m_size)
   {
     glBindBuffer(m_buffertype, m_buffer);
     glBufferData(m_buffertype, size, nullptr, GL_STREAM_DRAW);
@@ -323,6 +317,19 @@ public:
     glBufferSubData(m_buffertype, iter, size, src);
     return iter;
   }
+
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    return std::make_pair(m_cpu_buffer.data(), 0);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    glBindBuffer(m_buffertype, m_buffer);
+    glBufferSubData(m_buffertype, 0, used_size, m_cpu_buffer.data());
+  }
+
+  std::vector<u8> m_cpu_buffer;
 };
 
 /* Fifo based on the glBufferData call.
@@ -333,7 +340,7 @@ public:
 class BufferData : public StreamBuffer
 {
 public:
-  BufferData(u32 type, u32 size) : StreamBuffer(type, size)
+  BufferData(u32 type, u32 size) : StreamBuffer(type, size), m_cpu_buffer(m_size)
   {
     glBindBuffer(m_buffertype, m_buffer);
   }
@@ -347,6 +354,19 @@ public:
     glBufferData(m_buffertype, size, src, GL_STREAM_DRAW);
     return 0;
   }
+
+  std::pair<u8*, u32> Map(u32 size) override
+  {
+    return std::make_pair(m_cpu_buffer.data(), 0);
+  }
+
+  void Unmap(u32 used_size) override
+  {
+    glBindBuffer(m_buffertype, m_buffer);
+    glBufferData(m_buffertype, used_size, m_cpu_buffer.data(), GL_STREAM_DRAW);
+  }
+
+  std::vector<u8> m_cpu_buffer;
 };
 
 // Chooses the best streaming method based on the supported extensions and known issues
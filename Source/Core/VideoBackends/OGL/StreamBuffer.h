@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <array>
 #include <memory>
 #include <utility>
 
@@ -12,12 +11,13 @@
 
 #include "VideoBackends/OGL/FramebufferManager.h"
 
+#include "VideoCommon/StreamBufferRing.h"
 #include "VideoCommon/VideoCommon.h"
 
 namespace OGL
 {
 
-class StreamBuffer
+class StreamBuffer : public StreamBufferRing
 {
 
 public:
@@ -43,6 +43,26 @@ public:
     }
     return Stream(size, src);
   }
+
+  /* Maps a contiguous region of the fifo so the caller can generate data
+  * straight into it, returning the write pointer and the offset of the region
+  * in the GPU buffer. Unmap has to be called with the really used size before
+  * the data is consumed. Methods that cannot expose a write pointer fall back
+  * to a CPU-side buffer which Unmap uploads, so callers never pay more than
+  * the Stream copy they would have done anyway.
+  */
+  virtual std::pair<u8*, u32> Map(u32 size) = 0;
+  virtual void Unmap(u32 used_size) = 0;
+
+  std::pair<u8*, u32> Map(u32 size, u32 stride)
+  {
+    u32 padding = m_iterator % stride;
+    if (padding)
+    {
+      m_iterator += stride - padding;
+    }
+    return Map(size);
+  }
   bool CanStreamWithoutRestart(u32 size, u32 stride = 0)
   {
     return (m_iterator + size + stride) <= m_size;
@@ -51,26 +71,12 @@ public:
 
 protected:
   StreamBuffer(u32 type, u32 size, u32 align_size = 16, bool need_cpu_buffer = false);
-  void CreateFences();
-  void DeleteFences();
-  void AllocMemory(u32 size);
-
-  const u32 m_buffertype;
-  const u32 m_size;
 
-  u32 m_iterator;
-  u32 m_used_iterator;
-  u32 m_free_iterator;
+  FenceHandle InsertFence() override;
+  void WaitFence(FenceHandle fence) override;
+  void ReleaseFence(FenceHandle fence) override;
 
-private:
-  static constexpr int SYNC_POINTS = 8;
-  int Slot(u32 x) const
-  {
-    return x >> m_bit_per_slot;
-  }
-  const int m_bit_per_slot;
-
-  std::array<GLsync, SYNC_POINTS> m_fences{};
+  const u32 m_buffertype;
 };
 
 }
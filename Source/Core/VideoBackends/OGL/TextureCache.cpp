@@ -154,6 +154,11 @@ void TextureCache::CopyEFB(u8* dst, const EFBCopyFormat& format, u32 native_widt
     memory_stride, is_depth_copy, src_rect, scale_by_half);
 }
 
+void TextureCache::FlushEFBCopyReadbacks()
+{
+  TextureConverter::FlushPendingReadbacks();
+}
+
 bool TextureCache::Palettize(TCacheEntry* dst_entry, const TCacheEntry* base_entry)
 {
   OGLTexture* base_tex = static_cast<OGLTexture*>(base_entry->texture.get());
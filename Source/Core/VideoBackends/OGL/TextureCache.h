@@ -39,6 +39,8 @@ private:
     u32 num_blocks_y, u32 memory_stride, bool is_depth_copy,
     const EFBRectangle& src_rect, bool scale_by_half) override;
 
+  void FlushEFBCopyReadbacks() override;
+
   bool Palettize(TCacheEntry* entry, const TCacheEntry* base_entry) override;
   void LoadLut(u32 lutFmt, void* addr, u32 size) override;
   bool CompileShaders() override;
@@ -53,7 +53,25 @@ struct EncodingProgram
 };
 static std::map<EFBCopyFormat, EncodingProgram> s_encoding_programs;
 
-static GLuint s_PBO = 0; // for readback with different strides
+// Ring of PBOs for encoding readbacks. The glReadPixels into the PBO is
+// kicked asynchronously and fenced; the copy into guest RAM only happens in
+// FlushPendingReadbacks(), so a batch of EFB copies overlaps all of its GPU
+// encodes and pays for at most one sync at the end.
+constexpr u32 NUM_READBACK_PBOS = 4;
+constexpr u32 READBACK_PBO_SIZE = 1024 * 1024 * 4;
+
+struct PendingReadback
+{
+  GLsync fence = nullptr;
+  u8* dest_ptr = nullptr;
+  u32 dst_line_size = 0;
+  u32 dst_height = 0;
+  u32 write_stride = 0;
+};
+
+static GLuint s_PBOs[NUM_READBACK_PBOS] = {};
+static PendingReadback s_pending_readbacks[NUM_READBACK_PBOS];
+static u32 s_current_pbo = 0;
 
 static void CreatePrograms()
 {
@@ -189,18 +207,23 @@ void Init()
   glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s_dstTexture, 0);
   FramebufferManager::SetFramebuffer(0);
 
-  glGenBuffers(1, &s_PBO);
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBO);
-  glBufferData(GL_PIXEL_PACK_BUFFER, 1024 * 1024 * 4, nullptr, GL_STREAM_READ);
+  glGenBuffers(NUM_READBACK_PBOS, s_PBOs);
+  for (u32 i = 0; i < NUM_READBACK_PBOS; i++)
+  {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBOs[i]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, READBACK_PBO_SIZE, nullptr, GL_STREAM_READ);
+  }
   glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  s_current_pbo = 0;
   CreatePrograms();
 }
 
 void Shutdown()
 {
+  FlushPendingReadbacks();
   glDeleteTextures(1, &s_srcTexture);
   glDeleteTextures(1, &s_dstTexture);
-  glDeleteBuffers(1, &s_PBO);
+  glDeleteBuffers(NUM_READBACK_PBOS, s_PBOs);
   glDeleteFramebuffers(2, s_texConvFrameBuffer);
 
   s_rgbToYuyvProgram.Destroy();
@@ -212,11 +235,57 @@ void Shutdown()
 
   s_srcTexture = 0;
   s_dstTexture = 0;
-  s_PBO = 0;
+  for (u32 i = 0; i < NUM_READBACK_PBOS; i++)
+    s_PBOs[i] = 0;
   s_texConvFrameBuffer[0] = 0;
   s_texConvFrameBuffer[1] = 0;
 }
 
+// Waits for the slot's fence (if any) and copies the PBO contents into guest
+// RAM. Without ARB_sync the map itself blocks on the readback.
+static void FinishReadback(u32 index)
+{
+  PendingReadback& readback = s_pending_readbacks[index];
+  if (!readback.dest_ptr)
+    return;
+
+  if (readback.fence)
+  {
+    glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+  }
+
+  const u32 dst_size = readback.dst_line_size * readback.dst_height;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBOs[index]);
+  u8* pbo = (u8*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, dst_size, GL_MAP_READ_BIT);
+  u8* dest_ptr = readback.dest_ptr;
+  if (readback.dst_line_size == readback.write_stride)
+  {
+    memcpy(dest_ptr, pbo, dst_size);
+  }
+  else
+  {
+    for (u32 i = 0; i < readback.dst_height; i++)
+    {
+      memcpy(dest_ptr, pbo, readback.dst_line_size);
+      pbo += readback.dst_line_size;
+      dest_ptr += readback.write_stride;
+    }
+  }
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  readback.dest_ptr = nullptr;
+}
+
+void FlushPendingReadbacks()
+{
+  // Drain in submission order; with overlapping destinations the last
+  // submitted copy has to win in RAM.
+  for (u32 i = 0; i < NUM_READBACK_PBOS; i++)
+    FinishReadback((s_current_pbo + i) % NUM_READBACK_PBOS);
+}
+
 // dst_line_size, writeStride in bytes
 static void EncodeToRamUsingShader(GLuint srcTexture,
   u8* destAddr, u32 dst_line_size, u32 dstHeight,
@@ -242,29 +311,25 @@ static void EncodeToRamUsingShader(GLuint srcTexture,
 
   glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 
-  // .. and then read back the results.
-  int dstSize = dst_line_size * dstHeight;
-
-  // When the dst_line_size and writeStride are the same, we could use glReadPixels directly to RAM.
-  // But instead we always copy the data via a PBO, because macOS inexplicably prefers this for some
-  // reason.
-  glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBO);
+  // .. and then kick the readback into the next PBO slot. The copy to guest
+  // RAM is deferred to FlushPendingReadbacks() so consecutive encodes overlap
+  // on the GPU instead of each stalling on its own glReadPixels.
+  // (We always go through a PBO even for matching strides, because macOS
+  // inexplicably prefers this for some reason.)
+  const u32 index = s_current_pbo;
+  s_current_pbo = (s_current_pbo + 1) % NUM_READBACK_PBOS;
+  // If the ring wrapped within one batch, the oldest slot has to land first.
+  FinishReadback(index);
+
+  PendingReadback& readback = s_pending_readbacks[index];
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, s_PBOs[index]);
   glReadPixels(0, 0, (GLsizei)dstWidth, (GLsizei)dstHeight, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
-  u8* pbo = (u8*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, dstSize, GL_MAP_READ_BIT);
-  if (dst_line_size == writeStride)
-  {
-    memcpy(destAddr, pbo, dstSize);
-  }
-  else
-  {
-    for (u32 i = 0; i < dstHeight; i++)
-    {
-      memcpy(destAddr, pbo, dst_line_size);
-      pbo += dst_line_size;
-      destAddr += writeStride;
-    }
-  }
-  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  readback.fence =
+    g_ogl_config.bSupportsGLSync ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : nullptr;
+  readback.dest_ptr = destAddr;
+  readback.dst_line_size = dst_line_size;
+  readback.dst_height = dstHeight;
+  readback.write_stride = writeStride;
   glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 }
 
@@ -305,6 +370,8 @@ void EncodeToRamYUYV(GLuint srcTexture, const TargetRectangle& sourceRc, u8* des
   // yscale is enabled.
   // Otherwise we get jaggies when a game uses yscaling (most PAL games)
   EncodeToRamUsingShader(srcTexture, destAddr, dstWidth * 2, dstHeight, dstStride, true);
+  // XFB data is consumed by the VI emulation right away, so don't defer here.
+  FlushPendingReadbacks();
   FramebufferManager::SetFramebuffer(0);
   OGLTexture::DisableStage(0);
   g_renderer->RestoreAPIState();
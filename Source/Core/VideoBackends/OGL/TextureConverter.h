@@ -30,6 +30,10 @@ void EncodeToRamFromTexture(u8* dest_ptr, const EFBCopyFormat& format, u32 nativ
   u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
   bool is_depth_copy, const EFBRectangle& src_rect, bool scale_by_half);
 
+// Completes all fenced encoding readbacks, copying their results into guest
+// RAM. Must run before the CPU may observe the target memory.
+void FlushPendingReadbacks();
+
 }
 
 }  // namespace OGL
@@ -70,18 +70,47 @@ void VertexManager::PrepareDrawBuffers(u32 stride)
 {
   u32 vertex_data_size = IndexGenerator::GetNumVerts() * stride;
   u32 index_data_size = IndexGenerator::GetIndexLen() * sizeof(u16);
-  m_baseVertex = m_vertexBuffer->Stream(vertex_data_size, stride, m_cpu_v_buffer.data()) / stride;
-  m_index_offset = m_indexBuffer->Stream(index_data_size, m_cpu_i_buffer.data());
+  if (m_direct_buffers)
+  {
+    // The loaders already decoded straight into the mapped streaming fifo,
+    // just hand the really used sizes back.
+    m_vertexBuffer->Unmap(vertex_data_size);
+    m_indexBuffer->Unmap(index_data_size);
+  }
+  else
+  {
+    m_baseVertex = m_vertexBuffer->Stream(vertex_data_size, stride, m_cpu_v_buffer.data()) / stride;
+    m_index_offset = m_indexBuffer->Stream(index_data_size, m_cpu_i_buffer.data());
+  }
   ADDSTAT(stats.thisFrame.bytesVertexStreamed, vertex_data_size);
   ADDSTAT(stats.thisFrame.bytesIndexStreamed, index_data_size);
 }
 
 void VertexManager::ResetBuffer(u32 stride)
 {
-  m_pCurBufferPointer = m_pBaseBufferPointer = m_cpu_v_buffer.data();
-  m_pEndBufferPointer = m_pBaseBufferPointer + m_cpu_v_buffer.size();
-  m_index_buffer_base = m_cpu_i_buffer.data();
-  IndexGenerator::Start(m_cpu_i_buffer.data());
+  if (m_cull_all)
+  {
+    // This data is probably getting discarded, keep it in the CPU-side
+    // buffers instead of burning streaming fifo space on it.
+    m_direct_buffers = false;
+    m_pCurBufferPointer = m_pBaseBufferPointer = m_cpu_v_buffer.data();
+    m_pEndBufferPointer = m_pBaseBufferPointer + m_cpu_v_buffer.size();
+    m_index_buffer_base = m_cpu_i_buffer.data();
+    IndexGenerator::Start(m_cpu_i_buffer.data());
+    return;
+  }
+  // Map the streaming fifos directly so the vertex loaders write each decoded
+  // vertex into GPU-visible memory, skipping the staging copy at flush time.
+  m_direct_buffers = true;
+  auto vertex_buffer = m_vertexBuffer->Map(MAXVBUFFERSIZE, stride);
+  m_pCurBufferPointer = m_pBaseBufferPointer = vertex_buffer.first;
+  m_pEndBufferPointer = m_pBaseBufferPointer + MAXVBUFFERSIZE;
+  m_baseVertex = vertex_buffer.second / stride;
+
+  auto index_buffer = m_indexBuffer->Map(MAXIBUFFERSIZE * sizeof(u16));
+  m_index_buffer_base = reinterpret_cast<u16*>(index_buffer.first);
+  m_index_offset = index_buffer.second;
+  IndexGenerator::Start(m_index_buffer_base);
 }
 
 void VertexManager::Draw(u32 stride)
@@ -180,7 +209,7 @@ void VertexManager::vFlush(bool useDstAlpha)
     if (!active_shader)
     {
       g_Config.iSaveTargetId++;
-      ClearEFBCache();
+      ClearEFBCacheScissor();
       return;
     }
 
@@ -195,9 +224,10 @@ void VertexManager::vFlush(bool useDstAlpha)
     Draw(stride);
     g_renderer->ResetAPIState();
   }
+  BBox::StartReadback();
   g_Config.iSaveTargetId++;
 
-  ClearEFBCache();
+  ClearEFBCacheScissor();
 }
 
 }  // namespace
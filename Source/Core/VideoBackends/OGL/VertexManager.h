@@ -55,5 +55,7 @@ private:
   size_t m_baseVertex;
   size_t m_index_offset;
   u16* m_index_buffer_base;
+  // True when the current batch decodes straight into the mapped fifos.
+  bool m_direct_buffers = false;
 };
 }
@@ -3,9 +3,12 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 
+#include "Common/Common.h"
 #include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/Rasterizer.h"
@@ -38,9 +41,35 @@ static s32 scissorBottom = 0;
 static Tev tev;
 static RasterBlock rasterBlock;
 
+// Large triangles are scanned in horizontal bands of block rows spread
+// across the thread pool workers, with the video thread taking the last
+// band itself. Each worker needs its own Tev and RasterBlock: Tev builds
+// pointer tables into its own members in Init(), so the instances live in
+// a fixed array and are never copied.
+static constexpr u32 MAX_RASTER_SLICES = 8;
+// Triangles with a smaller scissored bounding area than this stay on the
+// serial path; below it the fork/join overhead costs more than the scan.
+static constexpr s32 MIN_PARALLEL_AREA = 64 * 64;
+static Tev slice_tevs[MAX_RASTER_SLICES - 1];
+static RasterBlock slice_blocks[MAX_RASTER_SLICES - 1];
+
+// Per-triangle edge equations, written once per triangle and read-only
+// while the block scan runs (possibly on several threads at once).
+struct EdgeEquations
+{
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+  s32 FDX12, FDX23, FDX31;
+  s32 FDY12, FDY23, FDY31;
+};
+static EdgeEquations edges;
+
 void Init()
 {
   tev.Init();
+  for (Tev& slice_tev : slice_tevs)
+    slice_tev.Init();
 
   // Set initial z reference plane in the unlikely case that zfreeze is enabled when drawing the first primitive.
   // TODO: This is just a guess!
@@ -95,9 +124,15 @@ void SetScissor()
 void SetTevReg(int reg, int comp, bool konst, s16 color)
 {
   tev.SetRegColor(reg, comp, konst, color);
+  // Keep the per-worker instances in sync. Stage outputs written into the
+  // TEV registers while drawing still stay local to whichever instance drew
+  // the pixel, so reads of registers that were never programmed depend on
+  // the band split - the same approximation the hardware backends make.
+  for (Tev& slice_tev : slice_tevs)
+    slice_tev.SetRegColor(reg, comp, konst, color);
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(Tev& tev, RasterBlock& rasterBlock, s32 x, s32 y, s32 xi, s32 yi)
 {
   INCSTAT(stats.thisFrame.rasterizedPixels);
 
@@ -186,7 +221,8 @@ static void InitSlope(Slope *slope, float f1, float f2, float f3, float DX31, fl
   slope->f0 = f1;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(RasterBlock& rasterBlock, s32* lodp, bool* linear, u32 texmap,
+                                u32 texcoord)
 {
   const FourTexUnits& texUnit = bpmem.tex[(texmap >> 2) & 1];
   const u8 subTexmap = texmap & 3;
@@ -234,7 +270,7 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -273,7 +309,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texcoord = indref & 3;
     indref >>= 3;
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -285,7 +322,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -302,7 +340,115 @@ static inline void PrepareBlock(s32 blockX, s32 blockY)
   {
     x = blockX;
     y = blockY;
-    BuildBlock(x, y);
+    BuildBlock(rasterBlock, x, y);
+  }
+}
+
+// Scans the block rows in [miny, maxy) against the edge equations set up by
+// DrawTriangleFrontFace. Bands with disjoint y ranges touch disjoint EFB
+// pixels, so concurrent calls only need their own Tev and RasterBlock. The
+// perf counter and statistics increments are not atomic, so their counts are
+// approximate while several bands are in flight.
+static void ScanBlockRange(Tev& tev, RasterBlock& rasterBlock, s32 minx, s32 maxx, s32 miny,
+                           s32 maxy)
+{
+  const s32 C1 = edges.C1;
+  const s32 C2 = edges.C2;
+  const s32 C3 = edges.C3;
+
+  const s32 DX12 = edges.DX12;
+  const s32 DX23 = edges.DX23;
+  const s32 DX31 = edges.DX31;
+
+  const s32 DY12 = edges.DY12;
+  const s32 DY23 = edges.DY23;
+  const s32 DY31 = edges.DY31;
+
+  const s32 FDX12 = edges.FDX12;
+  const s32 FDX23 = edges.FDX23;
+  const s32 FDX31 = edges.FDX31;
+
+  const s32 FDY12 = edges.FDY12;
+  const s32 FDY23 = edges.FDY23;
+  const s32 FDY31 = edges.FDY31;
+
+  // Loop through blocks
+  for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+  {
+    for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
+    {
+      // Corners of block
+      s32 x0 = x << 4;
+      s32 x1 = (x + BLOCK_SIZE - 1) << 4;
+      s32 y0 = y << 4;
+      s32 y1 = (y + BLOCK_SIZE - 1) << 4;
+
+      // Evaluate half-space functions
+      bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
+      bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
+      bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
+      bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
+      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+      bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
+      bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
+      bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
+      bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
+      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+      bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
+      bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
+      bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
+      bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
+      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+      // Skip block when outside an edge
+      if (a == 0x0 || b == 0x0 || c == 0x0)
+        continue;
+
+      BuildBlock(rasterBlock, x, y);
+
+      // Accept whole block when totally covered
+      if (a == 0xF && b == 0xF && c == 0xF)
+      {
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            Draw(tev, rasterBlock, x + ix, y + iy, ix, iy);
+          }
+        }
+      }
+      else // Partially covered block
+      {
+        s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
+        s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
+        s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
+
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          s32 CX1 = CY1;
+          s32 CX2 = CY2;
+          s32 CX3 = CY3;
+
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+            {
+              Draw(tev, rasterBlock, x + ix, y + iy, ix, iy);
+            }
+
+            CX1 -= FDY12;
+            CX2 -= FDY23;
+            CX3 -= FDY31;
+          }
+
+          CY1 += FDX12;
+          CY2 += FDX23;
+          CY3 += FDX31;
+        }
+      }
+    }
   }
 }
 
@@ -310,6 +456,10 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 {
   INCSTAT(stats.thisFrame.numTrianglesDrawn);
 
+  // Pick the TEV draw specialization for the current BP state once per
+  // triangle instead of re-testing the same config on every pixel.
+  Tev::SelectDrawFunction();
+
   // adapted from http://devmaster.net/posts/6145/advanced-rasterization
 
   // 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
@@ -402,82 +552,64 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
     // Start in corner of 8x8 block
     minx &= ~(BLOCK_SIZE - 1);
     miny &= ~(BLOCK_SIZE - 1);
-    // Loop through blocks
-    for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+
+    edges.C1 = C1;
+    edges.C2 = C2;
+    edges.C3 = C3;
+    edges.DX12 = DX12;
+    edges.DX23 = DX23;
+    edges.DX31 = DX31;
+    edges.DY12 = DY12;
+    edges.DY23 = DY23;
+    edges.DY31 = DY31;
+    edges.FDX12 = FDX12;
+    edges.FDX23 = FDX23;
+    edges.FDX31 = FDX31;
+    edges.FDY12 = FDY12;
+    edges.FDY23 = FDY23;
+    edges.FDY31 = FDY31;
+
+    // Split large triangles into bands of block rows scanned concurrently by
+    // the thread pool workers, with the video thread scanning the last band
+    // itself and waiting for the rest. The TEV dump paths share a single
+    // per-stage temp pixel in DebugUtil, so they force the serial scan.
+    u32 slices = 1;
+    const u32 block_rows = (maxy - miny + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if ((maxx - minx) * (maxy - miny) >= MIN_PARALLEL_AREA &&
+        !g_ActiveConfig.bDumpTevStages && !g_ActiveConfig.bDumpTevTextureFetches)
+    {
+      slices = std::min<u32>(static_cast<u32>(Common::ThreadPool::GetThreadCount()) + 1,
+                             std::min<u32>(block_rows, MAX_RASTER_SLICES));
+    }
+
+    if (slices <= 1)
+    {
+      ScanBlockRange(tev, rasterBlock, minx, maxx, miny, maxy);
+    }
+    else
     {
-      for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
+      const u32 block_rows_per_slice = block_rows / slices;
+      std::atomic<u32> finished_slices = { 0 };
+      s32 slice_miny = miny;
+      for (u32 slice = 0; slice + 1 < slices; slice++)
       {
-        // Corners of block
-        s32 x0 = x << 4;
-        s32 x1 = (x + BLOCK_SIZE - 1) << 4;
-        s32 y0 = y << 4;
-        s32 y1 = (y + BLOCK_SIZE - 1) << 4;
-
-        // Evaluate half-space functions
-        bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-        bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-        bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-        bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-        int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-        bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-        bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-        bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-        bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-        int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-        bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-        bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-        bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-        bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-        int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
-
-        // Skip block when outside an edge
-        if (a == 0x0 || b == 0x0 || c == 0x0)
-          continue;
-
-        BuildBlock(x, y);
-
-        // Accept whole block when totally covered
-        if (a == 0xF && b == 0xF && c == 0xF)
+        Tev& slice_tev = slice_tevs[slice];
+        RasterBlock& slice_block = slice_blocks[slice];
+        const s32 slice_maxy = slice_miny + block_rows_per_slice * BLOCK_SIZE;
+        Common::AsyncWorker::ExecuteAsync(
+            [=, &slice_tev, &slice_block, &finished_slices]()
         {
-          for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-          {
-            for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-            {
-              Draw(x + ix, y + iy, ix, iy);
-            }
-          }
-        }
-        else // Partially covered block
-        {
-          s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-          s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-          s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
-
-          for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-          {
-            s32 CX1 = CY1;
-            s32 CX2 = CY2;
-            s32 CX3 = CY3;
-
-            for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-            {
-              if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-              {
-                Draw(x + ix, y + iy, ix, iy);
-              }
-
-              CX1 -= FDY12;
-              CX2 -= FDY23;
-              CX3 -= FDY31;
-            }
-
-            CY1 += FDX12;
-            CY2 += FDX23;
-            CY3 += FDX31;
-          }
-        }
+          ScanBlockRange(slice_tev, slice_block, minx, maxx, slice_miny, slice_maxy);
+          finished_slices.fetch_add(1);
+        });
+        slice_miny = slice_maxy;
+      }
+      // Scan the remainder (including any rounding slack) on the video thread.
+      ScanBlockRange(tev, rasterBlock, minx, maxx, slice_miny, maxy);
+      u32 loopcount = 0;
+      while (finished_slices.load() < slices - 1)
+      {
+        Common::cYield(loopcount++);
       }
     }
   }
@@ -533,7 +665,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
         {
           // Build the new raster block every other pixel
           PrepareBlock(x, y);
-          Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+          Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
           if (y >= BoundingBox::coords[BoundingBox::TOP])
             break;
@@ -573,7 +705,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
         if (CY1 > 0 && CY2 > 0 && CY3 > 0)
         {
           PrepareBlock(x, y);
-          Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+          Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
           if (x >= BoundingBox::coords[BoundingBox::LEFT])
             break;
@@ -613,7 +745,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
         {
           // Build the new raster block every other pixel
           PrepareBlock(x, y);
-          Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+          Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
           if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
             break;
@@ -654,7 +786,7 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
         {
           // Build the new raster block every other pixel
           PrepareBlock(x, y);
-          Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+          Draw(tev, rasterBlock, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
           if (x <= BoundingBox::coords[BoundingBox::RIGHT])
             break;
@@ -80,6 +80,7 @@ void SWVertexLoader::vFlush(bool useDstAlpha)
   }
 
   m_SetupUnit->Init(primitiveType);
+  TransformUnit::ResetMatrixCache();
 
   // set all states with are stored within video sw
   Clipper::SetViewOffset();
@@ -506,14 +506,16 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
   }
 }
 
-void Tev::Draw()
+template <bool bHasIndirect, bool bHasZTex, bool bHasFog>
+void Tev::DrawTmpl()
 {
   ASSERT(Position[0] >= 0 && Position[0] < EFB_WIDTH);
   ASSERT(Position[1] >= 0 && Position[1] < EFB_HEIGHT);
 
   INCSTAT(stats.thisFrame.tevPixelsIn);
 
-  for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages.Value(); stageNum++)
+  const unsigned int numIndStages = bHasIndirect ? bpmem.genMode.numindstages.Value() : 0;
+  for (unsigned int stageNum = 0; stageNum < numIndStages; stageNum++)
   {
     int stageNum2 = stageNum >> 1;
     int stageOdd = stageNum & 1;
@@ -556,7 +558,18 @@ void Tev::Draw()
     int texcoordSel = order.getTexCoord(stageOdd);
     int texmap = order.getTexMap(stageOdd);
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    if (bHasIndirect)
+    {
+      Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    }
+    else
+    {
+      // SelectDrawFunction verified every stage's indirect op is a no-op
+      // (mid, sw, tw, bs and fb_addprev all zero), which reduces to this.
+      AlphaBump = 0;
+      TexCoord.s = Uv[texcoordSel].s;
+      TexCoord.t = Uv[texcoordSel].t;
+    }
 
     // sample texture
     if (order.getEnable(stageOdd))
@@ -656,7 +669,7 @@ void Tev::Draw()
     if (!TevAlphaTest(output[ALP_C]))
       return;
     // z texture
-    if (bpmem.ztex2.op)
+    if (bHasZTex && bpmem.ztex2.op)
     {
       u32 ztex = bpmem.ztex1.bias;
       switch (bpmem.ztex2.type)
@@ -679,7 +692,7 @@ void Tev::Draw()
     }
 
     // fog
-    if (bpmem.fog.c_proj_fsel.fsel)
+    if (bHasFog && bpmem.fog.c_proj_fsel.fsel)
     {
       float ze;
 
@@ -808,6 +821,46 @@ void Tev::Draw()
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
+// Default to the everything-enabled specialization, which is exactly the old
+// fully interpreted path.
+void (Tev::*Tev::s_draw_function)() = &Tev::DrawTmpl<true, true, true>;
+
+void Tev::SelectDrawFunction()
+{
+  // All eight specializations, indexed by (indirect << 2) | (ztex << 1) | fog.
+  static void (Tev::*const draw_functions[8])() = {
+      &Tev::DrawTmpl<false, false, false>, &Tev::DrawTmpl<false, false, true>,
+      &Tev::DrawTmpl<false, true, false>,  &Tev::DrawTmpl<false, true, true>,
+      &Tev::DrawTmpl<true, false, false>,  &Tev::DrawTmpl<true, false, true>,
+      &Tev::DrawTmpl<true, true, false>,   &Tev::DrawTmpl<true, true, true>,
+  };
+
+  // Fields of the indirect setup that make a stage's indirect op a no-op when
+  // all zero: mid, sw, tw, bs and fb_addprev (bias, fmt and bt only feed the
+  // matrix multiply, which mid == 0 already skips).
+  static const u32 IND_ACTIVE_MASK = 0x17ff80;
+
+  bool has_indirect = bpmem.genMode.numindstages.Value() != 0;
+  for (unsigned int stageNum = 0; !has_indirect && stageNum <= bpmem.genMode.numtevstages.Value();
+       stageNum++)
+  {
+    has_indirect = (bpmem.tevind[stageNum].hex & IND_ACTIVE_MASK) != 0;
+  }
+
+  // The inner runtime checks stay in the specializations, so a conservative
+  // selection here can only cost speed, never correctness.
+  const bool has_ztex = bpmem.ztex2.op != 0;
+  const bool has_fog = bpmem.fog.c_proj_fsel.fsel != 0;
+
+  s_draw_function =
+      draw_functions[(has_indirect ? 4 : 0) | (has_ztex ? 2 : 0) | (has_fog ? 1 : 0)];
+}
+
+void Tev::Draw()
+{
+  (this->*s_draw_function)();
+}
+
 void Tev::SetRegColor(int reg, int comp, bool konst, s16 color)
 {
   if (konst)
@@ -66,6 +66,13 @@ class Tev
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
+  // Draw specialized over the per-draw-constant feature branches; see
+  // SelectDrawFunction.
+  template <bool bHasIndirect, bool bHasZTex, bool bHasFog>
+  void DrawTmpl();
+
+  static void (Tev::*s_draw_function)();
+
 public:
   s32 Position[3];
   u8 Color[2][4]; // must be RGBA for correct swap table ordering
@@ -85,6 +92,11 @@ public:
 
   void Init();
 
+  // Picks the Draw specialization matching the current BP state (indirect
+  // stages, Z texturing, fog), hoisting those branches out of the per-pixel
+  // loop. Called once per triangle; shared by all Tev instances.
+  static void SelectDrawFunction();
+
   void Draw();
 
   void SetRegColor(int reg, int comp, bool konst, s16 color);
@@ -6,6 +6,7 @@
 #include <cmath>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
 
@@ -33,12 +34,14 @@ static void MultiplyVec2Mat34(const Vec3 &vec, const float *mat, Vec3 &result)
   result.z = mat[8] * vec.x + mat[9] * vec.y + mat[10] + mat[11];
 }
 
+#if !(_M_SSE >= 0x200)
 static void MultiplyVec3Mat33(const Vec3 &vec, const float *mat, Vec3 &result)
 {
   result.x = mat[0] * vec.x + mat[1] * vec.y + mat[2] * vec.z;
   result.y = mat[3] * vec.x + mat[4] * vec.y + mat[5] * vec.z;
   result.z = mat[6] * vec.x + mat[7] * vec.y + mat[8] * vec.z;
 }
+#endif
 
 static void MultiplyVec3Mat24(const Vec3 &vec, const float *mat, Vec3 &result)
 {
@@ -71,10 +74,86 @@ static void MultipleVec3Ortho(const Vec3 &vec, const float *proj, Vec4 &result)
   result.w = 1;
 }
 
+// Per-draw cache of the current position/normal matrix. XF loads flush the
+// pipeline before touching xfmem, so the matrices are stable for the duration
+// of a draw and runs of vertices sharing a matrix index - the common case on
+// skinned meshes - reuse the fetched matrix. On x86 the matrix is kept as
+// columns so the per-vertex multiply is three broadcast-multiply-adds.
+static int s_pos_mtx_cached = -1;
+static int s_nrm_mtx_cached = -1;
+
+#if _M_SSE >= 0x200
+static __m128 s_pos_mtx_cols[4];
+static __m128 s_nrm_mtx_cols[3];
+
+static void LoadPosMtxCols(const float* mat)
+{
+  __m128 r0 = _mm_loadu_ps(mat);
+  __m128 r1 = _mm_loadu_ps(mat + 4);
+  __m128 r2 = _mm_loadu_ps(mat + 8);
+  __m128 r3 = _mm_setzero_ps();
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  s_pos_mtx_cols[0] = r0;
+  s_pos_mtx_cols[1] = r1;
+  s_pos_mtx_cols[2] = r2;
+  s_pos_mtx_cols[3] = r3;
+}
+
+static void LoadNrmMtxCols(const float* mat)
+{
+  // Rows are 3 floats wide; assemble columns by hand so the last row of the
+  // last matrix is not read past the end of xfmem.normalMatrices.
+  s_nrm_mtx_cols[0] = _mm_set_ps(0.0f, mat[6], mat[3], mat[0]);
+  s_nrm_mtx_cols[1] = _mm_set_ps(0.0f, mat[7], mat[4], mat[1]);
+  s_nrm_mtx_cols[2] = _mm_set_ps(0.0f, mat[8], mat[5], mat[2]);
+}
+
+static void MultiplyVec3Cols34(const Vec3 &vec, const __m128 *cols, Vec3 &result)
+{
+  const __m128 res = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vec.x), cols[0]),
+                 _mm_mul_ps(_mm_set1_ps(vec.y), cols[1])),
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vec.z), cols[2]), cols[3]));
+  alignas(16) float out[4];
+  _mm_store_ps(out, res);
+  result.x = out[0];
+  result.y = out[1];
+  result.z = out[2];
+}
+
+static void MultiplyVec3Cols33(const Vec3 &vec, const __m128 *cols, Vec3 &result)
+{
+  const __m128 res = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vec.x), cols[0]),
+                 _mm_mul_ps(_mm_set1_ps(vec.y), cols[1])),
+      _mm_mul_ps(_mm_set1_ps(vec.z), cols[2]));
+  alignas(16) float out[4];
+  _mm_store_ps(out, res);
+  result.x = out[0];
+  result.y = out[1];
+  result.z = out[2];
+}
+#endif
+
+void ResetMatrixCache()
+{
+  s_pos_mtx_cached = -1;
+  s_nrm_mtx_cached = -1;
+}
+
 void TransformPosition(const InputVertexData *src, OutputVertexData *dst)
 {
+#if _M_SSE >= 0x200
+  if (src->posMtx != s_pos_mtx_cached)
+  {
+    LoadPosMtxCols(&xfmem.posMatrices[src->posMtx * 4]);
+    s_pos_mtx_cached = src->posMtx;
+  }
+  MultiplyVec3Cols34(src->position, s_pos_mtx_cols, dst->mvPosition);
+#else
   const float* mat = &xfmem.posMatrices[src->posMtx * 4];
   MultiplyVec3Mat34(src->position, mat, dst->mvPosition);
+#endif
 
   if (xfmem.projection.type == GX_PERSPECTIVE)
   {
@@ -88,6 +167,27 @@ void TransformPosition(const InputVertexData *src, OutputVertexData *dst)
 
 void TransformNormal(const InputVertexData *src, bool nbt, OutputVertexData *dst)
 {
+#if _M_SSE >= 0x200
+  const int mtx_index = src->posMtx & 31;
+  if (mtx_index != s_nrm_mtx_cached)
+  {
+    LoadNrmMtxCols(&xfmem.normalMatrices[mtx_index * 3]);
+    s_nrm_mtx_cached = mtx_index;
+  }
+
+  if (nbt)
+  {
+    MultiplyVec3Cols33(src->normal[0], s_nrm_mtx_cols, dst->normal[0]);
+    MultiplyVec3Cols33(src->normal[1], s_nrm_mtx_cols, dst->normal[1]);
+    MultiplyVec3Cols33(src->normal[2], s_nrm_mtx_cols, dst->normal[2]);
+    dst->normal[0].Normalize();
+  }
+  else
+  {
+    MultiplyVec3Cols33(src->normal[0], s_nrm_mtx_cols, dst->normal[0]);
+    dst->normal[0].Normalize();
+  }
+#else
   const float* mat = &xfmem.normalMatrices[(src->posMtx & 31) * 3];
 
   if (nbt)
@@ -102,6 +202,7 @@ void TransformNormal(const InputVertexData *src, bool nbt, OutputVertexData *dst
     MultiplyVec3Mat33(src->normal[0], mat, dst->normal[0]);
     dst->normal[0].Normalize();
   }
+#endif
 }
 
 static void TransformTexCoordRegular(const TexMtxInfo &texinfo, int coordNum, bool specialCase, const InputVertexData *srcVertex, OutputVertexData *dstVertex)
@@ -9,6 +9,9 @@ struct OutputVertexData;
 
 namespace TransformUnit
 {
+// Drops the cached position/normal matrix; call at the start of a draw,
+// before the first TransformPosition/TransformNormal.
+void ResetMatrixCache();
 void TransformPosition(const InputVertexData *src, OutputVertexData *dst);
 void TransformNormal(const InputVertexData *src, bool nbt, OutputVertexData *dst);
 void TransformColor(const InputVertexData *src, OutputVertexData *dst);
@@ -102,14 +102,14 @@ constexpr VkFormat TEXTURECACHE_TEXTURE_FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
 
 // Textures that don't fit into this buffer will be uploaded with a separate buffer (see below).
 constexpr size_t INITIAL_TEXTURE_UPLOAD_BUFFER_SIZE = 16 * 1024 * 1024;
-constexpr size_t MAXIMUM_TEXTURE_UPLOAD_BUFFER_SIZE = 64 * 1024 * 1024;
-
-// Textures greater than 1024*1024 will be put in staging textures that are released after
-// execution instead. A 2048x2048 texture is 16MB, and we'd only fit four of these in our
-// streaming buffer and be blocking frequently. Games are unlikely to have textures this
-// large anyway, so it's only really an issue for HD texture packs, and memory is not
-// a limiting factor in these scenarios anyway.
-constexpr size_t STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 8;
+constexpr size_t MAXIMUM_TEXTURE_UPLOAD_BUFFER_SIZE = 128 * 1024 * 1024;
+
+// Textures above this size are put in staging textures that are released after execution
+// instead. Each of those uploads pays for a device memory allocation and map, so with HD
+// texture packs full of 2048x2048 (16MB) and 4096x4096 (64MB) images the threshold is kept
+// high enough that they stream through the ring buffer; the buffer grows up to the maximum
+// above, and memory is not a limiting factor in these scenarios anyway.
+constexpr size_t STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 32;
 
 // Streaming uniform buffer size
 constexpr size_t INITIAL_UNIFORM_STREAM_BUFFER_SIZE = 16 * 1024 * 1024;
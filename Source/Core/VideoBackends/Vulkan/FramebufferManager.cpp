@@ -39,6 +39,27 @@ namespace Vulkan
 constexpr size_t MAX_POKE_VERTICES = 8192;
 constexpr size_t POKE_VERTEX_BUFFER_SIZE = 8 * 1024 * 1024;
 
+static bool RegionCovers(const VkRect2D& outer, const VkRect2D& inner)
+{
+  return outer.offset.x <= inner.offset.x && outer.offset.y <= inner.offset.y &&
+    (outer.offset.x + static_cast<s32>(outer.extent.width)) >=
+    (inner.offset.x + static_cast<s32>(inner.extent.width)) &&
+    (outer.offset.y + static_cast<s32>(outer.extent.height)) >=
+    (inner.offset.y + static_cast<s32>(inner.extent.height));
+}
+
+static VkRect2D RegionUnion(const VkRect2D& lhs, const VkRect2D& rhs)
+{
+  s32 left = std::min(lhs.offset.x, rhs.offset.x);
+  s32 top = std::min(lhs.offset.y, rhs.offset.y);
+  s32 right = std::max(lhs.offset.x + static_cast<s32>(lhs.extent.width),
+    rhs.offset.x + static_cast<s32>(rhs.extent.width));
+  s32 bottom = std::max(lhs.offset.y + static_cast<s32>(lhs.extent.height),
+    rhs.offset.y + static_cast<s32>(rhs.extent.height));
+  return { { left, top },
+  { static_cast<u32>(right - left), static_cast<u32>(bottom - top) } };
+}
+
 FramebufferManager::FramebufferManager()
 {
 }
@@ -420,6 +441,7 @@ void FramebufferManager::DestroyEFBFramebuffer()
   m_efb_depth_texture.reset();
   m_efb_resolve_color_texture.reset();
   m_efb_resolve_depth_texture.reset();
+  InvalidateResolveCache();
 }
 
 void FramebufferManager::ResizeEFBTextures()
@@ -488,6 +510,9 @@ void FramebufferManager::ReinterpretPixelData(int convtype)
   // Swap EFB texture pointers
   std::swap(m_efb_color_texture, m_efb_convert_color_texture);
   std::swap(m_efb_framebuffer, m_efb_convert_framebuffer);
+
+  // The resolved copies reflect the old pixel format.
+  InvalidateResolveCache();
 }
 
 Texture2D* FramebufferManager::ResolveEFBColorTexture(const VkRect2D& region)
@@ -496,6 +521,12 @@ Texture2D* FramebufferManager::ResolveEFBColorTexture(const VkRect2D& region)
   if (GetEFBSamples() == VK_SAMPLE_COUNT_1_BIT)
     return m_efb_color_texture.get();
 
+  // If the previous resolve is still current and covers the requested region, return it
+  // without breaking the current render pass. Pass round-trips are very expensive on
+  // tile-based GPUs, as each one spills and reloads the entire tile store.
+  if (m_efb_resolve_color_valid && RegionCovers(m_efb_resolve_color_region, region))
+    return m_efb_resolve_color_texture.get();
+
   // Can't resolve within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
 
@@ -527,6 +558,12 @@ Texture2D* FramebufferManager::ResolveEFBColorTexture(const VkRect2D& region)
   // Restore MSAA texture ready for rendering again
   m_efb_color_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentCommandBuffer(),
     VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+  // Anything resolved earlier is still current (an EFB write would have cleared the valid
+  // flag), so the cached region grows to the union of the two.
+  m_efb_resolve_color_region =
+    m_efb_resolve_color_valid ? RegionUnion(m_efb_resolve_color_region, region) : region;
+  m_efb_resolve_color_valid = true;
   return m_efb_resolve_color_texture.get();
 }
 
@@ -536,6 +573,12 @@ Texture2D* FramebufferManager::ResolveEFBDepthTexture(const VkRect2D& region)
   if (GetEFBSamples() == VK_SAMPLE_COUNT_1_BIT)
     return m_efb_depth_texture.get();
 
+  // Depth resolves are a full draw pass rather than a vkCmdResolveImage, so skipping a
+  // redundant one (e.g. PeekZ after a depth copy in the same frame) saves both the draw
+  // and the render pass round-trip.
+  if (m_efb_resolve_depth_valid && RegionCovers(m_efb_resolve_depth_region, region))
+    return m_efb_resolve_depth_texture.get();
+
   // Can't resolve within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
 
@@ -560,6 +603,10 @@ Texture2D* FramebufferManager::ResolveEFBDepthTexture(const VkRect2D& region)
 
   // Render pass transitions to shader resource.
   m_efb_resolve_depth_texture->OverrideImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+  m_efb_resolve_depth_region =
+    m_efb_resolve_depth_valid ? RegionUnion(m_efb_resolve_depth_region, region) : region;
+  m_efb_resolve_depth_valid = true;
   return m_efb_resolve_depth_texture.get();
 }
 
@@ -873,6 +920,12 @@ void FramebufferManager::InvalidatePeekCache()
   m_depth_readback_texture_valid = false;
 }
 
+void FramebufferManager::InvalidateResolveCache()
+{
+  m_efb_resolve_color_valid = false;
+  m_efb_resolve_depth_valid = false;
+}
+
 bool FramebufferManager::CreateReadbackRenderPasses()
 {
   VkAttachmentDescription copy_attachment = {
@@ -1247,6 +1300,9 @@ void FramebufferManager::DrawPokeVertices(const EFBPokeVertex* vertices, size_t
   vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
   vkCmdBindVertexBuffers(command_buffer, 0, 1, &vb_buffer, &vb_offset);
   vkCmdDraw(command_buffer, static_cast<u32>(vertex_count), 1, 0, 0);
+
+  // Unlike the peek cache, the resolved textures can't be patched in place.
+  InvalidateResolveCache();
 }
 
 void FramebufferManager::CreatePokeVertexFormat()
@@ -75,6 +75,11 @@ public:
   // Ensure ResolveEFBColorTexture is called before this method.
   Texture2D* GetResolvedEFBColorTexture() const { return m_efb_resolve_color_texture.get(); }
   Texture2D* GetResolvedEFBDepthTexture() const { return m_efb_resolve_depth_texture.get(); }
+
+  // Marks the resolved color/depth textures as stale. Must be called whenever the EFB is
+  // written (draws, pokes, clears, pixel format changes), so that the next resolve request
+  // actually re-resolves instead of returning the cached copy.
+  void InvalidateResolveCache();
   // Reads a framebuffer value back from the GPU. This may block if the cache is not current.
   u32 PeekEFBColor(u32 x, u32 y);
   float PeekEFBDepth(u32 x, u32 y);
@@ -133,6 +138,14 @@ private:
   std::unique_ptr<Texture2D> m_efb_depth_texture;
   std::unique_ptr<Texture2D> m_efb_resolve_color_texture;
   std::unique_ptr<Texture2D> m_efb_resolve_depth_texture;
+
+  // Regions of the resolve textures which still match the EFB contents. While a resolve
+  // remains valid, repeated resolve requests covered by it are serviced from the cached
+  // texture without breaking the current render pass.
+  VkRect2D m_efb_resolve_color_region = {};
+  VkRect2D m_efb_resolve_depth_region = {};
+  bool m_efb_resolve_color_valid = false;
+  bool m_efb_resolve_depth_valid = false;
   VkFramebuffer m_efb_framebuffer = VK_NULL_HANDLE;
   VkFramebuffer m_efb_convert_framebuffer = VK_NULL_HANDLE;
   VkFramebuffer m_depth_resolve_framebuffer = VK_NULL_HANDLE;
@@ -541,6 +541,9 @@ void VulkanPostProcessor::PostProcessEFB(const TargetRectangle& src_rect, const
   if (g_ActiveConfig.iMultisamples > 1)
     CopyTexture(target_rect, reinterpret_cast<uintptr_t>(FramebufferManager::GetInstance()->GetEFBColorTexture()), target_rect, reinterpret_cast<uintptr_t>(color_texture), target_size, -1, false, true);
 
+  // The EFB and resolve textures were both written here, so cached resolves are stale.
+  FramebufferManager::GetInstance()->InvalidateResolveCache();
+
   g_renderer->RestoreAPIState();
 }
 
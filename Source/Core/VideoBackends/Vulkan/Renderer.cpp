@@ -349,6 +349,9 @@ void Renderer::BeginFrame()
 void Renderer::ClearScreen(const EFBRectangle& rc, bool color_enable, bool alpha_enable,
   bool z_enable, u32 color, u32 z)
 {
+  // Any cached EFB resolves no longer match after the clear.
+  FramebufferManager::GetInstance()->InvalidateResolveCache();
+
   // Native -> EFB coordinates
   TargetRectangle target_rc = Renderer::ConvertEFBRectangle(rc);
 
@@ -946,13 +949,9 @@ void Renderer::WriteFrameDumpImage(size_t index)
 
 StagingTexture2D* Renderer::PrepareFrameDumpImage(u32 width, u32 height, u64 ticks)
 {
-  // Ensure the last frame that was sent to the frame dump has completed encoding before we send
-  // the next image to it.
-  FinishFrameData();
-
-  // If the last image hasn't been written to the frame dump yet, write it now.
-  // This is necessary so that the worker thread is no more than one frame behind, and the pointer
-  // (which is actually the buffer) is safe for us to re-use next time.
+  // If the last image hasn't been written to the frame dump yet, write it now. The dump thread
+  // copies the frame out of the readback texture, so the buffer is safe to re-use as soon as
+  // WriteFrameDumpImage returns.
   if (m_frame_dump_images[m_current_frame_dump_image].pending)
     WriteFrameDumpImage(m_current_frame_dump_image);
 
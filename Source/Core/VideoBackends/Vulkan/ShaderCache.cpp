@@ -5,15 +5,19 @@
 #include "VideoBackends/Vulkan/ShaderCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <sstream>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <xxhash.h>
 
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/LinearDiskCache.h"
 #include "Common/MsgHandler.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Host.h"
@@ -34,6 +38,11 @@ namespace Vulkan
 {
 std::unique_ptr<ShaderCache> g_shader_cache;
 
+// Serializes disk cache appends while the boot warm-up compiles shaders on the
+// thread pool workers. LinearDiskCache writes to a single stream and is not
+// thread safe on its own.
+static Common::SpinLock<true> s_disk_cache_append_lock;
+
 ShaderCache::ShaderCache()
 {
 }
@@ -372,6 +381,47 @@ std::pair<VkPipeline, bool> ShaderCache::GetPipelineWithCacheResult(const Pipeli
   return{ pipeline, false };
 }
 
+void ShaderCache::PrecachePipelines(const std::vector<PipelineInfo>& infos)
+{
+  if (infos.empty())
+    return;
+
+  // The VkPipelineCache is internally synchronized, so the workers can create
+  // pipelines concurrently; only our bookkeeping map needs the lock.
+  static Common::SpinLock<true> s_pipeline_map_lock;
+  const size_t total = infos.size();
+  std::atomic<size_t> finished_count = { 0 };
+  for (const PipelineInfo& info : infos)
+  {
+    Common::AsyncWorker::ExecuteAsync([this, info, &finished_count]()
+    {
+      s_pipeline_map_lock.lock();
+      const bool known = m_pipeline_objects.find(info) != m_pipeline_objects.end();
+      s_pipeline_map_lock.unlock();
+      if (!known)
+      {
+        VkPipeline pipeline = CreatePipeline(info);
+        s_pipeline_map_lock.lock();
+        auto result = m_pipeline_objects.emplace(info, std::make_pair(pipeline, true));
+        s_pipeline_map_lock.unlock();
+        // Another worker got the same info in first.
+        if (!result.second && pipeline != VK_NULL_HANDLE)
+          vkDestroyPipeline(g_vulkan_context->GetDevice(), pipeline, nullptr);
+      }
+      finished_count.fetch_add(1);
+    });
+  }
+  size_t finished = finished_count.load();
+  while (finished < total)
+  {
+    Host_UpdateProgressDialog(GetStringT("Prefetching Pipelines...").c_str(),
+      static_cast<int>(finished), static_cast<int>(total));
+    Common::SleepCurrentThread(10);
+    finished = finished_count.load();
+  }
+  Host_UpdateProgressDialog("", -1, -1);
+}
+
 VkPipeline ShaderCache::CreateComputePipeline(const ComputePipelineInfo& info)
 {
   VkComputePipelineCreateInfo pipeline_info =
@@ -704,38 +754,69 @@ void ShaderCache::LoadShaderCaches(bool forcecompile)
   SETSTAT(stats.numPixelShadersAlive, static_cast<int>(m_ps_cache.shader_map->size()));
 }
 
+// Feeds the gathered warm-up jobs into the thread pool compile queue and waits
+// until the workers drain it, pumping the progress dialog from this thread.
+// SPIR-V generation is pure CPU work, so every worker can compile independently;
+// only the disk cache appends are serialized.
+static void RunWarmUpJobs(std::vector<std::function<void()>>& jobs, const char* message)
+{
+  if (jobs.empty())
+    return;
+  // glslang lazily initializes global process state on first use,
+  // do it here so the workers never race on it.
+  ShaderCompiler::InitializeGlslang();
+  const size_t total = jobs.size();
+  std::atomic<size_t> finished_count = { 0 };
+  for (auto& job : jobs)
+  {
+    Common::AsyncWorker::ExecuteAsync([&finished_count, job]()
+    {
+      job();
+      finished_count.fetch_add(1);
+    });
+  }
+  size_t finished = finished_count.load();
+  while (finished < total)
+  {
+    Host_UpdateProgressDialog(GetStringT(message).c_str(),
+      static_cast<int>(finished), static_cast<int>(total));
+    Common::SleepCurrentThread(10);
+    finished = finished_count.load();
+  }
+  Host_UpdateProgressDialog("", -1, -1);
+  jobs.clear();
+}
+
 void ShaderCache::CompileUberShaders()
 {
-  int shader_count = 0;
+  // Claim pending entries on this thread so the workers never race on the same
+  // cache slot, then hand the actual compilation to the thread pool.
+  std::vector<std::function<void()>> jobs;
   UberShader::EnumerateVertexUberShaderUids([&](const UberShader::VertexUberShaderUid& uid, size_t total) {
     vkShaderItem& it = m_vus_cache.shader_map[uid];
     if (!it.initialized.test_and_set())
     {
-      CompileVertexUberShaderForUid(uid, it);
+      jobs.push_back([this, uid, &it]() { CompileVertexUberShaderForUid(uid, it); });
     }
-    shader_count++;
-    Host_UpdateProgressDialog(GetStringT("Compiling Vertex Uber shaders...").c_str(),
-      static_cast<int>(shader_count), static_cast<int>(total));
-  });  
-  Host_UpdateProgressDialog("", -1, -1);
-  shader_count = 0;
+  });
   UberShader::EnumeratePixelUberShaderUids([&](const UberShader::PixelUberShaderUid& uid, size_t total) {
     vkShaderItem& it = m_pus_cache.shader_map[uid];
     if (!it.initialized.test_and_set())
     {
-      CompilePixelUberShaderForUid(uid, it);
+      jobs.push_back([this, uid, &it]() { CompilePixelUberShaderForUid(uid, it); });
     }
-    shader_count++;
-    Host_UpdateProgressDialog(GetStringT("Compiling Pixel Uber shaders...").c_str(),
-      static_cast<int>(shader_count), static_cast<int>(total));    
   });
-  Host_UpdateProgressDialog("", -1, -1);
+  RunWarmUpJobs(jobs, "Compiling Uber shaders...");
 }
 
 void ShaderCache::CompileShaders()
 {
   pKey_t gameid = (pKey_t)GetMurmurHash3(reinterpret_cast<const u8*>(SConfig::GetInstance().GetGameID().data()), (u32)SConfig::GetInstance().GetGameID().size(), 0);
-  int shader_count = 0;
+  // Gather every uid the usage profile knows about for this game and claim its
+  // cache slot, then compile the whole batch on the thread pool so boot-time
+  // warm-up scales with the host core count instead of serializing on this
+  // thread.
+  std::vector<std::function<void()>> jobs;
   m_vs_cache.shader_map->ForEachMostUsedByCategory(gameid,
     [&](const VertexShaderUid& uid, size_t total)
   {
@@ -745,9 +826,7 @@ void ShaderCache::CompileShaders()
     vkShaderItem& it = m_vs_cache.shader_map->GetOrAdd(item);
     if (!it.initialized.test_and_set())
     {
-      CompileVertexShaderForUid(item, it);
-      Host_UpdateProgressDialog(GetStringT("Compiling Vertex shaders...").c_str(),
-        static_cast<int>(shader_count), static_cast<int>(total));
+      jobs.push_back([this, item, &it]() { CompileVertexShaderForUid(item, it); });
     }
   },
     [](vkShaderItem& entry)
@@ -755,7 +834,6 @@ void ShaderCache::CompileShaders()
     return !entry.compiled;
   }
   , true);
-  shader_count = 0;
   m_ps_cache.shader_map->ForEachMostUsedByCategory(gameid,
     [&](const PixelShaderUid& uid, size_t total)
   {
@@ -765,9 +843,7 @@ void ShaderCache::CompileShaders()
     vkShaderItem& it = m_ps_cache.shader_map->GetOrAdd(item);
     if (!it.initialized.test_and_set())
     {
-      CompilePixelShaderForUid(item, it);
-      Host_UpdateProgressDialog(GetStringT("Compiling Pixel shaders...").c_str(),
-        static_cast<int>(shader_count), static_cast<int>(total));
+      jobs.push_back([this, item, &it]() { CompilePixelShaderForUid(item, it); });
     }
   },
     [](vkShaderItem& entry)
@@ -778,23 +854,19 @@ void ShaderCache::CompileShaders()
 
   if (g_vulkan_context->SupportsGeometryShaders())
   {
-    shader_count = 0;
     EnumerateGeometryShaderUids([&](const GeometryShaderUid& uid, size_t total)
     {
       GeometryShaderUid item = uid;
       item.ClearHASH();
       item.CalculateUIDHash();
       vkShaderItem& it = m_gs_cache.shader_map[item];
-      shader_count++;
       if (!it.initialized.test_and_set())
       {
-        CompileGeometryShaderForUid(item, it);
-        Host_UpdateProgressDialog(GetStringT("Compiling Geometry shaders...").c_str(),
-          static_cast<int>(shader_count), static_cast<int>(total));
+        jobs.push_back([this, item, &it]() { CompileGeometryShaderForUid(item, it); });
       }
     });
   }
-  Host_UpdateProgressDialog("", -1, -1);
+  RunWarmUpJobs(jobs, "Compiling Shaders...");
 }
 
 void ShaderCache::Reload()
@@ -874,14 +946,18 @@ void ShaderCache::CompileVertexShaderForUid(const VertexShaderUid& uid, ShaderCa
     // Append to shader cache if it created successfully.
     if (module != VK_NULL_HANDLE)
     {
+      s_disk_cache_append_lock.lock();
       m_vs_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
+      s_disk_cache_append_lock.unlock();
       INCSTAT(stats.numVertexShadersCreated);
       INCSTAT(stats.numVertexShadersAlive);
     }
   }
-  it.compiled = true;
   // We still insert null entries to prevent further compilation attempts.
+  // The module has to be published before the compiled flag, so a reader on
+  // another thread that sees compiled == true also sees the module.
   it.module = module;
+  it.compiled.store(true, std::memory_order_release);
 }
 
 void ShaderCache::CompileVertexUberShaderForUid(const UberShader::VertexUberShaderUid& uid, ShaderCache::vkShaderItem& it)
@@ -899,12 +975,16 @@ void ShaderCache::CompileVertexUberShaderForUid(const UberShader::VertexUberShad
     // Append to shader cache if it created successfully.
     if (module != VK_NULL_HANDLE)
     {
+      s_disk_cache_append_lock.lock();
       m_vus_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
+      s_disk_cache_append_lock.unlock();
     }
   }
-  it.compiled = true;
   // We still insert null entries to prevent further compilation attempts.
+  // The module has to be published before the compiled flag, so a reader on
+  // another thread that sees compiled == true also sees the module.
   it.module = module;
+  it.compiled.store(true, std::memory_order_release);
 }
 
 void ShaderCache::CompileGeometryShaderForUid(const GeometryShaderUid& uid, ShaderCache::vkShaderItem& it)
@@ -921,11 +1001,17 @@ void ShaderCache::CompileGeometryShaderForUid(const GeometryShaderUid& uid, Shad
 
     // Append to shader cache if it created successfully.
     if (module != VK_NULL_HANDLE)
+    {
+      s_disk_cache_append_lock.lock();
       m_gs_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
+      s_disk_cache_append_lock.unlock();
+    }
   }
-  it.compiled = true;
   // We still insert null entries to prevent further compilation attempts.
+  // The module has to be published before the compiled flag, so a reader on
+  // another thread that sees compiled == true also sees the module.
   it.module = module;
+  it.compiled.store(true, std::memory_order_release);
 }
 
 void ShaderCache::CompilePixelShaderForUid(const PixelShaderUid& uid, ShaderCache::vkShaderItem& it)
@@ -943,14 +1029,18 @@ void ShaderCache::CompilePixelShaderForUid(const PixelShaderUid& uid, ShaderCach
     // Append to shader cache if it created successfully.
     if (module != VK_NULL_HANDLE)
     {
+      s_disk_cache_append_lock.lock();
       m_ps_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
+      s_disk_cache_append_lock.unlock();
       INCSTAT(stats.numPixelShadersCreated);
       INCSTAT(stats.numPixelShadersAlive);
     }
   }
-  it.compiled = true;
   // We still insert null entries to prevent further compilation attempts.
+  // The module has to be published before the compiled flag, so a reader on
+  // another thread that sees compiled == true also sees the module.
   it.module = module;
+  it.compiled.store(true, std::memory_order_release);
 }
 
 void ShaderCache::CompilePixelUberShaderForUid(const UberShader::PixelUberShaderUid& uid, ShaderCache::vkShaderItem& it)
@@ -968,14 +1058,18 @@ void ShaderCache::CompilePixelUberShaderForUid(const UberShader::PixelUberShader
     // Append to shader cache if it created successfully.
     if (module != VK_NULL_HANDLE)
     {
+      s_disk_cache_append_lock.lock();
       m_pus_cache.disk_cache.Append(uid, spv.data(), static_cast<u32>(spv.size()));
+      s_disk_cache_append_lock.unlock();
       INCSTAT(stats.numPixelShadersCreated);
       INCSTAT(stats.numPixelShadersAlive);
     }
   }
-  it.compiled = true;
   // We still insert null entries to prevent further compilation attempts.
+  // The module has to be published before the compiled flag, so a reader on
+  // another thread that sees compiled == true also sees the module.
   it.module = module;
+  it.compiled.store(true, std::memory_order_release);
 }
 
 VkShaderModule ShaderCache::GetVertexShaderForUid(const VertexShaderUid& uid)
@@ -1009,6 +1103,28 @@ VkShaderModule ShaderCache::GetPixelShaderForUid(const PixelShaderUid& uid)
   return it.module;
 }
 
+VkShaderModule ShaderCache::GetVertexShaderForUidAsync(const VertexShaderUid& uid)
+{
+  vkShaderItem& it = m_vs_cache.shader_map->GetOrAdd(uid);
+  if (it.initialized.test_and_set())
+    return it.compiled.load(std::memory_order_acquire) ? it.module : VK_NULL_HANDLE;
+
+  ShaderCompiler::InitializeGlslang();
+  Common::AsyncWorker::ExecuteAsync([this, uid, &it]() { CompileVertexShaderForUid(uid, it); });
+  return VK_NULL_HANDLE;
+}
+
+VkShaderModule ShaderCache::GetPixelShaderForUidAsync(const PixelShaderUid& uid)
+{
+  vkShaderItem& it = m_ps_cache.shader_map->GetOrAdd(uid);
+  if (it.initialized.test_and_set())
+    return it.compiled.load(std::memory_order_acquire) ? it.module : VK_NULL_HANDLE;
+
+  ShaderCompiler::InitializeGlslang();
+  Common::AsyncWorker::ExecuteAsync([this, uid, &it]() { CompilePixelShaderForUid(uid, it); });
+  return VK_NULL_HANDLE;
+}
+
 VkShaderModule ShaderCache::GetVertexUberShaderForUid(const UberShader::VertexUberShaderUid& uid)
 {
   vkShaderItem& it = m_vus_cache.shader_map[uid];
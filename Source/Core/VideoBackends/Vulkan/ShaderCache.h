@@ -5,12 +5,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/LinearDiskCache.h"
@@ -137,6 +139,12 @@ public:
   VkShaderModule GetGeometryShaderForUid(const GeometryShaderUid& uid);
   VkShaderModule GetPixelShaderForUid(const PixelShaderUid& uid);
 
+  // Hybrid ubershader mode: the first request for a uid kicks off compilation
+  // on the worker pool; VK_NULL_HANDLE is returned until the module is ready,
+  // so the caller can draw with the ubershader pipeline in the meantime.
+  VkShaderModule GetVertexShaderForUidAsync(const VertexShaderUid& uid);
+  VkShaderModule GetPixelShaderForUidAsync(const PixelShaderUid& uid);
+
   // Ubershader caches
   VkShaderModule GetVertexUberShaderForUid(const UberShader::VertexUberShaderUid& uid);
   VkShaderModule GetPixelUberShaderForUid(const UberShader::PixelUberShaderUid& uid);
@@ -156,6 +164,11 @@ public:
   // resulted in a pipeline being created, the second field of the return value will be false,
   // otherwise for a cache hit it will be true.
   std::pair<VkPipeline, bool> GetPipelineWithCacheResult(const PipelineInfo& info);
+
+  // Creates all pipelines in the list on the worker pool, reporting progress
+  // through the host. Used to pre-populate the pipeline cache at boot from
+  // the previously-seen pipeline UID database.
+  void PrecachePipelines(const std::vector<PipelineInfo>& infos);
   
   // Creates a compute pipeline, and does not track the handle.
   VkPipeline CreateComputePipeline(const ComputePipelineInfo& info);
@@ -188,7 +201,9 @@ public:
   class vkShaderItem
   {
   public:
-    bool compiled{};
+    // Written by worker threads in the async path; readers pair an acquire
+    // load of this flag with the release store in Compile*ForUid.
+    std::atomic<bool> compiled{};
     std::atomic_flag initialized{};
     VkShaderModule module = VK_NULL_HANDLE;
     vkShaderItem() {}
@@ -17,19 +17,19 @@
 #include "disassemble.h"
 
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/Timer.h"
 
+#include "VideoCommon/ShaderCompileTelemetry.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace Vulkan
 {
 namespace ShaderCompiler
 {
-// Registers itself for cleanup via atexit
-bool InitializeGlslang();
-
 // Resource limits used when compiling shaders
 static const TBuiltInResource* GetCompilerResourceLimits();
 
@@ -141,6 +141,8 @@ bool CompileShaderToSPV(SPIRVCodeVector* out_code, EShLanguage stage, const char
   if (!InitializeGlslang())
     return false;
 
+  const u64 compile_start = Common::Timer::GetTimeUs();
+
   std::unique_ptr<glslang::TShader> shader = std::make_unique<glslang::TShader>(stage);
   std::unique_ptr<glslang::TProgram> program;
   glslang::TShader::ForbidInclude includer;
@@ -254,6 +256,10 @@ bool CompileShaderToSPV(SPIRVCodeVector* out_code, EShLanguage stage, const char
     }
   }
 
+  ShaderCompileTelemetry::RecordCompile(stage_filename,
+    GetHash64(reinterpret_cast<const u8*>(source_code), static_cast<u32>(source_code_length), 0),
+    static_cast<u32>(Common::Timer::GetTimeUs() - compile_start));
+
   return true;
 }
 
@@ -17,6 +17,10 @@ namespace ShaderCompiler
 using SPIRVCodeType = u32;
 using SPIRVCodeVector = std::vector<SPIRVCodeType>;
 
+// Initializes the glslang process state. Registers itself for cleanup via atexit.
+// Must be called on a single thread before shaders are compiled concurrently.
+bool InitializeGlslang();
+
 // Compile a vertex shader to SPIR-V.
 bool CompileVertexShader(SPIRVCodeVector* out_code, const char* source_code,
   size_t source_code_length);
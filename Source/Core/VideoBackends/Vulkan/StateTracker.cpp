@@ -138,6 +138,9 @@ void StateTracker::ReloadPipelineUIDCache()
     VERTEXSHADERGEN_UID_VERSION,
     GEOMETRYSHADERGEN_UID_VERSION,
     PIXELSHADERGEN_UID_VERSION, PIPELINE_UID_VERSION));
+
+  g_shader_cache->PrecachePipelines(m_precache_pipeline_infos);
+  m_precache_pipeline_infos.clear();
 }
 
 void StateTracker::ReloadUberPipelineUIDCache()
@@ -170,6 +173,9 @@ void StateTracker::ReloadUberPipelineUIDCache()
       VERTEXUBERSHADERGEN_UID_VERSION,
       GEOMETRYSHADERGEN_UID_VERSION,
       PIXELUBERSHADERGEN_UID_VERSION, PIPELINE_UID_VERSION));
+
+  g_shader_cache->PrecachePipelines(m_precache_pipeline_infos);
+  m_precache_pipeline_infos.clear();
 }
 
 void StateTracker::AppendToUberPipelineUIDCache(const PipelineInfo& info)
@@ -247,14 +253,9 @@ bool StateTracker::PrecachePipelineUID(const SerializedPipelineUID& uid)
   pinfo.rasterization_state.hex = uid.rasterizer_state_bits;
   pinfo.depth_state.hex = uid.depth_state_bits;
 
-  VkPipeline pipeline = g_shader_cache->GetPipeline(pinfo);
-  if (pipeline == VK_NULL_HANDLE)
-  {
-    WARN_LOG(VIDEO, "Failed to get pipeline from cached UID.");
-    return false;
-  }
-
-  // We don't need to do anything with this pipeline, just make sure it exists.
+  // The pipelines themselves are created in parallel on the worker pool once
+  // the whole UID cache has been read.
+  m_precache_pipeline_infos.push_back(pinfo);
   return true;
 }
 
@@ -303,14 +304,9 @@ bool StateTracker::PrecacheUberPipelineUID(const SerializedUberPipelineUID& uid)
   pinfo.rasterization_state.hex = uid.rasterizer_state_bits;
   pinfo.depth_state.hex = uid.depth_state_bits;
 
-  VkPipeline pipeline = g_shader_cache->GetPipeline(pinfo);
-  if (pipeline == VK_NULL_HANDLE)
-  {
-    WARN_LOG(VIDEO, "Failed to get pipeline from cached UID.");
-    return false;
-  }
-
-  // We don't need to do anything with this pipeline, just make sure it exists.
+  // The pipelines themselves are created in parallel on the worker pool once
+  // the whole UID cache has been read.
+  m_precache_pipeline_infos.push_back(pinfo);
   return true;
 }
 
@@ -413,16 +409,29 @@ bool StateTracker::CheckForShaderChanges(PrimitiveType gx_primitive_type, u32 co
 
   bool changed = false;
   bool use_ubershaders = g_ActiveConfig.bDisableSpecializedShaders;
+  if (!use_ubershaders && g_ActiveConfig.bBackgroundShaderCompiling)
+  {
+    // Hybrid mode: the async getters kick off compilation on the worker pool
+    // the first time a uid is seen. Draw with the ubershader pipeline until
+    // both specialized modules have come back.
+    if (g_shader_cache->GetVertexShaderForUidAsync(vs_uid) == VK_NULL_HANDLE ||
+        g_shader_cache->GetPixelShaderForUidAsync(ps_uid) == VK_NULL_HANDLE)
+    {
+      use_ubershaders = true;
+    }
+  }
   if (!use_ubershaders)
   {
-    if (vs_uid != m_vs_uid)
+    // m_using_ubershaders means the previous draw fell back to the ubershader
+    // pipeline, so the modules have to be set even when the uids match.
+    if (vs_uid != m_vs_uid || m_using_ubershaders)
     {
       m_pipeline_state.vs = g_shader_cache->GetVertexShaderForUid(vs_uid);
       m_vs_uid = vs_uid;
       changed = true;
     }
 
-    if (ps_uid != m_ps_uid)
+    if (ps_uid != m_ps_uid || m_using_ubershaders)
     {
       m_pipeline_state.ps = g_shader_cache->GetPixelShaderForUid(ps_uid);
       m_ps_uid = ps_uid;
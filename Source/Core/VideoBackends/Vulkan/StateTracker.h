@@ -274,5 +274,8 @@ private:
   // loading should be reasonably efficient.
   LinearDiskCache<SerializedPipelineUID, u32> m_uid_cache;
   LinearDiskCache<SerializedUberPipelineUID, u32> m_uberuid_cache;
+  // Pipeline infos gathered while reading a UID cache, created in one
+  // parallel batch afterwards.
+  std::vector<PipelineInfo> m_precache_pipeline_infos;
 };
 }
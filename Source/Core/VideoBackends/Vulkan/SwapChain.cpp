@@ -207,17 +207,19 @@ bool SwapChain::SelectPresentMode()
     return true;
   }
 
-  // Prefer screen-tearing, if possible, for lowest latency.
-  if (CheckForMode(VK_PRESENT_MODE_IMMEDIATE_KHR))
+  // Prefer mailbox with vsync disabled: presentation never blocks and the
+  // newest completed frame is shown at the next vblank, so latency stays
+  // within one refresh without tearing.
+  if (CheckForMode(VK_PRESENT_MODE_MAILBOX_KHR))
   {
-    m_present_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+    m_present_mode = VK_PRESENT_MODE_MAILBOX_KHR;
     return true;
   }
 
-  // Use optimized-vsync above vsync.
-  if (CheckForMode(VK_PRESENT_MODE_MAILBOX_KHR))
+  // Otherwise accept screen-tearing for the lowest latency.
+  if (CheckForMode(VK_PRESENT_MODE_IMMEDIATE_KHR))
   {
-    m_present_mode = VK_PRESENT_MODE_MAILBOX_KHR;
+    m_present_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
     return true;
   }
 
@@ -22,6 +22,7 @@
 #include "VideoBackends/Vulkan/VulkanContext.h"
 
 #include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/TextureDumpQueue.h"
 #include "VideoCommon/TextureConfig.h"
 
 namespace Vulkan
@@ -130,15 +131,15 @@ bool VKTexture::Save(const std::string& filename, u32 level)
     return false;
   }
 
-  // Write texture out to file.
-  // It's okay to throw this texture away immediately, since we're done with it, and
-  // we blocked until the copy completed on the GPU anyway.
-  bool result = TextureToPng(reinterpret_cast<u8*>(staging_texture->GetMapPointer()),
+  // Hand the encode off to the background queue. It copies the pixel data
+  // before returning, so it's okay to throw the staging texture away
+  // immediately.
+  TextureDumpQueue::QueuePNG(reinterpret_cast<u8*>(staging_texture->GetMapPointer()),
     static_cast<u32>(staging_texture->GetRowStride()), filename,
     level_width, level_height);
 
   staging_texture->Unmap();
-  return result;
+  return true;
 }
 
 void VKTexture::CopyTextureRectangle(const MathUtil::Rectangle<int>& dst_rect,
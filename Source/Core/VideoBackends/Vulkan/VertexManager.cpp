@@ -154,8 +154,9 @@ void VertexManager::vFlush(bool use_dst_alpha)
   // with the command buffer that has the corresponding draw.
   PrepareDrawBuffers(vertex_stride);
 
-  // Flush all EFB pokes and invalidate the peek cache.
+  // Flush all EFB pokes and invalidate the peek and resolve caches.
   FramebufferManager::GetInstance()->InvalidatePeekCache();
+  FramebufferManager::GetInstance()->InvalidateResolveCache();
   FramebufferManager::GetInstance()->FlushEFBPokes();
 
   // If bounding box is enabled, we need to flush any changes first, then invalidate what we have.
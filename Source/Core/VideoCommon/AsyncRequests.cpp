@@ -4,109 +4,138 @@
 
 #include <mutex>
 
+#include "Common/Thread.h"
 #include "VideoCommon/AsyncRequests.h"
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
 AsyncRequests AsyncRequests::s_singleton;
 
-AsyncRequests::AsyncRequests()
-  : m_enable(false), m_passthrough(true)
-{}
+AsyncRequests::AsyncRequests() = default;
 
 void AsyncRequests::PullEventsInternal()
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
   m_empty.Set();
 
-  while (!m_queue.empty())
+  size_t read = m_read_index.load(std::memory_order_relaxed);
+  while (read != m_write_index.load(std::memory_order_acquire))
   {
-    Event e = m_queue.front();
+    const Event& e = m_ring[read & (QUEUE_SIZE - 1)];
 
     // try to merge as many efb pokes as possible
     // it's a bit hacky, but some games render a complete frame in this way
     if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
     {
+      const Event::Type first_type = e.type;
+      const EFBAccessType t =
+          first_type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
       m_merged_efb_pokes.clear();
-      Event first_event = m_queue.front();
-      EFBAccessType t = first_event.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
 
       do
       {
-        e = m_queue.front();
+        const Event& poke = m_ring[read & (QUEUE_SIZE - 1)];
 
         EfbPokeData d;
-        d.data = e.efb_poke.data;
-        d.x = e.efb_poke.x;
-        d.y = e.efb_poke.y;
+        d.data = poke.efb_poke.data;
+        d.x = poke.efb_poke.x;
+        d.y = poke.efb_poke.y;
         m_merged_efb_pokes.push_back(d);
 
-        m_queue.pop();
-      } while (!m_queue.empty() && m_queue.front().type == first_event.type);
+        // The slot is copied out, so it can be reused right away; a producer
+        // throttled by a full ring makes progress while we keep merging.
+        read++;
+        m_read_index.store(read, std::memory_order_release);
+      } while (read != m_write_index.load(std::memory_order_acquire) &&
+               m_ring[read & (QUEUE_SIZE - 1)].type == first_type);
 
-      lock.unlock();
+      // The pokes change the efb, so any deferred efb copies have to read it first.
+      g_texture_cache->FlushEFBCopies();
       g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
-      lock.lock();
       continue;
     }
 
-    lock.unlock();
-    HandleEvent(e);
-    lock.lock();
-
-    m_queue.pop();
+    // Release the slot only after the event is handled, so a blocking
+    // producer wakes up to an empty ring with its results in place.
+    const Event event_copy = e;
+    HandleEvent(event_copy);
+    read++;
+    m_read_index.store(read, std::memory_order_release);
   }
 
-  if (m_wake_me_up_again)
+  // The Set() at the top may race with a push that published right as the
+  // drain loop gave up; reopen the gate so the next PullEvents() sees it.
+  if (!RingEmpty())
+    m_empty.Clear();
+
+  if (m_wake_me_up_again.load(std::memory_order_acquire))
   {
-    m_wake_me_up_again = false;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // A blocking push may have landed after the drain loop above gave up; its
+    // wakeup belongs to the pull that will actually process it, so the flag
+    // is only cleared when the ring is seen empty under the lock.
+    if (!RingEmpty())
+      return;
+    m_wake_me_up_again.store(false, std::memory_order_relaxed);
+    lock.unlock();
     m_cond.notify_all();
   }
 }
 
 void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-
-  if (m_passthrough)
+  if (m_passthrough.load(std::memory_order_relaxed))
   {
     HandleEvent(event);
     return;
   }
 
-  m_empty.Clear();
-  m_wake_me_up_again |= blocking;
-
-  if (!m_enable)
+  if (!m_enable.load(std::memory_order_relaxed))
     return;
 
-  m_queue.push(event);
+  // Claim the next slot. A full ring only happens when a title floods pokes
+  // faster than the merge loop drains them; keep the GPU running and wait for
+  // space instead of growing a heap queue.
+  const size_t write = m_write_index.load(std::memory_order_relaxed);
+  while (write - m_read_index.load(std::memory_order_acquire) >= QUEUE_SIZE)
+  {
+    Fifo::RunGpu();
+    Common::YieldCPU();
+  }
+  m_ring[write & (QUEUE_SIZE - 1)] = event;
+  m_write_index.store(write + 1, std::memory_order_release);
+
+  // Clear the empty flag only once the slot is visible: a clear ahead of the
+  // publish could be overtaken by the consumer's Set() and leave the event
+  // permanently hidden behind the PullEvents() gate.
+  m_empty.Clear();
 
   Fifo::RunGpu();
   if (blocking)
   {
-    m_cond.wait(lock, [this]
-    {
-      return m_queue.empty();
-    });
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Raised under the mutex after the publish, and only lowered by the
+    // consumer after it sees the ring empty under the same mutex, so the
+    // notify for this event cannot be stolen by an earlier pull.
+    m_wake_me_up_again.store(true, std::memory_order_release);
+    m_cond.wait(lock, [this] { return RingEmpty(); });
   }
 }
 
 void AsyncRequests::SetEnable(bool enable)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_enable = enable;
+  m_enable.store(enable);
 
   if (!enable)
   {
     // flush the queue on disabling
-    while (!m_queue.empty())
-      m_queue.pop();
-    if (m_wake_me_up_again)
+    m_read_index.store(m_write_index.load());
+    if (m_wake_me_up_again.exchange(false))
       m_cond.notify_all();
   }
 }
@@ -118,6 +147,7 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
   {
   case Event::EFB_POKE_COLOR:
   {
+    g_texture_cache->FlushEFBCopies();
     EfbPokeData poke = { e.efb_poke.x, e.efb_poke.y, e.efb_poke.data };
     g_renderer->PokeEFB(EFBAccessType::PokeColor, &poke, 1);
   }
@@ -125,6 +155,7 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 
   case Event::EFB_POKE_Z:
   {
+    g_texture_cache->FlushEFBCopies();
     EfbPokeData poke = { e.efb_poke.x, e.efb_poke.y, e.efb_poke.data };
     g_renderer->PokeEFB(EFBAccessType::PokeZ, &poke, 1);
   }
@@ -139,6 +170,9 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
     break;
 
   case Event::SWAP_EVENT:
+    // The EFB holds the completed frame at swap time, so this is the batch
+    // point for the registered overlay sample points.
+    SampleEfbPoints();
     g_renderer->Swap(e.swap_event.xfbAddr, e.swap_event.fbWidth, e.swap_event.fbStride, e.swap_event.fbHeight, rc, e.time);
     break;
 
@@ -153,7 +187,9 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
     }
     break;
   case Event::PERF_QUERY:
-    g_perf_query->FlushResults();
+    // Only harvest what has already completed; the CPU thread no longer
+    // waits for this event and extrapolates over whatever is still pending.
+    g_perf_query->WeakFlush();
     break;
 
   }
@@ -162,6 +198,36 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 void AsyncRequests::SetPassthrough(bool enable)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_passthrough = enable;
+  m_passthrough.store(enable);
+}
+
+void AsyncRequests::SetEfbSamplePoints(std::vector<EfbSamplePoint> points,
+  EfbSampleCallback callback)
+{
+  std::unique_lock<std::mutex> lock(m_sample_mutex);
+  m_sample_points = std::move(points);
+  m_sample_callback = m_sample_points.empty() ? EfbSampleCallback() : std::move(callback);
+}
+
+void AsyncRequests::SampleEfbPoints()
+{
+  std::vector<EfbSamplePoint> points;
+  EfbSampleCallback callback;
+  {
+    std::unique_lock<std::mutex> lock(m_sample_mutex);
+    if (m_sample_points.empty() || !m_sample_callback)
+      return;
+    points = m_sample_points;
+    callback = m_sample_callback;
+  }
+
+  for (EfbSamplePoint& point : points)
+  {
+    point.color = g_renderer->AccessEFB(EFBAccessType::PeekColor, point.x, point.y, 0);
+    point.z = g_renderer->AccessEFB(EFBAccessType::PeekZ, point.x, point.y, 0);
+  }
+
+  // Invoked without holding the lock, so the callback may re-register.
+  callback(points);
 }
 
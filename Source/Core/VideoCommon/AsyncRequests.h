@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -66,8 +68,26 @@ public:
     };
   };
 
+  // Persistent EFB sample point for frontend overlays. x/y are native EFB
+  // coordinates; color and z are refreshed once per frame.
+  struct EfbSamplePoint
+  {
+    u16 x;
+    u16 y;
+    u32 color;
+    u32 z;
+  };
+  using EfbSampleCallback = std::function<void(const std::vector<EfbSamplePoint>&)>;
+
   AsyncRequests();
 
+  // Registers a persistent set of EFB sample points. They are read back in
+  // one batch on the video thread when a frame is swapped and delivered
+  // through callback (still on the video thread), so unlike a blocking
+  // EFB_PEEK event no caller ever stalls the pipeline. The delivered values
+  // lag presentation by at most one frame. An empty set unregisters.
+  void SetEfbSamplePoints(std::vector<EfbSamplePoint> points, EfbSampleCallback callback);
+
   void PullEvents()
   {
     if (!m_empty.IsSet())
@@ -83,19 +103,39 @@ public:
   }
 
 private:
+  // Events travel through a fixed ring of inline payload slots. The producer
+  // (the CPU thread; every PushEvent caller runs there) owns m_write_index
+  // and the video thread owns m_read_index, so a non-blocking push is a slot
+  // write and an index store: no mutex and no allocation per event. The
+  // mutex/condvar pair only backs the wait of blocking pushes.
+  static constexpr size_t QUEUE_SIZE = 0x1000;  // must be a power of two
+
+  bool RingEmpty() const
+  {
+    return m_read_index.load(std::memory_order_acquire) ==
+           m_write_index.load(std::memory_order_acquire);
+  }
+
   void PullEventsInternal();
   void HandleEvent(const Event& e);
+  void SampleEfbPoints();
 
   static AsyncRequests s_singleton;
 
   Common::Flag m_empty;
-  std::queue<Event> m_queue;
+  std::array<Event, QUEUE_SIZE> m_ring;
+  std::atomic<size_t> m_write_index{0};
+  std::atomic<size_t> m_read_index{0};
   std::mutex m_mutex;
   std::condition_variable m_cond;
 
-  bool m_wake_me_up_again;
-  bool m_enable;
-  bool m_passthrough;
+  std::atomic<bool> m_wake_me_up_again{false};
+  std::atomic<bool> m_enable{false};
+  std::atomic<bool> m_passthrough{true};
 
   std::vector<EfbPokeData> m_merged_efb_pokes;
+
+  std::mutex m_sample_mutex;
+  std::vector<EfbSamplePoint> m_sample_points;
+  EfbSampleCallback m_sample_callback;
 };
@@ -63,7 +63,11 @@ void SetScissor()
   if (rc.left > rc.right) std::swap(rc.right, rc.left);
   if (rc.top > rc.bottom) std::swap(rc.bottom, rc.top);
 
-  g_renderer->SetScissorRect(rc);
+  // The scissor offset also feeds the viewport constants, so it is part of
+  // the memoization key; when neither the rectangle nor the offset changed
+  // there is nothing to recompute.
+  if (!g_renderer->SetScissorRectIfChanged(rc, xoff, yoff))
+    return;
   VertexShaderManager::SetViewportChanged();
   GeometryShaderManager::SetViewportChanged();
   PixelShaderManager::SetViewportChanged();
@@ -22,6 +22,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/Statistics.h"
@@ -58,6 +59,33 @@ void BPInit()
   mapTexFound = false;
 }
 
+// Registers whose value feeds pixel shader UID generation (see
+// GetPixelShaderUID). Constant-only registers (tev/fog colors, scales, ...)
+// are deliberately absent; they only touch the constant buffer.
+static bool BPRegAffectsPixelShaderUid(int address)
+{
+  switch (address)
+  {
+  case BPMEM_GENMODE:
+  case BPMEM_IREF:
+  case BPMEM_ZMODE:
+  case BPMEM_BLENDMODE:
+  case BPMEM_ZCOMPARE:
+  case BPMEM_CLEARBBOX1:
+  case BPMEM_CLEARBBOX2:
+  case BPMEM_FOGRANGE:
+  case BPMEM_FOGPARAM3:
+  case BPMEM_ALPHACOMPARE:
+  case BPMEM_ZTEX2:
+    return true;
+  default:
+    return (address >= BPMEM_IND_CMD && address < BPMEM_IND_CMD + 16)
+      || (address >= BPMEM_TREF && address < BPMEM_TREF + 8)
+      || (address >= BPMEM_TEV_COLOR_ENV && address < BPMEM_TEV_COLOR_ENV + 32)
+      || (address >= BPMEM_TEV_KSEL && address < BPMEM_TEV_KSEL + 8);
+  }
+}
+
 void BPWritten(const BPCmd& bp)
 {
   /*
@@ -117,10 +145,42 @@ void BPWritten(const BPCmd& bp)
     }
   }
 
+  // EFB copy and clear configuration is never read by in-flight draws; the
+  // values are only latched when a copy or clear is actually triggered (and
+  // the trigger write still flushes). Update them without splitting the
+  // current batch, so titles that reprogram the copy window or clear color
+  // between draws don't pay a draw call per register write.
+  switch (bp.address)
+  {
+  case BPMEM_EFB_TL:        // EFB Source Rect. Top, Left
+  case BPMEM_EFB_BR:        // EFB Source Rect. Bottom, Right (w, h - 1)
+  case BPMEM_EFB_ADDR:      // EFB Target Address
+  case BPMEM_MIPMAP_STRIDE: // MipMap Stride Channel
+  case BPMEM_COPYYSCALE:    // Display Copy Y Scale
+  case BPMEM_CLEAR_AR:      // Alpha and Red Components
+  case BPMEM_CLEAR_GB:      // Green and Blue Components
+  case BPMEM_CLEAR_Z:       // Z Components (24-bit Zbuffer)
+  case BPMEM_COPYFILTER0:
+  case BPMEM_COPYFILTER1:
+  case BPMEM_DISPLAYCOPYFILTER:
+  case BPMEM_DISPLAYCOPYFILTER + 1:
+  case BPMEM_DISPLAYCOPYFILTER + 2:
+  case BPMEM_DISPLAYCOPYFILTER + 3:
+    ((u32*)&bpmem)[bp.address] = bp.newvalue;
+    return;
+  default:
+    break;
+  }
+
   FlushPipeline();
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
 
+  // Only writes that change the register's value get this far, so a write to
+  // any UID input makes the cached pixel shader UIDs stale.
+  if (BPRegAffectsPixelShaderUid(bp.address))
+    MarkPixelShaderUidDirty();
+
   switch (bp.address)
   {
   case BPMEM_GENMODE: // Set the Generation Mode
@@ -211,6 +271,9 @@ void BPWritten(const BPCmd& bp)
     switch (bp.newvalue & 0xFF)
     {
     case 0x02:
+      // The CPU synchronizes against this, so deferred copies must have
+      // landed in RAM before the interrupt fires.
+      g_texture_cache->FlushEFBCopies();
       if (!Fifo::UseDeterministicGPUThread())
         PixelEngine::SetFinish(); // may generate interrupt
       DEBUG_LOG(VIDEO, "GXSetDrawDone SetPEFinish (value: 0x%02X)", (bp.newvalue & 0xFFFF));
@@ -222,11 +285,13 @@ void BPWritten(const BPCmd& bp)
     }
     return;
   case BPMEM_PE_TOKEN_ID: // Pixel Engine Token ID
+    g_texture_cache->FlushEFBCopies();
     if (!Fifo::UseDeterministicGPUThread())
       PixelEngine::SetToken(static_cast<u16>(bp.newvalue & 0xFFFF), false);
     DEBUG_LOG(VIDEO, "SetPEToken 0x%04x", (bp.newvalue & 0xFFFF));
     return;
   case BPMEM_PE_TOKEN_INT_ID: // Pixel Engine Interrupt Token ID
+    g_texture_cache->FlushEFBCopies();
     if (!Fifo::UseDeterministicGPUThread())
       PixelEngine::SetToken(static_cast<u16>(bp.newvalue & 0xFFFF), true);
     DEBUG_LOG(VIDEO, "SetPEToken + INT 0x%04x", (bp.newvalue & 0xFFFF));
@@ -258,7 +323,9 @@ void BPWritten(const BPCmd& bp)
     {
       // bpmem.zcontrol.pixel_format to PEControl::Z24 is when the game wants to copy from ZBuffer (Zbuffer uses 24-bit Format)
       bool is_depth_copy = bpmem.zcontrol.pixel_format.Value() == PEControl::Z24;
-      g_texture_cache->CopyRenderTargetToTexture(destAddr, PE_copy.tp_realFormat(), destStride,
+      // Deferred: consecutive copies batch up and execute together at the
+      // next draw, clear, XFB present or PE sync (see FlushEFBCopies).
+      g_texture_cache->QueueCopyRenderTargetToTexture(destAddr, PE_copy.tp_realFormat(), destStride,
         is_depth_copy, srcRect,
         !!PE_copy.intensity_fmt, !!PE_copy.half_scale);
     }
@@ -270,6 +337,7 @@ void BPWritten(const BPCmd& bp)
 
       BoundingBox::active = false;
       PixelShaderManager::SetBoundingBoxActive(false);
+      MarkPixelShaderUidDirty();
 
       float yScale;
       if (PE_copy.scale_invert)
@@ -289,12 +357,16 @@ void BPWritten(const BPCmd& bp)
 
       DEBUG_LOG(VIDEO, "RenderToXFB: destAddr: %08x | srcRect {%d %d %d %d} | fbWidth: %u | fbStride: %u | fbHeight: %u",
         destAddr, srcRect.left, srcRect.top, srcRect.right, srcRect.bottom, bpmem.copyTexSrcWH.x + 1, destStride, height);
+      g_texture_cache->FlushEFBCopies();
       g_renderer->RenderToXFB(destAddr, srcRect, destStride, height, s_gammaLUT[PE_copy.gamma]);
     }
 
     // Clear the rectangular region after copying it.
     if (PE_copy.clear)
     {
+      // The clear changes the efb, so any deferred copies have to read it
+      // first.
+      g_texture_cache->FlushEFBCopies();
       ClearScreen(srcRect);
     }
 
@@ -374,13 +446,6 @@ void BPWritten(const BPCmd& bp)
   // Display Copy Filtering Control - GX_SetCopyFilter(u8 aa,u8 sample_pattern[12][2],u8 vf,u8 vfilter[7])
   // Fields: Destination, Frame2Field, Gamma, Source
   // ----------------------------------
-  case BPMEM_DISPLAYCOPYFILTER:   // if (aa) { use sample_pattern } else { use 666666 }
-  case BPMEM_DISPLAYCOPYFILTER + 1: // if (aa) { use sample_pattern } else { use 666666 }
-  case BPMEM_DISPLAYCOPYFILTER + 2: // if (aa) { use sample_pattern } else { use 666666 }
-  case BPMEM_DISPLAYCOPYFILTER + 3: // if (aa) { use sample_pattern } else { use 666666 }
-  case BPMEM_COPYFILTER0:	        // if (vf) { use vfilter } else { use 595000 }
-  case BPMEM_COPYFILTER1:	        // if (vf) { use vfilter } else { use 000015 }
-    return;
     // -----------------------------------
     // Interlacing Control
     // -----------------------------------
@@ -396,20 +461,6 @@ void BPWritten(const BPCmd& bp)
   case BPMEM_PERF0_TRI:      // Perf: Triangles
   case BPMEM_PERF0_QUAD:     // Perf: Quads
   case BPMEM_PERF1:          // Perf: Some Clock, Texels, TX, TC
-    return;
-    // ----------------
-    // EFB Copy config
-    // ----------------
-  case BPMEM_EFB_TL:   // EFB Source Rect. Top, Left
-  case BPMEM_EFB_BR:   // EFB Source Rect. Bottom, Right (w, h - 1)
-  case BPMEM_EFB_ADDR: // EFB Target Address
-    return;
-    // --------------
-    // Clear Config
-    // --------------
-  case BPMEM_CLEAR_AR: // Alpha and Red Components
-  case BPMEM_CLEAR_GB: // Green and Blue Components
-  case BPMEM_CLEAR_Z:  // Z Components (24-bit Zbuffer)
     return;
     // -------------------------
     // Bounding Box Control
@@ -444,9 +495,6 @@ void BPWritten(const BPCmd& bp)
     PixelShaderManager::SetZModeControl();
     return;
 
-  case BPMEM_MIPMAP_STRIDE: // MipMap Stride Channel
-  case BPMEM_COPYYSCALE:    // Display Copy Y Scale
-
       /* 24 RID
       * 21 BC3 - Ind. Tex Stage 3 NTexCoord
       * 18 BI3 - Ind. Tex Stage 3 NTexMap
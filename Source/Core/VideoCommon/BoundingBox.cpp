@@ -40,7 +40,7 @@ void LOADERDECL SetVertexBufferPosition()
 // Prepares the bounding box for new primitive data
 void Prepare(const VAT& vat, int primitive, const TVtxDesc& vtxDesc, const PortableVertexDeclaration& vtxDecl)
 {
-  if (!(active && g_ActiveConfig.iBBoxMode == BBoxCPU))
+  if (!(active && g_ActiveConfig.EffectiveBBoxMode() == BBoxCPU))
     return;
 
   myVat = vat;
@@ -48,6 +48,7 @@ void Prepare(const VAT& vat, int primitive, const TVtxDesc& vtxDesc, const Porta
   vertexDecl = vtxDecl;
 
   vtxUnit.Init(primitive);
+  TransformUnit::ResetMatrixCache();
 
   // Initialize the SW renderer
   static bool SWinit = false;
@@ -80,7 +81,7 @@ void Prepare(const VAT& vat, int primitive, const TVtxDesc& vtxDesc, const Porta
 // Updates the bounding box
 void LOADERDECL Update()
 {
-  if (!(active && g_ActiveConfig.iBBoxMode == BBoxCPU))
+  if (!(active && g_ActiveConfig.EffectiveBBoxMode() == BBoxCPU))
     return;
 
   // Grab vertex input data and transform to output vertex
@@ -11,8 +11,11 @@
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
+#include "Common/FlightRecorder.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Profiler.h"
+#include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -54,9 +57,12 @@ static CoreTiming::EventType* s_event_sync_gpu;
 
 // STATE_TO_SAVE
 static u8* s_video_buffer;
-static u8* s_video_buffer_read_ptr;
-static std::atomic<u8*> s_video_buffer_write_ptr;
+// The GPU-thread-written and CPU-thread-written pointers live on separate
+// cache lines, so a 32 byte FIFO chunk doesn't ping-pong one line between the
+// cores for every produce/consume pair.
+alignas(64) static u8* s_video_buffer_read_ptr;
 static std::atomic<u8*> s_video_buffer_seen_ptr;
+alignas(64) static std::atomic<u8*> s_video_buffer_write_ptr;
 static u8* s_video_buffer_pp_read_ptr;
 // The read_ptr is always owned by the GPU thread.  In normal mode, so is the
 // write_ptr, despite it being atomic.  In deterministic GPU thread mode,
@@ -70,7 +76,8 @@ static u8* s_video_buffer_pp_read_ptr;
 // polls, it's just atomic.
 // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
 
-static std::atomic<int> s_sync_ticks;
+// Modified from both threads under bSyncGPU, so keep it off the lines above.
+alignas(64) static std::atomic<int> s_sync_ticks;
 static bool s_syncing_suspended;
 static Common::Event s_sync_wakeup_event;
 
@@ -162,7 +169,11 @@ void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (s_use_deterministic_gpu_thread)
   {
+    const u64 wait_start_us = Common::Timer::GetTimeUs();
     s_gpu_mainloop.Wait();
+    Common::FlightRecorder::Count(Common::FlightRecorder::Counter::FifoSyncWaits);
+    Common::FlightRecorder::AddFifoWaitTime(
+        static_cast<u32>(Common::Timer::GetTimeUs() - wait_start_us));
     if (!s_gpu_mainloop.IsRunning())
       return;
 
@@ -316,6 +327,7 @@ void RunGpuLoop()
       // See comment in SyncGPU
       if (write_ptr > seen_ptr)
       {
+        TRACE_EVENT("Fifo::RunGpuLoop");
         g_VideoData.SetReadPosition(s_video_buffer_read_ptr, write_ptr);
         s_video_buffer_read_ptr = OpcodeDecoder::Run<false>(g_VideoData, nullptr);
         s_video_buffer_seen_ptr = write_ptr;
@@ -325,6 +337,10 @@ void RunGpuLoop()
     {
       SCPFifoStruct& fifo = CommandProcessor::fifo;
 
+      // Covers the whole wakeup, so idle wakeups show up as near-zero slices
+      // and fifo work as long ones - exactly what stall diagnosis needs.
+      TRACE_EVENT("Fifo::RunGpuLoop");
+
       AsyncRequests::GetInstance()->PullEvents();
 
       CommandProcessor::SetCPStatusFromGPU();
@@ -443,6 +459,7 @@ static int RunGpuOnCpu(int ticks)
 {
   SCPFifoStruct& fifo = CommandProcessor::fifo;
   bool reset_simd_state = false;
+  bool gpu_work_queued = false;
   int available_ticks = int(ticks * SConfig::GetInstance().fSyncGpuOverclock) + s_sync_ticks.load();
   while (fifo.bFF_GPReadEnable && fifo.CPReadWriteDistance && !AtBreakpoint() &&
     available_ticks >= 0)
@@ -450,7 +467,9 @@ static int RunGpuOnCpu(int ticks)
     if (s_use_deterministic_gpu_thread)
     {
       ReadDataFromFifoOnCPU(fifo.CPReadPointer);
-      s_gpu_mainloop.Wakeup();
+      // Batch the wakeup: one notification after the loop covers every chunk
+      // pushed by this slice, and the GPU thread polls while it is running.
+      gpu_work_queued = true;
     }
     else
     {
@@ -475,6 +494,9 @@ static int RunGpuOnCpu(int ticks)
     fifo.CPReadWriteDistance -= 32;
   }
 
+  if (gpu_work_queued)
+    s_gpu_mainloop.Wakeup();
+
   CommandProcessor::SetCPStatusFromGPU();
 
   if (reset_simd_state)
@@ -558,7 +580,13 @@ static int WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= param.iSyncGpuMaxDistance)
+  {
+    const u64 wait_start_us = Common::Timer::GetTimeUs();
     s_sync_wakeup_event.Wait();
+    Common::FlightRecorder::Count(Common::FlightRecorder::Counter::FifoSyncWaits);
+    Common::FlightRecorder::AddFifoWaitTime(
+        static_cast<u32>(Common::Timer::GetTimeUs() - wait_start_us));
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -7,6 +7,8 @@
 #include <memory>
 #include <utility>
 
+#include "Common/Hash.h"
+
 #include "Core/HW/Memmap.h"
 
 #include "VideoCommon/FramebufferManagerBase.h"
@@ -22,6 +24,12 @@ std::array<const XFBSourceBase*, FramebufferManagerBase::MAX_VIRTUAL_XFB> Frameb
 unsigned int FramebufferManagerBase::s_last_xfb_width = 1;
 unsigned int FramebufferManagerBase::s_last_xfb_height = 1;
 
+// Encode to guest memory for a couple of seconds after a detected CPU write,
+// so repeated overlay draws composite over current frames rather than a stale
+// encode, then drop back to the virtual-only path.
+static constexpr int REAL_XFB_ACTIVE_FRAMES = 120;
+int FramebufferManagerBase::s_real_xfb_frames_remaining = 0;
+
 unsigned int FramebufferManagerBase::m_EFBLayers = 1;
 
 FramebufferManagerBase::FramebufferManagerBase()
@@ -36,6 +44,7 @@ FramebufferManagerBase::~FramebufferManagerBase()
   // (they really shouldn't be and should be refactored at some point).
   m_virtualXFBList.clear();
   m_realXFBSource.reset();
+  s_real_xfb_frames_remaining = 0;
 }
 
 const XFBSourceBase* const* FramebufferManagerBase::GetXFBSource(u32 xfbAddr, u32 fbWidth, u32 fbHeight, u32* xfbCountP)
@@ -54,6 +63,10 @@ const XFBSourceBase* const* FramebufferManagerBase::GetXFBSource(u32 xfbAddr, u3
     }
     if (modified)
     {
+      // The CPU composited into the framebuffer; re-arm the real-XFB window
+      // so following frames are encoded to guest memory before it draws over
+      // them again.
+      s_real_xfb_frames_remaining = REAL_XFB_ACTIVE_FRAMES;
       return GetRealXFBSource(xfbAddr, fbWidth, fbHeight, xfbCountP);
     }
   }
@@ -74,6 +87,23 @@ const XFBSourceBase* const* FramebufferManagerBase::GetRealXFBSource(u32 xfbAddr
   if (!m_realXFBSource)
     return nullptr;
 
+  // Skip the decode entirely when the guest XFB bytes are unchanged since the
+  // last one (paused scenes, static menus); the previously decoded texture is
+  // still valid. A recreated source starts with srcAddr == 0 and hash == 0,
+  // so it always decodes at least once.
+  const u8* xfb_ptr = Memory::GetPointer(xfbAddr);
+  size_t src_hash = 0;
+  if (xfb_ptr)
+  {
+    src_hash = GetHash64(xfb_ptr, fbWidth * fbHeight * 2,
+      g_ActiveConfig.iSafeTextureCache_ColorSamples);
+    if (m_realXFBSource->srcAddr == xfbAddr && m_realXFBSource->hash == src_hash)
+    {
+      m_overlappingXFBArray[0] = m_realXFBSource.get();
+      return &m_overlappingXFBArray[0];
+    }
+  }
+
   m_realXFBSource->srcAddr = xfbAddr;
 
   m_realXFBSource->srcWidth = MAX_XFB_WIDTH;
@@ -89,6 +119,7 @@ const XFBSourceBase* const* FramebufferManagerBase::GetRealXFBSource(u32 xfbAddr
   m_realXFBSource->real = true;
   // Decode YUYV data from GameCube RAM
   m_realXFBSource->DecodeToTexture(xfbAddr, fbWidth, fbHeight);
+  m_realXFBSource->hash = src_hash;
 
   m_overlappingXFBArray[0] = m_realXFBSource.get();
   return &m_overlappingXFBArray[0];
@@ -129,9 +160,13 @@ void FramebufferManagerBase::CopyToXFB(u32 xfbAddr, u32 fbStride, u32 fbHeight,
 {
   if (!g_framebuffer_manager)
     return;
-  if (g_ActiveConfig.bUseRealXFB)
+  if (g_ActiveConfig.bUseRealXFB && s_real_xfb_frames_remaining > 0)
   {
-    g_framebuffer_manager->CopyToRealXFB(xfbAddr, fbStride, fbHeight, sourceRc, Gamma);    
+    // Only pay for the EFB->RAM encode while the guest has recently written
+    // into the XFB range; otherwise the virtual copy below is sufficient and
+    // the stale guest bytes still serve as a change-detection baseline.
+    s_real_xfb_frames_remaining--;
+    g_framebuffer_manager->CopyToRealXFB(xfbAddr, fbStride, fbHeight, sourceRc, Gamma);
   }
   CopyToVirtualXFB(xfbAddr, fbStride, fbHeight, sourceRc, Gamma);
 }
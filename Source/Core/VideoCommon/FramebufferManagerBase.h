@@ -108,6 +108,12 @@ private:
 
   static unsigned int s_last_xfb_width;
   static unsigned int s_last_xfb_height;
+
+  // Number of remaining frames for which the EFB is encoded to guest memory.
+  // Armed whenever a CPU write to the XFB range is detected, so real-XFB
+  // conversion is only paid for while the guest is actually compositing into
+  // the framebuffer.
+  static int s_real_xfb_frames_remaining;
 };
 
 extern std::unique_ptr<FramebufferManagerBase> g_framebuffer_manager;
@@ -4,7 +4,10 @@
 // Added for Ishiiruka By Tino
 
 #include "Common/CPUDetect.h"
+#include "Common/Hash.h"
+#include "Common/Timer.h"
 #include "VideoCommon/HLSLCompiler.h"
+#include "VideoCommon/ShaderCompileTelemetry.h"
 
 
 ShaderCompilerWorkUnit::ShaderCompilerWorkUnit() :
@@ -88,6 +91,7 @@ bool HLSLAsyncCompiler::NextTask(size_t ID)
     {
       unit->GenerateCodeHandler(unit);
     }
+    const u64 compile_start = Common::Timer::GetTimeUs();
     unit->cresult = PD3DCompile(unit->code.data(),
       unit->code.size(),
       nullptr,
@@ -98,6 +102,10 @@ bool HLSLAsyncCompiler::NextTask(size_t ID)
       unit->flags, 0,
       &unit->shaderbytecode,
       &unit->error);
+    ShaderCompileTelemetry::RecordCompile(unit->target,
+      GetHash64(reinterpret_cast<const u8*>(unit->code.data()),
+        static_cast<u32>(unit->code.size()), 0),
+      static_cast<u32>(Common::Timer::GetTimeUs() - compile_start));
     m_output.push(std::move(unit));
     return true;
   }
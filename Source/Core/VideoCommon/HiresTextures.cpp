@@ -21,10 +21,12 @@
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
 #include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 
 #include "Core/Config/GraphicsSettings.h"
@@ -89,6 +91,201 @@ static size_t max_mem = 0;
 static std::thread s_prefetcher;
 
 static const std::string s_format_prefix = "tex1_";
+
+// Packed cache: a single per-game archive holding the decoded, GPU-ready
+// buffers produced by Load(), keyed by the same basenames GenBaseName()
+// generates. Once a texture has been decoded in one session, later sessions
+// read its blob straight into the upload buffer instead of re-decoding the
+// png/dds files, which for large packs takes minutes of CPU time.
+struct PackedCacheEntry
+{
+  u64 offset = 0;
+  u64 size = 0;
+  u64 source_stamp = 0;
+  u32 format = 0;
+  u32 width = 0;
+  u32 height = 0;
+  u32 levels = 0;
+  u32 nrm_levels = 0;
+  u32 lum_levels = 0;
+  u8 has_arbitrary_mips = 0;
+};
+
+static const u32 PACKED_CACHE_MAGIC = 0x58545048;
+static const u32 PACKED_CACHE_VERSION = 1;
+static const u64 PACKED_CACHE_HEADER_SIZE = sizeof(u32) * 2 + sizeof(u64);
+
+static std::unordered_map<std::string, PackedCacheEntry> s_packedIndex;
+static File::IOFile s_packedFile;
+static std::mutex s_packedMutex;
+static u64 s_packedDataEnd = 0;
+static bool s_packedDirty = false;
+
+// Combined hash of the source image paths and file sizes, used to drop packed
+// entries when the texture pack itself changes between sessions.
+static u64 PackedCacheStamp(const HiresTextureCacheItem& item)
+{
+  u64 stamp = 0;
+  for (const auto& map : item.maps)
+  {
+    for (const hires_mip_level& level : map)
+    {
+      if (level.path.size() == 0)
+        continue;
+      stamp = XXH64(level.path.data(), level.path.size(), stamp);
+      u64 file_size = File::GetSize(level.path);
+      stamp = XXH64(&file_size, sizeof(file_size), stamp);
+    }
+  }
+  return stamp;
+}
+
+static void PackedCacheClose()
+{
+  std::lock_guard<std::mutex> guard(s_packedMutex);
+  if (s_packedFile.IsOpen() && s_packedDirty)
+  {
+    // The index lives after the blobs so entries can be appended in place;
+    // rewrite it at the new end of data and patch the header to point there.
+    s_packedFile.Clear();
+    s_packedFile.Seek(s_packedDataEnd, SEEK_SET);
+    u32 count = static_cast<u32>(s_packedIndex.size());
+    s_packedFile.WriteArray(&count, 1);
+    for (const auto& entry : s_packedIndex)
+    {
+      u32 name_len = static_cast<u32>(entry.first.size());
+      s_packedFile.WriteArray(&name_len, 1);
+      s_packedFile.WriteBytes(entry.first.data(), name_len);
+      s_packedFile.WriteArray(&entry.second, 1);
+    }
+    s_packedFile.Seek(0, SEEK_SET);
+    u32 header[2] = {PACKED_CACHE_MAGIC, PACKED_CACHE_VERSION};
+    s_packedFile.WriteArray(header, 2);
+    s_packedFile.WriteArray(&s_packedDataEnd, 1);
+  }
+  s_packedFile.Close();
+  s_packedIndex.clear();
+  s_packedDataEnd = 0;
+  s_packedDirty = false;
+}
+
+static void PackedCacheOpen()
+{
+  std::lock_guard<std::mutex> guard(s_packedMutex);
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".hirestexcache";
+  auto create_empty = [&]() {
+    s_packedIndex.clear();
+    s_packedDataEnd = PACKED_CACHE_HEADER_SIZE;
+    if (s_packedFile.Open(filename, "w+b"))
+    {
+      u32 header[2] = {PACKED_CACHE_MAGIC, PACKED_CACHE_VERSION};
+      s_packedFile.WriteArray(header, 2);
+      s_packedFile.WriteArray(&s_packedDataEnd, 1);
+    }
+  };
+  if (!File::Exists(filename) || !s_packedFile.Open(filename, "r+b"))
+  {
+    create_empty();
+    return;
+  }
+  u32 header[2] = {};
+  u64 index_offset = 0;
+  if (!s_packedFile.ReadArray(header, 2) || !s_packedFile.ReadArray(&index_offset, 1) ||
+      header[0] != PACKED_CACHE_MAGIC || header[1] != PACKED_CACHE_VERSION ||
+      !s_packedFile.Seek(index_offset, SEEK_SET))
+  {
+    create_empty();
+    return;
+  }
+  u32 count = 0;
+  if (!s_packedFile.ReadArray(&count, 1))
+  {
+    create_empty();
+    return;
+  }
+  for (u32 i = 0; i < count; i++)
+  {
+    u32 name_len = 0;
+    if (!s_packedFile.ReadArray(&name_len, 1) || name_len == 0 || name_len > 512)
+    {
+      create_empty();
+      return;
+    }
+    std::string name(name_len, '\0');
+    PackedCacheEntry entry;
+    if (!s_packedFile.ReadBytes(&name[0], name_len) || !s_packedFile.ReadArray(&entry, 1))
+    {
+      create_empty();
+      return;
+    }
+    // Only keep entries whose source files are still present and unchanged.
+    HiresTextureCache::iterator iter = s_textureMap.find(name);
+    if (iter == s_textureMap.end() || PackedCacheStamp(iter->second) != entry.source_stamp)
+    {
+      s_packedDirty = true;
+      continue;
+    }
+    s_packedIndex.emplace(std::move(name), entry);
+  }
+  s_packedDataEnd = index_offset;
+}
+
+// Returns true and copies the entry out if the packed cache holds this basename.
+static bool PackedCacheFind(const std::string& basename, PackedCacheEntry* entry)
+{
+  std::lock_guard<std::mutex> guard(s_packedMutex);
+  if (!s_packedFile.IsOpen())
+    return false;
+  auto iter = s_packedIndex.find(basename);
+  if (iter == s_packedIndex.end())
+    return false;
+  *entry = iter->second;
+  return true;
+}
+
+static bool PackedCacheRead(const PackedCacheEntry& entry, u8* dst)
+{
+  std::lock_guard<std::mutex> guard(s_packedMutex);
+  s_packedFile.Clear();
+  if (s_packedFile.Seek(entry.offset, SEEK_SET) &&
+      s_packedFile.ReadBytes(dst, static_cast<size_t>(entry.size)))
+  {
+    return true;
+  }
+  // Truncated or unreadable archive, stop serving from it.
+  ERROR_LOG(VIDEO, "Packed custom texture cache unreadable, dropping it");
+  s_packedIndex.clear();
+  return false;
+}
+
+static void PackedCacheAppend(const std::string& basename, const HiresTexture& tex, u64 stamp)
+{
+  std::lock_guard<std::mutex> guard(s_packedMutex);
+  if (!s_packedFile.IsOpen() || s_packedIndex.find(basename) != s_packedIndex.end())
+    return;
+  s_packedFile.Clear();
+  if (!s_packedFile.Seek(s_packedDataEnd, SEEK_SET) ||
+      !s_packedFile.WriteBytes(tex.m_cached_data.get(), tex.m_cached_data_size))
+  {
+    return;
+  }
+  PackedCacheEntry entry;
+  entry.offset = s_packedDataEnd;
+  entry.size = tex.m_cached_data_size;
+  entry.source_stamp = stamp;
+  entry.format = static_cast<u32>(tex.m_format);
+  entry.width = tex.m_width;
+  entry.height = tex.m_height;
+  entry.levels = tex.m_levels;
+  entry.nrm_levels = tex.m_nrm_levels;
+  entry.lum_levels = tex.m_lum_levels;
+  entry.has_arbitrary_mips = tex.has_arbitrary_mips ? 1 : 0;
+  s_packedIndex.emplace(basename, entry);
+  s_packedDataEnd += tex.m_cached_data_size;
+  s_packedDirty = true;
+}
+
 HiresTexture::HiresTexture()
     : m_format(PC_TEX_FMT_NONE), m_height(0), m_levels(0), m_nrm_levels(0), m_lum_levels(0),
       m_cached_data(nullptr), m_cached_data_size(0)
@@ -113,6 +310,7 @@ void HiresTexture::Shutdown()
     s_prefetcher.join();
   }
 
+  PackedCacheClose();
   s_textureMap.clear();
   s_textureCache.clear();
 }
@@ -139,6 +337,7 @@ void HiresTexture::Update()
 
   if (!g_ActiveConfig.bHiresTextures)
   {
+    PackedCacheClose();
     s_textureMap.clear();
     s_textureCache.clear();
     size_sum.store(0);
@@ -245,6 +444,12 @@ void HiresTexture::Update()
     }
   }
 
+  PackedCacheClose();
+  if (s_textureMap.size() > 0)
+  {
+    PackedCacheOpen();
+  }
+
   if (g_ActiveConfig.bCacheHiresTextures && s_textureMap.size() > 0)
   {
     // remove cached but deleted textures
@@ -274,55 +479,54 @@ void HiresTexture::Prefetch()
 {
   Common::SetCurrentThreadName("Prefetcher");
   const size_t total = s_textureMap.size();
-  size_t count = 0;
   size_t notification = 10;
   u32 starttime = Common::Timer::GetTimeMs();
+  // Each texture decodes independently, so fan the map out over the worker
+  // pool and keep this thread as the coordinator tracking progress, the
+  // memory budget and abort requests. The jobs reference locals, so we must
+  // not return until every one of them has finished.
+  std::atomic<size_t> finished_count = {};
   for (const auto& entry : s_textureMap)
   {
     const std::string& base_filename = entry.first;
-
-    std::unique_lock<std::mutex> lk(s_textureCacheMutex);
-
-    auto iter = s_textureCache.find(base_filename);
-    if (iter == s_textureCache.end())
-    {
-      lk.unlock();
-      HiresTexture* ptr =
-          Load(base_filename, [](size_t requested_size) { return new u8[requested_size]; }, true);
-      lk.lock();
-      if (ptr != nullptr)
+    Common::AsyncWorker::ExecuteAsync([&finished_count, &base_filename]() {
+      if (!s_textureCacheAbortLoading.IsSet() && size_sum.load() <= max_mem)
       {
-        size_sum.fetch_add(ptr->m_cached_data_size);
-        iter = s_textureCache.insert(
-            iter, std::make_pair(base_filename, std::shared_ptr<HiresTexture>(ptr)));
-      }
-    }
-
-    if (s_textureCacheAbortLoading.IsSet())
-    {
-      if (g_ActiveConfig.bWaitForCacheHiresTextures)
-      {
-        Host_UpdateProgressDialog("", -1, -1);
+        std::unique_lock<std::mutex> lk(s_textureCacheMutex);
+        auto iter = s_textureCache.find(base_filename);
+        if (iter == s_textureCache.end())
+        {
+          lk.unlock();
+          HiresTexture* ptr = Load(
+              base_filename, [](size_t requested_size) { return new u8[requested_size]; }, true);
+          lk.lock();
+          if (ptr != nullptr)
+          {
+            size_sum.fetch_add(ptr->m_cached_data_size);
+            s_textureCache.emplace(base_filename, std::shared_ptr<HiresTexture>(ptr));
+          }
+        }
       }
-      return;
-    }
-
-    if (size_sum.load() > max_mem)
+      finished_count.fetch_add(1);
+    });
+  }
+  bool budget_exceeded = false;
+  while (finished_count.load() < total)
+  {
+    Common::SleepCurrentThread(10);
+    if (!budget_exceeded && size_sum.load() > max_mem)
     {
+      budget_exceeded = true;
+      // Remaining jobs see the flag and bail out without decoding.
+      s_textureCacheAbortLoading.Set();
       Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
-
       OSD::AddMessage(
           StringFromFormat(
               "Custom Textures prefetching after %.1f MB aborted, not enough RAM available",
               size_sum / (1024.0 * 1024.0)),
           10000);
-      if (g_ActiveConfig.bWaitForCacheHiresTextures)
-      {
-        Host_UpdateProgressDialog("", -1, -1);
-      }
-      return;
     }
-    count++;
+    size_t count = finished_count.load();
     size_t percent = (count * 100) / total;
     if (percent >= notification)
     {
@@ -344,6 +548,10 @@ void HiresTexture::Prefetch()
   {
     Host_UpdateProgressDialog("", -1, -1);
   }
+  if (budget_exceeded || s_textureCacheAbortLoading.IsSet())
+  {
+    return;
+  }
   u32 stoptime = Common::Timer::GetTimeMs();
   OSD::AddMessage(StringFromFormat("Custom Textures loaded, %.1f MB in %.1f s",
                                    size_sum / (1024.0 * 1024.0), (stoptime - starttime) / 1000.0),
@@ -406,13 +614,21 @@ std::string HiresTexture::GenBaseName(const u8* texture, size_t texture_size, co
 
 inline u8* LoadImageFromFile(const char* path, int& width, int& height)
 {
+  // Decode straight out of a shared read-only mapping: no private copy of the
+  // compressed file, and pack files stay shared between emulator instances.
+  int image_channels;
+  if (auto mapping = Common::MappedFile::Open(path))
+  {
+    return SOIL_load_image_from_memory(mapping->Data(), (int)mapping->Size(), &width, &height,
+                                       &image_channels, SOIL_LOAD_RGBA);
+  }
+
   File::IOFile file(path, "rb");
   std::vector<u8> buffer(file.GetSize());
   if (!file.IsOpen() || !file.ReadBytes(buffer.data(), file.GetSize()))
   {
     return nullptr;
   }
-  int image_channels;
   return SOIL_load_image_from_memory(buffer.data(), (int)buffer.size(), &width, &height,
                                      &image_channels, SOIL_LOAD_RGBA);
 }
@@ -622,6 +838,34 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
   {
     return nullptr;
   }
+  // Serve the blob straight from the packed cache if this texture was already
+  // decoded in a previous session, skipping the png/dds decode entirely.
+  PackedCacheEntry packed_entry;
+  if (PackedCacheFind(basename, &packed_entry))
+  {
+    u8* dst = request_buffer_delegate(static_cast<size_t>(packed_entry.size));
+    if (dst != nullptr && PackedCacheRead(packed_entry, dst))
+    {
+      HiresTexture* packed = new HiresTexture();
+      packed->m_format = static_cast<HostTextureFormat>(packed_entry.format);
+      packed->m_width = packed_entry.width;
+      packed->m_height = packed_entry.height;
+      packed->m_levels = packed_entry.levels;
+      packed->m_nrm_levels = packed_entry.nrm_levels;
+      packed->m_lum_levels = packed_entry.lum_levels;
+      packed->has_arbitrary_mips = packed_entry.has_arbitrary_mips != 0;
+      if (cacheresult)
+      {
+        packed->m_cached_data.reset(dst);
+        packed->m_cached_data_size = static_cast<size_t>(packed_entry.size);
+      }
+      return packed;
+    }
+    if (cacheresult && dst != nullptr)
+    {
+      delete[] dst;
+    }
+  }
   HiresTexture* ret = nullptr;
   u8* buffer_pointer;
   u32 maxwidth = 0;
@@ -861,6 +1105,10 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
     {
       ret->m_lum_levels = 0;
     }
+    if (cacheresult && ret->m_cached_data != nullptr && ret->m_levels > 0)
+    {
+      PackedCacheAppend(basename, *ret, PackedCacheStamp(current));
+    }
   }
   return ret;
 }
@@ -5,6 +5,7 @@
 #include <cstddef>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -55,11 +56,72 @@ __forceinline u16* IndexGenerator::WriteTriangle(u16* ptr, u32 index1, u32 index
   return ptr;
 }
 
+#if _M_SSE >= 0x200
+// The list/strip/quad expansions all write a fixed index pattern shifted by a
+// running base, so eight triangles (24 indices, three vectors) go out per
+// iteration; the scalar loops below only handle the tail. The patterns repeat
+// with period 24, the least common multiple of the pattern length and the
+// eight u16 lanes per vector.
+alignas(16) static const u16 s_list_offsets[24] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+};
+alignas(16) static const u16 s_strip_offsets[24] = {
+    0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4, 4, 5, 6, 5, 7, 6, 6, 7, 8, 7, 9, 8,
+};
+alignas(16) static const u16 s_quad_offsets[24] = {
+    0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7, 8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15,
+};
+// Fans keep the first vertex in every triangle; the mask selects the lanes
+// holding the center index, the offsets shift the two moving indices.
+alignas(16) static const u16 s_fan_offsets[24] = {
+    0, 0, 1, 0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5, 0, 5, 6, 0, 6, 7, 0, 7, 8,
+};
+alignas(16) static const u16 s_fan_center_mask[24] = {
+    0xffff, 0, 0, 0xffff, 0, 0, 0xffff, 0, 0, 0xffff, 0, 0,
+    0xffff, 0, 0, 0xffff, 0, 0, 0xffff, 0, 0, 0xffff, 0, 0,
+};
+
+static __forceinline u16* WriteTriangles8(u16* ptr, u32 base, const u16* offsets)
+{
+  const __m128i b = _mm_set1_epi16(static_cast<s16>(base));
+  for (int k = 0; k < 3; k++)
+  {
+    const __m128i v =
+        _mm_add_epi16(b, _mm_load_si128(reinterpret_cast<const __m128i*>(offsets + k * 8)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + k * 8), v);
+  }
+  return ptr + 24;
+}
+
+static __forceinline u16* WriteFanTriangles8(u16* ptr, u32 center, u32 first)
+{
+  const __m128i c = _mm_set1_epi16(static_cast<s16>(center));
+  const __m128i f = _mm_set1_epi16(static_cast<s16>(first));
+  for (int k = 0; k < 3; k++)
+  {
+    const __m128i m =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(s_fan_center_mask + k * 8));
+    const __m128i moving =
+        _mm_add_epi16(f, _mm_load_si128(reinterpret_cast<const __m128i*>(s_fan_offsets + k * 8)));
+    const __m128i v = _mm_or_si128(_mm_and_si128(m, c), _mm_andnot_si128(m, moving));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + k * 8), v);
+  }
+  return ptr + 24;
+}
+#endif
+
 void IndexGenerator::AddList(u32 const numVerts)
 {
   u32 i = base_index + 2;
   u32 top = (base_index + numVerts);
   u16* ptr = index_buffer_current;
+#if _M_SSE >= 0x200
+  while (i + 21 < top)
+  {
+    ptr = WriteTriangles8(ptr, i - 2, s_list_offsets);
+    i += 24;
+  }
+#endif
   while (i < top)
   {
     ptr = WriteTriangle(ptr, i - 2, i - 1, i);
@@ -75,6 +137,14 @@ void IndexGenerator::AddStrip(u32 const numVerts)
   u32 a = base_index;
   u32 i = a + 2;
   u32 wind = 1;
+#if _M_SSE >= 0x200
+  while (i + 7 < top)
+  {
+    ptr = WriteTriangles8(ptr, a, s_strip_offsets);
+    i += 8;
+    a += 8;
+  }
+#endif
   while (i < top)
   {
     u32 b = i - wind;
@@ -116,6 +186,13 @@ void IndexGenerator::AddFan(u32 numVerts)
   u32 top = (base_index + numVerts);
   u16* ptr = index_buffer_current;
 
+#if _M_SSE >= 0x200
+  while (i + 7 < top)
+  {
+    ptr = WriteFanTriangles8(ptr, base_index, i - 1);
+    i += 8;
+  }
+#endif
   while (i < top)
   {
     ptr = WriteTriangle(ptr, base_index, i - 1, i);
@@ -146,6 +223,13 @@ void IndexGenerator::AddQuads(u32 numVerts)
   u32 i = base_index + 3;
   u32 top = (base_index + numVerts);
   u16* ptr = index_buffer_current;
+#if _M_SSE >= 0x200
+  while (i + 12 < top)
+  {
+    ptr = WriteTriangles8(ptr, i - 3, s_quad_offsets);
+    i += 16;
+  }
+#endif
   while (i < top)
   {
     ptr = WriteTriangle(ptr, i - 3, i - 2, i - 1);
@@ -0,0 +1,124 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "VideoCommon/InputLatencyTelemetry.h"
+
+namespace InputLatencyTelemetry
+{
+namespace
+{
+constexpr u32 BUCKET_WIDTH_US = 10000;
+
+// Dump the histogram to the log once per interval, then start a fresh one so
+// setting changes (vsync, dual-core) show up quickly.
+constexpr u32 LOG_INTERVAL_FRAMES = 600;
+
+// With dual-core the video thread can fall several fields behind the CPU;
+// anything deeper than this is a stall, not pipelining, so drop the oldest.
+constexpr size_t MAX_PENDING_FRAMES = 8;
+
+std::atomic<u64> s_last_poll_us{0};
+
+std::mutex s_pending_mutex;
+std::deque<u64> s_pending_frames;
+
+// Video thread only.
+u32 s_histogram[NUM_BUCKETS] = {};
+u64 s_age_sum_us = 0;
+u32 s_last_age_us = 0;
+u32 s_sample_count = 0;
+}  // namespace
+
+void OnInputPoll()
+{
+  s_last_poll_us.store(Common::Timer::GetTimeUs(), std::memory_order_relaxed);
+}
+
+void OnFrameIssued()
+{
+  const u64 poll_us = s_last_poll_us.load(std::memory_order_relaxed);
+  if (poll_us == 0)
+    return;
+
+  std::lock_guard<std::mutex> guard(s_pending_mutex);
+  if (s_pending_frames.size() >= MAX_PENDING_FRAMES)
+    s_pending_frames.pop_front();
+  s_pending_frames.push_back(poll_us);
+}
+
+void OnFramePresented()
+{
+  u64 poll_us;
+  {
+    std::lock_guard<std::mutex> guard(s_pending_mutex);
+    if (s_pending_frames.empty())
+      return;
+    poll_us = s_pending_frames.front();
+    s_pending_frames.pop_front();
+  }
+
+  const u64 now_us = Common::Timer::GetTimeUs();
+  const u32 age_us = now_us > poll_us ? static_cast<u32>(now_us - poll_us) : 0;
+  s_last_age_us = age_us;
+  s_age_sum_us += age_us;
+  s_sample_count++;
+  s_histogram[std::min(age_us / BUCKET_WIDTH_US, NUM_BUCKETS - 1)]++;
+
+  if (s_sample_count >= LOG_INTERVAL_FRAMES)
+  {
+    INFO_LOG(VIDEO,
+      "Input-to-present age over %u frames: avg %.1f ms, histogram (10 ms buckets) "
+      "%u %u %u %u %u %u %u %u %u %u",
+      s_sample_count, s_age_sum_us / (s_sample_count * 1000.0), s_histogram[0], s_histogram[1],
+      s_histogram[2], s_histogram[3], s_histogram[4], s_histogram[5], s_histogram[6],
+      s_histogram[7], s_histogram[8], s_histogram[9]);
+    std::fill(std::begin(s_histogram), std::end(s_histogram), 0);
+    s_age_sum_us = 0;
+    s_sample_count = 0;
+  }
+}
+
+void AppendToString(std::string* str)
+{
+  if (s_sample_count == 0 && s_last_age_us == 0)
+    return;
+
+  // One digit per 10 ms bucket, scaled to the busiest bucket.
+  u32 peak = 1;
+  for (u32 count : s_histogram)
+    peak = std::max(peak, count);
+
+  char bars[NUM_BUCKETS + 1];
+  for (u32 i = 0; i < NUM_BUCKETS; i++)
+    bars[i] = static_cast<char>('0' + (s_histogram[i] * 9 + peak - 1) / peak);
+  bars[NUM_BUCKETS] = '\0';
+
+  char buffer[128];
+  const int len = snprintf(buffer, sizeof(buffer),
+    "Input age: %.1f ms (avg %.1f ms)\nAge hist [10ms/bkt]: %s\n", s_last_age_us / 1000.0,
+    s_sample_count != 0 ? s_age_sum_us / (s_sample_count * 1000.0) : 0.0, bars);
+  str->append(buffer, std::min<size_t>(len, sizeof(buffer) - 1));
+}
+
+void Reset()
+{
+  {
+    std::lock_guard<std::mutex> guard(s_pending_mutex);
+    s_pending_frames.clear();
+  }
+  s_last_poll_us.store(0, std::memory_order_relaxed);
+  std::fill(std::begin(s_histogram), std::end(s_histogram), 0);
+  s_age_sum_us = 0;
+  s_last_age_us = 0;
+  s_sample_count = 0;
+}
+}
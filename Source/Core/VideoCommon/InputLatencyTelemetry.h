@@ -0,0 +1,39 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Measures how old the most recent controller input is by the time the frame
+// that consumed it is presented. Each SI poll is timestamped, every field the
+// CPU scans out is tagged with the last poll it could have observed, and the
+// present path pairs those tags with the wall-clock present time. The
+// resulting per-frame input-age histogram quantifies the latency cost of
+// dual-core, vsync modes and buffering without external capture hardware.
+namespace InputLatencyTelemetry
+{
+// Number of 10 ms histogram buckets; the last one collects everything above.
+constexpr u32 NUM_BUCKETS = 10;
+
+// Called from SI::UpdateDevices on the CPU thread each time the controllers
+// are polled.
+void OnInputPoll();
+
+// Called on the CPU thread when a field begins scanning out; tags the frame
+// with the newest poll it can contain.
+void OnFrameIssued();
+
+// Called from Renderer::Swap on the video thread once the frame is presented;
+// folds the tagged poll age into the histogram.
+void OnFramePresented();
+
+// Appends the input-age summary and histogram to the statistics overlay text.
+void AppendToString(std::string* str);
+
+// Drops all recorded samples.
+void Reset();
+}
@@ -19,6 +19,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/InputLatencyTelemetry.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelEngine.h"
@@ -60,6 +61,11 @@ void VideoBackendBase::Video_ExitLoop()
 // Run from the CPU thread (from VideoInterface.cpp)
 void VideoBackendBase::Video_BeginField(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, u64 ticks)
 {
+  // Tag the outgoing field with the newest SI poll, whether it is presented
+  // through the XFB path below or the XFB-less path in RenderToXFB.
+  if (m_initialized && g_renderer)
+    InputLatencyTelemetry::OnFrameIssued();
+
   if (m_initialized && g_ActiveConfig.bUseXFB && g_renderer)
   {
     Fifo::SyncGPU(Fifo::SyncGPUReason::Swap);
@@ -166,8 +172,13 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
   e.time = 0;
   e.type = AsyncRequests::Event::PERF_QUERY;
 
+  // Ask the video thread to harvest completed queries, but don't wait for
+  // it: blocking here stalled the CPU thread for a full pipeline drain every
+  // time a game read a PE performance register (Super Mario Sunshine does so
+  // each frame for its water effects). Backends answer from the results
+  // collected so far and extrapolate over still-pending queries.
   if (!g_perf_query->IsFlushed())
-    AsyncRequests::GetInstance()->PushEvent(e, true);
+    AsyncRequests::GetInstance()->PushEvent(e, false);
 
   return g_perf_query->GetQueryResult(type);
 }
@@ -12,7 +12,10 @@
 // while interpreting them, and hope that the vertex format doesn't change, though, if you do it right
 // when they are called. The reason is that the vertex format affects the sizes of the vertices.
 
+#include <unordered_map>
+
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "Common/MsgHandler.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -34,6 +37,19 @@ static bool s_bFifoErrorSeen = false;
 
 namespace OpcodeDecoder
 {
+// Preprocessing a display list only matters for its side effects on the
+// preprocess state (CP loads, indexed XF transfers, BP writes). Games like
+// F-Zero GX resubmit identical pure-geometry lists every frame, so lists
+// known to be free of such side effects are remembered here and skipped as
+// long as their contents hash the same.
+struct PreprocessDLCacheEntry
+{
+  u32 size = 0;
+  u64 hash = 0;
+};
+static std::unordered_map<u32, PreprocessDLCacheEntry> s_preprocess_dl_cache;
+static bool s_preprocess_side_effects = false;
+static constexpr size_t PREPROCESS_DL_CACHE_MAX_ENTRIES = 1024;
 
 template <int count>
 __forceinline void ReadU32xn(u32 *bufx16)
@@ -80,8 +96,30 @@ __forceinline void InterpretDisplayListPreprocess(u32 address, u32 size)
 
   if (startAddress != nullptr)
   {
+    const u64 dl_hash = GetHash64(startAddress, size, 0);
+    auto it = s_preprocess_dl_cache.find(address);
+    if (it != s_preprocess_dl_cache.end() && it->second.size == size && it->second.hash == dl_hash)
+      return;
+
     DataReader dlist_reader(startAddress, startAddress + size);
-    OpcodeDecoder::Run<true, false>(dlist_reader, nullptr);
+    const bool outer_side_effects = s_preprocess_side_effects;
+    s_preprocess_side_effects = false;
+    u8* end_address = OpcodeDecoder::Run<true, false>(dlist_reader, nullptr);
+
+    // Only a completely decoded, side-effect-free list may be skipped the
+    // next time it comes around.
+    const bool cacheable = !s_preprocess_side_effects && end_address == startAddress + size;
+    s_preprocess_side_effects |= outer_side_effects;
+    if (cacheable)
+    {
+      if (s_preprocess_dl_cache.size() >= PREPROCESS_DL_CACHE_MAX_ENTRIES)
+        s_preprocess_dl_cache.clear();
+      s_preprocess_dl_cache[address] = {size, dl_hash};
+    }
+    else if (it != s_preprocess_dl_cache.end())
+    {
+      s_preprocess_dl_cache.erase(it);
+    }
   }
 }
 
@@ -156,6 +194,8 @@ DataReadU32xNfunc DataReadU32xFuncs[16] = {
 void Init()
 {
   s_bFifoErrorSeen = false;
+  s_preprocess_dl_cache.clear();
+  s_preprocess_side_effects = false;
 }
 
 template <bool is_preprocess, bool sizeCheck>
@@ -193,7 +233,9 @@ u8* Run(DataReader& reader, u32* cycles)
       u8 sub_cmd = reader.Read<u8>();
       u32 value = reader.Read<u32>();
       LoadCPReg<is_preprocess>(sub_cmd, value);
-      if (!is_preprocess)
+      if (is_preprocess)
+        s_preprocess_side_effects = true;
+      else
         INCSTAT(stats.thisFrame.numCPLoads);
     }
     break;
@@ -214,7 +256,36 @@ u8* Run(DataReader& reader, u32* cycles)
       else
       {
         u32 xf_address = Cmd2 & 0xFFFF;
-        LoadXFReg(transfer_size, xf_address);
+        // Matrix sets are uploaded as one XF load per matrix. Scan ahead for
+        // fully buffered commands continuing the same contiguous XF memory
+        // range and apply the whole burst with a single flush and one
+        // consolidated dirty range instead of per-command bookkeeping.
+        u32 total_size = transfer_size;
+        u32 merged = 0;
+        if (xf_address + transfer_size <= 0x1000)
+        {
+          const size_t available = reader.size();
+          size_t offset = static_cast<size_t>(transfer_size) * sizeof(u32);
+          while (available >= offset + GX_LOAD_XF_REG_SIZE + 1 &&
+                 reader.Peek<u8>(static_cast<s32>(offset)) == GX_LOAD_XF_REG)
+          {
+            const u32 next_cmd2 = reader.Peek<u32>(static_cast<s32>(offset + 1));
+            const u32 next_size = ((next_cmd2 >> 16) & 15) + 1;
+            const u32 next_address = next_cmd2 & 0xFFFF;
+            if (next_address != xf_address + total_size || next_address + next_size > 0x1000 ||
+                available < offset + GX_LOAD_XF_REG_SIZE + 1 + next_size * sizeof(u32))
+              break;
+            totalCycles += GX_LOAD_XF_REG_BASE_CYCLES + GX_LOAD_XF_REG_TRANSFER_CYCLES * next_size;
+            INCSTAT(stats.thisFrame.numXFLoads);
+            total_size += next_size;
+            offset += GX_LOAD_XF_REG_SIZE + 1 + next_size * sizeof(u32);
+            merged++;
+          }
+        }
+        if (merged != 0)
+          LoadXFRegBlock(transfer_size, xf_address, total_size);
+        else
+          LoadXFReg(transfer_size, xf_address);
         INCSTAT(stats.thisFrame.numXFLoads);
       }
     }
@@ -229,9 +300,14 @@ u8* Run(DataReader& reader, u32* cycles)
       totalCycles += GX_LOAD_INDX_CYCLES;
       const s32 ref_array = (cmd_byte >> 3) + 8;
       if (is_preprocess)
+      {
+        s_preprocess_side_effects = true;
         PreprocessIndexedXF(reader.Read<u32>(), ref_array);
+      }
       else
+      {
         LoadIndexedXF(reader.Read<u32>(), ref_array);
+      }
     }
     break;
     case GX_CMD_CALL_DL:
@@ -266,6 +342,7 @@ u8* Run(DataReader& reader, u32* cycles)
       u32 bp_cmd = reader.Read<u32>();
       if (is_preprocess)
       {
+        s_preprocess_side_effects = true;
         LoadBPRegPreprocess(bp_cmd);
       }
       else
@@ -64,6 +64,14 @@ public:
   virtual void FlushResults()
   {}
 
+  // Retrieve the results of queries that have already completed on the host
+  // GPU without waiting for the rest. Backends without a cheap completion
+  // check fall back to a full flush.
+  virtual void WeakFlush()
+  {
+    FlushResults();
+  }
+
   // True if there are no further pending query results
   // NOTE: Called from CPU thread
   virtual bool IsFlushed() const
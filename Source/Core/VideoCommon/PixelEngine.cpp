@@ -21,6 +21,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 
 namespace PixelEngine
@@ -256,6 +257,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     {
       BoundingBox::active = false;
       PixelShaderManager::SetBoundingBoxActive(false);
+      MarkPixelShaderUidDirty();
       return g_video_backend->Video_GetBoundingBox(i);
     }),
       MMIO::InvalidWrite<u16>()
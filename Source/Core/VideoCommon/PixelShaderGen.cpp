@@ -454,10 +454,41 @@ float snoise(float2 v)
 }
 )hlsl";
 
+// Every backend rebuilds the pixel shader UID once per draw, but the registers
+// feeding it change far less often than that. The BP/XF write handlers (and the
+// other UID inputs: config updates, bbox activation, savestate loads) bump this
+// generation counter; while it still matches, the UID built on the previous
+// call with the same render mode and vertex components is reused as-is.
+static u32 s_uid_generation = 1;
+static u32 s_cached_uid_generation[PSRM_DEPTH_ONLY + 1];
+static u32 s_cached_uid_components[PSRM_DEPTH_ONLY + 1];
+static PixelShaderUid s_cached_uids[PSRM_DEPTH_ONLY + 1];
+
+void MarkPixelShaderUidDirty()
+{
+  s_uid_generation++;
+}
+
+static void CachePixelShaderUid(const PixelShaderUid& uid, PIXEL_SHADER_RENDER_MODE render_mode, u32 components)
+{
+  s_cached_uids[render_mode] = uid;
+  s_cached_uid_components[render_mode] = components;
+  s_cached_uid_generation[render_mode] = s_uid_generation;
+}
+
 // FIXME: Some of the video card's capabilities (BBox support, EarlyZ support, dstAlpha support) leak
 //        into this UID; This is really unhelpful if these UIDs ever move from one machine to another.
 void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode, u32 components, const XFMemory &xfr, const BPMemory &bpm)
 {
+  // The generation counter only tracks writes to the global state, so the
+  // cache is bypassed for callers passing in snapshots.
+  const bool cacheable = &xfr == &xfmem && &bpm == &bpmem;
+  if (cacheable && s_cached_uid_generation[render_mode] == s_uid_generation
+    && s_cached_uid_components[render_mode] == components)
+  {
+    out = s_cached_uids[render_mode];
+    return;
+  }
   out.ClearUID();
   pixel_shader_uid_data& uid_data = out.GetUidData<pixel_shader_uid_data>();
 
@@ -484,6 +515,8 @@ void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode
   if (render_mode == PSRM_DEPTH_ONLY)
   {
     out.CalculateUIDHash();
+    if (cacheable)
+      CachePixelShaderUid(out, render_mode, components);
     return;
   }
   uid_data.bounding_box = g_ActiveConfig.backend_info.bSupportsBBox && BoundingBox::active && g_ActiveConfig.iBBoxMode == BBoxGPU;
@@ -638,11 +671,13 @@ void GetPixelShaderUID(PixelShaderUid& out, PIXEL_SHADER_RENDER_MODE render_mode
   }
 
   out.CalculateUIDHash();
+  if (cacheable)
+    CachePixelShaderUid(out, render_mode, components);
 }
 
 void SampleTexture(ShaderCode& out, API_TYPE ApiType, const char *texcoords, const char *texswap, int texmap, bool stereo)
 {
-  out.Write("wuround(");
+  out.Append("wuround(");
   out.Write((ApiType & API_D3D9) ? "tex2D" : (ApiType == API_D3D11 ? "Tex[%d].Sample" : "texture"), texmap);
   out.Write("(samp[%d],%s%s.xy * " I_TEXDIMS"[%d].xy", texmap, (ApiType & API_D3D9) ? "" : "float3(", texcoords, texmap);
   if ((ApiType & API_D3D9) == 0)
@@ -653,7 +688,7 @@ void SampleTexture(ShaderCode& out, API_TYPE ApiType, const char *texcoords, con
     }
     else
     {
-      out.Write(",0.0)");
+      out.Append(",0.0)");
     }
   }
   out.Write(").%s * 255.0);\n", texswap);
@@ -713,9 +748,9 @@ inline void WriteAlphaTest(ShaderCode& out, API_TYPE ApiType, bool use_integer_m
   };
   // using discard then return works the same in cg and dx9 but not in dx11
   if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_NEGATED_BOOLEAN))
-    out.Write("\tif(( ");
+    out.Append("\tif(( ");
   else
-    out.Write("\tif(!( ");
+    out.Append("\tif(!( ");
 
   // Lookup the first component from the alpha function table
   int compindex = uid_data.alpha_test_comp0;
@@ -734,19 +769,19 @@ inline void WriteAlphaTest(ShaderCode& out, API_TYPE ApiType, bool use_integer_m
     out.Write(tevAlphaFuncsTable[compindex], alphaRef[1]);
 
   if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_NEGATED_BOOLEAN))
-    out.Write(") == false) {\n");
+    out.Append(") == false) {\n");
   else
-    out.Write(")) {\n");
+    out.Append(")) {\n");
   if (uid_data.uint_output)
   {
-    out.Write("ocol0 = uint4(0,0,0,0);\n");
+    out.Append("ocol0 = uint4(0,0,0,0);\n");
   }
   else
   {
-    out.Write("ocol0 = float4(0.0,0.0,0.0,0.0);\n");
+    out.Append("ocol0 = float4(0.0,0.0,0.0,0.0);\n");
   }
   if (uid_data.render_mode == PSRM_DUAL_SOURCE_BLEND)
-    out.Write("ocol1 = float4(0.0,0.0,0.0,0.0);\n");
+    out.Append("ocol1 = float4(0.0,0.0,0.0,0.0);\n");
   if (uid_data.per_pixel_depth)
     out.Write("depth = %s;\n", (ApiType == API_OPENGL) ? "1.0" : "0.0");
 
@@ -765,11 +800,11 @@ inline void WriteAlphaTest(ShaderCode& out, API_TYPE ApiType, bool use_integer_m
   // it's the much faster code path for the GPU.		
   if (!uid_data.alpha_test_use_zcomploc_hack)
   {
-    out.Write("discard;\n");
+    out.Append("discard;\n");
     if (ApiType != API_D3D11)
-      out.Write("return;\n");
+      out.Append("return;\n");
   }
-  out.Write("}\n");
+  out.Append("}\n");
 }
 
 inline void WriteFog(ShaderCode& out, bool use_integer_math, const pixel_shader_uid_data& uid_data)
@@ -816,7 +851,7 @@ inline void WriteFog(ShaderCode& out, bool use_integer_math, const pixel_shader_
   {
     out.Write("float x_adjust = (2.0 * (cPos.x / " I_FOGF "[0].y)) - 1.0 - " I_FOGF "[0].x;\n");
     out.Write("x_adjust = sqrt(x_adjust * x_adjust + " I_FOGF "[0].z * " I_FOGF "[0].z) / " I_FOGF "[0].z;\n");
-    out.Write("ze *= x_adjust;\n");
+    out.Append("ze *= x_adjust;\n");
   }
 
   out.Write("float fog = clamp(ze - " I_FOGF "[1].z, 0.0, 1.0);\n");
@@ -825,7 +860,7 @@ inline void WriteFog(ShaderCode& out, bool use_integer_math, const pixel_shader_
   {
     out.Write("%s", tevFogFuncsTable[uid_data.fog_fsel]);
   }
-  out.Write("wu ifog = wu(round(fog * 256.0));\n");
+  out.Append("wu ifog = wu(round(fog * 256.0));\n");
   out.Write("prev.rgb = BSHR(prev.rgb * (wu(256) - ifog) + " I_FOGCOLOR".rgb * ifog, wu(8));\n");
 
 }
@@ -1107,12 +1142,12 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
   u32 texcoord = stage.tevorders_texcoord;
   bool bHasTexCoord = texcoord < uid_data.genMode_numtexgens;
   bool bHasIndStage = stage.hasindstage;
-  out.Write("\n{\n");
+  out.Append("\n{\n");
   if (bHasIndStage)
   {
     TevStageIndirect tevind;
     tevind.hex = stage.tevind;
-    out.Write("// indirect op\n");
+    out.Append("// indirect op\n");
     // perform the indirect op on the incoming regular coordinates using indtex%d as the offset coords
     if (tevind.bs.Value() != ITBA_OFF)
     {
@@ -1273,7 +1308,7 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
     if (tevind.sw.Value() == ITW_OFF)
       out.Write("wrappedcoord.x = wu(uv%d.x);\n", texcoord);
     else if (tevind.sw.Value() == ITW_0)
-      out.Write("wrappedcoord.x = wu(0);\n");
+      out.Append("wrappedcoord.x = wu(0);\n");
     else
       out.Write("wrappedcoord.x = remainder(wu(uv%d.x), %s);\n", texcoord, tevIndWrapStart[tevind.sw.Value()]);
 
@@ -1281,7 +1316,7 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
     if (tevind.tw.Value() == ITW_OFF)
       out.Write("wrappedcoord.y = wu(uv%d.y);\n", texcoord);
     else if (tevind.tw.Value() == ITW_0)
-      out.Write("wrappedcoord.y = wu(0);\n");
+      out.Append("wrappedcoord.y = wu(0);\n");
     else
       out.Write("wrappedcoord.y = remainder(wu(uv%d.y), %s);\n", texcoord, tevIndWrapStart[tevind.tw.Value()]);
 
@@ -1293,7 +1328,7 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
     if (use_integer_math)
     {
       // Emulate s24 overflows
-      out.Write("tevcoord.xy = (tevcoord.xy << 8) >> 8;\n");
+      out.Append("tevcoord.xy = (tevcoord.xy << 8) >> 8;\n");
     }
   }
   if (stage.tevorders_enable)
@@ -1312,35 +1347,35 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
       if (bHasTexCoord)
         out.Write("tevcoord.xy = wu2(uv%d.xy);\n", texcoord);
       else
-        out.Write("tevcoord.xy = wu2(0,0);\n");
+        out.Append("tevcoord.xy = wu2(0,0);\n");
     }
     int texmap = stage.tevorders_texmap;
-    out.Write("float2 stagecoord = float2(tevcoord.xy);\n");
+    out.Append("float2 stagecoord = float2(tevcoord.xy);\n");
     out.Write("tex_ta[%i] = ", n);
     SampleTexture(out, ApiType, "stagecoord", "rgba", texmap, hostconfig.stereo);
     if (LoadMaterial)
     {
       out.Write("if((" I_FLAGS ".y & %i) != 0)\n{\n", 1 << texmap);
-      out.Write("emmisive_mask += ");
+      out.Append("emmisive_mask += ");
       SampleTextureRAW(out, ApiType, "(stagecoord)", "rgb", "z", texmap);
-      out.Write("}\n");
+      out.Append("}\n");
       out.Write("if((" I_FLAGS ".x & %i) != 0)\n{\n", 1 << texmap);
-      out.Write("mapcoord = stagecoord;");
-      out.Write("float4 nrmap = ");
+      out.Append("mapcoord = stagecoord;");
+      out.Append("float4 nrmap = ");
       SampleTextureRAW(out, ApiType, "(stagecoord)", "agbr", "y", texmap);
-      out.Write("nrmap.xy = nrmap.xy * (255.0/127.0) - (128.0/127.0);\n");
+      out.Append("nrmap.xy = nrmap.xy * (255.0/127.0) - (128.0/127.0);\n");
       // Extact z value from x and y
-      out.Write("nrmap.z = sqrt(1.0 - dot(nrmap.xy, nrmap.xy));\n");
+      out.Append("nrmap.z = sqrt(1.0 - dot(nrmap.xy, nrmap.xy));\n");
       // Combine Normals
-      out.Write("normalmap.xyz = normalize(float3(nrmap.xy + normalmap.xy, nrmap.z * normalmap.z));\n");
+      out.Append("normalmap.xyz = normalize(float3(nrmap.xy + normalmap.xy, nrmap.z * normalmap.z));\n");
       // Combine Specular intensity
-      out.Write("normalmap.w = normalmap.w * normalmapcount + nrmap.w;\n");
+      out.Append("normalmap.w = normalmap.w * normalmapcount + nrmap.w;\n");
       // finalize Running average
-      out.Write("normalmapcount+=1.0;\n");
-      out.Write("normalmap.w /= normalmapcount;\n}\n");
+      out.Append("normalmapcount+=1.0;\n");
+      out.Append("normalmap.w /= normalmapcount;\n}\n");
       if (uid_data.pixel_lighting > 2)
       {
-        out.Write("else ");
+        out.Append("else ");
       }
     }
     if (uid_data.pixel_lighting > 2)
@@ -1365,7 +1400,7 @@ inline void WriteFetchStageTexture(ShaderCode& out, API_TYPE ApiType, bool use_i
   {
     out.Write("tex_ta[%i] = wu4(255,255,255,255);\n", n);
   }
-  out.Write("\n}\n");
+  out.Append("\n}\n");
 }
 
 inline void WriteStage(ShaderCode& out, API_TYPE ApiType, bool use_integer_math, const pixel_shader_uid_data& uid_data, int n, TevRegisterState& register_state)
@@ -1389,12 +1424,12 @@ inline void WriteStage(ShaderCode& out, API_TYPE ApiType, bool use_integer_math,
     int rasindex = stage.tevorders_colorchan;
     if (rasindex == 0 && !register_state.Ras0Expanded())
     {
-      out.Write("col0 = round(col0 * 255.0);\n");
+      out.Append("col0 = round(col0 * 255.0);\n");
       register_state.Ras0Expanded(true);
     }
     if (rasindex == 1 && !register_state.Ras1Expanded())
     {
-      out.Write("col1 = round(col1 * 255.0);\n");
+      out.Append("col1 = round(col1 * 255.0);\n");
       register_state.Ras1Expanded(true);
     }
     out.Write("ras_t = %s.%s;\n", tevRasTable[rasindex], rasswap);
@@ -1434,7 +1469,7 @@ inline void WriteStage(ShaderCode& out, API_TYPE ApiType, bool use_integer_math,
   register_state.SetOverflowControl(tevCOutputSourceMap[cc.dest.Value()], !cc.clamp.Value());
   register_state.SetOverflowControl(tevAOutputSourceMap[ac.dest.Value()], !ac.clamp.Value());
 
-  out.Write("// color combine\n");
+  out.Append("// color combine\n");
   out.Write("%s = clamp(", tevCOutputTable[cc.dest.Value()]);
   // combine the color channel
   if (cc.bias != TEVBIAS_COMPARE) // if not compare
@@ -1456,14 +1491,14 @@ inline void WriteStage(ShaderCode& out, API_TYPE ApiType, bool use_integer_math,
   }
   if (cc.clamp.Value())
   {
-    out.Write(",wu(0),wu(255));\n");
+    out.Append(",wu(0),wu(255));\n");
   }
   else
   {
-    out.Write(",wu(-1024),wu(1023));\n");
+    out.Append(",wu(-1024),wu(1023));\n");
   }
 
-  out.Write("// alpha combine\n");
+  out.Append("// alpha combine\n");
   out.Write("%s = clamp(", tevAOutputTable[ac.dest.Value()]);
   if (ac.bias != TEVBIAS_COMPARE) // if not compare
   {
@@ -1484,13 +1519,13 @@ inline void WriteStage(ShaderCode& out, API_TYPE ApiType, bool use_integer_math,
   }
   if (ac.clamp.Value())
   {
-    out.Write(",wu(0),wu(255));\n\n");
+    out.Append(",wu(0),wu(255));\n\n");
   }
   else
   {
-    out.Write(",wu(-1024),wu(1023));\n\n");
+    out.Append(",wu(-1024),wu(1023));\n\n");
   }
-  out.Write("// TEV done\n");
+  out.Append("// TEV done\n");
 }
 
 inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& uid_data, API_TYPE ApiType, const ShaderHostConfig& hostconfig, bool Use_integer_math = true)
@@ -1507,7 +1542,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   bool forcePhong = uid_data.pixel_lighting > 1;
   bool enablesimbumps = uid_data.pixel_lighting > 2;
   TevRegisterState register_state;
-  out.Write("//Pixel Shader for TEV stages\n");
+  out.Append("//Pixel Shader for TEV stages\n");
   if (enablenormalmaps || forcePhong)
   {
     out.Write(headerLightUtil);
@@ -1518,76 +1553,76 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   }
   if (Use_integer_math)
   {
-    out.Write("#define wu int\n");
+    out.Append("#define wu int\n");
     if (ApiType == API_OPENGL || ApiType == API_VULKAN)
     {
-      out.Write("#define wu2 ivec2\n");
-      out.Write("#define wu3 ivec3\n");
-      out.Write("#define wu4 ivec4\n");
+      out.Append("#define wu2 ivec2\n");
+      out.Append("#define wu3 ivec3\n");
+      out.Append("#define wu4 ivec4\n");
     }
     else
     {
-      out.Write("#define wu2 int2\n");
-      out.Write("#define wu3 int3\n");
-      out.Write("#define wu4 int4\n");
+      out.Append("#define wu2 int2\n");
+      out.Append("#define wu3 int3\n");
+      out.Append("#define wu4 int4\n");
     }
     out.Write(headerUtilI);
   }
   else
   {
 
-    out.Write("#define wu float\n");
+    out.Append("#define wu float\n");
     if (ApiType == API_OPENGL || ApiType == API_VULKAN)
     {
-      out.Write("#define wu2 vec2\n");
-      out.Write("#define wu3 vec3\n");
-      out.Write("#define wu4 vec4\n");
+      out.Append("#define wu2 vec2\n");
+      out.Append("#define wu3 vec3\n");
+      out.Append("#define wu4 vec4\n");
     }
     else
     {
-      out.Write("#define wu2 float2\n");
-      out.Write("#define wu3 float3\n");
-      out.Write("#define wu4 float4\n");
+      out.Append("#define wu2 float2\n");
+      out.Append("#define wu3 float3\n");
+      out.Append("#define wu4 float4\n");
     }
     out.Write(headerUtil);
   }
 
   if (ApiType == API_D3D11)
   {
-    out.Write("#define ddx ddx_fine\n");
-    out.Write("#define ddy ddy_fine\n");
+    out.Append("#define ddx ddx_fine\n");
+    out.Append("#define ddy ddy_fine\n");
   }
 
   if (ApiType == API_OPENGL || ApiType == API_VULKAN)
   {
     // Declare samplers
-    out.Write("SAMPLER_BINDING(0) uniform sampler2DArray samp[8];\n");
+    out.Append("SAMPLER_BINDING(0) uniform sampler2DArray samp[8];\n");
   }
   else
   {
     // Declare samplers
     if (ApiType == API_D3D11)
     {
-      out.Write("SamplerState samp[8] : register(s0);\n");
+      out.Append("SamplerState samp[8] : register(s0);\n");
     }
     else
     {
-      out.Write("uniform sampler2D samp[8] : register(s0);\n");
+      out.Append("uniform sampler2D samp[8] : register(s0);\n");
     }
 
 
     if (ApiType == API_D3D11)
     {
-      out.Write("\n");
-      out.Write("Texture2DArray Tex[8] : register(t0);\n");
+      out.Append("\n");
+      out.Append("Texture2DArray Tex[8] : register(t0);\n");
     }
   }
-  out.Write("\n");
+  out.Append("\n");
 
   if (ApiType == API_OPENGL || ApiType == API_VULKAN)
-    out.Write("UBO_BINDING(std140, 1) uniform PSBlock {\n");
+    out.Append("UBO_BINDING(std140, 1) uniform PSBlock {\n");
   else if (ApiType == API_D3D11)
-    out.Write("cbuffer PSBlock : register(b0) {\n");
+    out.Append("cbuffer PSBlock : register(b0) {\n");
 
   DeclareUniform(out, ApiType, C_COLORS, "wu4", I_COLORS "[4]");
   DeclareUniform(out, ApiType, C_KCOLORS, "wu4", I_KCOLORS "[4]");
@@ -1605,14 +1640,14 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   DeclareUniform(out, ApiType, C_EFBSCALE, "float4", I_EFBSCALE);
 
   if (!(ApiType & API_D3D9))
-    out.Write("};\n");
+    out.Append("};\n");
 
   if (enable_pl && render_mode != PSRM_DEPTH_ONLY)
   {
     if (ApiType == API_OPENGL || ApiType == API_VULKAN)
-      out.Write("UBO_BINDING(std140, 2) uniform VSBlock {\n");
+      out.Append("UBO_BINDING(std140, 2) uniform VSBlock {\n");
     else if (ApiType == API_D3D11)
-      out.Write("cbuffer VSBlock : register(b1) {\n");
+      out.Append("cbuffer VSBlock : register(b1) {\n");
 
     if (!(ApiType & API_D3D9))
     {
@@ -1632,18 +1667,18 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       DeclareUniform(out, ApiType, C_NORMALMATRICES, "float4", I_NORMALMATRICES"[32]");
       DeclareUniform(out, ApiType, C_POSTTRANSFORMMATRICES, "float4", I_POSTTRANSFORMMATRICES"[64]");
       DeclareUniform(out, ApiType, C_PLOFFSETPARAMS, "float4", I_PLOFFSETPARAMS"[13]");
-      out.Write("};\n");
+      out.Append("};\n");
     }
   }
   if (uid_data.dither)
   {
-    out.Write("wu GetDitherValue(wu2 ditherindex)\n{\n");
+    out.Append("wu GetDitherValue(wu2 ditherindex)\n{\n");
     if (uid_data.rgba6_format)
-      out.Write("\twu4 bayer[4] = {wu4(-8,0,-6,2),wu4(4,-4,6,-2),wu4(-5,3,-7,1),wu4(7,-1,5,-3)};\n");
+      out.Append("\twu4 bayer[4] = {wu4(-8,0,-6,2),wu4(4,-4,6,-2),wu4(-5,3,-7,1),wu4(7,-1,5,-3)};\n");
     else
-      out.Write("\tint4 bayer[4] = {wu4(-2,0,1,-1),wu4(-1,1,-2,0),wu4(1,3,-1,-2),wu4(0,-1,2,1)};\n");
-    out.Write("\treturn bayer[ditherindex.y][ditherindex.x];\n");
-    out.Write("}\n");
+      out.Append("\tint4 bayer[4] = {wu4(-2,0,1,-1),wu4(-1,1,-2,0),wu4(1,3,-1,-2),wu4(0,-1,2,1)};\n");
+    out.Append("\treturn bayer[ditherindex.y][ditherindex.x];\n");
+    out.Append("}\n");
   }
   if (ApiType == API_OPENGL || ApiType == API_VULKAN)
   {
@@ -1658,32 +1693,32 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     {
       if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_FRAGMENT_SHADER_INDEX_DECORATION))
       {
-        out.Write("FRAGMENT_OUTPUT_LOCATION(0) out vec4 ocol0;\n");
-        out.Write("FRAGMENT_OUTPUT_LOCATION(1) out vec4 ocol1;\n");
+        out.Append("FRAGMENT_OUTPUT_LOCATION(0) out vec4 ocol0;\n");
+        out.Append("FRAGMENT_OUTPUT_LOCATION(1) out vec4 ocol1;\n");
       }
       else
       {
-        out.Write("FRAGMENT_OUTPUT_LOCATION_INDEXED(0, 0) out vec4 ocol0;\n");
-        out.Write("FRAGMENT_OUTPUT_LOCATION_INDEXED(0, 1) out vec4 ocol1;\n");
+        out.Append("FRAGMENT_OUTPUT_LOCATION_INDEXED(0, 0) out vec4 ocol0;\n");
+        out.Append("FRAGMENT_OUTPUT_LOCATION_INDEXED(0, 1) out vec4 ocol1;\n");
       }
     }
     else
     {
-      out.Write("FRAGMENT_OUTPUT_LOCATION(0) out vec4 ocol0;\n");
+      out.Append("FRAGMENT_OUTPUT_LOCATION(0) out vec4 ocol0;\n");
     }
 
     if (per_pixel_depth)
-      out.Write("#define depth gl_FragDepth\n");
+      out.Append("#define depth gl_FragDepth\n");
     // We need to always use output blocks for Vulkan, but geometry shaders are also optional.
     if (hostconfig.backend_geometry_shaders || ApiType == API_VULKAN)
     {
-      out.Write("VARYING_LOCATION(0) in VertexData {\n");
+      out.Append("VARYING_LOCATION(0) in VertexData {\n");
       GenerateVSOutputMembers(out, ApiType, enable_pl, uid_data.genMode_numtexgens, GetInterpolationQualifier(ApiType, hostconfig.msaa, hostconfig.ssaa, true, true));
 
       if (hostconfig.stereo)
-        out.Write("\tflat int layer;\n");
+        out.Append("\tflat int layer;\n");
 
-      out.Write("};\n");
+      out.Append("};\n");
     }
     else
     {
@@ -1748,10 +1783,10 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       // ARB_image_load_store extension yet.
 
       // This is a #define which signals whatever early-z method the driver supports.
-      out.Write("FORCE_EARLY_Z\n");
+      out.Append("FORCE_EARLY_Z\n");
     }
-    out.Write("void main()\n{\n");
-    out.Write("\tfloat4 rawpos = gl_FragCoord;\n");
+    out.Append("void main()\n{\n");
+    out.Append("\tfloat4 rawpos = gl_FragCoord;\n");
   }
   else
   {
@@ -1766,9 +1801,9 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     }
     if (forced_early_z && !(ApiType & API_D3D9))
     {
-      out.Write("[earlydepthstencil]\n");
+      out.Append("[earlydepthstencil]\n");
     }
-    out.Write("void main(\n");
+    out.Append("void main(\n");
     if (ApiType != API_D3D11)
     {
       out.Write("  out float4 ocol0 : COLOR0,%s%s\n  in float4 rawpos : %s,\n",
@@ -1780,11 +1815,11 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     {
       if (uid_data.uint_output)
       {
-        out.Write("  out uint4 ocol0 : SV_Target0");
+        out.Append("  out uint4 ocol0 : SV_Target0");
       }
       else
       {
-        out.Write("  out float4 ocol0 : SV_Target0");
+        out.Append("  out float4 ocol0 : SV_Target0");
       }
       out.Write(",%s%s\n  in float4 rawpos : SV_Position,\n",
         render_mode == PSRM_DUAL_SOURCE_BLEND ? "\n  out float4 ocol1 : SV_Target1," : "",
@@ -1806,8 +1841,8 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       if (enable_pl)
         out.Write(",\n  in %s float4 Normal : TEXCOORD%d", optCentroid, numTexgen + 1);
       if (hostconfig.stereo)
-        out.Write(",\n  in uint layer : SV_RenderTargetArrayIndex\n");
-      out.Write("        ) {\n");
+        out.Append(",\n  in uint layer : SV_RenderTargetArrayIndex\n");
+      out.Append("        ) {\n");
     }
     else
     {
@@ -1823,8 +1858,8 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
           out.Write(",\n in %s float%d uv%d : TEXCOORD%d", optCentroid, i < 4 ? 4 : 3, i, i);
       }
       if (hostconfig.stereo)
-        out.Write(",\n  in uint layer : SV_RenderTargetArrayIndex\n");
-      out.Write("        ) {\n");      
+        out.Append(",\n  in uint layer : SV_RenderTargetArrayIndex\n");
+      out.Append("        ) {\n");      
     }
   }
   if (render_mode == PSRM_DEPTH_ONLY)
@@ -1835,14 +1870,14 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     }
     if (uid_data.uint_output)
     {
-      out.Write("ocol0 = uint4(0,0,0,0);\n");
+      out.Append("ocol0 = uint4(0,0,0,0);\n");
     }
     else
     {
-      out.Write("ocol0 = float4(0.0,0.0,0.0,0.0);\n");
+      out.Append("ocol0 = float4(0.0,0.0,0.0,0.0);\n");
     }
     
-    out.Write("}\n");
+    out.Append("}\n");
     return;
   }
   if (uid_data.dither)
@@ -1853,7 +1888,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
 	  }
 	  else
 	  {
-		  out.Write("\tint2 ditherindex = int2(rawpos.xy) & 3;\n");
+		  out.Append("\tint2 ditherindex = int2(rawpos.xy) & 3;\n");
 	  }
   }
   out.Write("wu4 c0 = " I_COLORS "[1], c1 = " I_COLORS "[2], c2 = " I_COLORS "[3], prev = " I_COLORS "[0];\n"
@@ -1900,15 +1935,15 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
 
   if (numTexgen >= 7)
   {
-    out.Write("float4 clipPos = float4(uv0.w,uv1.w,uv2.w,uv3.w);");
+    out.Append("float4 clipPos = float4(uv0.w,uv1.w,uv2.w,uv3.w);");
     if (enable_pl)
-      out.Write("float4 Normal = float4(uv4.w,uv5.w,uv6.w,uv7.w);");
+      out.Append("float4 Normal = float4(uv4.w,uv5.w,uv6.w,uv7.w);");
   }
 
   // HACK to handle cases where the tex gen is not enabled
   if (numTexgen == 0)
   {
-    out.Write("float3 uv0 = float3(0.0,0.0,0.0);\n");
+    out.Append("float3 uv0 = float3(0.0,0.0,0.0);\n");
   }
   else
   {
@@ -1935,7 +1970,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       }
       else
       {
-        out.Write("t_coord = wu2(0,0);\n");
+        out.Append("t_coord = wu2(0,0);\n");
       }
       out.Write("wu3 indtex%d = ", i);
       SampleTexture(out, ApiType, "(float2(t_coord))", "abg", texmap, hostconfig.stereo);
@@ -1943,15 +1978,15 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   }
   if (enablenormalmaps || forcePhong)
   {
-    out.Write("\tfloat3 emmisive_mask = float3(0.0,0.0,0.0);\n");
-    out.Write("\tfloat4 normalmap = float4(0.0,0.0,1.0,0.3);\n");
-    out.Write("\tfloat height_map = 0.0, height_map_count = 0.0;\n");
-    out.Write("\tfloat2 mapcoord = float2(0.0,0.0);\n");
-    out.Write("\tfloat2 mapsize = float2(0.0,0.0);\n");
+    out.Append("\tfloat3 emmisive_mask = float3(0.0,0.0,0.0);\n");
+    out.Append("\tfloat4 normalmap = float4(0.0,0.0,1.0,0.3);\n");
+    out.Append("\tfloat height_map = 0.0, height_map_count = 0.0;\n");
+    out.Append("\tfloat2 mapcoord = float2(0.0,0.0);\n");
+    out.Append("\tfloat2 mapsize = float2(0.0,0.0);\n");
   }
   if (enablenormalmaps)
   {
-    out.Write("\tfloat normalmapcount = 0.0;\n");
+    out.Append("\tfloat normalmapcount = 0.0;\n");
   }
 
   for (u32 i = 0; i < numStages; ++i)
@@ -1961,33 +1996,33 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
 
   if (enable_pl)
   {
-    out.Write("float3 _norm0 = normalize(Normal.xyz);\n\n");
-    out.Write("float3 pos = float3(clipPos.x,clipPos.y,Normal.w);\n");
+    out.Append("float3 _norm0 = normalize(Normal.xyz);\n\n");
+    out.Append("float3 pos = float3(clipPos.x,clipPos.y,Normal.w);\n");
 
     if (forcePhong)
     {
-      out.Write("float4 spec = float4(0.0,0.0,0.0,0.0);\n");
-      out.Write("float3 View = normalize(-pos);\n");
+      out.Append("float4 spec = float4(0.0,0.0,0.0,0.0);\n");
+      out.Append("float3 View = normalize(-pos);\n");
     }
     out.Write("float4 mat, lacc;\n"
       "float3 ldir, h;\n"
       "float dist, dist2, attn;\n");
     if (Use_integer_math)
     {
-      out.Write("int4 ilacc;\n");
+      out.Append("int4 ilacc;\n");
     }
     // On GLSL, input variables must not be assigned to.
     // This is why we declare these variables locally instead.
-    out.Write("\tfloat4 col0 = float4(0.0,0.0,0.0,0.0), col1 = float4(0.0,0.0,0.0,0.0);\n");
-    out.Write("\tfloat3 rawnormal = _norm0;\n");
+    out.Append("\tfloat4 col0 = float4(0.0,0.0,0.0,0.0), col1 = float4(0.0,0.0,0.0,0.0);\n");
+    out.Append("\tfloat3 rawnormal = _norm0;\n");
     if (enablenormalmaps)
     {
       out.Write("if(" I_FLAGS ".x != 0)\n{\n");
-      out.Write("_norm0 = perturb_normal(_norm0, pos, mapcoord, normalmap.xyz);\n");
-      out.Write("}\n");
+      out.Append("_norm0 = perturb_normal(_norm0, pos, mapcoord, normalmap.xyz);\n");
+      out.Append("}\n");
       if (enablesimbumps)
       {
-        out.Write("else ");
+        out.Append("else ");
       }
     }
     if (enablesimbumps)
@@ -2007,16 +2042,16 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       out.Write("spec.w = pow(1.0 - saturate(dot(View, _norm0))," I_PPHONG "[0].y);\n");
       // Surfaces are more reflective depending on the view angle
       // Aproximate this with a small math trick
-      out.Write("normalmap.w = lerp(normalmap.w, sqrt(normalmap.w), spec.w);\n");
+      out.Append("normalmap.w = lerp(normalmap.w, sqrt(normalmap.w), spec.w);\n");
     }
   }
   else
   {
-    out.Write("\tfloat4 col0 = colors_0;\n");
-    out.Write("\tfloat4 col1 = colors_1;\n");
+    out.Append("\tfloat4 col0 = colors_0;\n");
+    out.Append("\tfloat4 col1 = colors_1;\n");
   }
 
-  out.Write("float4 cPos = float4(rawpos.x, rawpos.y, clipPos.z, clipPos.w);\n");
+  out.Append("float4 cPos = float4(rawpos.x, rawpos.y, clipPos.z, clipPos.w);\n");
 
   for (u32 i = 0; i < numStages; i++)
     WriteStage(out,ApiType, Use_integer_math, uid_data, i, register_state); // build the equation for this stage
@@ -2039,7 +2074,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   }
   // emulation of unsigned 8 overflow
   if (register_state.NeedOverflowControl(tevCOutputSourceMap[colorCdest]) || register_state.NeedOverflowControl(tevAOutputSourceMap[alphaCdest]))
-    out.Write("prev = CHK_O_U8(prev);\n");
+    out.Append("prev = CHK_O_U8(prev);\n");
 
   // NOTE: Fragment may not be discarded if alpha test always fails and early depth test is enabled 
   // (in this case we need to write a depth value if depth test passes regardless of the alpha testing result)
@@ -2074,7 +2109,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       out.Write("wu zCoord = wuround((%srawpos.z) * 16777216.0);\n", ApiType == API_OPENGL ? "" : "1.0 - ");
     }
     else
-      out.Write("wu zCoord = wu(rawpos.z);\n");
+      out.Append("wu zCoord = wu(rawpos.z);\n");
   }
   else
   {
@@ -2086,11 +2121,11 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   }
   if (Use_integer_math)
   {
-    out.Write("zCoord = clamp(zCoord, 0, 0xFFFFFF);\n");
+    out.Append("zCoord = clamp(zCoord, 0, 0xFFFFFF);\n");
   }
   else
   {
-    out.Write("zCoord = clamp(zCoord, 0.0, 1.0);\n");
+    out.Append("zCoord = clamp(zCoord, 0.0, 1.0);\n");
   }
   // Note: z-textures are not written to depth buffer if early depth test is used
   if (per_pixel_depth && uid_data.early_ztest)
@@ -2112,7 +2147,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     {
       out.Write("zCoord = idot(" I_ZBIAS"[0].xyzw, tex_t.xyzw) + " I_ZBIAS"[1].w %s;\n",
         (uid_data.ztex_op == ZTEXTURE_ADD) ? "+ zCoord" : "");
-      out.Write("zCoord = zCoord & 0xFFFFFF;\n");
+      out.Append("zCoord = zCoord & 0xFFFFFF;\n");
     }
     else
     {
@@ -2120,7 +2155,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       out.Write("zCoord = dot(" I_ZBIAS"[0].xyzw, tex_t.xyzw * (1.0/255.0)) + " I_ZBIAS "[1].w %s;\n",
         (uid_data.ztex_op == ZTEXTURE_ADD) ? "+ zCoord" : "");
       // U24 overflow emulation : disabled find out why this make nvidia compiler crasy
-      // out.Write("zCoord = zCoord > 1.0f ? (zCoord - 1.0f) : zCoord;\n");
+      // out.Append("zCoord = zCoord > 1.0f ? (zCoord - 1.0f) : zCoord;\n");
     }
   }
   if (per_pixel_depth && uid_data.late_ztest)
@@ -2154,18 +2189,18 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
   {
     // Add emmisive color
     out.Write("if(" I_FLAGS ".y != 0)\n{\n");
-    out.Write("prev.rgb += wu3(emmisive_mask * 255.0);\n");
-    out.Write("}\n");
+    out.Append("prev.rgb += wu3(emmisive_mask * 255.0);\n");
+    out.Append("}\n");
   }
 
   if (uid_data.dither)
   {
-    out.Write("\tprev.rgb += GetDitherValue(ditherindex);\n");
+    out.Append("\tprev.rgb += GetDitherValue(ditherindex);\n");
   }
 
   if (uid_data.rgba6_format)
   {
-    out.Write("\tprev = CAST_TO_U6(clamp(prev, 0, 255));\n");
+    out.Append("\tprev = CAST_TO_U6(clamp(prev, 0, 255));\n");
   }
 
   // Use dual-source color blending to perform dst alpha in a single pass
@@ -2175,27 +2210,27 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
     {
       // alpha component must be 0 or the shader will not compile (Direct3D 9Ex restriction)
       // Colors will be blended against the color from ocol1 in D3D 9...
-      out.Write("ocol1 = float4(prev.a, prev.a, prev.a, 0.0) * (1.0/255.0);\n");
+      out.Append("ocol1 = float4(prev.a, prev.a, prev.a, 0.0) * (1.0/255.0);\n");
     }
     else
     {
       // Colors will be blended against the alpha from ocol1...
-      out.Write("ocol1 = float4(prev) * (1.0/255.0);\n");
+      out.Append("ocol1 = float4(prev) * (1.0/255.0);\n");
     }
     // ...and the alpha from ocol0 will be written to the framebuffer.
     out.Write("prev.a = " I_ALPHA ".a;\n");
     if (uid_data.rgba6_format)
     {
-      out.Write("\tprev.a = CAST_TO_U6(prev.a);\n");
+      out.Append("\tprev.a = CAST_TO_U6(prev.a);\n");
     }
   }
   if (uid_data.uint_output)
   {
-    out.Write("ocol0 = prev;\n");
+    out.Append("ocol0 = prev;\n");
   }
   else
   {
-    out.Write("ocol0 = float4(prev) * (1.0/255.0);\n");
+    out.Append("ocol0 = float4(prev) * (1.0/255.0);\n");
   }
   if (uid_data.bounding_box)
   {
@@ -2207,7 +2242,7 @@ inline void GeneratePixelShader(ShaderCode& out, const pixel_shader_uid_data& ui
       "\tif(bbox_data[3] < int(rawpos.y)) %sMax(bbox_data[3], int(rawpos.y));\n",
       atomic_op, atomic_op, atomic_op, atomic_op);
   }
-  out.Write("}\n");
+  out.Append("}\n");
 }
 
 void GeneratePixelShaderCode(ShaderCode& object, const pixel_shader_uid_data& uid_data, const ShaderHostConfig& hostconfig)
@@ -237,5 +237,8 @@ struct pixel_shader_uid_data
 #define PIXELSHADERGEN_UID_VERSION 1
 typedef ShaderUid<pixel_shader_uid_data> PixelShaderUid;
 
+// Invalidates the cached UIDs inside GetPixelShaderUID. Must be called whenever
+// a BP/XF register or config setting that feeds UID generation changes.
+void MarkPixelShaderUidDirty();
 void GetPixelShaderUID(PixelShaderUid& object, PIXEL_SHADER_RENDER_MODE render_mode, u32 components, const XFMemory &xfr, const BPMemory &bpm);
 void GeneratePixelShaderCode(ShaderCode& object, const pixel_shader_uid_data& uid_data, const ShaderHostConfig& hostconfig);
@@ -854,7 +854,7 @@ void PixelShaderManager::SetBoundingBoxActive(bool active)
     return;
   }
   const u32 enable =
-    active && g_ActiveConfig.iBBoxMode == BBoxGPU ? 1 : 0;
+    active && g_ActiveConfig.EffectiveBBoxMode() == BBoxGPU ? 1 : 0;
   if (m_buffer.GetBuffer<u32>(C_UBERPARAM2)[1] != enable)
   {
     m_buffer.SetConstant(C_UBERPARAM2, 1, enable);
@@ -23,6 +23,7 @@
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
@@ -1124,7 +1125,11 @@ void PostProcessingShader::LinkPassOutputs()
     RenderPassData& pass = m_passes[pass_index];
     pass.enabled = pass_config.CheckEnabled();
     if (!pass.enabled)
+    {
+      // Don't keep intermediates of passes that got disabled by an option.
+      pass.ReleaseOutput();
       continue;
+    }
     size_t previous_pass_index = m_last_pass_index;
     m_last_pass_index = pass_index;
     m_last_pass_uses_color_buffer = false;
@@ -1231,8 +1236,8 @@ void PostProcessingShader::RenderPassData::AddOutput()
   if (enabled && !output_texture)
   {
     output_texture = g_texture_cache->AllocateTexture(config);
-    ref_count = use_count;
   }
+  ref_count = use_count;
 }
 
 void PostProcessingShader::RenderPassData::ClenaupOutput()
@@ -1240,7 +1245,12 @@ void PostProcessingShader::RenderPassData::ClenaupOutput()
   ref_count--;
   if (output_texture && ref_count <= 0)
   {
-    ReleaseOutput();
+    // All consumers for this frame are done. Keep the texture for the next
+    // frame; the chain renders every frame with the same layout, so bouncing
+    // the intermediate through the texture cache pool each pass only added
+    // allocator traffic. ResizeOutputTextures/LinkPassOutputs still release
+    // it when the size or the pass setup actually changes.
+    ref_count = use_count;
   }
 }
 
@@ -1317,6 +1327,7 @@ bool PostProcessor::XFBDepthDataRequired() const
 
 void PostProcessor::DoEFB(const TargetRectangle* src_rect)
 {
+  STATZONE(stats.thisFrame.usPostProcessTime);
   TargetSize target_size(g_renderer->GetTargetWidth(), g_renderer->GetTargetHeight());
   TargetRectangle target_rect;
   if (src_rect)
@@ -1836,6 +1847,7 @@ void PostProcessor::PostProcess(TargetRectangle* output_rect, TargetSize* output
 {
   if (!m_active)
     return;
+  STATZONE(stats.thisFrame.usPostProcessTime);
   uintptr_t real_dst_texture = dst_texture == 0 && dst_rect == nullptr ? src_texture : dst_texture;
   // Setup copy buffers first, and update compile-time constants.
   TargetSize buffer_size(src_rect.GetWidth(), src_rect.GetHeight());
@@ -14,6 +14,7 @@
 
 #include <cinttypes>
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -23,6 +24,7 @@
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
+#include "Common/FlightRecorder.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -38,6 +40,7 @@
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 
 #include "VideoCommon/AVIDump.h"
@@ -49,10 +52,12 @@
 #include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/InputLatencyTelemetry.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/ShaderCompileTelemetry.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -96,6 +101,10 @@ Renderer::~Renderer()
   ShutdownFrameDumping();
   if (m_frame_dump_thread.joinable())
     m_frame_dump_thread.join();
+
+  ShaderCompileTelemetry::ExportSummary();
+  ShaderCompileTelemetry::Reset();
+  InputLatencyTelemetry::Reset();
 }
 
 void Renderer::RenderToXFB(u32 xfbAddr, const EFBRectangle& sourceRc, u32 fbStride, u32 fbHeight, float Gamma)
@@ -248,6 +257,10 @@ bool Renderer::CalculateTargetSize(int multiplier)
     m_target_width = new_efb_width;
     m_target_height = new_efb_height;
     m_efb_scale = float(m_target_width) / float(EFB_WIDTH);
+    // The guest-to-host mapping changed, so the cached scissor/viewport state
+    // no longer describes what the backend should have.
+    m_scissor_state_valid = false;
+    m_viewport_state_valid = false;
     VertexShaderManager::SetViewportChanged();
     GeometryShaderManager::SetViewportChanged();
     PixelShaderManager::SetViewportChanged();
@@ -256,6 +269,43 @@ bool Renderer::CalculateTargetSize(int multiplier)
   return false;
 }
 
+bool Renderer::SetScissorRectIfChanged(const EFBRectangle& rc, int x_off, int y_off)
+{
+  if (m_scissor_state_valid && rc == m_last_scissor_rc && x_off == m_last_scissor_xoff &&
+      y_off == m_last_scissor_yoff)
+  {
+    INCSTAT(stats.thisFrame.numScissorSetsSkipped);
+    return false;
+  }
+  m_last_scissor_rc = rc;
+  m_last_scissor_xoff = x_off;
+  m_last_scissor_yoff = y_off;
+  m_scissor_state_valid = true;
+  SetScissorRect(rc);
+  return true;
+}
+
+void Renderer::SetViewportIfChanged()
+{
+  // The host viewport is derived from the guest viewport registers and the
+  // scissor offset; everything else that feeds it (EFB scale, stereo mode)
+  // invalidates the cache or is stable within a frame.
+  const int x_off = bpmem.scissorOffset.x;
+  const int y_off = bpmem.scissorOffset.y;
+  if (m_viewport_state_valid &&
+      std::memcmp(m_last_viewport, &xfmem.viewport, sizeof(m_last_viewport)) == 0 &&
+      x_off == m_last_viewport_xoff && y_off == m_last_viewport_yoff)
+  {
+    INCSTAT(stats.thisFrame.numViewportSetsSkipped);
+    return;
+  }
+  std::memcpy(m_last_viewport, &xfmem.viewport, sizeof(m_last_viewport));
+  m_last_viewport_xoff = x_off;
+  m_last_viewport_yoff = y_off;
+  m_viewport_state_valid = true;
+  SetViewport();
+}
+
 std::tuple<TargetRectangle, TargetRectangle>
 Renderer::ConvertStereoRectangle(const TargetRectangle& rc) const
 {
@@ -331,7 +381,10 @@ bool Renderer::CheckForHostConfigChanges()
 // Create On-Screen-Messages
 void Renderer::DrawDebugText()
 {
-  std::string final_yellow, final_cyan;
+  // reused across frames so steady-state text assembly doesn't allocate
+  static std::string final_yellow, final_cyan;
+  final_yellow.clear();
+  final_cyan.clear();
 
   if (g_ActiveConfig.bShowFPS || SConfig::GetInstance().m_ShowFrameCount)
   {
@@ -460,10 +513,14 @@ void Renderer::DrawDebugText()
   final_cyan += Common::Profiler::ToString();
 
   if (g_ActiveConfig.bOverlayStats)
-    final_cyan += Statistics::ToString();
+  {
+    ShaderCompileTelemetry::AppendToString(&final_cyan);
+    InputLatencyTelemetry::AppendToString(&final_cyan);
+    Statistics::AppendToString(&final_cyan);
+  }
 
   if (g_ActiveConfig.bOverlayProjStats)
-    final_cyan += Statistics::ToStringProj();
+    Statistics::AppendToStringProj(&final_cyan);
 
   // and then the text
   RenderText(final_cyan, 20, 20, 0xFF00FFFF);
@@ -778,7 +835,8 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
   }
 
   // TODO: merge more generic parts into VideoCommon
-  SwapImpl(xfbAddr, fbWidth, fbStride, fbHeight, rc, ticks, Gamma);
+  if (!UpdatePresentGovernor(ticks))
+    SwapImpl(xfbAddr, fbWidth, fbStride, fbHeight, rc, ticks, Gamma);
 
   if (m_xfb_written || (g_ActiveConfig.bUseXFB && g_ActiveConfig.bUseRealXFB))
     m_fps_counter.Update();
@@ -786,15 +844,93 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
   frameCount++;
   GFX_DEBUGGER_PAUSE_AT(NEXT_FRAME, true);
 
+  ShaderCompileTelemetry::EndFrame();
+  Common::FlightRecorder::EndFrame();
+  InputLatencyTelemetry::OnFramePresented();
+
   // Begin new frame
   // Set default viewport and scissor, for the clear to work correctly
   // New frame
   stats.ResetFrame();
 
+  // Backends touch the scissor/viewport during presentation, and per-frame
+  // config (stereo, post-processing) may have changed; force the first set of
+  // the new frame through.
+  m_scissor_state_valid = false;
+  m_viewport_state_valid = false;
+
   Core::Callback_VideoCopiedToXFB(m_xfb_written || (g_ActiveConfig.bUseXFB && g_ActiveConfig.bUseRealXFB));
   m_xfb_written = false;
 }
 
+// Graceful degradation when presentation cannot keep up with emulation: once
+// the wall-clock time between swaps has overshot the emulated interval (the
+// tick delta between the XFB copies) for several consecutive frames, skip the
+// presentation - not the emulation - of every other frame until presents stay
+// on time again for a sustained stretch. Returns true when this swap's
+// SwapImpl call should be skipped; all the post-present bookkeeping in Swap
+// still runs so frame counting and the CPU/GPU handshake are unaffected.
+bool Renderer::UpdatePresentGovernor(u64 ticks)
+{
+  // How far past the emulated interval a present may land before it counts as
+  // a miss; small scheduler jitter should not trip the governor.
+  constexpr u64 MISS_THRESHOLD_PERCENT = 120;
+  constexpr u32 ENGAGE_MISSES = 5;
+  constexpr u32 DISENGAGE_MET_FRAMES = 120;
+
+  // Frame dumps must contain every frame, and with the governor off the
+  // streaks must not carry stale intervals into a later re-enable.
+  if (!g_ActiveConfig.bPresentSkipGovernor || IsFrameDumping())
+  {
+    if (m_governor_active)
+      OSD::AddMessage("Present-skip governor disengaged.", 4000);
+    m_governor_last_wall_us = 0;
+    m_governor_miss_streak = 0;
+    m_governor_met_streak = 0;
+    m_governor_active = false;
+    return false;
+  }
+
+  const u64 now_us = Common::Timer::GetTimeUs();
+  const u64 last_wall_us = m_governor_last_wall_us;
+  const u64 last_ticks = m_governor_last_ticks;
+  m_governor_last_wall_us = now_us;
+  m_governor_last_ticks = ticks;
+
+  // First sample, or the tick counter jumped backwards (state load).
+  if (last_wall_us == 0 || ticks <= last_ticks)
+    return false;
+
+  const u64 expected_us = (ticks - last_ticks) * 1000000 / SystemTimers::GetTicksPerSecond();
+  const bool missed = now_us - last_wall_us > expected_us * MISS_THRESHOLD_PERCENT / 100;
+
+  if (missed)
+  {
+    m_governor_met_streak = 0;
+    if (++m_governor_miss_streak >= ENGAGE_MISSES && !m_governor_active)
+    {
+      m_governor_active = true;
+      m_governor_skip_parity = false;
+      OSD::AddMessage("GPU can't keep up, skipping presentation of alternate frames.", 4000);
+    }
+  }
+  else
+  {
+    m_governor_miss_streak = 0;
+    if (m_governor_active && ++m_governor_met_streak >= DISENGAGE_MET_FRAMES)
+    {
+      m_governor_active = false;
+      OSD::AddMessage("Present-skip governor disengaged.", 4000);
+    }
+  }
+
+  if (!m_governor_active)
+    return false;
+
+  m_governor_skip_parity = !m_governor_skip_parity;
+  return m_governor_skip_parity;
+}
+
 bool Renderer::IsFrameDumping()
 {
   if (m_screenshot_request.IsSet())
@@ -819,9 +955,27 @@ void Renderer::ShutdownFrameDumping()
 
 void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVIDump::Frame& state, bool swap_upside_down, bool bgra)
 {
-  FinishFrameData();
+  // Never stall presentation: if the dump thread has fallen behind and the
+  // ring is full, drop this frame. The PTS of the next frame is derived from
+  // CPU ticks, so a dropped frame simply lengthens the previous one.
+  const size_t write_index = m_frame_dump_write_index.load(std::memory_order_relaxed);
+  if ((write_index + 1) % FRAME_DUMP_QUEUE_DEPTH ==
+      m_frame_dump_read_index.load(std::memory_order_acquire))
+  {
+    m_frame_dump_frames_dropped++;
+    if ((m_frame_dump_frames_dropped & 127) == 1)
+    {
+      WARN_LOG(VIDEO, "Frame dump encoder is falling behind, %u frame(s) dropped so far",
+        m_frame_dump_frames_dropped);
+    }
+    return;
+  }
 
-  m_frame_dump_config = FrameDumpConfig{ data, w, h, stride, swap_upside_down, bgra, state };
+  FrameDumpSlot& slot = m_frame_dump_queue[write_index];
+  slot.data.assign(data, data + static_cast<size_t>(stride) * h);
+  slot.config = FrameDumpConfig{ slot.data.data(), w, h, stride, swap_upside_down, bgra, state };
+  m_frame_dump_write_index.store((write_index + 1) % FRAME_DUMP_QUEUE_DEPTH,
+    std::memory_order_release);
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -832,16 +986,20 @@ void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVI
   }
 
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
 void Renderer::FinishFrameData()
 {
-  if (!m_frame_dump_frame_running)
+  // Drains the ring; only needed before tearing the dump thread down. The
+  // per-frame producer path no longer waits since frames are copied.
+  if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  while (m_frame_dump_read_index.load(std::memory_order_acquire) !=
+         m_frame_dump_write_index.load(std::memory_order_acquire))
+  {
+    m_frame_dump_done.Wait();
+  }
 }
 
 void Renderer::RunFrameDumps()
@@ -866,53 +1024,59 @@ void Renderer::RunFrameDumps()
     if (!m_frame_dump_thread_running.IsSet())
       break;
 
-    auto config = m_frame_dump_config;
-
-    if (config.upside_down)
-    {
-      config.data = config.data + (config.height - 1) * config.stride;
-      config.stride = -config.stride;
-    }
-
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    size_t read_index = m_frame_dump_read_index.load(std::memory_order_relaxed);
+    while (read_index != m_frame_dump_write_index.load(std::memory_order_acquire))
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
+      auto config = m_frame_dump_queue[read_index].config;
 
-      if (TextureToPng(config.data, config.stride, m_screenshot_name, config.width, config.height,
-        false, (g_ActiveConfig.backend_info.APIType & API_D3D9) != 0))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
-
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
+      if (config.upside_down)
+      {
+        config.data = config.data + (config.height - 1) * config.stride;
+        config.stride = -config.stride;
+      }
 
-    if (SConfig::GetInstance().m_DumpFrames)
-    {
-      if (!frame_dump_started)
+      // Save screenshot
+      if (m_screenshot_request.TestAndClear())
       {
-        if (dump_to_avi)
-          frame_dump_started = StartFrameDumpToAVI(config);
-        else
-          frame_dump_started = StartFrameDumpToImage(config);
+        std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-        // Stop frame dumping if we fail to start.
-        if (!frame_dump_started)
-          SConfig::GetInstance().m_DumpFrames = false;
+        if (TextureToPng(config.data, config.stride, m_screenshot_name, config.width, config.height,
+          false, (g_ActiveConfig.backend_info.APIType & API_D3D9) != 0))
+          OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+
+        // Reset settings
+        m_screenshot_name.clear();
+        m_screenshot_completed.Set();
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
+      if (SConfig::GetInstance().m_DumpFrames)
       {
-        if (dump_to_avi)
-          DumpFrameToAVI(config);
-        else
-          DumpFrameToImage(config);
+        if (!frame_dump_started)
+        {
+          if (dump_to_avi)
+            frame_dump_started = StartFrameDumpToAVI(config);
+          else
+            frame_dump_started = StartFrameDumpToImage(config);
+
+          // Stop frame dumping if we fail to start.
+          if (!frame_dump_started)
+            SConfig::GetInstance().m_DumpFrames = false;
+        }
+
+        // If we failed to start frame dumping, don't write a frame.
+        if (frame_dump_started)
+        {
+          if (dump_to_avi)
+            DumpFrameToAVI(config);
+          else
+            DumpFrameToImage(config);
+        }
       }
-    }
 
-    m_frame_dump_done.Set();
+      read_index = (read_index + 1) % FRAME_DUMP_QUEUE_DEPTH;
+      m_frame_dump_read_index.store(read_index, std::memory_order_release);
+      m_frame_dump_done.Set();
+    }
   }
 
   if (frame_dump_started)
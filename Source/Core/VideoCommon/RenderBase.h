@@ -13,6 +13,8 @@
 // ---------------------------------------------------------------------------------------------
 
 #pragma once
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -80,6 +82,14 @@ public:
   virtual void ResetAPIState() {}
   virtual void RestoreAPIState() {}
 
+  // Memoizing entry points for the BP/XF state translation code. Games
+  // rewrite identical scissor/viewport registers constantly, so these compare
+  // the derived state against what was last pushed and skip the backend call
+  // (and dependent constant updates) on a match. Returns true when the state
+  // actually changed and was pushed.
+  bool SetScissorRectIfChanged(const EFBRectangle& rc, int x_off, int y_off);
+  void SetViewportIfChanged();
+
   // Ideal internal resolution - determined by display resolution (automatic scaling) and/or a multiple of the native EFB resolution
   int GetTargetWidth() const { return m_target_width; }
   int GetTargetHeight() const { return m_target_height; }
@@ -194,7 +204,29 @@ protected:
 private:
   void RunFrameDumps();
   void ShutdownFrameDumping();
+
+  // Present-skip governor, see the comment on UpdatePresentGovernor().
+  bool UpdatePresentGovernor(u64 ticks);
+  u64 m_governor_last_wall_us = 0;
+  u64 m_governor_last_ticks = 0;
+  u32 m_governor_miss_streak = 0;
+  u32 m_governor_met_streak = 0;
+  bool m_governor_active = false;
+  bool m_governor_skip_parity = false;
   PEControl::PixelFormat m_prev_efb_format = PEControl::INVALID_FMT;
+
+  // Last scissor/viewport state pushed to the backend, for the memoization in
+  // SetScissorRectIfChanged/SetViewportIfChanged. The valid flags are dropped
+  // whenever the guest-to-host mapping itself may have changed (EFB size
+  // change, new frame).
+  EFBRectangle m_last_scissor_rc;
+  int m_last_scissor_xoff = 0;
+  int m_last_scissor_yoff = 0;
+  bool m_scissor_state_valid = false;
+  float m_last_viewport[6] = {};
+  int m_last_viewport_xoff = 0;
+  int m_last_viewport_yoff = 0;
+  bool m_viewport_state_valid = false;
   u32 m_efb_scale_numeratorX = 1;
   u32 m_efb_scale_numeratorY = 1;
   u32 m_efb_scale_denominatorX = 1;
@@ -211,7 +243,6 @@ private:
   Common::Event m_frame_dump_done;
   Common::Flag m_frame_dump_thread_running;
   u32 m_frame_dump_image_counter = 0;
-  bool m_frame_dump_frame_running = false;
 
   struct FrameDumpConfig
   {
@@ -222,7 +253,23 @@ private:
     bool upside_down;
     bool bgra;
     AVIDump::Frame state;
-  } m_frame_dump_config;
+  };
+
+  // Frames are handed to the dump thread through a small ring of copies, so
+  // the caller's readback buffer can be unmapped as soon as DumpFrameData
+  // returns and presentation never waits on the encoder. When the encoder
+  // falls behind and the ring fills up, frames are dropped; the timestamps
+  // carried in AVIDump::Frame keep the output in sync regardless.
+  static const size_t FRAME_DUMP_QUEUE_DEPTH = 4;
+  struct FrameDumpSlot
+  {
+    std::vector<u8> data;
+    FrameDumpConfig config;
+  };
+  std::array<FrameDumpSlot, FRAME_DUMP_QUEUE_DEPTH> m_frame_dump_queue;
+  std::atomic<size_t> m_frame_dump_read_index{0};
+  std::atomic<size_t> m_frame_dump_write_index{0};
+  u32 m_frame_dump_frames_dropped = 0;
 
   // NOTE: The methods below are called on the framedumping thread.
   bool StartFrameDumpToAVI(const FrameDumpConfig& config);
@@ -0,0 +1,158 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/ShaderCompileTelemetry.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace ShaderCompileTelemetry
+{
+namespace
+{
+struct Event
+{
+  u32 frame;
+  u32 draw_call;
+  u32 duration_us;
+  u64 uid_hash;
+  char stage[12];
+};
+
+// Cap the event log so a title that keeps generating new shaders cannot grow
+// it without bound; the aggregate counters keep counting past the cap.
+constexpr size_t MAX_EVENTS = 16384;
+
+// Compiles that together cost more than this in one frame are worth an OSD
+// warning; half a 60 fps frame is well past the stutter threshold.
+constexpr u32 FRAME_WARN_US = 8000;
+
+std::mutex s_event_mutex;
+std::vector<Event> s_events;
+
+std::atomic<u32> s_frame_compiles{0};
+std::atomic<u32> s_frame_us{0};
+std::atomic<u32> s_total_compiles{0};
+std::atomic<u64> s_total_us{0};
+
+// Video thread only.
+u32 s_frame_index = 0;
+u32 s_heatmap_us[HEATMAP_FRAMES] = {};
+}  // namespace
+
+void RecordCompile(const char* stage, u64 uid_hash, u32 duration_us)
+{
+  // numDrawCalls is written by the video thread without synchronization; a
+  // slightly stale value is fine for attribution.
+  const u32 draw_call = static_cast<u32>(stats.thisFrame.numDrawCalls);
+
+  s_frame_compiles.fetch_add(1, std::memory_order_relaxed);
+  s_frame_us.fetch_add(duration_us, std::memory_order_relaxed);
+  s_total_compiles.fetch_add(1, std::memory_order_relaxed);
+  s_total_us.fetch_add(duration_us, std::memory_order_relaxed);
+
+  INFO_LOG(VIDEO, "Shader compile: %s uid %016" PRIx64 " took %u us (frame %u, draw %u)", stage,
+    uid_hash, duration_us, s_frame_index, draw_call);
+
+  std::lock_guard<std::mutex> guard(s_event_mutex);
+  if (s_events.size() >= MAX_EVENTS)
+    return;
+  Event e;
+  e.frame = s_frame_index;
+  e.draw_call = draw_call;
+  e.duration_us = duration_us;
+  e.uid_hash = uid_hash;
+  snprintf(e.stage, sizeof(e.stage), "%s", stage);
+  s_events.push_back(e);
+}
+
+void EndFrame()
+{
+  const u32 compiles = s_frame_compiles.exchange(0, std::memory_order_relaxed);
+  const u32 us = s_frame_us.exchange(0, std::memory_order_relaxed);
+
+  s_heatmap_us[s_frame_index % HEATMAP_FRAMES] = us;
+  s_frame_index++;
+
+  if (us >= FRAME_WARN_US)
+  {
+    OSD::AddTypedMessage(OSD::MessageType::ShaderCompiles,
+      StringFromFormat("Compiled %u shader(s) in %.1f ms", compiles, us / 1000.0f),
+      OSD::Duration::SHORT, OSD::Color::RED);
+  }
+}
+
+void AppendToString(std::string* str)
+{
+  // One character per frame, oldest first: '.' none, '0'-'9' total compile
+  // milliseconds that frame, '!' for 10 ms and up.
+  char heatmap[HEATMAP_FRAMES + 1];
+  for (u32 i = 0; i < HEATMAP_FRAMES; i++)
+  {
+    const u32 us = s_heatmap_us[(s_frame_index + i) % HEATMAP_FRAMES];
+    if (us == 0)
+      heatmap[i] = '.';
+    else if (us >= 10000)
+      heatmap[i] = '!';
+    else
+      heatmap[i] = static_cast<char>('0' + us / 1000);
+  }
+  heatmap[HEATMAP_FRAMES] = '\0';
+
+  char buffer[192];
+  const int len = snprintf(buffer, sizeof(buffer),
+    "Runtime shader compiles: %u (%.1f ms)\nCompile heat [%uf]: %s\n",
+    s_total_compiles.load(std::memory_order_relaxed),
+    s_total_us.load(std::memory_order_relaxed) / 1000.0, HEATMAP_FRAMES, heatmap);
+  str->append(buffer, std::min<size_t>(len, sizeof(buffer) - 1));
+}
+
+void ExportSummary()
+{
+  if (!g_ActiveConfig.bLogRenderTimeToFile)
+    return;
+
+  std::lock_guard<std::mutex> guard(s_event_mutex);
+  if (s_events.empty())
+    return;
+
+  std::ofstream file;
+  File::OpenFStream(file, File::GetUserPath(D_LOGS_IDX) + "shader_compiles.csv",
+    std::ios_base::out);
+  if (!file.good())
+    return;
+
+  file << "frame,draw_call,stage,uid,duration_us\n";
+  for (const Event& e : s_events)
+  {
+    file << e.frame << ',' << e.draw_call << ',' << e.stage << ','
+         << StringFromFormat("%016" PRIx64, e.uid_hash) << ',' << e.duration_us << '\n';
+  }
+}
+
+void Reset()
+{
+  {
+    std::lock_guard<std::mutex> guard(s_event_mutex);
+    s_events.clear();
+  }
+  s_frame_compiles.store(0, std::memory_order_relaxed);
+  s_frame_us.store(0, std::memory_order_relaxed);
+  s_total_compiles.store(0, std::memory_order_relaxed);
+  s_total_us.store(0, std::memory_order_relaxed);
+  s_frame_index = 0;
+  std::fill(std::begin(s_heatmap_us), std::end(s_heatmap_us), 0);
+}
+}  // namespace ShaderCompileTelemetry
@@ -0,0 +1,42 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Records every runtime shader/pipeline compile with its duration, source
+// hash and the draw call it blocked, so stutter can be attributed to shader
+// compilation without a debug build. Aggregates feed the statistics overlay
+// (a per-frame compile heatmap) and the raw event log can be exported as CSV
+// next to the render-time benchmark log.
+namespace ShaderCompileTelemetry
+{
+// Width of the rolling per-frame window shown in the overlay heatmap.
+constexpr u32 HEATMAP_FRAMES = 60;
+
+// Records one finished compile. stage is a short static tag (e.g. "ps_5_0",
+// "gl-prog", "vs"), uid_hash identifies the generated source and duration_us
+// is the wall-clock time the compile took. Safe to call from any thread,
+// including the shader compiler worker threads.
+void RecordCompile(const char* stage, u64 uid_hash, u32 duration_us);
+
+// Folds the current frame's counters into the rolling window and raises an
+// OSD warning when compiles ate a noticeable part of the frame. Called once
+// per presented frame from the renderer.
+void EndFrame();
+
+// Appends totals and the per-frame heatmap to the statistics overlay text.
+void AppendToString(std::string* str);
+
+// Writes the per-event log to shader_compiles.csv in the logs directory.
+// Only active alongside the render-time benchmark log
+// (g_ActiveConfig.bLogRenderTimeToFile); a no-op otherwise.
+void ExportSummary();
+
+// Drops all recorded events and counters.
+void Reset();
+}
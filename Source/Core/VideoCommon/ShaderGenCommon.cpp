@@ -16,7 +16,7 @@ ShaderHostConfig ShaderHostConfig::GetCurrent()
   bits.stereo = g_ActiveConfig.iStereoMode > 0;
   bits.wireframe = g_ActiveConfig.bWireFrame;
   bits.fast_depth_calc = g_ActiveConfig.bFastDepthCalc;
-  bits.bounding_box = g_ActiveConfig.iBBoxMode == BBoxMode::BBoxGPU;
+  bits.bounding_box = g_ActiveConfig.EffectiveBBoxMode() == BBoxMode::BBoxGPU;
   bits.backend_dual_source_blend = g_ActiveConfig.backend_info.bSupportsDualSourceBlend;
   bits.backend_geometry_shaders = g_ActiveConfig.backend_info.bSupportsGeometryShaders;
   bits.backend_early_z = g_ActiveConfig.backend_info.bSupportsEarlyZ;
@@ -123,9 +123,17 @@ public:
   {
     va_list arglist;
     va_start(arglist, fmt);
-    m_buffer += StringFromFormatV(fmt, arglist);
+    StringAppendFormatV(m_buffer, fmt, arglist);
     va_end(arglist);
 }
+  // Appends a raw fragment, bypassing printf parsing entirely; the length
+  // comes from the literal at compile time, so this is a plain memcpy into
+  // the preallocated buffer. Only for fragments without format specifiers.
+  template <size_t N>
+  void Append(const char (&fragment)[N])
+  {
+    m_buffer.append(fragment, N - 1);
+  }
   void clear()
   {
     m_buffer.clear();
@@ -195,7 +203,7 @@ inline void WriteLocation(ShaderCode& object, API_TYPE api_type)
   if (!(api_type & API_D3D9))
     return;
 
-  object.Write("uniform ");
+  object.Append("uniform ");
 }
 
 inline void DeclareUniform(ShaderCode& object, API_TYPE api_type, const u32 num, const char* type, const char* name)
@@ -203,7 +211,7 @@ inline void DeclareUniform(ShaderCode& object, API_TYPE api_type, const u32 num,
   WriteLocation(object, api_type);
   object.Write("%s %s ", type, name);
   WriteRegister(object, api_type, "c", num);
-  object.Write(";\n");
+  object.Append(";\n");
 }
 
 inline void DefineVSOutputStructMember(ShaderCode& object, API_TYPE api_type, const char* qualifier, const char* type, const char* name, int var_index, const char* semantic, int semantic_index = -1)
@@ -217,7 +225,7 @@ inline void DefineVSOutputStructMember(ShaderCode& object, API_TYPE api_type, co
     object.Write("%d", var_index);
 
   if (api_type == API_OPENGL || api_type == API_VULKAN)
-    object.Write(";\n");
+    object.Append(";\n");
   else
   {
     if (semantic_index != -1)
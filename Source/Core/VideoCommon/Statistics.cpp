@@ -2,17 +2,29 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <string>
 #include <utility>
 
-#include "Common/StringUtil.h"
+#include "Common/Timer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 
 Statistics stats;
 
+StatScopedZoneTimer::StatScopedZoneTimer(int* accumulator)
+    : m_accumulator(accumulator), m_start(Common::Timer::GetTimeUs())
+{
+}
+
+StatScopedZoneTimer::~StatScopedZoneTimer()
+{
+  *m_accumulator += static_cast<int>(Common::Timer::GetTimeUs() - m_start);
+}
+
 void Statistics::ResetFrame()
 {
   memset(&thisFrame, 0, sizeof(ThisFrame));
@@ -26,50 +38,68 @@ void Statistics::SwapDL()
   std::swap(stats.thisFrame.numBPLoadsInDL, stats.thisFrame.numBPLoads);
 }
 
-std::string Statistics::ToString()
+// Formats in place into a fixed buffer; the old StringFromFormat-per-line
+// version allocated dozens of temporary strings per overlay frame.
+#define APPEND(...)                                                                                \
+  do                                                                                               \
+  {                                                                                                \
+    if (len < sizeof(buffer))                                                                      \
+      len += snprintf(buffer + len, sizeof(buffer) - len, __VA_ARGS__);                            \
+  } while (0)
+
+void Statistics::AppendToString(std::string* str)
 {
-  std::string str;
+  char buffer[4096];
+  size_t len = 0;
   if (g_ActiveConfig.backend_info.APIType == API_TYPE::API_NONE)
   {
-    str += StringFromFormat("Objects:            %i\n", stats.thisFrame.numDrawnObjects);
-    str += StringFromFormat("Vertices Loaded:    %i\n", stats.thisFrame.numVerticesLoaded);
-    str += StringFromFormat("Triangles Input:    %i\n", stats.thisFrame.numTrianglesIn);
-    str += StringFromFormat("Triangles Rejected: %i\n", stats.thisFrame.numTrianglesRejected);
-    str += StringFromFormat("Triangles Culled:   %i\n", stats.thisFrame.numTrianglesCulled);
-    str += StringFromFormat("Triangles Clipped:  %i\n", stats.thisFrame.numTrianglesClipped);
-    str += StringFromFormat("Triangles Drawn:    %i\n", stats.thisFrame.numTrianglesDrawn);
-    str += StringFromFormat("Rasterized Pix:     %i\n", stats.thisFrame.rasterizedPixels);
-    str += StringFromFormat("TEV Pix In:         %i\n", stats.thisFrame.tevPixelsIn);
-    str += StringFromFormat("TEV Pix Out:        %i\n", stats.thisFrame.tevPixelsOut);
+    APPEND("Objects:            %i\n", stats.thisFrame.numDrawnObjects);
+    APPEND("Vertices Loaded:    %i\n", stats.thisFrame.numVerticesLoaded);
+    APPEND("Triangles Input:    %i\n", stats.thisFrame.numTrianglesIn);
+    APPEND("Triangles Rejected: %i\n", stats.thisFrame.numTrianglesRejected);
+    APPEND("Triangles Culled:   %i\n", stats.thisFrame.numTrianglesCulled);
+    APPEND("Triangles Clipped:  %i\n", stats.thisFrame.numTrianglesClipped);
+    APPEND("Triangles Drawn:    %i\n", stats.thisFrame.numTrianglesDrawn);
+    APPEND("Rasterized Pix:     %i\n", stats.thisFrame.rasterizedPixels);
+    APPEND("TEV Pix In:         %i\n", stats.thisFrame.tevPixelsIn);
+    APPEND("TEV Pix Out:        %i\n", stats.thisFrame.tevPixelsOut);
   }
-  str += StringFromFormat("Textures created: %i\n", stats.numTexturesCreated);
-  str += StringFromFormat("Textures alive: %i\n", stats.numTexturesAlive);
-  str += StringFromFormat("pshaders created: %i\n", stats.numPixelShadersCreated);
-  str += StringFromFormat("pshaders alive: %i\n", stats.numPixelShadersAlive);
-  str += StringFromFormat("vshaders created: %i\n", stats.numVertexShadersCreated);
-  str += StringFromFormat("vshaders alive: %i\n", stats.numVertexShadersAlive);
-  str += StringFromFormat("gshaders created: %i\n", stats.numGeometryShadersCreated);
-  str += StringFromFormat("gshaders alive: %i\n", stats.numGeometryShadersAlive);
-  str += StringFromFormat("hshaders created: %i\n", stats.numHullShadersCreated);
-  str += StringFromFormat("hshaders alive: %i\n", stats.numHullShadersAlive);
-  str += StringFromFormat("dshaders created: %i\n", stats.numDomainShadersCreated);
-  str += StringFromFormat("dshaders alive: %i\n", stats.numDomainShadersAlive);
-  str += StringFromFormat("shaders changes: %i\n", stats.thisFrame.numShaderChanges);
-  str += StringFromFormat("dlists called: %i\n", stats.thisFrame.numDListsCalled);
-  str += StringFromFormat("Primitive joins: %i\n", stats.thisFrame.numPrimitiveJoins);
-  str += StringFromFormat("Draw calls: %i\n", stats.thisFrame.numDrawCalls);
-  str += StringFromFormat("Primitives: %i\n", stats.thisFrame.numPrims);
-  str += StringFromFormat("Primitives (DL): %i\n", stats.thisFrame.numDLPrims);
-  str += StringFromFormat("XF loads: %i\n", stats.thisFrame.numXFLoads);
-  str += StringFromFormat("XF loads (DL): %i\n", stats.thisFrame.numXFLoadsInDL);
-  str += StringFromFormat("CP loads: %i\n", stats.thisFrame.numCPLoads);
-  str += StringFromFormat("CP loads (DL): %i\n", stats.thisFrame.numCPLoadsInDL);
-  str += StringFromFormat("BP loads: %i\n", stats.thisFrame.numBPLoads);
-  str += StringFromFormat("BP loads (DL): %i\n", stats.thisFrame.numBPLoadsInDL);
-  str += StringFromFormat("Vertex streamed: %i kB\n", stats.thisFrame.bytesVertexStreamed / 1024);
-  str += StringFromFormat("Index streamed: %i kB\n", stats.thisFrame.bytesIndexStreamed / 1024);
-  str += StringFromFormat("Uniform streamed: %i kB\n", stats.thisFrame.bytesUniformStreamed / 1024);
-  str += StringFromFormat("Vertex Loaders: %i\n", stats.numVertexLoaders);
+  APPEND("Draw submit: %.2f ms\n", stats.thisFrame.usDrawTime / 1000.0);
+  APPEND("EFB copy submit: %.2f ms\n", stats.thisFrame.usEFBCopyTime / 1000.0);
+  APPEND("Texture load: %.2f ms\n", stats.thisFrame.usTextureLoadTime / 1000.0);
+  APPEND("Post-process: %.2f ms\n", stats.thisFrame.usPostProcessTime / 1000.0);
+  APPEND("Textures created: %i\n", stats.numTexturesCreated);
+  APPEND("Textures alive: %i\n", stats.numTexturesAlive);
+  APPEND("pshaders created: %i\n", stats.numPixelShadersCreated);
+  APPEND("pshaders alive: %i\n", stats.numPixelShadersAlive);
+  APPEND("vshaders created: %i\n", stats.numVertexShadersCreated);
+  APPEND("vshaders alive: %i\n", stats.numVertexShadersAlive);
+  APPEND("gshaders created: %i\n", stats.numGeometryShadersCreated);
+  APPEND("gshaders alive: %i\n", stats.numGeometryShadersAlive);
+  APPEND("hshaders created: %i\n", stats.numHullShadersCreated);
+  APPEND("hshaders alive: %i\n", stats.numHullShadersAlive);
+  APPEND("dshaders created: %i\n", stats.numDomainShadersCreated);
+  APPEND("dshaders alive: %i\n", stats.numDomainShadersAlive);
+  APPEND("shaders changes: %i\n", stats.thisFrame.numShaderChanges);
+  APPEND("dlists called: %i\n", stats.thisFrame.numDListsCalled);
+  APPEND("Primitive joins: %i\n", stats.thisFrame.numPrimitiveJoins);
+  APPEND("Draw calls: %i\n", stats.thisFrame.numDrawCalls);
+  APPEND("Scissor sets skipped: %i\n", stats.thisFrame.numScissorSetsSkipped);
+  APPEND("Viewport sets skipped: %i\n", stats.thisFrame.numViewportSetsSkipped);
+  APPEND("Primitives: %i\n", stats.thisFrame.numPrims);
+  APPEND("Primitives (DL): %i\n", stats.thisFrame.numDLPrims);
+  APPEND("XF loads: %i\n", stats.thisFrame.numXFLoads);
+  APPEND("XF loads (DL): %i\n", stats.thisFrame.numXFLoadsInDL);
+  APPEND("CP loads: %i\n", stats.thisFrame.numCPLoads);
+  APPEND("CP loads (DL): %i\n", stats.thisFrame.numCPLoadsInDL);
+  APPEND("BP loads: %i\n", stats.thisFrame.numBPLoads);
+  APPEND("BP loads (DL): %i\n", stats.thisFrame.numBPLoadsInDL);
+  APPEND("Vertex streamed: %i kB\n", stats.thisFrame.bytesVertexStreamed / 1024);
+  APPEND("Index streamed: %i kB\n", stats.thisFrame.bytesIndexStreamed / 1024);
+  APPEND("Uniform streamed: %i kB\n", stats.thisFrame.bytesUniformStreamed / 1024);
+  APPEND("Vertex Loaders: %i\n", stats.numVertexLoaders);
+
+  str->append(buffer, std::min(len, sizeof(buffer) - 1));
 
   std::string vertex_list;
   VertexLoaderManager::AppendListToString(&vertex_list);
@@ -77,36 +107,37 @@ std::string Statistics::ToString()
   // TODO : at some point text1 just becomes too huge and overflows, we can't even read the added stuff
   // since it gets added at the far bottom of the screen anyway (actually outside the rendering window)
   // we should really reset the list instead of using substr
-  if (vertex_list.size() + str.size() > 8170)
-    vertex_list = vertex_list.substr(0, 8170 - str.size());
-
-  str += vertex_list;
+  if (vertex_list.size() + str->size() > 8170)
+    vertex_list = vertex_list.substr(0, 8170 - str->size());
 
-  return str;
+  *str += vertex_list;
 }
 
 // Is this really needed?
-std::string Statistics::ToStringProj()
+void Statistics::AppendToStringProj(std::string* str)
 {
-  std::string projections;
-
-  projections += "Projection #: X for Raw 6=0 (X for Raw 6!=0)\n\n";
-  projections += StringFromFormat("Projection 0: %f (%f) Raw 0: %f\n", stats.gproj_0, stats.g2proj_0, stats.proj_0);
-  projections += StringFromFormat("Projection 1: %f (%f)\n", stats.gproj_1, stats.g2proj_1);
-  projections += StringFromFormat("Projection 2: %f (%f) Raw 1: %f\n", stats.gproj_2, stats.g2proj_2, stats.proj_1);
-  projections += StringFromFormat("Projection 3: %f (%f)\n\n", stats.gproj_3, stats.g2proj_3);
-  projections += StringFromFormat("Projection 4: %f (%f)\n", stats.gproj_4, stats.g2proj_4);
-  projections += StringFromFormat("Projection 5: %f (%f) Raw 2: %f\n", stats.gproj_5, stats.g2proj_5, stats.proj_2);
-  projections += StringFromFormat("Projection 6: %f (%f) Raw 3: %f\n", stats.gproj_6, stats.g2proj_6, stats.proj_3);
-  projections += StringFromFormat("Projection 7: %f (%f)\n\n", stats.gproj_7, stats.g2proj_7);
-  projections += StringFromFormat("Projection 8: %f (%f)\n", stats.gproj_8, stats.g2proj_8);
-  projections += StringFromFormat("Projection 9: %f (%f)\n", stats.gproj_9, stats.g2proj_9);
-  projections += StringFromFormat("Projection 10: %f (%f) Raw 4: %f\n\n", stats.gproj_10, stats.g2proj_10, stats.proj_4);
-  projections += StringFromFormat("Projection 11: %f (%f) Raw 5: %f\n\n", stats.gproj_11, stats.g2proj_11, stats.proj_5);
-  projections += StringFromFormat("Projection 12: %f (%f)\n", stats.gproj_12, stats.g2proj_12);
-  projections += StringFromFormat("Projection 13: %f (%f)\n", stats.gproj_13, stats.g2proj_13);
-  projections += StringFromFormat("Projection 14: %f (%f)\n", stats.gproj_14, stats.g2proj_14);
-  projections += StringFromFormat("Projection 15: %f (%f)\n", stats.gproj_15, stats.g2proj_15);
-
-  return projections;
+  char buffer[2048];
+  size_t len = 0;
+
+  APPEND("Projection #: X for Raw 6=0 (X for Raw 6!=0)\n\n");
+  APPEND("Projection 0: %f (%f) Raw 0: %f\n", stats.gproj_0, stats.g2proj_0, stats.proj_0);
+  APPEND("Projection 1: %f (%f)\n", stats.gproj_1, stats.g2proj_1);
+  APPEND("Projection 2: %f (%f) Raw 1: %f\n", stats.gproj_2, stats.g2proj_2, stats.proj_1);
+  APPEND("Projection 3: %f (%f)\n\n", stats.gproj_3, stats.g2proj_3);
+  APPEND("Projection 4: %f (%f)\n", stats.gproj_4, stats.g2proj_4);
+  APPEND("Projection 5: %f (%f) Raw 2: %f\n", stats.gproj_5, stats.g2proj_5, stats.proj_2);
+  APPEND("Projection 6: %f (%f) Raw 3: %f\n", stats.gproj_6, stats.g2proj_6, stats.proj_3);
+  APPEND("Projection 7: %f (%f)\n\n", stats.gproj_7, stats.g2proj_7);
+  APPEND("Projection 8: %f (%f)\n", stats.gproj_8, stats.g2proj_8);
+  APPEND("Projection 9: %f (%f)\n", stats.gproj_9, stats.g2proj_9);
+  APPEND("Projection 10: %f (%f) Raw 4: %f\n\n", stats.gproj_10, stats.g2proj_10, stats.proj_4);
+  APPEND("Projection 11: %f (%f) Raw 5: %f\n\n", stats.gproj_11, stats.g2proj_11, stats.proj_5);
+  APPEND("Projection 12: %f (%f)\n", stats.gproj_12, stats.g2proj_12);
+  APPEND("Projection 13: %f (%f)\n", stats.gproj_13, stats.g2proj_13);
+  APPEND("Projection 14: %f (%f)\n", stats.gproj_14, stats.g2proj_14);
+  APPEND("Projection 15: %f (%f)\n", stats.gproj_15, stats.g2proj_15);
+
+  str->append(buffer, std::min(len, sizeof(buffer) - 1));
 }
+
+#undef APPEND
@@ -6,6 +6,8 @@
 
 #include <string>
 
+#include "Common/CommonTypes.h"
+
 struct Statistics
 {
   int numDomainShadersCreated;
@@ -48,6 +50,10 @@ struct Statistics
     int numPrimitiveJoins;
     int numDrawCalls;
 
+    // backend state sets suppressed because the derived state was unchanged
+    int numScissorSetsSkipped;
+    int numViewportSetsSkipped;
+
     int numDListsCalled;
 
     int bytesVertexStreamed;
@@ -64,19 +70,45 @@ struct Statistics
     int numVerticesLoaded;
     int tevPixelsIn;
     int tevPixelsOut;
+
+    // CPU-side submission cost per category of GPU work, in microseconds.
+    // GPU timestamp queries are not available on every backend, so these
+    // measure the time spent handing the work to the API instead.
+    int usDrawTime;
+    int usEFBCopyTime;
+    int usTextureLoadTime;
+    int usPostProcessTime;
   };
   ThisFrame thisFrame;
   void ResetFrame();
   static void SwapDL();
 
-  static std::string ToString();
-  static std::string ToStringProj();
+  // These append with in-place formatting into a fixed buffer; they run
+  // every frame while the overlay is enabled, so they must not allocate.
+  static void AppendToString(std::string* str);
+  static void AppendToStringProj(std::string* str);
 };
 
 extern Statistics stats;
 
 #define STATISTICS
 
+#ifdef STATISTICS
+// Adds the wall-clock time spent in the enclosing scope to a per-frame
+// counter from Statistics::ThisFrame. Use via the STATZONE macro; only one
+// zone may be opened per scope.
+class StatScopedZoneTimer
+{
+public:
+  explicit StatScopedZoneTimer(int* accumulator);
+  ~StatScopedZoneTimer();
+
+private:
+  int* m_accumulator;
+  u64 m_start;
+};
+#endif
+
 #ifdef STATISTICS
 #define INCSTAT(a) (a)++;
 #define DECSTAT(a) (a)--;
@@ -84,8 +116,10 @@ extern Statistics stats;
 #define SETSTAT(a,x) (a)=(int)(x);
 #define SETSTAT_UINT(a,x) (a)=(u32)(x);
 #define SETSTAT_FT(a,x) (a)=(float)(x);
+#define STATZONE(a) StatScopedZoneTimer stat_zone_timer_(&(a));
 #else
 #define INCSTAT(a) ;
 #define ADDSTAT(a,b) ;
 #define SETSTAT(a,x) ;
+#define STATZONE(a) ;
 #endif
@@ -0,0 +1,99 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/StreamBufferRing.h"
+
+#include <algorithm>
+
+#include "Common/MathUtil.h"
+
+/* Shared synchronization code for ring buffers
+*
+* To reduce overhead, the complete buffer is splitted up into SYNC_POINTS chunks.
+* For each of this chunks, there is a fence which checks if this chunk is still in use.
+*
+* As our API allows to alloc more memory then it has to use, we have to catch how much is already written.
+*
+* m_iterator      - writing position
+* m_free_iterator - last position checked if free
+* m_used_iterator - last position known to be written
+*
+* So on alloc, we have to wait for all slots between m_free_iterator and m_iterator (and set m_free_iterator to m_iterator afterwards).
+*
+* We also assume that this buffer is accessed by the GPU between the Unmap and Map function,
+* so we may create the fences on the start of mapping.
+* Some here, new fences for the chunks between m_used_iterator and m_iterator (also update m_used_iterator).
+*
+* As ring buffers have an ugly behavior on rollover, have fun to read this code ;)
+*/
+
+StreamBufferRing::StreamBufferRing(u32 size) : m_size(size), m_bit_per_slot(IntLog2(size / SYNC_POINTS))
+{
+}
+
+StreamBufferRing::~StreamBufferRing() = default;
+
+void StreamBufferRing::CreateFences()
+{
+  for (int i = 0; i < SYNC_POINTS; i++)
+  {
+    m_fences[i] = InsertFence();
+  }
+}
+
+void StreamBufferRing::DeleteFences()
+{
+  for (int i = 0; i < SYNC_POINTS; i++)
+  {
+    if (m_fences[i])
+    {
+      ReleaseFence(m_fences[i]);
+    }
+    m_fences[i] = 0;
+  }
+}
+
+void StreamBufferRing::AllocMemory(u32 size)
+{
+  // insert waiting slots for used memory
+  for (int i = Slot(m_used_iterator); i < Slot(m_iterator); i++)
+  {
+    if (!m_fences[i])
+    {
+      m_fences[i] = InsertFence();
+    }
+  }
+  m_used_iterator = m_iterator;
+  u32 start_fence = Slot(m_free_iterator) + 1;
+  // if buffer is full
+  if (m_iterator + size >= m_size)
+  {
+    // insert waiting slots in unused space at the end of the buffer
+    for (int i = Slot(m_used_iterator); i < SYNC_POINTS; i++)
+    {
+      if (m_fences[i])
+      {
+        ReleaseFence(m_fences[i]);
+      }
+      m_fences[i] = InsertFence();
+    }
+
+    // move to the start
+    m_used_iterator = m_iterator = 0; // offset 0 is always aligned
+
+    // wait for space at the start
+    start_fence = 0;
+  }
+  u32 end_fence = std::min(Slot(m_iterator + size), SYNC_POINTS - 1);
+  for (u32 i = start_fence; i <= end_fence; i++)
+  {
+    if (m_fences[i])
+    {
+      WaitFence(m_fences[i]);
+      ReleaseFence(m_fences[i]);
+      m_fences[i] = 0;
+    }
+  }
+  m_free_iterator = m_iterator + size;
+}
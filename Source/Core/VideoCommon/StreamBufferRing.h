@@ -0,0 +1,58 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+
+// Ring allocation bookkeeping for the backends' streaming buffers.
+//
+// Every backend streams vertex/index/uniform data through a fixed-size fifo
+// that the GPU consumes while the CPU keeps writing ahead, and every backend
+// needs the same bookkeeping to know when a region can be reused: split the
+// buffer into SYNC_POINTS chunks, drop a fence when the write position leaves
+// a chunk, and wait on the fence of a chunk before handing it out again.
+// This class owns that logic; the backend only supplies the three fence
+// primitives. Fences are stored as opaque u64 handles (0 means "no fence"),
+// which is wide enough for a GLsync pointer or any API fence value.
+class StreamBufferRing
+{
+public:
+  virtual ~StreamBufferRing();
+
+protected:
+  explicit StreamBufferRing(u32 size);
+
+  using FenceHandle = u64;
+
+  // Inserts a fence into the command stream and returns its handle.
+  virtual FenceHandle InsertFence() = 0;
+  // Blocks until the given fence has been reached by the GPU.
+  virtual void WaitFence(FenceHandle fence) = 0;
+  // Frees a fence that is no longer needed.
+  virtual void ReleaseFence(FenceHandle fence) = 0;
+
+  void CreateFences();
+  void DeleteFences();
+  void AllocMemory(u32 size);
+
+  static constexpr int SYNC_POINTS = 8;
+  int Slot(u32 x) const
+  {
+    return x >> m_bit_per_slot;
+  }
+
+  const u32 m_size;
+
+  u32 m_iterator = 0;
+  u32 m_used_iterator = 0;
+  u32 m_free_iterator = 0;
+
+private:
+  const int m_bit_per_slot;
+
+  std::array<FenceHandle, SYNC_POINTS> m_fences{};
+};
@@ -17,10 +17,19 @@
 
 alignas(256) TessellationShaderConstants TessellationShaderManager::constants;
 bool TessellationShaderManager::dirty;
+bool TessellationShaderManager::skip_draw;
+
+// Raw inputs the current constants were derived from, so SetConstants can
+// bail out on a few integer compares instead of re-deriving every flush.
+static int s_cached_options[4];
+static u32 s_cached_cull_key;
 
 void TessellationShaderManager::Init()
 {
   memset(&constants, 0, sizeof(constants));
+  s_cached_options[0] = s_cached_options[1] = s_cached_options[2] = s_cached_options[3] = -1;
+  s_cached_cull_key = ~0u;
+  skip_draw = false;
   dirty = true;
 }
 
@@ -34,25 +43,44 @@ void TessellationShaderManager::Dirty()
   dirty = true;
 }
 
+void TessellationShaderManager::SetDrawCoverage(float extent_px)
+{
+  // A negative extent means the sample was unusable (no triangle, or a vertex
+  // behind the projection plane); keep tessellation on rather than guess.
+  skip_draw = extent_px >= 0.0f && extent_px < MIN_DRAW_EXTENT;
+}
+
 void TessellationShaderManager::SetConstants()
 {
-  if (g_ActiveConfig.TessellationEnabled())
+  if (!g_ActiveConfig.TessellationEnabled())
+    return;
+  // The derived parameters depend only on the four tessellation options and on
+  // the host cull configuration, so both halves are memoized on their raw
+  // inputs; in the common case this whole function is a handful of compares.
+  if (s_cached_options[0] != g_ActiveConfig.iTessellationDistance
+    || s_cached_options[1] != g_ActiveConfig.iTessellationMax
+    || s_cached_options[2] != g_ActiveConfig.iTessellationRoundingIntensity
+    || s_cached_options[3] != g_ActiveConfig.iTessellationDisplacementIntensity)
   {
-    float tessmin = 1.0f / ((500000 - float(g_ActiveConfig.iTessellationDistance) * 500.0f) + 0.01f);
-    float tessmax = float(g_ActiveConfig.iTessellationMax);
-    float rounding = float(g_ActiveConfig.iTessellationRoundingIntensity) * 0.01f;
-    float displacement = float(g_ActiveConfig.iTessellationDisplacementIntensity) * 0.01f;
-    if (constants.tessparams[0] != tessmin
-      || constants.tessparams[1] != tessmax
-      || constants.tessparams[2] != rounding
-      || constants.tessparams[3] != displacement)
-    {
-      constants.tessparams[0] = tessmin;
-      constants.tessparams[1] = tessmax;
-      constants.tessparams[2] = rounding;
-      constants.tessparams[3] = displacement;
-      dirty = true;
-    }
+    s_cached_options[0] = g_ActiveConfig.iTessellationDistance;
+    s_cached_options[1] = g_ActiveConfig.iTessellationMax;
+    s_cached_options[2] = g_ActiveConfig.iTessellationRoundingIntensity;
+    s_cached_options[3] = g_ActiveConfig.iTessellationDisplacementIntensity;
+    constants.tessparams[0] = 1.0f / ((500000 - float(s_cached_options[0]) * 500.0f) + 0.01f);
+    constants.tessparams[1] = float(s_cached_options[1]);
+    constants.tessparams[2] = float(s_cached_options[2]) * 0.01f;
+    constants.tessparams[3] = float(s_cached_options[3]) * 0.01f;
+    dirty = true;
+  }
+  // Everything RasterizationState::Generate reads for the cull mode, packed
+  // into one key so the state is only regenerated when an input changed.
+  const u32 cull_key = static_cast<u32>(bpmem.genMode.cullmode.Value())
+    | ((bpmem.blendmode.blendenable.Value() | bpmem.blendmode.subtract.Value() | bpmem.dstalpha.enable.Value()) << 2)
+    | (static_cast<u32>(g_ActiveConfig.eCullMode) << 3)
+    | ((g_ActiveConfig.bTessellationEarlyCulling ? 1u : 0u) << 7);
+  if (cull_key != s_cached_cull_key)
+  {
+    s_cached_cull_key = cull_key;
     RasterizationState state = {};
     state.Generate(bpmem, PrimitiveType::Triangles);
     int cull = state.cullmode.Value() > 0 ? (state.cullmode.Value() == GenMode::CullMode::CULL_FRONT ? 1 : -1) : 0;
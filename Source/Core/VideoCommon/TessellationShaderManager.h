@@ -14,9 +14,23 @@ class PointerWrap;
 class TessellationShaderManager
 {
   static bool dirty;
+  static bool skip_draw;
 public:
+  // The hull shader never partitions an edge into fewer than 4 segments, so a
+  // draw whose triangles project to fewer pixels than that only gains
+  // sub-pixel geometry from tessellation.
+  static constexpr float MIN_DRAW_EXTENT = 4.0f;
+
   static void Init();
   static void Dirty();
+  // Called once per flush with the screen-space extent in pixels of a sample
+  // triangle of the pending draw, before the backends pick their shaders.
+  // Negative means no usable sample; tessellation is then left enabled.
+  static void SetDrawCoverage(float extent_px);
+  static inline bool DrawSkipped()
+  {
+    return skip_draw;
+  }
   static inline bool IsDirty()
   {
     return dirty && g_ActiveConfig.TessellationEnabled();
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -9,8 +10,10 @@
 
 #include "Common/Align.h"
 #include "Common/FileUtil.h"
+#include "Common/FlightRecorder.h"
 #include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
@@ -26,6 +29,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDumpQueue.h"
 #include "VideoCommon/TextureScalerCommon.h"
 #include "VideoCommon/TextureUtil.h"
 #include "VideoCommon/VideoCommon.h"
@@ -77,6 +81,10 @@ TextureCacheBase::TextureCacheBase()
 
 void TextureCacheBase::Invalidate()
 {
+  // Whatever queued these copies is gone too (config change or shutdown), so
+  // drop them instead of executing against a backend that may be tearing
+  // down.
+  m_pending_efb_copies.clear();
   InvalidateAllBindPoints();
   bound_textures.fill(nullptr);
   auto iter = textures_by_address.begin();
@@ -86,15 +94,19 @@ void TextureCacheBase::Invalidate()
     iter = InvalidateTexture(iter);
   }
   textures_by_address.clear();
+  textures_by_range.clear();
   textures_by_hash.clear();
 }
 
 TextureCacheBase::~TextureCacheBase()
 {
+  // Let pending background texture dumps hit the disk before textures go away.
+  TextureDumpQueue::Flush();
   HiresTexture::Shutdown();
   Invalidate();
   texture_pool.clear();
   texture_pool_memory_usage = 0;
+  m_pool_bytes = 0;
   if (TextureCacheBase::temp)
   {
     Common::FreeAlignedMemory(TextureCacheBase::temp);
@@ -153,8 +165,13 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
 }
 
+// Current frame number as last reported to Cleanup(). Used to scope the
+// CalculateHash() memo in TCacheEntry to a single frame.
+static s32 s_hash_memo_frame = 0;
+
 void TextureCacheBase::Cleanup(s32 _frameCount)
 {
+  s_hash_memo_frame = _frameCount;
   s32 texture_kill_threshold = TEXTURE_KILL_THRESHOLD;
   if (texture_pool_memory_usage < (TEXTURE_POOL_MEMORY_LIMIT / 2))
   {
@@ -204,23 +221,146 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
       ++iter;
     }
   }
-  TexPool::iterator iter2 = texture_pool.begin();
-  TexPool::iterator tcend2 = texture_pool.end();
-  while (iter2 != tcend2)
+  TrimTexturePool(_frameCount);
+
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iTexCacheBudgetMB) * 1024 * 1024;
+  if (budget != 0 && texture_pool_memory_usage > budget)
+  {
+    EnforceMemoryBudget(_frameCount);
+  }
+}
+
+// Trims the recycling pool. A short fixed age-out would empty the pool after
+// a few quiet frames, which is exactly when a scene transition needs it: the
+// freed efb copy targets would be recreated through the driver allocator, and
+// those allocations cluster into visible stalls. Instead, pooled textures are
+// retained up to a high-water mark of recent per-frame allocation demand,
+// which ratchets up on bursts and decays over a couple of seconds, with a
+// long fixed age as the backstop.
+void TextureCacheBase::TrimTexturePool(s32 _frameCount)
+{
+  m_pool_high_water -= m_pool_high_water / 64;
+  m_pool_high_water = std::max(m_pool_high_water, m_frame_alloc_bytes);
+  m_frame_alloc_bytes = 0;
+
+  std::vector<TexPool::iterator> by_age;
+  TexPool::iterator iter = texture_pool.begin();
+  while (iter != texture_pool.end())
   {
-    if (iter2->second.frameCount == FRAMECOUNT_INVALID)
+    if (iter->second.frameCount == FRAMECOUNT_INVALID)
     {
-      iter2->second.frameCount = _frameCount;
+      iter->second.frameCount = _frameCount;
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter->second.frameCount)
     {
-      texture_pool_memory_usage -= iter2->second.texture->GetConfig().GetSizeInBytes();
-      iter2 = texture_pool.erase(iter2);
+      const u32 size = iter->second.texture->GetConfig().GetSizeInBytes();
+      texture_pool_memory_usage -= size;
+      m_pool_bytes -= size;
+      iter = texture_pool.erase(iter);
     }
     else
     {
-      ++iter2;
+      by_age.push_back(iter);
+      ++iter;
+    }
+  }
+
+  if (m_pool_bytes <= m_pool_high_water)
+    return;
+
+  // Over the high-water mark: drop the least recently freed textures first.
+  std::sort(by_age.begin(), by_age.end(),
+            [](const TexPool::iterator& a, const TexPool::iterator& b) {
+              return a->second.frameCount < b->second.frameCount;
+            });
+  for (const TexPool::iterator& pool_iter : by_age)
+  {
+    if (m_pool_bytes <= m_pool_high_water)
+      break;
+    const u32 size = pool_iter->second.texture->GetConfig().GetSizeInBytes();
+    texture_pool_memory_usage -= size;
+    m_pool_bytes -= size;
+    texture_pool.erase(pool_iter);
+  }
+}
+
+// Proactively trims the cache back under the configured budget instead of
+// growing until the driver starts paging textures, which costs far more than
+// the eviction does. Pooled textures go first, then upscaled entries are
+// demoted to their native size, then plain textures by LRU; efb copies go
+// last, since their GPU contents are unrecoverable once deleted.
+void TextureCacheBase::EnforceMemoryBudget(s32 _frameCount)
+{
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iTexCacheBudgetMB) * 1024 * 1024;
+
+  const auto trim_pool = [&]() {
+    TexPool::iterator iter = texture_pool.begin();
+    while (texture_pool_memory_usage > budget && iter != texture_pool.end())
+    {
+      const u32 size = iter->second.texture->GetConfig().GetSizeInBytes();
+      texture_pool_memory_usage -= size;
+      m_pool_bytes -= size;
+      iter = texture_pool.erase(iter);
+    }
+  };
+
+  trim_pool();
+  if (texture_pool_memory_usage <= budget)
+    return;
+
+  // Everything not used this frame and not bound is a candidate. Bound
+  // entries must stay resident for tmem cache emulation.
+  std::vector<TexAddrCache::iterator> candidates;
+  for (auto iter = textures_by_address.begin(); iter != textures_by_address.end(); ++iter)
+  {
+    TCacheEntry* entry = iter->second;
+    if (entry->frameCount == FRAMECOUNT_INVALID || entry->frameCount >= _frameCount)
+      continue;
+    if (std::find(bound_textures.begin(), bound_textures.end(), entry) != bound_textures.end())
+      continue;
+    candidates.push_back(iter);
+  }
+
+  const auto eviction_class = [](const TCacheEntry* entry) {
+    // Upscaled textures can be demoted without losing anything the guest
+    // provided, plain textures reload from guest memory, and efb copies are
+    // the last resort.
+    if (entry->is_scaled)
+      return 0;
+    if (!entry->IsEfbCopy())
+      return 1;
+    return 2;
+  };
+  std::sort(candidates.begin(), candidates.end(),
+            [&eviction_class](const TexAddrCache::iterator& a, const TexAddrCache::iterator& b) {
+              const int class_a = eviction_class(a->second);
+              const int class_b = eviction_class(b->second);
+              if (class_a != class_b)
+                return class_a < class_b;
+              return a->second->frameCount < b->second->frameCount;
+            });
+
+  for (const TexAddrCache::iterator& iter : candidates)
+  {
+    if (texture_pool_memory_usage <= budget)
+      break;
+
+    TCacheEntry* entry = iter->second;
+    if (entry->is_scaled && entry->GetConfig().levels == 1)
+    {
+      // Demote instead of evicting: the entry stays usable at native size
+      // (lookups key on guest address and hash, not host dimensions) while
+      // the large texture goes back to the pool, where the trim below
+      // reclaims it. Mipmapped entries are evicted instead, since the
+      // replacement texture only has a base level.
+      ScaleTextureCacheEntryTo(entry, entry->native_width, entry->native_height);
+      entry->is_scaled = false;
+      trim_pool();
+      continue;
     }
+
+    InvalidateTexture(iter);
+    trim_pool();
   }
 }
 
@@ -254,6 +394,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::ApplyPaletteToEntry(TCacheEntry
     decoded_entry->is_efb_copy = false;
     g_texture_cache->LoadLut(tlutfmt, &texMem[tlutaddr], palette_size);
     auto iter = textures_by_address.emplace(entry->addr, decoded_entry);
+    AddToRangeIndex(decoded_entry);
     if (g_texture_cache->Palettize(decoded_entry, entry))
     {
       return decoded_entry;
@@ -295,6 +436,7 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(TextureCacheBase::TCacheEntry* e
     auto config = new_texture->GetConfig();
     // At this point new_texture has the old texture in it,
     // we can potentially reuse this, so let's move it back to the pool
+    m_pool_bytes += config.GetSizeInBytes();
     texture_pool.emplace(config, TexPoolEntry(std::move(new_texture)));
   }
   else
@@ -330,10 +472,9 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u32 tlut
 
   u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
-  auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
-  while (iter.first != iter.second)
+  for (TCacheEntry* entry :
+       FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes))
   {
-    TCacheEntry* entry = iter.first->second;
     if (entry != entry_to_update && entry->IsEfbCopy() && !entry->tmem_only &&
         entry->references.count(entry_to_update) == 0 &&
         entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes) &&
@@ -355,7 +496,6 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u32 tlut
           }
           else
           {
-            ++iter.first;
             continue;
           }
         }
@@ -437,11 +577,9 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u32 tlut
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
-        continue;
+        InvalidateTexture(GetTexCacheIter(entry));
       }
     }
-    ++iter.first;
   }
   return entry_to_update;
 }
@@ -462,7 +600,9 @@ void TextureCacheBase::DumpTexture(TCacheEntry* entry, std::string basename, u32
   std::string filename = szDir + "/" + basename +
                          (TexDecoder::IsCompressed(entry->GetConfig().pcformat) ? ".dds" : ".png");
 
-  if (!File::Exists(filename))
+  // The bloom filter in the dump queue also covers names whose encode is
+  // still queued, so a texture is never read back or encoded twice.
+  if (!TextureDumpQueue::AlreadyDumped(filename))
     entry->texture->Save(filename, level);
 }
 
@@ -487,6 +627,48 @@ void TextureCacheBase::BindTextures()
   }
 }
 
+// Splits the block rows of a linear RGBA32 decode across the thread pool
+// workers, with the video thread decoding the last slice itself and waiting
+// for the rest. Each slice writes its own output rows, so the only shared
+// state is the completion counter.
+static void DecodeRGBA32Parallel(u8* dst, const u8* src, u32 expandedWidth, u32 expandedHeight,
+                                 u32 texformat, u32 tlutaddr, TlutFormat tlutfmt)
+{
+  const u32 bsw = TexDecoder::GetBlockWidthInTexels(texformat);
+  const u32 bsh = TexDecoder::GetBlockHeightInTexels(texformat);
+  const u32 bytes_per_block = (bsw * bsh * TexDecoder::GetTexelSizeInNibbles(texformat)) / 2;
+  const u32 src_stride_per_block_row = (expandedWidth / bsw) * bytes_per_block;
+  const u32 dst_stride_per_block_row = expandedWidth * bsh * sizeof(u32);
+  const u32 block_rows = expandedHeight / bsh;
+  const u32 slices =
+      std::min<u32>(static_cast<u32>(Common::ThreadPool::GetThreadCount()) + 1, block_rows);
+  const u32 block_rows_per_slice = block_rows / slices;
+  std::atomic<u32> finished_slices = { 0 };
+  u32 block_row = 0;
+  for (u32 slice = 0; slice + 1 < slices; slice++)
+  {
+    const u8* slice_src = src + block_row * src_stride_per_block_row;
+    u8* slice_dst = dst + block_row * dst_stride_per_block_row;
+    const u32 slice_height = block_rows_per_slice * bsh;
+    Common::AsyncWorker::ExecuteAsync([=, &finished_slices]()
+    {
+      TexDecoder::Decode(slice_dst, slice_src, expandedWidth, slice_height, texformat, tlutaddr,
+                         tlutfmt, true);
+      finished_slices.fetch_add(1);
+    });
+    block_row += block_rows_per_slice;
+  }
+  // Decode the remainder (including any rounding slack) on the video thread.
+  TexDecoder::Decode(dst + block_row * dst_stride_per_block_row,
+                     src + block_row * src_stride_per_block_row, expandedWidth,
+                     (block_rows - block_row) * bsh, texformat, tlutaddr, tlutfmt, true);
+  u32 loopcount = 0;
+  while (finished_slices.load() < slices - 1)
+  {
+    Common::cYield(loopcount++);
+  }
+}
+
 TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
 {
   // if this stage was not invalidated by changes to texture registers, keep the current texture
@@ -494,6 +676,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
   {
     return ReturnEntry(stage, bound_textures[stage]);
   }
+  STATZONE(stats.thisFrame.usTextureLoadTime);
 
   const FourTexUnits& tex = bpmem.tex[stage >> 2];
   const u32 id = stage & 3;
@@ -803,8 +986,12 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
   // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
   // there's no conversion between formats. In the future this could be extended with a separate
   // shader, however.
+  // Tiny textures stay on the CPU: the upload, dispatch and barrier overhead
+  // of the compute path costs more than the decode itself below this size.
+  constexpr u32 MIN_GPU_DECODE_SIZE = 1024;
   bool decode_on_gpu =
-      !hires_tex && !use_scaling && g_ActiveConfig.UseGPUTextureDecoding() &&
+      !hires_tex && !use_scaling && texture_size >= MIN_GPU_DECODE_SIZE &&
+      g_ActiveConfig.UseGPUTextureDecoding() &&
       g_texture_cache->SupportsGPUTextureDecode(static_cast<TextureFormat>(texformat),
                                                 static_cast<TlutFormat>(tlutfmt)) &&
       !(from_tmem && texformat == GX_TF_RGBA8);
@@ -844,6 +1031,8 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
                         !!hires_tex && hires_tex->has_arbitrary_mips);
   entry->SetHashes(full_hash, tex_hash);
   entry->is_efb_copy = false;
+  // Index the entry only now that its address and size are known.
+  AddToRangeIndex(entry);
 
   // load texture
   if (hires_tex)
@@ -917,6 +1106,14 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
         TexDecoder::DecodeRGBA8FromTmem(reinterpret_cast<u32*>(texturedata), src_data, ptr_odd,
                                         expandedWidth, expandedHeight);
       }
+      else if (PC_TEX_FMT_RGBA32 == config.pcformat && !g_ActiveConfig.bTexFmtOverlayEnable &&
+               expandedWidth >= 128 && expandedHeight >= 128)
+      {
+        // Large linear textures are decoded in parallel; the frame spikes from
+        // EFB-sized or animated textures are dominated by this decode.
+        DecodeRGBA32Parallel(texturedata, src_data, expandedWidth, expandedHeight, texformat,
+                             tlutaddr, static_cast<TlutFormat>(tlutfmt));
+      }
       else
       {
         TexDecoder::Decode(texturedata, src_data, expandedWidth, expandedHeight, texformat,
@@ -987,14 +1184,88 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
 
   INCSTAT(stats.numTexturesCreated);
   SETSTAT(stats.numTexturesAlive, textures_by_address.size());
+  Common::FlightRecorder::Count(Common::FlightRecorder::Counter::TextureUploads);
   entry = DoPartialTextureUpdates(iter->second, tlutaddr, tlutfmt, palette_size);
   return ReturnEntry(stage, entry);
 }
 
+void TextureCacheBase::QueueCopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32 dstStride,
+                                                      bool is_depth_copy,
+                                                      const EFBRectangle& srcRect, bool isIntensity,
+                                                      bool scaleByHalf)
+{
+  PendingEFBCopy copy;
+  copy.dst_addr = dstAddr;
+  copy.dst_format = dstFormat;
+  copy.dst_stride = dstStride;
+  copy.is_depth_copy = is_depth_copy;
+  copy.src_rect = srcRect;
+  copy.is_intensity = isIntensity;
+  copy.scale_by_half = scaleByHalf;
+  copy.src_format = bpmem.zcontrol.pixel_format.Value();
+
+  // Same covered-range math as CopyRenderTargetToTexture().
+  const u32 baseFormat = TexDecoder::GetEfbCopyBaseFormat(dstFormat);
+  const u32 blockH = TexDecoder::GetBlockHeightInTexels(baseFormat);
+  const u32 tex_h = srcRect.GetHeight() / (scaleByHalf ? 2 : 1);
+  copy.covered_range = Common::AlignUpSizePow2(tex_h, blockH) / blockH * dstStride;
+
+  m_pending_efb_copies.push_back(copy);
+}
+
+void TextureCacheBase::FlushEFBCopies()
+{
+  if (m_pending_efb_copies.empty())
+    return;
+
+  if (m_pending_efb_copies.size() > 1)
+  {
+    // Group copies of the same kind so the backends switch encoding
+    // pipelines (and render targets) once per group instead of once per
+    // copy. Reordering is only safe while no two destinations overlap;
+    // with overlap the trigger order decides the final RAM contents.
+    bool overlap = false;
+    for (size_t i = 0; i < m_pending_efb_copies.size() && !overlap; i++)
+    {
+      for (size_t j = i + 1; j < m_pending_efb_copies.size(); j++)
+      {
+        const PendingEFBCopy& a = m_pending_efb_copies[i];
+        const PendingEFBCopy& b = m_pending_efb_copies[j];
+        if (a.dst_addr < b.dst_addr + b.covered_range &&
+            b.dst_addr < a.dst_addr + a.covered_range)
+        {
+          overlap = true;
+          break;
+        }
+      }
+    }
+    if (!overlap)
+    {
+      std::stable_sort(m_pending_efb_copies.begin(), m_pending_efb_copies.end(),
+                       [](const PendingEFBCopy& a, const PendingEFBCopy& b) {
+                         if (a.is_depth_copy != b.is_depth_copy)
+                           return !a.is_depth_copy;
+                         return a.dst_format < b.dst_format;
+                       });
+    }
+  }
+
+  for (const PendingEFBCopy& copy : m_pending_efb_copies)
+  {
+    CopyRenderTargetToTexture(copy.dst_addr, copy.dst_format, copy.dst_stride, copy.is_depth_copy,
+                              copy.src_rect, copy.is_intensity, copy.scale_by_half,
+                              copy.src_format);
+  }
+  m_pending_efb_copies.clear();
+  FlushEFBCopyReadbacks();
+}
+
 void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32 dstStride,
                                                  bool is_depth_copy, const EFBRectangle& srcRect,
-                                                 bool isIntensity, bool scaleByHalf)
+                                                 bool isIntensity, bool scaleByHalf,
+                                                 PEControl::PixelFormat src_format)
 {
+  STATZONE(stats.thisFrame.usEFBCopyTime);
   // Emulation methods:
   //
   // - EFB to RAM:
@@ -1051,7 +1322,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
   ColorMask[0] = ColorMask[1] = ColorMask[2] = ColorMask[3] = 255.0f;
   ColorMask[4] = ColorMask[5] = ColorMask[6] = ColorMask[7] = 1.0f / 255.0f;
   u32 cbufid = -1;
-  auto srcFormat = bpmem.zcontrol.pixel_format.Value();
+  auto srcFormat = src_format;
   bool efbHasAlpha = srcFormat == PEControl::RGBA6_Z24;
 
   if (is_depth_copy)
@@ -1441,20 +1712,17 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
   // TODO: This also invalidates partial overlaps, which we currently don't have a better way
   //       of dealing with.
   bool invalidate_textures = dstStride == bytes_per_row || !copy_to_vram;
-  auto iter = FindOverlappingTextures(dstAddr, covered_range);
-  while (iter.first != iter.second)
+  for (TCacheEntry* entry : FindOverlappingTextures(dstAddr, covered_range))
   {
-    TCacheEntry* entry = iter.first->second;
     if (entry->OverlapsMemoryRange(dstAddr, covered_range))
     {
       if (invalidate_textures)
       {
-        iter.first = InvalidateTexture(iter.first);
+        InvalidateTexture(GetTexCacheIter(entry));
         continue;
       }
       entry->may_have_overlapping_textures = true;
     }
-    ++iter.first;
   }
 
   if (copy_to_vram)
@@ -1495,17 +1763,20 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
       }
 
       textures_by_address.emplace(dstAddr, entry);
+      AddToRangeIndex(entry);
     }
   }
 }
 
 std::unique_ptr<HostTexture> TextureCacheBase::AllocateTexture(const TextureConfig& config)
 {
+  m_frame_alloc_bytes += config.GetSizeInBytes();
   TexPool::iterator iter = FindMatchingTextureFromPool(config);
   std::unique_ptr<HostTexture> entry;
   if (iter != texture_pool.end())
   {
     entry = std::move(iter->second.texture);
+    m_pool_bytes -= config.GetSizeInBytes();
     texture_pool.erase(iter);
   }
   else
@@ -1537,6 +1808,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::AllocateCacheEntry(const Textur
 void TextureCacheBase::DisposeTexture(std::unique_ptr<HostTexture>& texture)
 {
   auto config = texture->GetConfig();
+  m_pool_bytes += config.GetSizeInBytes();
   texture_pool.emplace(config, TexPoolEntry(std::move(texture)));
 }
 
@@ -1549,6 +1821,7 @@ void TextureCacheBase::DisposeCacheEntry(TCacheEntry* entry)
   }
 
   auto config = entry->texture->GetConfig();
+  m_pool_bytes += config.GetSizeInBytes();
   texture_pool.emplace(config, TexPoolEntry(std::move(entry->texture)));
   delete entry;
 }
@@ -1601,25 +1874,54 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter)
       return ++iter;
     }
   }
+  RemoveFromRangeIndex(iter->second);
   DisposeCacheEntry(iter->second);
   return textures_by_address.erase(iter);
 }
 
-std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
+void TextureCacheBase::AddToRangeIndex(TCacheEntry* entry)
+{
+  const u32 last_page = (entry->addr + std::max(entry->size_in_bytes, 1u) - 1) / RANGE_PAGE_SIZE;
+  for (u32 page = entry->addr / RANGE_PAGE_SIZE; page <= last_page; page++)
+    textures_by_range[page].insert(entry);
+}
+
+void TextureCacheBase::RemoveFromRangeIndex(TCacheEntry* entry)
+{
+  const u32 last_page = (entry->addr + std::max(entry->size_in_bytes, 1u) - 1) / RANGE_PAGE_SIZE;
+  for (u32 page = entry->addr / RANGE_PAGE_SIZE; page <= last_page; page++)
+  {
+    auto iter = textures_by_range.find(page);
+    if (iter == textures_by_range.end())
+      continue;
+    iter->second.erase(entry);
+    if (iter->second.empty())
+      textures_by_range.erase(iter);
+  }
+}
+
+std::vector<TextureCacheBase::TCacheEntry*>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
-  // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
-  auto begin = textures_by_address.lower_bound(lower_addr);
-  auto end = textures_by_address.upper_bound(addr + size_in_bytes);
-
-  return std::make_pair(begin, end);
+  // The index holds each entry in every page its memory range touches, so this
+  // only visits the pages the query covers instead of walking
+  // textures_by_address from addr minus the maximal texture size, which
+  // degraded to a scan over most of the cache for small address windows.
+  std::vector<TCacheEntry*> candidates;
+  const u32 first_page = addr / RANGE_PAGE_SIZE;
+  const u32 last_page = (addr + std::max(size_in_bytes, 1u) - 1) / RANGE_PAGE_SIZE;
+  for (auto iter = textures_by_range.lower_bound(first_page);
+       iter != textures_by_range.end() && iter->first <= last_page; ++iter)
+  {
+    for (TCacheEntry* entry : iter->second)
+    {
+      // Entries spanning several queried pages are reported once, through the
+      // first page both they and the query cover.
+      if (std::max(first_page, entry->addr / RANGE_PAGE_SIZE) == iter->first)
+        candidates.push_back(entry);
+    }
+  }
+  return candidates;
 }
 
 u32 TextureCacheBase::TCacheEntry::BytesPerRow() const
@@ -1658,10 +1960,18 @@ void TextureCacheBase::TCacheEntry::SetEfbCopy(u32 stride)
 
 u64 TextureCacheBase::TCacheEntry::CalculateHash() const
 {
+  // Efb copies overlapped by several draws get validated on every lookup;
+  // within one frame the memory cannot have been overwritten by the CPU in a
+  // way we could detect anyway, so hash it at most once per frame.
+  if (cached_hash_frame == s_hash_memo_frame)
+    return cached_hash;
+  cached_hash_frame = s_hash_memo_frame;
+
   u8* ptr = Memory::GetPointer(addr);
   if (memory_stride == BytesPerRow())
   {
-    return GetHash64(ptr, size_in_bytes, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+    cached_hash = GetHash64(ptr, size_in_bytes, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+    return cached_hash;
   }
   else
   {
@@ -1683,6 +1993,7 @@ u64 TextureCacheBase::TCacheEntry::CalculateHash() const
       temp_hash = (temp_hash * 397) ^ GetHash64(ptr, BytesPerRow(), samples_per_row);
       ptr += memory_stride;
     }
+    cached_hash = temp_hash;
     return temp_hash;
   }
 }
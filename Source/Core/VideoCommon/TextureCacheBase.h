@@ -8,6 +8,7 @@
 #include <bitset>
 #include <map>
 #include <memory>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <unordered_map>
@@ -32,7 +33,7 @@ enum TextureCacheParams
   FRAMECOUNT_INVALID = 0,
   TEXTURE_KILL_MULTIPLIER = 2,
   TEXTURE_KILL_THRESHOLD = 120,
-  TEXTURE_POOL_KILL_THRESHOLD = 3,
+  TEXTURE_POOL_KILL_THRESHOLD = 120,
   TEXTURE_POOL_MEMORY_LIMIT = 64 * 1024 * 1024
 };
 
@@ -62,6 +63,11 @@ public:
     bool may_have_overlapping_textures = true;
     bool tmem_only = false;  // indicates that this texture only exists in the tmem cache
 
+    // Frame-granular memo of CalculateHash(), so overlapping lookups in the
+    // same frame validate an efb copy against memory only once.
+    mutable u64 cached_hash = {};
+    mutable s32 cached_hash_frame = -1;
+
     // Keep an iterator to the entry in textures_by_hash, so it does not need to be searched when
     // removing the cache entry
     std::multimap<u64, TCacheEntry*>::iterator textures_by_hash_iter;
@@ -105,6 +111,9 @@ public:
     {
       hash = _hash;
       base_hash = _base_hash;
+      // The reference hash changed, so the memoized memory hash may no longer
+      // describe the data this entry is compared against.
+      cached_hash_frame = -1;
     }
 
     // This texture entry is used by the other entry as a sub-texture
@@ -153,7 +162,13 @@ public:
   virtual bool Palettize(TCacheEntry* entry, const TCacheEntry* base_entry) = 0;
   virtual void CopyEFB(u8* dst, const EFBCopyFormat& format, u32 native_width, u32 bytes_per_row,
     u32 num_blocks_y, u32 memory_stride,
-    bool is_depth_copy, const EFBRectangle& src_rect, bool scale_by_half) = 0;  
+    bool is_depth_copy, const EFBRectangle& src_rect, bool scale_by_half) = 0;
+
+  // Called after a batch of CopyEFB() calls. Backends that kick the
+  // EFB-to-RAM readback asynchronously drain it here, before the CPU can
+  // observe the target memory; synchronous backends keep the no-op.
+  virtual void FlushEFBCopyReadbacks()
+  {}
 
   virtual bool CompileShaders() = 0; // currently only implemented by OGL
   virtual void DeleteShaders() = 0; // currently only implemented by OGL
@@ -164,8 +179,20 @@ public:
   void InvalidateAllBindPoints() { valid_bind_points.reset(); }
   bool IsValidBindPoint(u32 i) const { return valid_bind_points.test(i); }
   virtual void BindTextures();
-  void CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32 dstStride,
+  // Records an efb copy without executing it, so back-to-back copies (shadow
+  // maps, heat haze and the like) batch up and run together in
+  // FlushEFBCopies() instead of breaking the backend's render pass one by
+  // one. Captures the source pixel format, since BP writes may change it
+  // before the flush.
+  void QueueCopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32 dstStride,
     bool is_depth_copy, const EFBRectangle& srcRect, bool isIntensity, bool scaleByHalf);
+  // Executes all queued efb copies. Must run before anything can observe
+  // their results or change the efb: draws, efb clears and pokes, XFB
+  // presents, and the PE finish/token writes the CPU synchronizes against.
+  void FlushEFBCopies();
+  void CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32 dstStride,
+    bool is_depth_copy, const EFBRectangle& srcRect, bool isIntensity, bool scaleByHalf,
+    PEControl::PixelFormat src_format);
   u8* GetTemporalBuffer()
   {
     return temp;
@@ -199,6 +226,22 @@ private:
   virtual void CopyEFBToCacheEntry(TCacheEntry* entry, bool is_depth_copy,
     const EFBRectangle& src_rect, bool scale_by_half,
     unsigned int cbuf_id, const float* colmat, u32 width, u32 height) = 0;
+  // See QueueCopyRenderTargetToTexture().
+  struct PendingEFBCopy
+  {
+    u32 dst_addr;
+    u32 dst_format;
+    u32 dst_stride;
+    bool is_depth_copy;
+    EFBRectangle src_rect;
+    bool is_intensity;
+    bool scale_by_half;
+    PEControl::PixelFormat src_format;
+    // Bytes of guest memory the copy covers; used to rule out destination
+    // overlap before the flush reorders copies.
+    u32 covered_range;
+  };
+
   // Minimal version of TCacheEntry just for TexPool
   struct TexPoolEntry
   {
@@ -214,6 +257,14 @@ private:
   void SetBackupConfig(const VideoConfig& config);
   void ScaleTextureCacheEntryTo(TCacheEntry* entry, u32 new_width, u32 new_height);
   void CheckTempSize(size_t required_size);
+  // Trims the cache down to g_ActiveConfig.iTexCacheBudgetMB when the total
+  // allocated texture memory exceeds it. Called from Cleanup().
+  void EnforceMemoryBudget(s32 _frameCount);
+  // Ages out and trims the recycling pool. Pooled textures are retained up to
+  // a decaying high-water mark of per-frame allocation demand, so scene
+  // transitions refill from the pool instead of the driver allocator. Called
+  // from Cleanup().
+  void TrimTexturePool(s32 _frameCount);
 
   
   TCacheEntry* DoPartialTextureUpdates(TCacheEntry* entry_to_update, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
@@ -228,15 +279,37 @@ private:
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter);
   TCacheEntry* ReturnEntry(u32 stage, TCacheEntry* entry);
 
-  // Return all possible overlapping textures. As addr+size of the textures is not
-  // indexed, this may return false positives.
-  std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
-    FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+  // Return all entries whose memory range touches the pages covered by
+  // [addr, addr + size_in_bytes). The index is page-granular, so callers still
+  // have to check OverlapsMemoryRange() for exact overlap.
+  std::vector<TCacheEntry*> FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+
+  void AddToRangeIndex(TCacheEntry* entry);
+  void RemoveFromRangeIndex(TCacheEntry* entry);
 
   TexAddrCache textures_by_address;
   TexHashCache textures_by_hash;
+
+  // Range of overlapping cache entries indexed by memory page, like the jit
+  // cache's block_range_map. Range invalidations (efb copies, partial
+  // updates) only visit the pages they cover instead of scanning
+  // textures_by_address backwards by the maximal texture size.
+  static constexpr u32 RANGE_PAGE_SIZE = 0x8000;
+  std::map<u32, std::set<TCacheEntry*>> textures_by_range;
+
+  std::vector<PendingEFBCopy> m_pending_efb_copies;
   TexPool texture_pool;
+  // Counts all backend texture memory, not just the pool: it is incremented
+  // when a texture is created and only decremented when one is destroyed,
+  // and textures recycle through the pool in between.
   size_t texture_pool_memory_usage = {};
+  // Bytes currently sitting idle in texture_pool, unlike
+  // texture_pool_memory_usage which also counts live textures.
+  size_t m_pool_bytes = {};
+  // Decaying peak of per-frame AllocateTexture() demand; TrimTexturePool()
+  // keeps up to this many pooled bytes around as warm spares.
+  size_t m_pool_high_water = {};
+  size_t m_frame_alloc_bytes = {};
 
   // Backup configuration values
   struct BackupConfig
@@ -0,0 +1,154 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/ThreadPool.h"
+#include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/TextureDumpQueue.h"
+
+namespace TextureDumpQueue
+{
+struct DumpJob
+{
+  std::vector<u8> data;
+  std::string filename;
+  int row_stride;
+  int width;
+  int height;
+  bool compressed;
+  bool frombgra;
+  DDSCompression format;
+};
+
+// 4 Mbit bloom filter (512 KiB) with three probes per name. For a
+// full-playthrough sized session (~10^5 distinct textures) the false positive
+// rate - a texture silently not dumped - stays well below one in a million.
+static constexpr size_t BLOOM_BITS = 1 << 22;
+static u64 s_bloom[BLOOM_BITS / 64];
+static std::mutex s_bloom_lock;
+
+// Cap on in-flight encodes so a slow disk backs pressure onto the video
+// thread instead of accumulating unbounded pixel copies.
+static constexpr s32 MAX_PENDING_JOBS = 512;
+static std::atomic<s32> s_pending_jobs{ 0 };
+
+static void BloomProbes(const std::string& filename, size_t probes[3])
+{
+  u64 hash = GetHash64(reinterpret_cast<const u8*>(filename.data()),
+    static_cast<u32>(filename.size()), 0);
+  probes[0] = static_cast<size_t>(hash % BLOOM_BITS);
+  probes[1] = static_cast<size_t>((hash >> 21) % BLOOM_BITS);
+  probes[2] = static_cast<size_t>((hash >> 42) % BLOOM_BITS);
+}
+
+static bool BloomTest(const size_t probes[3])
+{
+  std::lock_guard<std::mutex> guard(s_bloom_lock);
+  for (size_t i = 0; i < 3; i++)
+  {
+    if (!(s_bloom[probes[i] / 64] & (u64(1) << (probes[i] & 63))))
+      return false;
+  }
+  return true;
+}
+
+static void BloomSet(const size_t probes[3])
+{
+  std::lock_guard<std::mutex> guard(s_bloom_lock);
+  for (size_t i = 0; i < 3; i++)
+    s_bloom[probes[i] / 64] |= u64(1) << (probes[i] & 63);
+}
+
+bool AlreadyDumped(const std::string& filename)
+{
+  size_t probes[3];
+  BloomProbes(filename, probes);
+  if (BloomTest(probes))
+    return true;
+  // Not dumped this session; it may still be left over from a previous one.
+  if (File::Exists(filename))
+  {
+    BloomSet(probes);
+    return true;
+  }
+  return false;
+}
+
+static void Enqueue(DumpJob&& job)
+{
+  size_t probes[3];
+  BloomProbes(job.filename, probes);
+  BloomSet(probes);
+  u32 loopcount = 0;
+  while (s_pending_jobs.load() >= MAX_PENDING_JOBS)
+  {
+    Common::cYield(loopcount++);
+  }
+  s_pending_jobs.fetch_add(1);
+  Common::AsyncWorker::ExecuteAsync([job = std::move(job)]() {
+    if (job.compressed)
+    {
+      TextureToDDS(job.data.data(), job.row_stride, job.filename, job.width, job.height,
+        job.format);
+    }
+    else
+    {
+      TextureToPng(job.data.data(), job.row_stride, job.filename, job.width, job.height, false,
+        job.frombgra);
+    }
+    s_pending_jobs.fetch_sub(1);
+  });
+}
+
+void QueuePNG(const u8* data, int row_stride, const std::string& filename, int width, int height,
+  bool frombgra)
+{
+  DumpJob job;
+  job.data.resize(static_cast<size_t>(row_stride) * height);
+  std::memcpy(job.data.data(), data, job.data.size());
+  job.filename = filename;
+  job.row_stride = row_stride;
+  job.width = width;
+  job.height = height;
+  job.compressed = false;
+  job.frombgra = frombgra;
+  job.format = DDSCompression::DDSC_DXT3;
+  Enqueue(std::move(job));
+}
+
+void QueueDDS(const u8* data, int row_stride, const std::string& filename, int width, int height,
+  DDSCompression format)
+{
+  // Copy only the block rows TextureToDDS will read; the last row of a mapped
+  // staging buffer may be shorter than row_stride.
+  size_t block_rows = (static_cast<size_t>(height) + 3) >> 2;
+  size_t block_row_size = ((static_cast<size_t>(width) + 3) >> 2) * 16;
+  DumpJob job;
+  job.data.resize((block_rows - 1) * row_stride + block_row_size);
+  std::memcpy(job.data.data(), data, job.data.size());
+  job.filename = filename;
+  job.row_stride = row_stride;
+  job.width = width;
+  job.height = height;
+  job.compressed = true;
+  job.frombgra = false;
+  job.format = format;
+  Enqueue(std::move(job));
+}
+
+void Flush()
+{
+  u32 loopcount = 0;
+  while (s_pending_jobs.load() > 0)
+  {
+    Common::cYield(loopcount++);
+  }
+}
+}
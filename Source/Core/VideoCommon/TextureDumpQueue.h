@@ -0,0 +1,31 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/ImageLoader.h"
+
+// Background encoder for texture dumping. The video thread only pays for a
+// copy of the raw pixels; the PNG/DDS encode and the file write run on the
+// shared thread pool so dumping stays usable during gameplay.
+namespace TextureDumpQueue
+{
+// Returns true if filename was already queued this session or exists on disk.
+// A bloom filter over queued names lets the common already-dumped case skip
+// both the File::Exists stat and the GPU readback in the caller.
+bool AlreadyDumped(const std::string& filename);
+
+// Copy the pixel data and queue the encode. Safe to call with a pointer into
+// a mapped staging buffer; the data is copied before returning.
+void QueuePNG(const u8* data, int row_stride, const std::string& filename, int width, int height,
+  bool frombgra = false);
+void QueueDDS(const u8* data, int row_stride, const std::string& filename, int width, int height,
+  DDSCompression format = DDSCompression::DDSC_DXT3);
+
+// Block until every queued encode has been written out.
+void Flush();
+}
@@ -21,17 +21,23 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cmath>
 #include <xbrz.h>
 
 
 #include "Common/Common.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CPUDetect.h"
 #include "Common/Intrinsics.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
+#include "Core/ConfigManager.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/TextureScalerCommon.h"
 
@@ -50,6 +56,45 @@
 /////////////////////////////////////// Helper Functions (mostly math for parallelization)
 
 namespace {
+
+// Stand-in for the GlobalThreadPool::Loop calls in the PPSSPP original, which
+// were dropped when the scaler was ported: splits the row range [lower, upper)
+// across the thread pool workers, with the video thread working the last
+// slice itself and waiting for the rest. Every kernel invoked through this
+// only reads the source image and writes its own output rows.
+template <typename F>
+void ParallelLoop(F func, int lower, int upper)
+{
+  const int range = upper - lower;
+  const int slices =
+      std::min(static_cast<int>(Common::ThreadPool::GetThreadCount()) + 1, range);
+  if (slices <= 1)
+  {
+    func(lower, upper);
+    return;
+  }
+  const int rows_per_slice = range / slices;
+  std::atomic<u32> finished_slices = { 0 };
+  int l = lower;
+  for (int slice = 0; slice + 1 < slices; slice++)
+  {
+    const int u = l + rows_per_slice;
+    Common::AsyncWorker::ExecuteAsync([=, &finished_slices]()
+    {
+      func(l, u);
+      finished_slices.fetch_add(1);
+    });
+    l = u;
+  }
+  // Work the remainder (including any rounding slack) on the video thread.
+  func(l, upper);
+  u32 loopcount = 0;
+  while (finished_slices.load() < static_cast<u32>(slices - 1))
+  {
+    Common::cYield(loopcount++);
+  }
+}
+
 //////////////////////////////////////////////////////////////////// Various image processing
 
 #define R(_col) ((_col>> 0)&0xFF)
@@ -1632,6 +1677,74 @@ bool TextureScaler::IsEmptyOrFlat(u32* data, int pixels)
   return true;
 }
 
+namespace
+{
+// Inputs above this size are cheap enough to rescale relative to what their
+// scaled output would cost to store; almost all GameCube/Wii textures fit.
+constexpr int CACHE_MAX_INPUT_PIXELS = 256 * 256;
+// Total budget for cached results, so the cache file (and its in-memory
+// mirror) cannot grow without bound across sessions.
+constexpr size_t CACHE_MAX_TOTAL_BYTES = 512 * 1024 * 1024;
+
+class TextureScalerCacheReader : public LinearDiskCacheReader<TextureScalerCacheKey, u32>
+{
+public:
+  TextureScalerCacheReader(std::map<TextureScalerCacheKey, std::vector<u32>>* entries,
+    size_t* bytes)
+    : m_entries(entries), m_bytes(bytes)
+  {}
+
+  void Read(const TextureScalerCacheKey& key, const u32* value, u32 value_size) override
+  {
+    (*m_entries)[key].assign(value, value + value_size);
+    *m_bytes += value_size * sizeof(u32);
+  }
+
+private:
+  std::map<TextureScalerCacheKey, std::vector<u32>>* m_entries;
+  size_t* m_bytes;
+};
+}
+
+void TextureScaler::SyncDiskCache(u32 config)
+{
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  std::string filename = File::GetUserPath(D_CACHE_IDX) +
+    StringFromFormat("texscale-%s-%08x.cache", game_id.c_str(), config);
+  if (filename == m_disk_cache_filename)
+    return;
+
+  // First use, or the scaler configuration changed mid-session.
+  m_disk_cache.Close();
+  m_disk_cache_entries.clear();
+  m_disk_cache_bytes = 0;
+
+  if (!File::Exists(File::GetUserPath(D_CACHE_IDX)))
+    File::CreateDir(File::GetUserPath(D_CACHE_IDX));
+
+  TextureScalerCacheReader reader(&m_disk_cache_entries, &m_disk_cache_bytes);
+  m_disk_cache.OpenAndRead(filename, reader);
+  m_disk_cache_filename = filename;
+}
+
+u32* TextureScaler::LookupDiskCache(const TextureScalerCacheKey& key)
+{
+  auto it = m_disk_cache_entries.find(key);
+  if (it == m_disk_cache_entries.end())
+    return nullptr;
+  return it->second.data();
+}
+
+void TextureScaler::InsertDiskCache(const TextureScalerCacheKey& key, const u32* data,
+  u32 pixel_count)
+{
+  if (m_disk_cache_bytes + pixel_count * sizeof(u32) > CACHE_MAX_TOTAL_BYTES)
+    return;
+  m_disk_cache_entries[key].assign(data, data + pixel_count);
+  m_disk_cache_bytes += pixel_count * sizeof(u32);
+  m_disk_cache.Append(key, data, pixel_count);
+}
+
 u32* TextureScaler::Scale(u32* data, int width, int height)
 {
   // prevent processing empty or flat textures (this happens a lot in some games)
@@ -1645,6 +1758,25 @@ u32* TextureScaler::Scale(u32* data, int width, int height)
   double t_start = real_time_now();
 #endif
   int factor = g_ActiveConfig.iTexScalingFactor;
+
+  // Check the persistent result cache first; a warm cache turns rescaling a
+  // title's textures on a later boot into a plain memory copy.
+  const u32 cache_config = (g_ActiveConfig.iTexScalingType << 8) | (factor << 1) |
+    (g_ActiveConfig.bTexDeposterize ? 1 : 0);
+  const bool cacheable = width * height <= CACHE_MAX_INPUT_PIXELS;
+  TextureScalerCacheKey cache_key = {};
+  if (cacheable)
+  {
+    SyncDiskCache(cache_config);
+    cache_key.hash = GetHash64(reinterpret_cast<u8*>(data), width * height * sizeof(u32), 0);
+    cache_key.width = width;
+    cache_key.height = height;
+    cache_key.config = cache_config;
+    u32* cached = LookupDiskCache(cache_key);
+    if (cached)
+      return cached;
+  }
+
   //bufInput.resize(width*height); // used to store the input image image if it needs to be reformatted
   bufOutput.resize(width*height*factor*factor); // used to store the upscaled image
   u32 *inputBuf = data;
@@ -1694,6 +1826,10 @@ u32* TextureScaler::Scale(u32* data, int width, int height)
   default:
     ERROR_LOG(VIDEO, "Unknown scaling type: %d", g_ActiveConfig.iTexScalingType);
   }
+
+  if (cacheable)
+    InsertDiskCache(cache_key, outputBuf, width * height * factor * factor);
+
 #ifdef SCALING_MEASURE_TIME
   if (width*height > 64 * 64 * factor*factor)
   {
@@ -1708,30 +1844,41 @@ u32* TextureScaler::Scale(u32* data, int width, int height)
 void TextureScaler::ScaleXBRZ(int factor, u32* source, u32* dest, int width, int height)
 {
   xbrz::ScalerCfg cfg;
-  //GlobalThreadPool::Loop(std::bind(&xbrz::scale, factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, placeholder::_1, placeholder::_2), 0, height);
-  xbrz::scale(factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, 0, height);
+  // xBRZ supports row-sliced operation directly via yFirst/yLast.
+  ParallelLoop([=](int l, int u)
+  {
+    xbrz::scale(factor, source, dest, width, height, xbrz::ColorFormat::ARGB, cfg, l, u);
+  }, 0, height);
 }
 
 void TextureScaler::ScaleBilinear(int factor, u32* source, u32* dest, int width, int height)
 {
   bufTmp1.resize(width*height*factor);
   u32 *tmpBuf = bufTmp1.data();
-  //GlobalThreadPool::Loop(std::bind(&bilinearH, factor, source, tmpBuf, width, placeholder::_1, placeholder::_2), 0, height);
-  //GlobalThreadPool::Loop(std::bind(&bilinearV, factor, tmpBuf, dest, width, 0, height, placeholder::_1, placeholder::_2), 0, height);
-  bilinearH(factor, source, tmpBuf, width, 0, height);
-  bilinearV(factor, tmpBuf, dest, width, 0, height, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    bilinearH(factor, source, tmpBuf, width, l, u);
+  }, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    bilinearV(factor, tmpBuf, dest, width, 0, height, l, u);
+  }, 0, height);
 }
 
 void TextureScaler::ScaleBicubicBSpline(int factor, u32* source, u32* dest, int width, int height)
 {
-  //GlobalThreadPool::Loop(std::bind(&scaleBicubicBSpline, factor, source, dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-  scaleBicubicBSpline(factor, source, dest, width, height, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    scaleBicubicBSpline(factor, source, dest, width, height, l, u);
+  }, 0, height);
 }
 
 void TextureScaler::ScaleBicubicMitchell(int factor, u32* source, u32* dest, int width, int height)
 {
-  //GlobalThreadPool::Loop(std::bind(&scaleBicubicMitchell, factor, source, dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-  scaleBicubicMitchell(factor, source, dest, width, height, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    scaleBicubicMitchell(factor, source, dest, width, height, l, u);
+  }, 0, height);
 }
 
 void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, int height, bool bicubic)
@@ -1748,10 +1895,14 @@ void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, i
   bufTmp1.resize(width*height);
   bufTmp2.resize(width*height*factor*factor);
   bufTmp3.resize(width*height*factor*factor);
-  //GlobalThreadPool::Loop(std::bind(&generateDistanceMask, source, bufTmp1.data(), width, height, placeholder::_1, placeholder::_2), 0, height);
-  //GlobalThreadPool::Loop(std::bind(&convolve3x3, bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, placeholder::_1, placeholder::_2), 0, height);
-  generateDistanceMask(source, bufTmp1.data(), width, height, 0, height);
-  convolve3x3(bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    generateDistanceMask(source, bufTmp1.data(), width, height, l, u);
+  }, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    convolve3x3(bufTmp1.data(), bufTmp2.data(), KERNEL_SPLAT, width, height, l, u);
+  }, 0, height);
 
   ScaleBilinear(factor, bufTmp2.data(), bufTmp3.data(), width, height);
   // mask C is now in bufTmp3
@@ -1765,8 +1916,10 @@ void TextureScaler::ScaleHybrid(int factor, u32* source, u32* dest, int width, i
 
   // Now we can mix it all together
   // The factor 8192 was found through practical testing on a variety of textures
-  //GlobalThreadPool::Loop(std::bind(&mix, dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, placeholder::_1, placeholder::_2), 0, height*factor);
-  mix(dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, 0, height*factor);
+  ParallelLoop([=](int l, int u)
+  {
+    mix(dest, bufTmp2.data(), bufTmp3.data(), 8192, width*factor, l, u);
+  }, 0, height*factor);
 }
 
 void TextureScaler::ScaleJinc(int factor, u32* source, u32* dest, int width, int height)
@@ -1808,12 +1961,22 @@ void TextureScaler::ScaleDDTSharp(int factor, u32* source, u32* dest, int width,
 void TextureScaler::DePosterize(u32* source, u32* dest, int width, int height)
 {
   bufTmp3.resize(width*height);
-  //GlobalThreadPool::Loop(std::bind(&deposterizeH, source, bufTmp3.data(), width, placeholder::_1, placeholder::_2), 0, height);
-  //GlobalThreadPool::Loop(std::bind(&deposterizeV, bufTmp3.data(), dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-  //GlobalThreadPool::Loop(std::bind(&deposterizeH, dest, bufTmp3.data(), width, placeholder::_1, placeholder::_2), 0, height);
-  //GlobalThreadPool::Loop(std::bind(&deposterizeV, bufTmp3.data(), dest, width, height, placeholder::_1, placeholder::_2), 0, height);
-  deposterizeH(source, bufTmp3.data(), width, 0, height);
-  deposterizeV(bufTmp3.data(), dest, width, height, 0, height);
-  deposterizeH(dest, bufTmp3.data(), width, 0, height);
-  deposterizeV(bufTmp3.data(), dest, width, height, 0, height);
+  // Each pass joins before the next starts, since H and V passes read the
+  // other's full output.
+  ParallelLoop([=](int l, int u)
+  {
+    deposterizeH(source, bufTmp3.data(), width, l, u);
+  }, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    deposterizeV(bufTmp3.data(), dest, width, height, l, u);
+  }, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    deposterizeH(dest, bufTmp3.data(), width, l, u);
+  }, 0, height);
+  ParallelLoop([=](int l, int u)
+  {
+    deposterizeV(bufTmp3.data(), dest, width, height, l, u);
+  }, 0, height);
 }
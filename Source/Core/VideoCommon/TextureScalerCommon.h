@@ -18,10 +18,32 @@
 #pragma once
 
 #include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
 #include "Common/MemoryUtil.h"
 
+#include <map>
+#include <string>
+#include <tuple>
 #include <vector>
 
+// Key for the on-disk cache of scaled texture results. The config field
+// packs the scaler type, factor and deposterize flag, so a stale entry can
+// never be returned for a different configuration even though those values
+// are also part of the cache file name.
+struct TextureScalerCacheKey
+{
+  u64 hash;
+  u32 width;
+  u32 height;
+  u32 config;
+
+  bool operator<(const TextureScalerCacheKey& other) const
+  {
+    return std::tie(hash, width, height, config) <
+      std::tie(other.hash, other.width, other.height, other.config);
+  }
+};
+
 class TextureScaler
 {
 public:
@@ -53,6 +75,17 @@ private:
 
   bool IsEmptyOrFlat(u32* data, int pixels);
 
+  // Persistent cache of scaled results, so a second boot of the same title
+  // streams pre-scaled textures off disk instead of recomputing them.
+  void SyncDiskCache(u32 config);
+  u32* LookupDiskCache(const TextureScalerCacheKey& key);
+  void InsertDiskCache(const TextureScalerCacheKey& key, const u32* data, u32 pixel_count);
+
+  LinearDiskCache<TextureScalerCacheKey, u32> m_disk_cache;
+  std::map<TextureScalerCacheKey, std::vector<u32>> m_disk_cache_entries;
+  std::string m_disk_cache_filename;
+  size_t m_disk_cache_bytes = 0;
+
   // depending on the factor and texture sizes, these can get pretty large 
   // maximum is (100 MB total for a 512 by 512 texture with scaling factor 5 and hybrid scaling)
   // of course, scaling factor 5 is totally silly anyway
@@ -3,14 +3,19 @@
 // Refer to the license.txt file included.
 // Modified for Ishiiruka by Tino
 
+#include <algorithm>
 #include <map>
 #include <memory>
-#include <unordered_map>
 
 
 #include "Core/ConfigManager.h"
 #include "Core/HW/Memmap.h"
 
+#include "Common/BitSet.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/FlatHashMap.h"
+#include "Common/Intrinsics.h"
 #include "Common/ThreadPool.h"
 #include "Common/StringUtil.h"
 
@@ -26,7 +31,9 @@
 static VertexLoaderBase *s_cpu_loaders[8];
 static std::string last_game_code;
 
-typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
+// Flat so the per-draw UID lookup probes adjacent buckets instead of
+// chasing unordered_map nodes.
+typedef Common::FlatHashMap<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 
 namespace VertexLoaderManager
 {
@@ -70,14 +77,14 @@ void AppendListToString(std::string *dest)
   std::vector<entry> entries;
 
   size_t total_size = 0;
-  for (VertexLoaderMap::const_iterator iter = s_vertex_loader_map.begin(); iter != s_vertex_loader_map.end(); ++iter)
-  {
-    entry e;
-    iter->second->AppendToString(&e.text);
-    e.num_verts = iter->second->m_numLoadedVertices;
-    entries.push_back(e);
-    total_size += e.text.size() + 1;
-  }
+  s_vertex_loader_map.ForEach(
+      [&](const VertexLoaderUID&, const std::unique_ptr<VertexLoaderBase>& loader) {
+        entry e;
+        loader->AppendToString(&e.text);
+        e.num_verts = loader->m_numLoadedVertices;
+        entries.push_back(e);
+        total_size += e.text.size() + 1;
+      });
   sort(entries.begin(), entries.end());
   dest->reserve(dest->size() + total_size);
   for (std::vector<entry>::const_iterator iter = entries.begin(); iter != entries.end(); ++iter)
@@ -86,6 +93,75 @@ void AppendListToString(std::string *dest)
   }
 }
 
+void DumpLoadersCode()
+{
+  std::vector<codeentry> entries;
+  s_vertex_loader_map.ForEach(
+      [&](const VertexLoaderUID& uid, const std::unique_ptr<VertexLoaderBase>& loader) {
+        if (loader->m_numLoadedVertices == 0)
+          return;
+        codeentry e;
+        e.name = loader->GetName();
+        e.conf = StringFromFormat("0x%08xu, 0x%08xu, 0x%08xu, 0x%08xu", uid.GetElement(0),
+                                  uid.GetElement(1), uid.GetElement(2), uid.GetElement(3));
+        e.num_verts = loader->m_numLoadedVertices;
+        e.hash = StringFromFormat("%llu", static_cast<unsigned long long>(uid.GetHash()));
+        entries.push_back(e);
+      });
+  if (entries.empty())
+    return;
+  sort(entries.begin(), entries.end());
+
+  const std::string class_name = "G_" + last_game_code + "_pvt";
+
+  File::IOFile header(File::GetUserPath(D_DUMP_IDX) + class_name + ".h", "w");
+  if (!header)
+    return;
+  fprintf(header.GetHandle(), "// Copyright 2013 Dolphin Emulator Project\n"
+                              "// Licensed under GPLv2+\n"
+                              "// Refer to the license.txt file included.\n"
+                              "// Added for Ishiiruka by Tino\n"
+                              "#pragma once\n"
+                              "#include <map>\n"
+                              "#include \"VideoCommon/NativeVertexFormat.h\"\n"
+                              "class %s\n"
+                              "{\n"
+                              "public:\n"
+                              "  static void Initialize(std::map<u64, TCompiledLoaderFunction> "
+                              "&pvlmap);\n"
+                              "};\n",
+          class_name.c_str());
+
+  File::IOFile source(File::GetUserPath(D_DUMP_IDX) + class_name + ".cpp", "w");
+  if (!source)
+    return;
+  fprintf(source.GetHandle(), "// Copyright 2013 Dolphin Emulator Project\n"
+                              "// Licensed under GPLv2+\n"
+                              "// Refer to the license.txt file included.\n\n"
+                              "#include \"VideoCommon/%s.h\"\n"
+                              "#include \"VideoCommon/VertexLoader_Template.h\"\n\n\n\n"
+                              "void %s::Initialize(std::map<u64, TCompiledLoaderFunction> "
+                              "&pvlmap)\n{\n",
+          class_name.c_str(), class_name.c_str());
+  for (const codeentry& e : entries)
+  {
+    fprintf(source.GetHandle(), "  // %s\n// num_verts= %llu\n"
+                                "#if _M_SSE >= 0x301\n"
+                                "  if (cpu_info.bSSSE3)\n"
+                                "  {\n"
+                                "    pvlmap[%s] = TemplatedLoader<0x301, %s>;\n"
+                                "  }\n"
+                                "  else\n"
+                                "#endif\n"
+                                "  {\n"
+                                "    pvlmap[%s] = TemplatedLoader<0, %s>;\n"
+                                "  }\n",
+            e.name.c_str(), static_cast<unsigned long long>(e.num_verts), e.hash.c_str(),
+            e.conf.c_str(), e.hash.c_str(), e.conf.c_str());
+  }
+  fprintf(source.GetHandle(), "}\n");
+}
+
 void Init()
 {
   MarkAllDirty();
@@ -96,6 +172,8 @@ void Init()
 
 void Shutdown()
 {
+  if (g_ActiveConfig.bDumpVertexLoaders)
+    DumpLoadersCode();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
@@ -208,8 +286,8 @@ NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl)
 inline VertexLoaderBase *GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxAttr)
 {
   VertexLoaderUID uid(VtxDesc, VtxAttr);
-  VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-  if (iter == s_vertex_loader_map.end())
+  std::unique_ptr<VertexLoaderBase>* entry = s_vertex_loader_map.find(uid);
+  if (entry == nullptr)
   {
     s_vertex_loader_map[uid] = VertexLoaderBase::CreateVertexLoader(VtxDesc, VtxAttr);
     VertexLoaderBase* loader = s_vertex_loader_map[uid].get();
@@ -222,7 +300,7 @@ inline VertexLoaderBase *GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxA
     INCSTAT(stats.numVertexLoaders);
     return loader;
   }
-  return iter->second.get();
+  return entry->get();
 }
 
 void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &vertexsize, u32 &components)
@@ -241,6 +319,43 @@ inline void UpdateLoader(const VertexLoaderParameters &parameters)
   g_main_cp_state.last_id = parameters.vtx_attr_group;
 }
 
+// Indexed position fetches are scattered reads through the array base and
+// miss the cache on most vertices of a fresh draw; walk the indices ahead of
+// the decode loop so the referenced lines are already in flight by the time
+// the loader needs them.
+static void PrefetchPositionArray(const VertexLoaderParameters &parameters, u32 vertex_size)
+{
+#ifdef _M_X86
+  const TVtxDesc &desc = *parameters.VtxDesc;
+  if (!(desc.Position & 2))
+    return;
+  // The position index sits behind the matrix index bytes at the start of
+  // the vertex.
+  const u32 index_offset = BitSet32(static_cast<u32>(desc.Hex & 0x1FF)).Count();
+  const u8 *src = parameters.source + index_offset;
+  const u8 *array_base = cached_arraybases[ARRAY_POSITION];
+  const u32 stride = g_main_cp_state.array_strides[ARRAY_POSITION];
+  // Don't walk giant draws completely, the early lines would be evicted again
+  // before the loader reached them.
+  const u32 count = std::min<u32>(parameters.count, 4096);
+  if (desc.Position == INDEX8)
+  {
+    for (u32 i = 0; i < count; i++, src += vertex_size)
+    {
+      _mm_prefetch(reinterpret_cast<const char*>(array_base + src[0] * stride), _MM_HINT_T0);
+    }
+  }
+  else
+  {
+    for (u32 i = 0; i < count; i++, src += vertex_size)
+    {
+      const u32 index = (src[0] << 8) | src[1];
+      _mm_prefetch(reinterpret_cast<const char*>(array_base + index * stride), _MM_HINT_T0);
+    }
+  }
+#endif
+}
+
 bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &writesize)
 {
   if (parameters.needloaderrefresh)
@@ -272,6 +387,7 @@ bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &wri
   VertexShaderManager::SetVertexFormat(loader->m_native_components);
   g_vertex_manager->PrepareForAdditionalData(parameters.primitive, parameters.count, loader->m_native_stride);
   parameters.destination = g_vertex_manager->GetCurrentBufferPointer();
+  PrefetchPositionArray(parameters, loader->m_VertexSize);
   s32 finalcount = loader->RunVertices(parameters);
   writesize = loader->m_native_stride * finalcount;
   IndexGenerator::AddIndices(parameters.primitive, finalcount);
@@ -37,6 +37,13 @@ void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &v
 // For debugging
 void AppendListToString(std::string *dest);
 
+// Writes G_<gameid>_pvt.h/.cpp sources to the dump directory covering every
+// vertex format combination used this session, in the same form as the
+// precompiled loader files in VideoCommon. Run with DumpVertexLoaders enabled,
+// then drop the pair into the build and register it in
+// VertexLoaderCompiled::Initialize() to keep the title off the generic loader.
+void DumpLoadersCode();
+
 void UpdateVertexArrayPointers();
 
 NativeVertexFormat* GetCurrentVertexFormat();
@@ -54,7 +54,9 @@ VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att) :
   if (!IsInitialized())
     return;
 
-  AllocCodeSpace(1024);
+  // The unrolled direct path emits the vertex body three times (two for the
+  // main loop, one for the odd-count remainder), so leave it enough room.
+  AllocCodeSpace(4096);
   ClearCodeSpace();
   GenerateVertexLoader();
   WriteProtect();
@@ -413,8 +415,97 @@ void VertexLoaderX64::GenerateVertexLoader()
   if (m_VtxDesc.Position & MASKINDEXED)
     XOR(32, R(skipped_reg), R(skipped_reg));
 
+  // With every attribute read directly from the vertex there are no index
+  // array lookups and no skip-vertex branch, so the body is pure straight-line
+  // code with immediate offsets. In that case decode two vertices per
+  // iteration to halve the loop and pointer-update overhead.
+  const u64 indexed_attributes =
+    (m_VtxDesc.Position | m_VtxDesc.Normal | m_VtxDesc.Color0 | m_VtxDesc.Color1 |
+      m_VtxDesc.Tex0Coord | m_VtxDesc.Tex1Coord | m_VtxDesc.Tex2Coord | m_VtxDesc.Tex3Coord |
+      m_VtxDesc.Tex4Coord | m_VtxDesc.Tex5Coord | m_VtxDesc.Tex6Coord | m_VtxDesc.Tex7Coord) &
+    MASKINDEXED;
+  if (!indexed_attributes)
+  {
+    const u8* loop_start = GetCodePtr();
+    CMP(32, R(count_reg), Imm8(2));
+    FixupBranch tail = J_CC(CC_B, true);
+    GenerateVertexBody();
+    GenerateVertexBody();
+    ADD(64, R(dst_reg), Imm32(m_dst_ofs));
+    ADD(64, R(src_reg), Imm32(m_src_ofs));
+    SUB(32, R(count_reg), Imm8(2));
+    JMP(loop_start, true);
+
+    SetJumpTarget(tail);
+    TEST(32, R(count_reg), R(count_reg));
+    FixupBranch done = J_CC(CC_Z, true);
+    // The remainder body regenerates the native declaration with the offsets
+    // of a single vertex, undoing the shifted values the second unrolled body
+    // wrote into it.
+    m_src_ofs = 0;
+    m_dst_ofs = 0;
+    GenerateVertexBody();
+    SetJumpTarget(done);
+
+    // Get the original count.
+    POP(32, R(ABI_RETURN));
+    ABI_PopRegistersAndAdjustStack(regs, 0);
+    RET();
+
+    m_native_stride = m_dst_ofs;
+    m_VertexSize = m_src_ofs;
+    m_native_vtx_decl.stride = m_native_stride;
+    return;
+  }
+
   const u8* loop_start = GetCodePtr();
 
+  GenerateVertexBody();
+
+  // Prepare for the next vertex.
+
+  ADD(64, R(dst_reg), Imm32(m_dst_ofs));
+  const u8* cont = GetCodePtr();
+  ADD(64, R(src_reg), Imm32(m_src_ofs));
+
+  SUB(32, R(count_reg), Imm8(1));
+  J_CC(CC_NZ, loop_start);
+
+  // Get the original count.
+  POP(32, R(ABI_RETURN));
+
+  ABI_PopRegistersAndAdjustStack(regs, 0);
+
+  if (m_VtxDesc.Position & MASKINDEXED)
+  {
+    SUB(32, R(ABI_RETURN), R(skipped_reg));
+    RET();
+
+    SetJumpTarget(m_skip_vertex);
+    ADD(32, R(skipped_reg), Imm8(1));
+    JMP(cont);
+  }
+  else
+  {
+    RET();
+  }
+  m_native_stride = m_dst_ofs;
+  m_VertexSize = m_src_ofs;
+  m_native_vtx_decl.stride = m_native_stride;
+}
+
+void VertexLoaderX64::GenerateVertexBody()
+{
+  const u64 tc[8] = {
+      m_VtxDesc.Tex0Coord, m_VtxDesc.Tex1Coord, m_VtxDesc.Tex2Coord, m_VtxDesc.Tex3Coord,
+      m_VtxDesc.Tex4Coord, m_VtxDesc.Tex5Coord, m_VtxDesc.Tex6Coord, m_VtxDesc.Tex7Coord,
+  };
+  const X64Reg treg[8] = {
+      XMM4, XMM5, XMM6, XMM7,
+      XMM8, XMM9, XMM10, XMM11,
+  };
+
+  const u32 vertex_src_base = m_src_ofs;
   if (m_VtxDesc.PosMatIdx)
   {
     m_src_ofs++;
@@ -506,7 +597,7 @@ void VertexLoaderX64::GenerateVertexLoader()
   }
   if (m_VtxDesc.PosMatIdx)
   {
-    MOVZX(32, 8, scratch1, MDisp(src_reg, 0));
+    MOVZX(32, 8, scratch1, MDisp(src_reg, vertex_src_base));
   }
   else
   {
@@ -519,42 +610,11 @@ void VertexLoaderX64::GenerateVertexLoader()
   m_native_vtx_decl.posmtx.offset = m_dst_ofs;
   m_native_vtx_decl.posmtx.type = FORMAT_UBYTE;
   m_dst_ofs += sizeof(u32);
-
-  // Prepare for the next vertex.
-
-  ADD(64, R(dst_reg), Imm32(m_dst_ofs));
-  const u8* cont = GetCodePtr();
-  ADD(64, R(src_reg), Imm32(m_src_ofs));
-
-  SUB(32, R(count_reg), Imm8(1));
-  J_CC(CC_NZ, loop_start);
-
-  // Get the original count.
-  POP(32, R(ABI_RETURN));
-
-  ABI_PopRegistersAndAdjustStack(regs, 0);
-
-  if (m_VtxDesc.Position & MASKINDEXED)
-  {
-    SUB(32, R(ABI_RETURN), R(skipped_reg));
-    RET();
-
-    SetJumpTarget(m_skip_vertex);
-    ADD(32, R(skipped_reg), Imm8(1));
-    JMP(cont);
-  }
-  else
-  {
-    RET();
-  }
-  m_native_stride = m_dst_ofs;
-  m_VertexSize = m_src_ofs;
-  m_native_vtx_decl.stride = m_native_stride;
 }
 
 bool VertexLoaderX64::EnvironmentIsSupported()
 {
-  return g_ActiveConfig.iBBoxMode == BBoxGPU || !BoundingBox::active;
+  return g_ActiveConfig.EffectiveBBoxMode() == BBoxGPU || !BoundingBox::active;
 }
 
 int VertexLoaderX64::RunVertices(const VertexLoaderParameters &parameters)
@@ -21,4 +21,5 @@ private:
   int ReadVertex(Gen::OpArg data, u64 attribute, int format, int count_in, int count_out, bool dequantize, AttributeFormat* native_format, Gen::X64Reg scaling_register);
   void ReadColor(Gen::OpArg data, u64 attribute, int format);
   void GenerateVertexLoader();
+  void GenerateVertexBody();
 };
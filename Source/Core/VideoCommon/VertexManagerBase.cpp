@@ -2,11 +2,14 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
+#include <cfloat>
 #include <cmath>
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/Profiler.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/BPStructs.h"
@@ -206,9 +209,26 @@ static void SetSamplerState(u32 index, bool custom_tex, bool has_arbitrary_mips,
 
 void VertexManagerBase::DoFlush()
 {
+  TRACE_EVENT("VertexManagerBase::Flush");
+  // The draw changes the efb, so any deferred efb copies have to read it first.
+  g_texture_cache->FlushEFBCopies();
   // loading a state will invalidate BP, so check for it
   NativeVertexFormat* current_vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
   g_video_backend->CheckInvalidState();
+  // Sample the pending draw's screen coverage before shader selection, so the
+  // backends keep the plain triangle pipeline for draws that tessellation
+  // could only turn into sub-pixel geometry.
+  if (g_ActiveConfig.TessellationEnabled())
+  {
+    float coverage = -1.0f;
+    if (m_current_primitive_type == PrimitiveType::Triangles && !m_cull_all
+      && IndexGenerator::GetIndexLen() >= 3)
+    {
+      coverage = CalculateScreenCoverage(current_vertex_format->GetVertexDeclaration(),
+        g_vertex_manager->GetIndexBuffer() + IndexGenerator::GetIndexLen() - 3);
+    }
+    TessellationShaderManager::SetDrawCoverage(coverage);
+  }
   g_vertex_manager->PrepareShaders(m_current_primitive_type, VertexLoaderManager::g_current_components, xfmem, bpmem);
 #if defined(_DEBUG) || defined(DEBUGFAST)
   PRIM_LOG("frame%d:\n texgen=%d, numchan=%d, dualtex=%d, ztex=%d, cole=%d, alpe=%d, ze=%d", g_ActiveConfig.iSaveTargetId, xfmem.numTexGen.numTexGens,
@@ -345,11 +365,14 @@ void VertexManagerBase::DoFlush()
     bpmem.blendmode.alphaupdate &&
     bpmem.zcontrol.pixel_format == PEControl::RGBA6_Z24;
 
-  if (PerfQueryBase::ShouldEmulate())
-    g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
-  g_vertex_manager->vFlush(useDstAlpha);
-  if (PerfQueryBase::ShouldEmulate())
-    g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
+  {
+    STATZONE(stats.thisFrame.usDrawTime);
+    if (PerfQueryBase::ShouldEmulate())
+      g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
+    g_vertex_manager->vFlush(useDstAlpha);
+    if (PerfQueryBase::ShouldEmulate())
+      g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
+  }
 
   GFX_DEBUGGER_PAUSE_AT(NEXT_FLUSH, true);
 
@@ -406,3 +429,30 @@ void VertexManagerBase::CalculateZSlope(const PortableVertexDeclaration &vert_de
   m_zslope.f0 = out[2] - (out[0] * m_zslope.dfdx + out[1] * m_zslope.dfdy);
   m_zslope_refresh_required = true;
 }
+
+// Measures the draw's screen footprint by projecting one sample triangle (the
+// last one, the same sample CalculateZSlope uses) and returning the longest
+// side of its screen-space bounding box in pixels. Returns a negative value
+// when a vertex lands behind the projection plane, since the projected
+// positions are meaningless there.
+float VertexManagerBase::CalculateScreenCoverage(const PortableVertexDeclaration &vert_decl, const u16* indices) const
+{
+  float minc[2] = { FLT_MAX, FLT_MAX };
+  float maxc[2] = { -FLT_MAX, -FLT_MAX };
+  for (u32 i = 0; i < 3; ++i)
+  {
+    float vout[4];
+    u8* vtx_ptr = m_pBaseBufferPointer + vert_decl.stride * indices[i];
+    VertexShaderManager::TransformToClipSpace(vtx_ptr, vert_decl, vout);
+    if (vout[3] <= 0.0f)
+      return -1.0f;
+    float w = 1.0f / vout[3];
+    float x = vout[0] * w * xfmem.viewport.wd;
+    float y = vout[1] * w * xfmem.viewport.ht;
+    minc[0] = std::min(minc[0], x);
+    minc[1] = std::min(minc[1], y);
+    maxc[0] = std::max(maxc[0], x);
+    maxc[1] = std::max(maxc[1], y);
+  }
+  return std::max(maxc[0] - minc[0], maxc[1] - minc[1]);
+}
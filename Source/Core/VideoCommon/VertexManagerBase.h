@@ -86,6 +86,7 @@ protected:
   bool m_cull_all = false;
 
   void CalculateZSlope(const PortableVertexDeclaration &vert_decl, const u16* indices);
+  float CalculateScreenCoverage(const PortableVertexDeclaration &vert_decl, const u16* indices) const;
   virtual void vDoState(PointerWrap& p) {}
   virtual void ResetBuffer(u32 stride) = 0;
 
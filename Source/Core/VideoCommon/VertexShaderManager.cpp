@@ -470,7 +470,7 @@ void VertexShaderManager::SetConstants()
       pixel_size_x,
       pixel_size_y);
     // This is so implementation-dependent that we can't have it here.
-    g_renderer->SetViewport();
+    g_renderer->SetViewportIfChanged();
 
     // Update projection if the viewport isn't 1:1 useable
     if (!g_ActiveConfig.backend_info.bSupportsOversizedViewports)
@@ -14,6 +14,7 @@
 #include "Core/Movie.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -21,6 +22,7 @@ VideoConfig g_Config;
 VideoConfig g_ActiveConfig;
 static std::mutex config_mutex;
 static bool s_has_registered_callback = false;
+static u64 s_last_config_generation = 0;
 
 void UpdateActiveConfig()
 {
@@ -28,6 +30,8 @@ void UpdateActiveConfig()
     Movie::SetGraphicsConfig();
   std::unique_lock<std::mutex> config_lock(config_mutex);
   g_ActiveConfig = g_Config;
+  // Several config settings feed pixel shader UID generation.
+  MarkPixelShaderUidDirty();
 }
 void VideoConfig::ClearFormats()
 {
@@ -56,6 +60,7 @@ VideoConfig::VideoConfig()
   bTexDeposterize = false;
   iTexScalingType = 0;
   iTexScalingFactor = 2;
+  iTexCacheBudgetMB = 1024;
   backend_info.bSupportsMultithreading = false;
   backend_info.bSupportsInternalResolutionFrameDumps = false;
   bEnableValidationLayer = false;
@@ -79,6 +84,14 @@ void VideoConfig::Refresh()
     s_has_registered_callback = true;
   }
   std::unique_lock<std::mutex> config_lock(config_mutex);
+
+  // Every read below resolves through the layer maps; skip the whole pass
+  // when no layer has actually changed since the last refresh.
+  const u64 config_generation = Config::GetGeneration();
+  if (config_generation == s_last_config_generation)
+    return;
+  s_last_config_generation = config_generation;
+
   bVSync = Config::Get(Config::GFX_VSYNC);
   iAdapter = Config::Get(Config::GFX_ADAPTER);
 
@@ -87,7 +100,9 @@ void VideoConfig::Refresh()
   bCrop = Config::Get(Config::GFX_CROP);
   bUseXFB = Config::Get(Config::GFX_USE_XFB);
   bUseRealXFB = Config::Get(Config::GFX_USE_REAL_XFB);
+  bPresentSkipGovernor = Config::Get(Config::GFX_PRESENT_SKIP_GOVERNOR);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  iTexCacheBudgetMB = Config::Get(Config::GFX_TEXTURE_CACHE_MEMORY_BUDGET_MB);
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
   bShowNetPlayPing = Config::Get(Config::GFX_SHOW_NETPLAY_PING);
   bShowNetPlayMessages = Config::Get(Config::GFX_SHOW_NETPLAY_MESSAGES);
@@ -95,6 +110,7 @@ void VideoConfig::Refresh()
   bOverlayStats = Config::Get(Config::GFX_OVERLAY_STATS);
   bOverlayProjStats = Config::Get(Config::GFX_OVERLAY_PROJ_STATS);
   bDumpTextures = Config::Get(Config::GFX_DUMP_TEXTURES);
+  bDumpVertexLoaders = Config::Get(Config::GFX_DUMP_VERTEX_LOADERS);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bHiresMaterialMaps = Config::Get(Config::GFX_HIRES_MATERIAL_MAPS);
   bHiresMaterialMapsBuild = Config::Get(Config::GFX_HIRES_MATERIAL_MAPS_BUILD);  
@@ -280,6 +296,10 @@ void VideoConfig::VerifyValidity()
   {
     iBBoxMode = BBoxCPU;
   }
+  if (iTexCacheBudgetMB < 0)
+  {
+    iTexCacheBudgetMB = 0;
+  }
   if (iTexScalingFactor < 2)
   {
     iTexScalingFactor = 2;
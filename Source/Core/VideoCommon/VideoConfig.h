@@ -117,6 +117,7 @@ struct VideoConfig final
   bool bCrop;   // Aspect ratio controls.
   bool bUseXFB;
   bool bUseRealXFB;
+  bool bPresentSkipGovernor;  // Skip alternate presents when GPU-bound, see Renderer::Swap.
 
   // OpenCL/OpenMP
   bool bEnableOpenCL;
@@ -163,7 +164,9 @@ struct VideoConfig final
   bool bDisableFog;
 
   // Utility
-  bool bDumpTextures;  
+  bool bDumpTextures;
+  // Write G_<gameid>_pvt sources for the vertex formats used this session.
+  bool bDumpVertexLoaders;
   bool bHiresTextures;
   bool bHiresMaterialMaps;
   bool bHiresMaterialMapsBuild;
@@ -194,6 +197,9 @@ struct VideoConfig final
   bool bSkipEFBCopyToRam;
   bool bCopyEFBScaled;
   int iSafeTextureCache_ColorSamples;
+  // Total host texture memory (cache entries + recycling pool) the texture
+  // cache tries to stay under, in megabytes. 0 disables the budget.
+  int iTexCacheBudgetMB;
   ProjectionHackConfig phack;
   float fAspectRatioHackW, fAspectRatioHackH;
   bool bEnablePixelLighting;
@@ -349,6 +355,13 @@ struct VideoConfig final
     return backend_info.bSupportsHighPrecisionFrameBuffer && bHPFrameBuffer;
   }
   inline bool UseVertexRounding() const { return bVertexRounding && iEFBScale != SCALE_1X; }
+  // The bounding box mode that is actually in effect. Backends without
+  // shader-side accumulation (GL drivers lacking SSBO support) degrade the
+  // GPU mode to the speculative CPU path instead of leaving the box stale.
+  inline int EffectiveBBoxMode() const
+  {
+    return iBBoxMode == BBoxGPU && !backend_info.bSupportsBBox ? BBoxCPU : iBBoxMode;
+  }
 };
 
 extern VideoConfig g_Config;
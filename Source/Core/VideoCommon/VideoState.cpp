@@ -11,6 +11,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/TessellationShaderManager.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -31,6 +32,10 @@ void VideoCommon_DoState(PointerWrap &p)
   p.Do(xfmem);
   p.DoMarker("XF Memory");
 
+  // Loading a state bypasses the BP/XF write handlers entirely.
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    MarkPixelShaderUidDirty();
+
   // Texture decoder
   p.DoArray(texMem);
   p.DoMarker("texMem");
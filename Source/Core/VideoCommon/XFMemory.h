@@ -291,5 +291,6 @@ struct XFMemory
 extern XFMemory xfmem;
 
 void LoadXFReg(u32 transferSize, u32 address);
+void LoadXFRegBlock(u32 firstTransferSize, u32 baseAddress, u32 totalSize);
 void LoadIndexedXF(u32 val, int array);
 void PreprocessIndexedXF(u32 val, int refarray);
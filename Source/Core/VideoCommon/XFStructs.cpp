@@ -15,6 +15,7 @@
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
 
@@ -57,7 +58,10 @@ inline void XFRegWritten(int transferSize, u32 baseAddress)
 
     case XFMEM_SETNUMCHAN:
       if (xfmem.numChan.numColorChans != (newValue & 3))
+      {
         g_vertex_manager->Flush();
+        MarkPixelShaderUidDirty();
+      }
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
@@ -92,7 +96,10 @@ inline void XFRegWritten(int transferSize, u32 baseAddress)
     case XFMEM_SETCHAN0_ALPHA: // Channel Alpha
     case XFMEM_SETCHAN1_ALPHA:
       if (((u32*)&xfmem)[address - 0x1000] != (newValue & 0x7fff))
+      {
         g_vertex_manager->Flush();
+        MarkPixelShaderUidDirty();
+      }
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
@@ -135,6 +142,9 @@ inline void XFRegWritten(int transferSize, u32 baseAddress)
       g_vertex_manager->Flush();
       VertexShaderManager::SetProjectionChanged();
       GeometryShaderManager::SetProjectionChanged();
+      // The projection type feeds the pixel shader UID through the forced
+      // lighting path.
+      MarkPixelShaderUidDirty();
       nextAddress = XFMEM_SETPROJECTION + 7;
       break;
 
@@ -250,6 +260,31 @@ void LoadXFReg(u32 transferSize, u32 baseAddress)
   }
 }
 
+// Applies a coalesced run of contiguous XF memory load commands as one block
+// write with a single flush and dirty-range notification. The decoder has
+// already verified that every command stays below the register area, that the
+// addresses are contiguous and that all headers and payloads are buffered;
+// the first command's header has already been consumed.
+void LoadXFRegBlock(u32 firstTransferSize, u32 baseAddress, u32 totalSize)
+{
+  XFMemWritten(totalSize, baseAddress);
+
+  u32 address = baseAddress;
+  u32 transferSize = firstTransferSize;
+  while (true)
+  {
+    OpcodeDecoder::DataReadU32xFuncs[transferSize - 1](&((u32*)&xfmem)[address]);
+    address += transferSize;
+    if (address == baseAddress + totalSize)
+      break;
+
+    // Skip the next command's header and pick up its transfer size.
+    const u32 cmd2 = g_VideoData.Peek<u32>(1);
+    g_VideoData.ReadSkip(1 + OpcodeDecoder::GX_LOAD_XF_REG_SIZE);
+    transferSize = ((cmd2 >> 16) & 15) + 1;
+  }
+}
+
 // TODO - verify that it is correct. Seems to work, though.
 void LoadIndexedXF(u32 val, int refarray)
 {
@@ -0,0 +1,123 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMap.h"
+
+// Differential test against std::unordered_map across several rehashes
+// (initial capacity is 64, growth at 75% load).
+TEST(FlatHashMap, GrowthMatchesUnorderedMap)
+{
+  Common::FlatHashMap<u32, u32> map;
+  std::unordered_map<u32, u32> ref;
+
+  u32 x = 1;
+  for (u32 i = 0; i < 5000; ++i)
+  {
+    x = x * 1664525 + 1013904223;
+    // Narrowed keys so some inserts overwrite existing entries.
+    const u32 key = x % 4096;
+    map[key] = i;
+    ref[key] = i;
+  }
+
+  EXPECT_EQ(ref.size(), map.size());
+  for (const auto& entry : ref)
+  {
+    u32* value = map.find(entry.first);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(entry.second, *value);
+  }
+}
+
+TEST(FlatHashMap, CollisionHeavyKeys)
+{
+  // Every key probes from the same bucket, so lookups and rehashes have to
+  // walk (and preserve) long collision runs.
+  struct ConstantHash
+  {
+    size_t operator()(const u32&) const { return 0x12345678; }
+  };
+
+  Common::FlatHashMap<u32, u32, ConstantHash> map;
+  for (u32 i = 0; i < 300; ++i)
+    map[i] = i * 3;
+
+  EXPECT_EQ(300u, map.size());
+  for (u32 i = 0; i < 300; ++i)
+  {
+    u32* value = map.find(i);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(i * 3, *value);
+  }
+  for (u32 i = 300; i < 400; ++i)
+    EXPECT_EQ(nullptr, map.find(i));
+}
+
+TEST(FlatHashMap, MoveOnlyValuesSurviveRehash)
+{
+  Common::FlatHashMap<u32, std::unique_ptr<u32>> map;
+  for (u32 i = 0; i < 200; ++i)
+    map[i] = std::make_unique<u32>(i);
+
+  EXPECT_EQ(200u, map.size());
+  for (u32 i = 0; i < 200; ++i)
+  {
+    std::unique_ptr<u32>* value = map.find(i);
+    ASSERT_NE(nullptr, value);
+    ASSERT_NE(nullptr, value->get());
+    EXPECT_EQ(i, **value);
+  }
+}
+
+TEST(FlatHashMap, SubscriptReturnsExistingEntry)
+{
+  Common::FlatHashMap<u32, u32> map;
+  map[5] = 1;
+  map[5] = 2;
+  EXPECT_EQ(1u, map.size());
+  ASSERT_NE(nullptr, map.find(5));
+  EXPECT_EQ(2u, *map.find(5));
+
+  // Absent keys are default-constructed, like std::map.
+  EXPECT_EQ(0u, map[6]);
+  EXPECT_EQ(2u, map.size());
+}
+
+TEST(FlatHashMap, ForEachVisitsEveryEntryOnce)
+{
+  Common::FlatHashMap<u32, u32> map;
+  for (u32 i = 0; i < 1000; ++i)
+    map[i] = i + 7;
+
+  std::unordered_map<u32, u32> seen;
+  map.ForEach([&seen](const u32& key, const u32& value) { seen[key]++; EXPECT_EQ(key + 7, value); });
+
+  EXPECT_EQ(1000u, seen.size());
+  for (const auto& entry : seen)
+    EXPECT_EQ(1u, entry.second);
+}
+
+TEST(FlatHashMap, ClearAndReuse)
+{
+  Common::FlatHashMap<u32, u32> map;
+  for (u32 i = 0; i < 100; ++i)
+    map[i] = i;
+
+  map.clear();
+  EXPECT_EQ(0u, map.size());
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(nullptr, map.find(50));
+
+  for (u32 i = 0; i < 50; ++i)
+    map[i] = i * 2;
+  EXPECT_EQ(50u, map.size());
+  ASSERT_NE(nullptr, map.find(25));
+  EXPECT_EQ(50u, *map.find(25));
+}
@@ -0,0 +1,181 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+constexpr char CACHE_VERSION[] = "linear-disk-cache-test";
+
+// Collects everything OpenAndRead hands back so tests can compare it against
+// what was appended.
+struct CacheCapture : LinearDiskCacheReader<u32, u8>
+{
+  void Read(const u32& key, const u8* value, u32 value_size) override
+  {
+    entries.emplace_back(key, std::vector<u8>(value, value + value_size));
+  }
+
+  std::vector<std::pair<u32, std::vector<u8>>> entries;
+};
+
+std::vector<u8> MakeValue(u32 key)
+{
+  std::vector<u8> value((key % 97) + 1);
+  for (size_t i = 0; i < value.size(); ++i)
+    value[i] = static_cast<u8>(key * 31 + i);
+  return value;
+}
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = File::CreateTempDir();
+    ASSERT_FALSE(m_dir.empty());
+    m_filename = m_dir + "/cache.bin";
+  }
+
+  void TearDown() override { File::DeleteDirRecursively(m_dir); }
+
+  // Creates the cache file (if needed) and appends records [first, first + count).
+  void AppendRecords(u32 first, u32 count)
+  {
+    LinearDiskCache<u32, u8> cache;
+    CacheCapture ignored;
+    cache.OpenAndRead(m_filename, ignored, CACHE_VERSION);
+    for (u32 key = first; key < first + count; ++key)
+    {
+      const std::vector<u8> value = MakeValue(key);
+      cache.Append(key, value.data(), static_cast<u32>(value.size()));
+    }
+    cache.Sync();
+    cache.Close();
+  }
+
+  u32 ReadRecords(CacheCapture* capture)
+  {
+    LinearDiskCache<u32, u8> cache;
+    const u32 count = cache.OpenAndRead(m_filename, *capture, CACHE_VERSION);
+    cache.Close();
+    return count;
+  }
+
+  // Asserts the capture holds exactly keys [0, count) with the expected values.
+  static void ExpectRecords(const CacheCapture& capture, u32 count)
+  {
+    ASSERT_EQ(count, capture.entries.size());
+    for (u32 key = 0; key < count; ++key)
+    {
+      EXPECT_EQ(key, capture.entries[key].first);
+      EXPECT_EQ(MakeValue(key), capture.entries[key].second);
+    }
+  }
+
+  // On-disk offset of record index for the key/value scheme above:
+  // 48 byte header, then value_size/checksum/key/value/entry_number records.
+  static u64 RecordOffset(u32 index)
+  {
+    u64 offset = 48;
+    for (u32 key = 0; key < index; ++key)
+      offset += 4 * sizeof(u32) + (key % 97) + 1;
+    return offset;
+  }
+
+  void Truncate(u64 bytes_off_the_end)
+  {
+    File::IOFile file(m_filename, "r+b");
+    ASSERT_TRUE(file.IsOpen());
+    ASSERT_TRUE(file.Resize(file.GetSize() - bytes_off_the_end));
+  }
+
+  void FlipByte(u64 offset)
+  {
+    File::IOFile file(m_filename, "r+b");
+    ASSERT_TRUE(file.IsOpen());
+    u8 byte;
+    ASSERT_TRUE(file.Seek(offset, SEEK_SET) && file.ReadBytes(&byte, 1));
+    byte ^= 0xff;
+    ASSERT_TRUE(file.Seek(offset, SEEK_SET) && file.WriteBytes(&byte, 1));
+  }
+
+  std::string m_dir;
+  std::string m_filename;
+};
+
+TEST_F(LinearDiskCacheTest, RoundTrip)
+{
+  AppendRecords(0, 20);
+
+  CacheCapture capture;
+  EXPECT_EQ(20u, ReadRecords(&capture));
+  ExpectRecords(capture, 20);
+
+  // Appending after a reopen continues the entry numbering.
+  AppendRecords(20, 5);
+  CacheCapture more;
+  EXPECT_EQ(25u, ReadRecords(&more));
+  ExpectRecords(more, 25);
+}
+
+TEST_F(LinearDiskCacheTest, TruncatedTailIsDiscarded)
+{
+  AppendRecords(0, 20);
+  Truncate(3);
+
+  // The torn final record is dropped; everything before it survives.
+  CacheCapture capture;
+  EXPECT_EQ(19u, ReadRecords(&capture));
+  ExpectRecords(capture, 19);
+
+  // The rebuild compacted the torn tail away and round-trips.
+  EXPECT_EQ(RecordOffset(19), File::GetSize(m_filename));
+  CacheCapture again;
+  EXPECT_EQ(19u, ReadRecords(&again));
+  ExpectRecords(again, 19);
+}
+
+TEST_F(LinearDiskCacheTest, CorruptPayloadKeepsPrecedingRecords)
+{
+  AppendRecords(0, 10);
+  // Flip a byte inside record 4's value; its checksum no longer matches, so
+  // it and everything after it is rejected.
+  FlipByte(RecordOffset(4) + 3 * sizeof(u32) + 1);
+
+  CacheCapture capture;
+  EXPECT_EQ(4u, ReadRecords(&capture));
+  ExpectRecords(capture, 4);
+
+  EXPECT_EQ(RecordOffset(4), File::GetSize(m_filename));
+  CacheCapture again;
+  EXPECT_EQ(4u, ReadRecords(&again));
+  ExpectRecords(again, 4);
+}
+
+TEST_F(LinearDiskCacheTest, CorruptHeaderRebuildsEmpty)
+{
+  AppendRecords(0, 10);
+  FlipByte(1);  // inside the magic
+
+  CacheCapture capture;
+  EXPECT_EQ(0u, ReadRecords(&capture));
+  EXPECT_TRUE(capture.entries.empty());
+
+  // The rebuilt file is usable again.
+  AppendRecords(0, 3);
+  CacheCapture again;
+  EXPECT_EQ(3u, ReadRecords(&again));
+  ExpectRecords(again, 3);
+}
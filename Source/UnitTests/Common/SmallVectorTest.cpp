@@ -0,0 +1,143 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "Common/SmallVector.h"
+
+namespace
+{
+// Counts constructions and destructions so the tests can assert that spilling
+// from inline to heap storage neither leaks nor double-destroys elements.
+struct Counted
+{
+  explicit Counted(int value_) : value(value_) { ++ctor_count; }
+  Counted(const Counted& other) : value(other.value) { ++ctor_count; }
+  Counted(Counted&& other) : value(other.value) { ++ctor_count; }
+  ~Counted() { ++dtor_count; }
+
+  int value;
+  static int ctor_count;
+  static int dtor_count;
+};
+
+int Counted::ctor_count = 0;
+int Counted::dtor_count = 0;
+}  // namespace
+
+TEST(SmallVector, SpillsFromInlineToHeap)
+{
+  Common::SmallVector<u32, 4> v;
+  EXPECT_TRUE(v.empty());
+
+  for (u32 i = 0; i < 4; ++i)
+    v.push_back(i);
+  const u32* inline_data = v.data();
+
+  // Growing past the inline capacity must move to the heap and keep the
+  // existing elements intact.
+  for (u32 i = 4; i < 100; ++i)
+    v.push_back(i);
+  EXPECT_NE(inline_data, v.data());
+  EXPECT_EQ(100u, v.size());
+  for (u32 i = 0; i < 100; ++i)
+    EXPECT_EQ(i, v[i]);
+}
+
+TEST(SmallVector, SpillDoesNotLeakOrDoubleDestroy)
+{
+  Counted::ctor_count = 0;
+  Counted::dtor_count = 0;
+  {
+    Common::SmallVector<Counted, 2> v;
+    for (int i = 0; i < 50; ++i)
+      v.emplace_back(i);
+    for (int i = 0; i < 50; ++i)
+      EXPECT_EQ(i, v[i].value);
+  }
+  EXPECT_EQ(Counted::ctor_count, Counted::dtor_count);
+}
+
+TEST(SmallVector, MoveOnlyElements)
+{
+  Common::SmallVector<std::unique_ptr<u32>, 2> v;
+  for (u32 i = 0; i < 20; ++i)
+    v.push_back(std::make_unique<u32>(i));
+
+  EXPECT_EQ(20u, v.size());
+  for (u32 i = 0; i < 20; ++i)
+  {
+    ASSERT_NE(nullptr, v[i].get());
+    EXPECT_EQ(i, *v[i]);
+  }
+}
+
+TEST(SmallVector, CopyAndMove)
+{
+  Common::SmallVector<u32, 4> v;
+  for (u32 i = 0; i < 10; ++i)
+    v.push_back(i);
+
+  Common::SmallVector<u32, 4> copy(v);
+  EXPECT_EQ(10u, copy.size());
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(i, copy[i]);
+
+  Common::SmallVector<u32, 4> moved(std::move(copy));
+  EXPECT_EQ(10u, moved.size());
+  EXPECT_TRUE(copy.empty());
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(i, moved[i]);
+
+  Common::SmallVector<u32, 4> assigned;
+  assigned.push_back(99);
+  assigned = v;
+  EXPECT_EQ(10u, assigned.size());
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(i, assigned[i]);
+
+  Common::SmallVector<u32, 4> move_assigned;
+  move_assigned = std::move(moved);
+  EXPECT_EQ(10u, move_assigned.size());
+  EXPECT_TRUE(moved.empty());
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(i, move_assigned[i]);
+}
+
+TEST(SmallVector, ClearAndReuse)
+{
+  Common::SmallVector<u32, 4> v;
+  for (u32 i = 0; i < 30; ++i)
+    v.push_back(i);
+
+  v.clear();
+  EXPECT_EQ(0u, v.size());
+  EXPECT_TRUE(v.empty());
+
+  for (u32 i = 0; i < 5; ++i)
+    v.push_back(i * 2);
+  EXPECT_EQ(5u, v.size());
+  for (u32 i = 0; i < 5; ++i)
+    EXPECT_EQ(i * 2, v[i]);
+}
+
+TEST(SmallVector, Iteration)
+{
+  Common::SmallVector<u32, 4> v;
+  for (u32 i = 0; i < 10; ++i)
+    v.push_back(i);
+
+  u32 sum = 0;
+  u32 visited = 0;
+  for (u32 value : v)
+  {
+    sum += value;
+    ++visited;
+  }
+  EXPECT_EQ(10u, visited);
+  EXPECT_EQ(45u, sum);
+}
@@ -0,0 +1,147 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Core/ConfigManager.h"
+#include "Core/State.h"
+#include "UICommon/UICommon.h"
+
+// Exercises the host-pure on-disk logic of the rotating auto-save store
+// through the entry points State::SaveRotation uses, without a running core.
+class StateRotationTest : public testing::Test
+{
+protected:
+  // The store blocks at 64 KiB; states span a few blocks plus a partial tail.
+  static constexpr size_t BLOCK_SIZE = 64 * 1024;
+  static constexpr size_t STATE_SIZE = 3 * BLOCK_SIZE + 12345;
+
+  void SetUp() override
+  {
+    m_profile_path = File::CreateTempDir();
+    ASSERT_FALSE(m_profile_path.empty());
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    // The store hashes blocks through GetHash64, whose implementation is
+    // normally picked during video backend initialization.
+    SetHash64Function();
+    m_filename = m_profile_path + "/rotation.rot";
+  }
+
+  void TearDown() override
+  {
+    SConfig::Shutdown();
+    Config::Shutdown();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  static std::vector<u8> MakeState(u32 seed)
+  {
+    std::vector<u8> state(STATE_SIZE);
+    u32 x = seed * 2654435761u + 1;
+    for (u8& byte : state)
+    {
+      x = x * 1664525 + 1013904223;
+      byte = static_cast<u8>(x >> 24);
+    }
+    return state;
+  }
+
+  u64 StoreSize() const { return File::GetSize(m_filename); }
+
+  std::string m_profile_path;
+  std::string m_filename;
+};
+
+TEST_F(StateRotationTest, RoundTripAndDedup)
+{
+  const std::vector<u8> a = MakeState(1);
+  State::WriteRotationSnapshot(m_filename, 10, a);
+  const u64 size_a = StoreSize();
+
+  // b differs from a inside a single block.
+  std::vector<u8> b = a;
+  b[70000] ^= 0xff;
+  State::WriteRotationSnapshot(m_filename, 10, b);
+  const u64 size_b = StoreSize();
+
+  // A snapshot identical to the previous one.
+  State::WriteRotationSnapshot(m_filename, 10, b);
+  const u64 size_c = StoreSize();
+
+  u32 count = 0;
+  std::vector<u8> out;
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 2, &out, &count));
+  EXPECT_EQ(3u, count);
+  EXPECT_EQ(a, out);
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 1, &out, &count));
+  EXPECT_EQ(b, out);
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 0, &out, &count));
+  EXPECT_EQ(b, out);
+  EXPECT_FALSE(State::ReadRotationSnapshotFile(m_filename, 3, &out, &count));
+
+  // Dedup: the second snapshot only stored the one changed block, and the
+  // third stored no blocks at all, just a snapshot record.
+  EXPECT_LT(size_b - size_a, static_cast<u64>(2 * BLOCK_SIZE));
+  EXPECT_LT(size_c - size_b, static_cast<u64>(1024));
+}
+
+TEST_F(StateRotationTest, CompactionDropsRotatedOutSnapshots)
+{
+  // Fully distinct states with keep_count 2 build up dead blocks until the
+  // store rewrites itself.
+  for (u32 seed = 0; seed < 6; ++seed)
+    State::WriteRotationSnapshot(m_filename, 2, MakeState(seed));
+
+  u32 count = 0;
+  std::vector<u8> out;
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 0, &out, &count));
+  EXPECT_EQ(2u, count);
+  EXPECT_EQ(MakeState(5), out);
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 1, &out, &count));
+  EXPECT_EQ(MakeState(4), out);
+
+  // The rewritten store holds roughly the two kept states, not all six.
+  EXPECT_LT(StoreSize(), static_cast<u64>(3 * STATE_SIZE));
+}
+
+TEST_F(StateRotationTest, TruncatedStoreKeepsEarlierSnapshots)
+{
+  const std::vector<u8> a = MakeState(1);
+  State::WriteRotationSnapshot(m_filename, 10, a);
+  State::WriteRotationSnapshot(m_filename, 10, MakeState(2));
+
+  // Cut into the tail, as a crash mid-append would: the second snapshot's
+  // record is torn off, the first must survive.
+  {
+    File::IOFile f(m_filename, "r+b");
+    ASSERT_TRUE(f.IsOpen());
+    ASSERT_TRUE(f.Resize(f.GetSize() - 5));
+  }
+
+  u32 count = 0;
+  std::vector<u8> out;
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 0, &out, &count));
+  EXPECT_EQ(1u, count);
+  EXPECT_EQ(a, out);
+
+  // Writing after the truncation cuts the file back to the intact prefix and
+  // continues from there.
+  const std::vector<u8> c = MakeState(3);
+  State::WriteRotationSnapshot(m_filename, 10, c);
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 0, &out, &count));
+  EXPECT_EQ(2u, count);
+  EXPECT_EQ(c, out);
+  ASSERT_TRUE(State::ReadRotationSnapshotFile(m_filename, 1, &out, &count));
+  EXPECT_EQ(a, out);
+}